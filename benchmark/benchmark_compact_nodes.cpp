@@ -0,0 +1,217 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <new>
+#include "lockfree/atomic_stack.hpp"
+#include "lockfree/atomic_queue.hpp"
+#include "lockfree/atomic_linkedlist.hpp"
+#include "lockfree/atomic_skiplist.hpp"
+#include "lockfree/atomic_compact_stack.hpp"
+#include "lockfree/atomic_compact_queue.hpp"
+#include "lockfree/atomic_compact_linkedlist.hpp"
+#include "lockfree/atomic_compact_skiplist.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::high_resolution_clock;
+
+// Count live heap bytes and allocations so the footprint of each layout can be measured
+static std::atomic<size_t> g_heap_bytes{0};
+static std::atomic<size_t> g_heap_allocations{0};
+static std::atomic<size_t> g_total_allocations{0};
+
+static void* counted_alloc(size_t size, size_t alignment) {
+    // Store the size in a header so delete can subtract it
+    size_t header = alignment > sizeof(size_t) ? alignment : sizeof(size_t);
+    void* raw = std::aligned_alloc(header, ((size + header + header - 1) / header) * header);
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(raw) = size;
+    g_heap_bytes.fetch_add(size, std::memory_order_relaxed);
+    g_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_total_allocations.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<char*>(raw) + header;
+}
+
+static void counted_free(void* ptr, size_t alignment) {
+    if (!ptr) {
+        return;
+    }
+    size_t header = alignment > sizeof(size_t) ? alignment : sizeof(size_t);
+    void* raw = static_cast<char*>(ptr) - header;
+    g_heap_bytes.fetch_sub(*static_cast<size_t*>(raw), std::memory_order_relaxed);
+    g_heap_allocations.fetch_sub(1, std::memory_order_relaxed);
+    std::free(raw);
+}
+
+void* operator new(size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<size_t>(al)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return counted_alloc(size, alignof(std::max_align_t));
+    } catch (...) {
+        return nullptr;
+    }
+}
+void operator delete(void* ptr) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, size_t) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr, size_t) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, std::align_val_t al) noexcept { counted_free(ptr, static_cast<size_t>(al)); }
+void operator delete(void* ptr, size_t, std::align_val_t al) noexcept { counted_free(ptr, static_cast<size_t>(al)); }
+
+struct Measurement {
+    double bytes_per_element;       // Live heap bytes once filled
+    double churn_allocations;       // Heap allocations per operation in steady state
+    double mops;                    // Steady-state throughput with all threads
+};
+
+void print_header(const char* title) {
+    std::cout << "\n" << title << "\n";
+    std::cout << "  " << std::left << std::setw(28) << "Structure" << std::right
+              << std::setw(14) << "Bytes/elem" << std::setw(14) << "Allocs/op" << std::setw(12) << "Mops/s" << "\n";
+}
+
+void print_row(const char* name, const Measurement& m) {
+    std::cout << "  " << std::left << std::setw(28) << name << std::right
+              << std::setw(14) << m.bytes_per_element
+              << std::setw(14) << m.churn_allocations
+              << std::setw(12) << m.mops << "\n";
+}
+
+// Measure the footprint of `count` elements in a container sized for exactly that many, then
+// fill a container with spare capacity and run `ops_per_thread` churn operations on each thread
+template<typename Container, typename Make, typename Fill, typename Churn>
+Measurement measure(size_t count, size_t ops_per_thread, int num_threads, Make make, Fill fill, Churn churn) {
+    size_t bytes_before = g_heap_bytes.load();
+    Container* container = make(count);
+    for (size_t i = 0; i < count; ++i) {
+        fill(*container, i);
+    }
+    size_t bytes = g_heap_bytes.load() - bytes_before;
+    delete container;
+
+    // Erased nodes wait out a grace period before reuse, so leave room for them
+    container = make(4 * count);
+    for (size_t i = 0; i < count; ++i) {
+        fill(*container, i);
+    }
+
+    // Count every allocation made during the churn phase, including ones freed again
+    size_t allocations_before = g_total_allocations.load();
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937_64 gen(1000 + t);
+            for (size_t i = 0; i < ops_per_thread; ++i) {
+                churn(*container, gen());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    size_t allocations = g_total_allocations.load() - allocations_before;
+
+    delete container;
+    double total_ops = static_cast<double>(ops_per_thread) * num_threads;
+    return {static_cast<double>(bytes) / count, allocations / total_ops, total_ops / seconds / 1e6};
+}
+
+void benchmark_stacks(int num_threads) {
+    constexpr size_t count = 1000000;
+    constexpr size_t ops = 500000;
+    print_header("Stack<uint32_t>: fill 1M, then push+pop pairs");
+
+    print_row("AtomicStack", measure<AtomicStack<uint32_t>>(count, ops, num_threads,
+        [](size_t) { return new AtomicStack<uint32_t>(); },
+        [](auto& s, size_t i) { s.push(static_cast<uint32_t>(i)); },
+        [](auto& s, uint64_t r) { uint32_t v; s.push(static_cast<uint32_t>(r)); s.pop(v); }));
+    print_row("AtomicCompactStack", measure<AtomicCompactStack<uint32_t>>(count, ops, num_threads,
+        [](size_t capacity) { return new AtomicCompactStack<uint32_t>(capacity); },
+        [](auto& s, size_t i) { s.push(static_cast<uint32_t>(i)); },
+        [](auto& s, uint64_t r) { uint32_t v; s.push(static_cast<uint32_t>(r)); s.pop(v); }));
+}
+
+void benchmark_queues(int num_threads) {
+    constexpr size_t count = 1000000;
+    constexpr size_t ops = 500000;
+    print_header("Queue<uint32_t>: fill 1M, then enqueue+dequeue pairs");
+
+    print_row("AtomicQueue", measure<AtomicQueue<uint32_t>>(count, ops, num_threads,
+        [](size_t) { return new AtomicQueue<uint32_t>(); },
+        [](auto& q, size_t i) { q.enqueue(static_cast<uint32_t>(i)); },
+        [](auto& q, uint64_t r) { uint32_t v; q.enqueue(static_cast<uint32_t>(r)); q.dequeue(v); }));
+    print_row("AtomicCompactQueue", measure<AtomicCompactQueue<uint32_t>>(count, ops, num_threads,
+        [](size_t capacity) { return new AtomicCompactQueue<uint32_t>(capacity); },
+        [](auto& q, size_t i) { q.enqueue(static_cast<uint32_t>(i)); },
+        [](auto& q, uint64_t r) { uint32_t v; q.enqueue(static_cast<uint32_t>(r)); q.dequeue(v); }));
+}
+
+void benchmark_lists(int num_threads) {
+    constexpr size_t count = 2000;
+    constexpr size_t ops = 2000;
+    print_header("LinkedList<uint32_t>: fill 2K, then remove+insert of random keys");
+
+    auto churn = [](auto& l, uint64_t r) {
+        uint32_t key = static_cast<uint32_t>(r % count);
+        if (l.remove(key)) {
+            l.insert(key);
+        }
+    };
+    print_row("AtomicLinkedList", measure<AtomicLinkedList<uint32_t>>(count, ops, num_threads,
+        [](size_t) { return new AtomicLinkedList<uint32_t>(); },
+        [](auto& l, size_t i) { l.insert(static_cast<uint32_t>(i)); }, churn));
+    print_row("AtomicCompactLinkedList", measure<AtomicCompactLinkedList<uint32_t>>(count, ops, num_threads,
+        [](size_t capacity) { return new AtomicCompactLinkedList<uint32_t>(capacity); },
+        [](auto& l, size_t i) { l.insert(static_cast<uint32_t>(i)); }, churn));
+}
+
+void benchmark_skiplists(int num_threads) {
+    constexpr size_t count = 100000;
+    constexpr size_t ops = 20000;
+    print_header("SkipList<uint64_t, uint64_t>: fill 100K, then 80% find / 10% erase / 10% insert");
+
+    auto churn = [](auto& s, uint64_t r) {
+        uint64_t key = (r >> 8) % (2 * count);
+        uint64_t value;
+        switch (r % 10) {
+        case 0: s.erase(key); break;
+        case 1: s.insert(key, key); break;
+        default: s.find(key, value); break;
+        }
+    };
+    print_row("AtomicSkipList", measure<AtomicSkipList<uint64_t, uint64_t>>(count, ops, num_threads,
+        [](size_t) { return new AtomicSkipList<uint64_t, uint64_t>(); },
+        [](auto& s, size_t i) { s.insert(2 * i, i); }, churn));
+    print_row("AtomicCompactSkipList", measure<AtomicCompactSkipList<uint64_t, uint64_t>>(count, ops, num_threads,
+        [](size_t capacity) { return new AtomicCompactSkipList<uint64_t, uint64_t>(capacity); },
+        [](auto& s, size_t i) { s.insert(2 * i, i); }, churn));
+}
+
+int main() {
+    int num_threads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+
+    std::cout << "Compact (arena + 32-bit index) vs. pointer-based nodes\n";
+    std::cout << "=======================================================\n";
+    std::cout << "Threads: " << num_threads << "\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    benchmark_stacks(num_threads);
+    benchmark_queues(num_threads);
+    benchmark_lists(num_threads);
+    benchmark_skiplists(num_threads);
+
+    std::cout << "\nBytes/elem: requested heap bytes per element, with compact structures sized\n"
+                 "to exactly the element count. Allocs/op: heap allocations per churn operation.\n";
+    return 0;
+}
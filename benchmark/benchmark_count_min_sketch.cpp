@@ -0,0 +1,232 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <random>
+#include <memory>
+#include <algorithm>
+#include <unordered_map>
+#include <cmath>
+#include <cstdint>
+#include "lockfree/atomic_count_min_sketch.hpp"
+#include "lockfree/atomic_top_k.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Accuracy against memory and update throughput of AtomicCountMinSketch and
+ * AtomicTopK, against exact counting in a mutex-protected hash map.
+ */
+
+constexpr size_t STREAM_LENGTH = 2000000;
+constexpr size_t DISTINCT_KEYS = 1000000;
+constexpr size_t TOP = 100;
+
+// Zipf(1.0) over DISTINCT_KEYS keys, scrambled so frequency does not follow key order
+std::vector<uint64_t> make_stream() {
+    std::vector<double> weights(DISTINCT_KEYS);
+    for (size_t i = 0; i < DISTINCT_KEYS; ++i) {
+        weights[i] = 1.0 / static_cast<double>(i + 1);
+    }
+    std::discrete_distribution<uint64_t> dist(weights.begin(), weights.end());
+    std::mt19937_64 rng(11);
+    std::vector<uint64_t> stream(STREAM_LENGTH);
+    for (auto& key : stream) {
+        key = dist(rng) * 0x9e3779b97f4a7c15ULL;
+    }
+    return stream;
+}
+
+class MutexCounter {
+private:
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, uint64_t> counts_;
+
+public:
+    void add(uint64_t key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++counts_[key];
+    }
+};
+
+struct Truth {
+    std::unordered_map<uint64_t, uint64_t> counts;
+    std::vector<uint64_t> top;      // True top-TOP keys
+    std::vector<uint64_t> sample;   // Keys drawn uniformly from the distinct keys
+};
+
+Truth exact_counts(const std::vector<uint64_t>& stream) {
+    Truth truth;
+    for (uint64_t key : stream) {
+        ++truth.counts[key];
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> by_count(truth.counts.begin(), truth.counts.end());
+    std::partial_sort(by_count.begin(), by_count.begin() + TOP, by_count.end(),
+                      [](const auto& a, const auto& b) { return a.second > b.second; });
+    for (size_t i = 0; i < TOP; ++i) {
+        truth.top.push_back(by_count[i].first);
+    }
+    for (size_t i = 0; i < by_count.size(); i += 97) {
+        truth.sample.push_back(by_count[i].first);
+    }
+    return truth;
+}
+
+// Mean overestimate of the sampled keys, as a fraction of the stream length
+template<typename Sketch>
+double mean_error(const Sketch& sketch, const Truth& truth) {
+    double error = 0;
+    for (uint64_t key : truth.sample) {
+        error += static_cast<double>(sketch.estimate(key) - truth.counts.at(key));
+    }
+    return error / static_cast<double>(truth.sample.size()) / STREAM_LENGTH;
+}
+
+// Mean overestimate of the true top keys, relative to their own counts
+template<typename Sketch>
+double mean_top_error(const Sketch& sketch, const Truth& truth) {
+    double error = 0;
+    for (uint64_t key : truth.top) {
+        const double count = static_cast<double>(truth.counts.at(key));
+        error += (static_cast<double>(sketch.estimate(key)) - count) / count;
+    }
+    return error / static_cast<double>(truth.top.size());
+}
+
+template<size_t Width>
+void accuracy_row(const std::vector<uint64_t>& stream, const Truth& truth) {
+    auto plain = std::make_unique<AtomicCountMinSketch<uint64_t, Width, 4>>();
+    auto conservative = std::make_unique<AtomicCountMinSketch<uint64_t, Width, 4, true>>();
+    auto top_k = std::make_unique<AtomicTopK<uint64_t, TOP, Width, 4>>();
+    plain->add_batch(stream.data(), stream.size());
+    conservative->add_batch(stream.data(), stream.size());
+    top_k->add_batch(stream.data(), stream.size());
+
+    size_t found = 0;
+    for (const auto& entry : top_k->top()) {
+        found += std::find(truth.top.begin(), truth.top.end(), entry.first) != truth.top.end();
+    }
+
+    std::cout << std::setw(8) << Width << std::setw(10) << (plain->memory_bytes() / 1024)
+              << std::setw(12) << 100.0 * plain->epsilon()
+              << std::setw(12) << 100.0 * mean_error(*plain, truth)
+              << std::setw(12) << 100.0 * mean_error(*conservative, truth)
+              << std::setw(12) << 100.0 * mean_top_error(*plain, truth)
+              << std::setw(12) << 100.0 * mean_top_error(*conservative, truth)
+              << std::setw(10) << found << "%\n";
+}
+
+void benchmark_accuracy(const std::vector<uint64_t>& stream) {
+    const Truth truth = exact_counts(stream);
+    std::cout << "=== Accuracy vs Memory (Depth 4, " << STREAM_LENGTH / 1000000 << "M updates, "
+              << truth.counts.size() << " distinct keys) ===\n\n";
+    std::cout << "Mean overestimate: of sampled keys as % of the stream, of the true top " << TOP
+              << " as % of their counts;\nrecall: share of the true top " << TOP << " reported by AtomicTopK\n";
+    std::cout << std::setw(8) << "Width" << std::setw(10) << "KB" << std::setw(12) << "bound e/W"
+              << std::setw(12) << "plain" << std::setw(12) << "conserv." << std::setw(12) << "top plain"
+              << std::setw(12) << "top cons." << std::setw(11) << "recall" << "\n";
+
+    accuracy_row<512>(stream, truth);
+    accuracy_row<2048>(stream, truth);
+    accuracy_row<8192>(stream, truth);
+    accuracy_row<32768>(stream, truth);
+
+    // unordered_map node (key, count, next, cached hash) plus its bucket pointer
+    const size_t exact_kb = truth.counts.size() * (4 * sizeof(uint64_t) + sizeof(void*)) / 1024;
+    std::cout << "  exact hash map: about " << exact_kb << " KB, growing with the distinct keys\n\n";
+}
+
+// Runs body(begin, end) on num_threads threads over slices of the stream; returns M updates/s
+template<typename Body>
+double measure(int num_threads, size_t length, Body body) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    const size_t slice = length / num_threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            body(t * slice, (t + 1) * slice);
+        });
+    }
+    while (ready.load() < num_threads) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(slice * num_threads) / seconds / 1e6;
+}
+
+void benchmark_throughput(const std::vector<uint64_t>& stream) {
+    std::cout << "=== Update Throughput (M updates/s, 8192 x 4 sketch) ===\n\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(12) << "mutex map" << std::setw(12) << "add"
+              << std::setw(12) << "add_batch" << std::setw(12) << "conserv." << std::setw(12) << "top-K"
+              << std::setw(12) << "top-K batch" << "\n";
+
+    const uint64_t* keys = stream.data();
+    for (int threads : {1, 2, 4, 8, 16}) {
+        auto exact = std::make_unique<MutexCounter>();
+        auto plain = std::make_unique<AtomicCountMinSketch<uint64_t, 8192, 4>>();
+        auto batched = std::make_unique<AtomicCountMinSketch<uint64_t, 8192, 4>>();
+        auto conservative = std::make_unique<AtomicCountMinSketch<uint64_t, 8192, 4, true>>();
+        auto top_k = std::make_unique<AtomicTopK<uint64_t, TOP, 8192, 4>>();
+        auto top_k_batched = std::make_unique<AtomicTopK<uint64_t, TOP, 8192, 4>>();
+
+        double exact_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                exact->add(keys[i]);
+            }
+        });
+        double plain_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                plain->add(keys[i]);
+            }
+        });
+        double batch_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            batched->add_batch(keys + begin, end - begin);
+        });
+        double conservative_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                conservative->add(keys[i]);
+            }
+        });
+        double top_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                top_k->add(keys[i]);
+            }
+        });
+        double top_batch_rate = measure(threads, stream.size(), [&](size_t begin, size_t end) {
+            top_k_batched->add_batch(keys + begin, end - begin);
+        });
+
+        std::cout << std::setw(8) << threads << std::setw(12) << exact_rate << std::setw(12) << plain_rate
+                  << std::setw(12) << batch_rate << std::setw(12) << conservative_rate
+                  << std::setw(12) << top_rate << std::setw(12) << top_batch_rate << "\n";
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    std::cout << "Count-Min Sketch / Top-K Benchmark\n";
+    std::cout << "==================================\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "Hash kernel: " << kernels().name << "\n\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    const auto stream = make_stream();
+    benchmark_accuracy(stream);
+    std::cout << std::setprecision(2);
+    benchmark_throughput(stream);
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <random>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include "lockfree/cpu_dispatch.hpp"
+#include "lockfree/atomic_bloomfilter.hpp"
+#include "lockfree/atomic_trie.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::high_resolution_clock;
+
+/**
+ * Prints the CPU level detected at runtime and the kernel chosen for each
+ * SIMD-capable loop, then times every kernel at each level the host supports.
+ * Run with LOCKFREE_KERNELS=generic to see the containers on the baseline paths.
+ */
+
+static volatile uint64_t g_sink = 0;
+
+std::vector<const KernelTable*> supported_tables() {
+    std::vector<const KernelTable*> tables;
+    for (CpuLevel level : {CpuLevel::GENERIC, CpuLevel::POPCNT, CpuLevel::AVX2}) {
+        if (static_cast<int>(level) <= static_cast<int>(host_cpu_level())) {
+            tables.push_back(&kernels_for(level));
+        }
+    }
+    return tables;
+}
+
+// Name of the lowest level that provides the same function, i.e. the variant actually in use
+template<typename Fn>
+const char* kernel_name(Fn KernelTable::*kernel) {
+    for (const KernelTable* table : supported_tables()) {
+        if (table->*kernel == kernels().*kernel) {
+            return table->name;
+        }
+    }
+    return kernels().name;
+}
+
+void print_selection() {
+    std::cout << "Host CPU level : " << kernels_for(host_cpu_level()).name << "\n";
+    std::cout << "Selected level : " << kernels().name << "\n\n";
+    std::cout << "Selected kernels:\n";
+    std::cout << "  popcount     (Bloom bits_set/load_factor) : " << kernel_name(&KernelTable::popcount) << "\n";
+    std::cout << "  popcount_quiescent (Bloom deserialize)    : " << kernel_name(&KernelTable::popcount_quiescent) << "\n";
+    std::cout << "  find_nonzero (trie teardown, bulk grafts)  : " << kernel_name(&KernelTable::find_nonzero) << "\n";
+    std::cout << "  hash_batch   (64-bit batch hashing)       : " << kernel_name(&KernelTable::hash_batch) << "\n\n";
+}
+
+template<typename Body>
+double ns_per_call(int calls, Body body) {
+    double best = 1e300;
+    for (int run = 0; run < 3; ++run) {
+        auto start = Clock::now();
+        for (int i = 0; i < calls; ++i) {
+            body(i);
+        }
+        auto end = Clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / calls);
+    }
+    return best;
+}
+
+void print_row(const KernelTable& table, double ns, double generic_ns) {
+    std::cout << "  " << std::left << std::setw(8) << table.name << std::right
+              << std::setw(10) << ns << " ns/call" << std::setw(8) << (generic_ns / ns) << "x\n";
+}
+
+void benchmark_popcount() {
+    std::cout << "--- popcount_quiescent: 8192-bit filter (128 words) ---\n";
+    std::mt19937_64 rng(1);
+    std::vector<std::atomic<uint64_t>> words(128);
+    for (auto& w : words) {
+        w.store(rng());
+    }
+
+    double generic_ns = 0;
+    for (const KernelTable* table : supported_tables()) {
+        double ns = ns_per_call(200000, [&](int) {
+            g_sink = g_sink + table->popcount_quiescent(words.data(), words.size());
+        });
+        if (table->level == CpuLevel::GENERIC) {
+            generic_ns = ns;
+        }
+        print_row(*table, ns, generic_ns);
+    }
+    std::cout << "\n";
+}
+
+void benchmark_find_nonzero() {
+    std::cout << "--- find_nonzero: visit every child of a 256-slot node with 8 children ---\n";
+    std::mt19937_64 rng(3);
+    std::vector<std::atomic<uintptr_t>> slots(256);
+    for (int i = 0; i < 8; ++i) {
+        slots[rng() % slots.size()].store(rng() | 1);
+    }
+
+    double generic_ns = 0;
+    for (const KernelTable* table : supported_tables()) {
+        double ns = ns_per_call(500000, [&](int) {
+            for (size_t i = table->find_nonzero(slots.data(), 0, slots.size()); i < slots.size();
+                 i = table->find_nonzero(slots.data(), i + 1, slots.size())) {
+                g_sink = g_sink + i;
+            }
+        });
+        if (table->level == CpuLevel::GENERIC) {
+            generic_ns = ns;
+        }
+        print_row(*table, ns, generic_ns);
+    }
+    std::cout << "\n";
+}
+
+void benchmark_hash_batch() {
+    constexpr size_t batch = 1024;
+
+    std::cout << "--- hash_batch: 1024 keys ---\n";
+    std::mt19937_64 rng(4);
+    std::vector<uint64_t> keys(batch);
+    std::vector<uint64_t> out(batch);
+    for (auto& k : keys) {
+        k = rng();
+    }
+
+    double generic_ns = 0;
+    for (const KernelTable* table : supported_tables()) {
+        double ns = ns_per_call(50000, [&](int) {
+            table->hash_batch(keys.data(), out.data(), batch);
+            g_sink = g_sink + out[batch - 1];
+        });
+        if (table->level == CpuLevel::GENERIC) {
+            generic_ns = ns;
+        }
+        print_row(*table, ns, generic_ns);
+    }
+    std::cout << "\n";
+}
+
+void benchmark_containers() {
+    std::cout << "--- Containers on the selected kernels (" << kernels().name << ") ---\n";
+
+    auto filter = std::make_unique<AtomicBloomFilter<int, (1 << 20), 8>>();
+    for (int i = 0; i < 50000; ++i) {
+        filter->insert(i);
+    }
+    double bits_ns = ns_per_call(2000, [&](int) { g_sink = g_sink + filter->bits_set(); });
+
+    AtomicTrie<char> trie;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 5000; ++i) {
+        std::string word;
+        for (int c = 0; c < 6; ++c) {
+            word.push_back(static_cast<char>('a' + rng() % 26));
+        }
+        trie.insert(word);
+    }
+    double prefix_ns = ns_per_call(200, [&](int i) {
+        g_sink = g_sink + trie.get_all_with_prefix(std::string(1, static_cast<char>('a' + i % 26))).size();
+    });
+
+    std::cout << "  BloomFilter<1M bits, k=8>::bits_set : " << std::setw(10) << bits_ns << " ns\n";
+    std::cout << "  Trie (5000 words) prefix listing    : " << std::setw(10) << prefix_ns << " ns\n\n";
+}
+
+int main() {
+    std::cout << "Runtime CPU Dispatch Benchmark\n";
+    std::cout << "==============================\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    print_selection();
+    benchmark_popcount();
+    benchmark_find_nonzero();
+    benchmark_hash_batch();
+    benchmark_containers();
+
+    std::cout << "Speedups are against the generic kernel. LOCKFREE_KERNELS=generic|popcnt|avx2\n"
+                 "caps the selection; binaries are built without -march=native.\n";
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cmath>
+#include "lockfree/hash.hpp"
+#include "lockfree/atomic_hashmap.hpp"
+#include "lockfree/atomic_bloomfilter.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::high_resolution_clock;
+
+/**
+ * Distribution quality and throughput of lockfree::Hasher against std::hash
+ * (plus the old h1 ^ (h2 << 1) pair combination and XOR-seeded Bloom indices).
+ */
+
+static volatile size_t g_sink = 0;
+
+// The pair hash AtomicSet used to inject into namespace std
+struct XorShiftPairHash {
+    size_t operator()(const std::pair<int, int>& p) const {
+        return std::hash<int>{}(p.first) ^ (std::hash<int>{}(p.second) << 1);
+    }
+};
+
+struct BucketStats {
+    size_t max_load;
+    size_t empty_buckets;
+    double chi_squared_ratio;   // 1.0 for an ideal random hash
+};
+
+// Bucket the hashes the way AtomicHashMap does (hash % buckets)
+template<typename Key, typename Hash>
+BucketStats bucket_stats(const std::vector<Key>& keys, size_t buckets, Hash hash) {
+    std::vector<size_t> load(buckets, 0);
+    for (const auto& key : keys) {
+        ++load[hash(key) % buckets];
+    }
+    const double expected = static_cast<double>(keys.size()) / buckets;
+    double chi = 0;
+    for (size_t l : load) {
+        chi += (l - expected) * (l - expected) / expected;
+    }
+    return {*std::max_element(load.begin(), load.end()),
+            static_cast<size_t>(std::count(load.begin(), load.end(), 0)),
+            chi / (buckets - 1)};
+}
+
+void print_stats(const std::string& name, const BucketStats& s) {
+    std::cout << "  " << std::left << std::setw(30) << name << std::right
+              << std::setw(10) << s.max_load << std::setw(10) << s.empty_buckets
+              << std::setw(14) << s.chi_squared_ratio << "\n";
+}
+
+template<typename Key, typename StdHash>
+void compare_distribution(const std::string& family, const std::vector<Key>& keys, StdHash std_hash) {
+    constexpr size_t buckets = 4096;
+    std::cout << family << " (" << keys.size() << " keys, " << buckets << " buckets)\n";
+    print_stats("std::hash", bucket_stats(keys, buckets, std_hash));
+    print_stats("lockfree::Hasher", bucket_stats(keys, buckets, Hasher<Key>{}));
+}
+
+void benchmark_distribution() {
+    std::cout << "=== Distribution Quality ===\n\n";
+    std::cout << "  " << std::left << std::setw(30) << "hash" << std::right
+              << std::setw(10) << "max load" << std::setw(10) << "empty" << std::setw(14) << "chi2/dof" << "\n";
+
+    std::vector<uint64_t> sequential, strided, addresses;
+    for (uint64_t i = 0; i < 16384; ++i) {
+        sequential.push_back(i);
+        strided.push_back(i << 12);      // Page-aligned ids
+        addresses.push_back(0x7f0000000000ULL + i * 48);
+    }
+    compare_distribution("Sequential integers", sequential, std::hash<uint64_t>{});
+    compare_distribution("Integers 4096 apart", strided, std::hash<uint64_t>{});
+    compare_distribution("48-byte-spaced addresses", addresses, std::hash<uint64_t>{});
+
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < 128; ++i) {
+        for (int j = 0; j < 128; ++j) {
+            pairs.push_back({i, j});
+        }
+    }
+    compare_distribution("Pairs (i, j), i, j < 128", pairs, XorShiftPairHash{});
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 16384; ++i) {
+        strings.push_back("user:" + std::to_string(i));
+    }
+    compare_distribution("Strings \"user:N\"", strings, std::hash<std::string>{});
+    std::cout << "\n";
+}
+
+template<typename Body>
+double ns_per_key(size_t keys, Body body) {
+    double best = 1e300;
+    for (int run = 0; run < 5; ++run) {
+        auto start = Clock::now();
+        body();
+        auto end = Clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / keys);
+    }
+    return best;
+}
+
+void benchmark_throughput() {
+    std::cout << "=== Throughput (ns per key, best of 5) ===\n\n";
+
+    constexpr size_t count = 1 << 16;
+    std::mt19937_64 rng(1);
+    std::vector<uint64_t> ints(count);
+    for (auto& k : ints) {
+        k = rng();
+    }
+    std::vector<size_t> out(count);
+
+    double std_ns = ns_per_key(count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::hash<uint64_t>{}(ints[i]);
+        }
+        g_sink = g_sink + out[count - 1];
+    });
+    double scalar_ns = ns_per_key(count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Hasher<uint64_t>{}(ints[i]);
+        }
+        g_sink = g_sink + out[count - 1];
+    });
+    double batch_ns = ns_per_key(count, [&] {
+        hash_batch(std::span<const uint64_t>(ints), std::span<size_t>(out));
+        g_sink = g_sink + out[count - 1];
+    });
+
+    std::cout << "uint64_t keys\n";
+    std::cout << "  std::hash (identity)          : " << std::setw(8) << std_ns << "\n";
+    std::cout << "  Hasher, one key at a time     : " << std::setw(8) << scalar_ns << "\n";
+    std::cout << "  hash_batch, " << std::left << std::setw(18) << (std::string(kernels().name) + " kernel") << std::right
+              << ": " << std::setw(8) << batch_ns
+              << "  (" << (scalar_ns / batch_ns) << "x scalar)\n\n";
+
+    std::cout << "Strings" << std::string(24, ' ') << "std::hash    Hasher   speedup\n";
+    for (size_t len : {8u, 16u, 32u, 64u, 256u}) {
+        constexpr size_t num_strings = 4096;
+        std::vector<std::string> strings(num_strings);
+        for (auto& s : strings) {
+            s.resize(len);
+            for (auto& c : s) {
+                c = static_cast<char>('a' + rng() % 26);
+            }
+        }
+        double std_str = ns_per_key(num_strings, [&] {
+            size_t acc = 0;
+            for (const auto& s : strings) {
+                acc += std::hash<std::string>{}(s);
+            }
+            g_sink = g_sink + acc;
+        });
+        double ours_str = ns_per_key(num_strings, [&] {
+            size_t acc = 0;
+            for (const auto& s : strings) {
+                acc += Hasher<std::string>{}(s);
+            }
+            g_sink = g_sink + acc;
+        });
+        std::cout << "  " << std::setw(4) << len << "-byte" << std::string(20, ' ')
+                  << std::setw(9) << std_str << std::setw(10) << ours_str
+                  << std::setw(9) << (std_str / ours_str) << "x\n";
+    }
+    std::cout << "\n";
+}
+
+template<typename Hash>
+double map_lookup_ns(const std::vector<uint64_t>& keys) {
+    auto map = std::make_unique<AtomicHashMap<uint64_t, uint64_t, Hash>>(keys.size());
+    for (uint64_t k : keys) {
+        map->insert(k, k);
+    }
+    std::vector<uint64_t> values(keys.size());
+    std::unique_ptr<bool[]> found(new bool[keys.size()]);
+    return ns_per_key(keys.size(), [&] {
+        g_sink = g_sink + map->find_batch(keys.data(), keys.size(), values.data(), found.get());
+    });
+}
+
+void benchmark_containers() {
+    std::cout << "=== Containers ===\n\n";
+
+    // Ids that share their low 12 bits land in two of the 8192 buckets under std::hash
+    std::vector<uint64_t> keys;
+    for (uint64_t i = 0; i < 8192; ++i) {
+        keys.push_back(i << 12);
+    }
+    double std_ns = map_lookup_ns<std::hash<uint64_t>>(keys);
+    double ours_ns = map_lookup_ns<Hasher<uint64_t>>(keys);
+    std::cout << "AtomicHashMap find_batch, 8192 keys 4096 apart, 8192 buckets\n";
+    std::cout << "  std::hash : " << std::setw(10) << std_ns << " ns/key\n";
+    std::cout << "  Hasher    : " << std::setw(10) << ours_ns << " ns/key  (" << (std_ns / ours_ns) << "x)\n\n";
+
+    // Bloom filter: k indices from one std::hash XOR fixed seeds (the old scheme) vs double hashing
+    constexpr size_t bits = 1 << 16;
+    constexpr size_t k = 4;
+    constexpr uint64_t seeds[k] = {0x9e3779b9, 0x85ebca6b, 0xc2b2ae35, 0x27d4eb2f};
+    std::vector<uint64_t> old_bits(bits / 64, 0);
+    auto filter = std::make_unique<AtomicBloomFilter<uint64_t, bits, k>>();
+    for (uint64_t i = 0; i < 4000; ++i) {
+        const uint64_t key = i << 16;
+        for (uint64_t seed : seeds) {
+            const size_t bit = (std::hash<uint64_t>{}(key) ^ seed) & (bits - 1);
+            old_bits[bit / 64] |= uint64_t{1} << (bit % 64);
+        }
+        filter->insert(key);
+    }
+    size_t old_fp = 0, new_fp = 0;
+    constexpr size_t probes = 100000;
+    for (uint64_t i = 0; i < probes; ++i) {
+        const uint64_t key = (i + 4000) << 16;   // Never inserted
+        bool all = true;
+        for (uint64_t seed : seeds) {
+            const size_t bit = (std::hash<uint64_t>{}(key) ^ seed) & (bits - 1);
+            all = all && (old_bits[bit / 64] >> (bit % 64) & 1);
+        }
+        old_fp += all;
+        new_fp += filter->contains(key);
+    }
+    const double theory = std::pow(1.0 - std::exp(-static_cast<double>(k) * 4000 / bits), k);
+    std::cout << "Bloom filter, 64K bits, k = 4, 4000 keys 65536 apart (theory: " << 100.0 * theory << "%)\n";
+    std::cout << "  std::hash ^ seeds : " << std::setw(8) << 100.0 * old_fp / probes << "% false positives\n";
+    std::cout << "  Hasher, h1 + i*h2 : " << std::setw(8) << 100.0 * new_fp / probes << "% false positives\n\n";
+}
+
+int main() {
+    std::cout << "Hash Library Benchmark\n";
+    std::cout << "======================\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    benchmark_distribution();
+    benchmark_throughput();
+    benchmark_containers();
+
+    std::cout << "chi2/dof is the chi-squared statistic of the bucket loads over its degrees of\n"
+                 "freedom: about 1.0 for a random hash, far above 1.0 for clustered buckets.\n";
+    return 0;
+}
@@ -7,8 +7,14 @@
 #include <unordered_map>
 #include <atomic>
 #include <random>
+#include <type_traits>
 #include <algorithm>
+#include <filesystem>
+#include <cstdio>
+#include <memory>
+#include "lockfree/atomic_cuckoo_hashmap.hpp"
 #include "lockfree/atomic_hashmap.hpp"
+#include "lockfree/atomic_rcu_hashmap.hpp"
 
 using namespace lockfree;
 
@@ -376,6 +382,381 @@ void benchmark_string_keys() {
     string_benchmark(mutex_map, "Mutex HashMap");
 }
 
+// Counts key comparisons; with long keys each one reads a cold heap buffer
+struct CountingStringEqual {
+    static inline size_t calls = 0;
+    bool operator()(const std::string& a, const std::string& b) const {
+        ++calls;
+        return a == b;
+    }
+};
+
+void benchmark_long_string_keys() {
+    std::cout << "=== Long String Keys (cached hash) ===\n\n";
+    
+    using Clock = std::chrono::high_resolution_clock;
+    constexpr size_t num_keys = 200000;
+    constexpr size_t bucket_count = num_keys / 8;   // Chains of ~8 nodes
+    constexpr int num_lookups = 1000000;
+    
+    // 96-byte keys with a long shared prefix: equal lengths, so std::string's
+    // operator== has to memcmp into every key it is handed
+    auto make_key = [](size_t i) {
+        std::string key = "tenant/0042/region/eu-west/bucket/archive/objects/";
+        key += std::to_string(1000000000 + i);
+        key.resize(96, '#');
+        return key;
+    };
+    std::vector<std::string> present;
+    std::vector<std::string> absent;
+    for (size_t i = 0; i < num_keys; ++i) {
+        present.push_back(make_key(i));
+        absent.push_back(make_key(num_keys + i));
+    }
+    
+    // Lookup keys are separate copies so they do not share buffers with the nodes
+    std::mt19937 gen(7);
+    std::vector<std::string> probes;
+    for (int i = 0; i < num_lookups; ++i) {
+        const auto& source = (i & 1) ? absent : present;
+        probes.push_back(source[gen() % num_keys]);
+    }
+    
+    AtomicHashMap<std::string, int> map(bucket_count);
+    AtomicHashMap<std::string, int, std::hash<std::string>, CountingStringEqual> counted(bucket_count);
+    for (size_t i = 0; i < num_keys; ++i) {
+        map.insert(present[i], static_cast<int>(i));
+        counted.insert(present[i], static_cast<int>(i));
+    }
+    
+    auto start = Clock::now();
+    int hits = 0;
+    for (const auto& key : probes) {
+        int value;
+        hits += map.find(key, value) ? 1 : 0;
+    }
+    double ns_per_lookup = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / num_lookups;
+    
+    // Without the cached hash every node on the chain would be a key comparison
+    CountingStringEqual::calls = 0;
+    for (const auto& key : probes) {
+        counted.contains(key);
+    }
+    double compares = static_cast<double>(CountingStringEqual::calls) / num_lookups;
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Keys: " << num_keys << " x 96 bytes, load factor: " << map.load_factor() << "\n";
+    std::cout << "  Lookups: " << num_lookups << " (" << hits << " hits)\n";
+    std::cout << "  Time per lookup:             " << ns_per_lookup << " ns\n";
+    std::cout << "  Nodes on chain per lookup:   " << map.load_factor() << " (key reads without hash check)\n";
+    std::cout << "  Key comparisons per lookup:  " << compares << " (key reads with hash check)\n\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+void benchmark_snapshot_warm_start() {
+    std::cout << "=== Snapshot Warm Start (restart-to-ready) ===\n\n";
+    
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms_since = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+    
+    constexpr uint64_t num_entries = 1000000;
+    constexpr size_t bucket_count = 1 << 20;
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_bench.snap").string();
+    
+    // Refill from the source of truth: what a restart costs without a snapshot
+    auto start = Clock::now();
+    AtomicHashMap<uint64_t, uint64_t> source(bucket_count);
+    for (uint64_t i = 0; i < num_entries; ++i) {
+        source.insert(i * 2654435761ULL, i);
+    }
+    double refill_ms = ms_since(start);
+    
+    start = Clock::now();
+    bool saved = source.save_snapshot(path);
+    double save_ms = ms_since(start);
+    
+    start = Clock::now();
+    AtomicHashMap<uint64_t, uint64_t> eager(bucket_count);
+    bool eager_loaded = eager.load_snapshot(path, SnapshotMode::EAGER);
+    double eager_ms = ms_since(start);
+    
+    start = Clock::now();
+    AtomicHashMap<uint64_t, uint64_t> lazy(bucket_count);
+    bool lazy_loaded = lazy.load_snapshot(path, SnapshotMode::LAZY);
+    uint64_t value = 0;
+    bool first_hit = lazy.find(12345 * 2654435761ULL, value);
+    double lazy_ready_ms = ms_since(start);
+    
+    // Lookups while the whole map is still served from the mapping
+    start = Clock::now();
+    uint64_t hits = 0;
+    for (uint64_t i = 0; i < num_entries; i += 7) {
+        hits += lazy.find(i * 2654435761ULL, value) ? 1 : 0;
+    }
+    double lazy_lookup_ms = ms_since(start);
+    
+    start = Clock::now();
+    lazy.promote_snapshot();
+    double promote_ms = ms_since(start);
+    
+    std::cout << "  Entries: " << num_entries << ", buckets: " << bucket_count
+              << ", snapshot size: " << (std::filesystem::file_size(path) >> 20) << " MiB\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  Refill by insert:        " << refill_ms << " ms\n";
+    std::cout << "  save_snapshot:           " << save_ms << " ms" << (saved ? "" : " (FAILED)") << "\n";
+    std::cout << "  Eager load (ready):      " << eager_ms << " ms" << (eager_loaded ? "" : " (FAILED)") << "\n";
+    std::cout << "  Lazy load + first find:  " << lazy_ready_ms << " ms"
+              << (lazy_loaded && first_hit ? "" : " (FAILED)") << "\n";
+    std::cout << "  Lazy lookups (" << hits << " hits): " << lazy_lookup_ms << " ms\n";
+    std::cout << "  Background promotion:    " << promote_ms << " ms\n\n";
+    std::cout.unsetf(std::ios::fixed);
+    
+    std::remove(path.c_str());
+}
+
+void benchmark_batch_lookup_sweep() {
+    std::cout << "=== Batched Lookups: find() loop vs find_batch() ===\n\n";
+    
+    using Clock = std::chrono::high_resolution_clock;
+    constexpr size_t num_keys = 1 << 22;        // Nodes and buckets well beyond L2
+    constexpr size_t num_lookups = 1 << 21;
+    
+    AtomicHashMap<uint64_t, uint64_t> map(num_keys);
+    for (uint64_t i = 0; i < num_keys; ++i) {
+        map.insert(i * 0x9E3779B97F4A7C15ULL, i);
+    }
+    
+    // Random fan-out requests: ~90% of the keys are present
+    std::mt19937_64 gen(11);
+    std::vector<uint64_t> keys(num_lookups);
+    for (auto& key : keys) {
+        uint64_t index = gen() % num_keys;
+        key = (gen() % 10 == 0 ? index + num_keys : index) * 0x9E3779B97F4A7C15ULL;
+    }
+    std::vector<uint64_t> values(num_lookups);
+    std::unique_ptr<bool[]> found(new bool[num_lookups]);
+    
+    std::cout << std::setw(10) << "Batch" << std::setw(16) << "find() ns/key"
+              << std::setw(18) << "find_batch ns/key" << std::setw(12) << "Speedup" << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    
+    for (size_t batch : {1, 4, 16, 64, 256, 512}) {
+        const size_t rounds = num_lookups / batch;
+        
+        auto start = Clock::now();
+        size_t single_hits = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            for (size_t i = r * batch; i < (r + 1) * batch; ++i) {
+                found[i] = map.find(keys[i], values[i]);
+                single_hits += found[i] ? 1 : 0;
+            }
+        }
+        double single_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds * batch);
+        
+        start = Clock::now();
+        size_t batch_hits = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            batch_hits += map.find_batch(&keys[r * batch], batch, &values[r * batch], &found[r * batch]);
+        }
+        double batch_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds * batch);
+        
+        std::cout << std::setw(10) << batch << std::setw(16) << single_ns << std::setw(18) << batch_ns
+                  << std::setw(11) << single_ns / batch_ns << "x"
+                  << (single_hits == batch_hits ? "" : "  (MISMATCH)") << "\n";
+    }
+    std::cout << "\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+struct LoadFactorResult {
+    double throughput;      // Lookups per second across all threads
+    double p50;             // Lookup latency percentiles in nanoseconds
+    double p99;
+    double p999;
+};
+
+// Fill a map to the given number of keys, then measure lookups (half hits, half misses)
+template<typename MapType>
+LoadFactorResult measure_at_load(size_t slots, size_t present, const std::vector<uint64_t>& keys) {
+    MapType map(slots);
+    for (size_t i = 0; i < present; ++i) {
+        map.insert(keys[i], i);
+    }
+    // keys[present, 2 * present) are never inserted
+    auto pick = [&](uint64_t draw) {
+        return draw & 1 ? keys[draw % present] : keys[present + draw % present];
+    };
+
+    constexpr int samples = 200000;
+    std::vector<double> latencies;
+    latencies.reserve(samples);
+    std::mt19937_64 gen(11);
+    uint64_t value;
+    for (int i = 0; i < samples; ++i) {
+        uint64_t key = pick(gen());
+        auto start = std::chrono::high_resolution_clock::now();
+        map.find(key, value);
+        auto end = std::chrono::high_resolution_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    constexpr int num_threads = 4;
+    constexpr int lookups_per_thread = 500000;
+    std::atomic<bool> start_flag{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937_64 thread_gen(t + 1);
+            while (!start_flag.load(std::memory_order_acquire)) {
+                // Spin wait
+            }
+            uint64_t found = 0;
+            uint64_t result;
+            for (int i = 0; i < lookups_per_thread; ++i) {
+                found += map.find(pick(thread_gen()), result);
+            }
+            volatile uint64_t sink = found;
+            (void)sink;
+        });
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    start_flag.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+
+    return {num_threads * static_cast<double>(lookups_per_thread) / seconds,
+            latencies[samples / 2],
+            latencies[samples * 99 / 100],
+            latencies[samples * 999 / 1000]};
+}
+
+void benchmark_load_factor_sweep() {
+    std::cout << "=== Load Factor Sweep: Chained vs Cuckoo (50% hit lookups) ===\n\n";
+
+    // Same slot budget for both: AtomicHashMap gets `slots` chains, the cuckoo
+    // map `slots / 4` buckets of 4 entries
+    constexpr size_t slots = 1 << 19;
+    std::vector<uint64_t> keys(slots * 2);
+    std::mt19937_64 gen(42);
+    for (auto& key : keys) {
+        key = gen();
+    }
+
+    std::cout << std::setw(8) << "Load" << std::setw(16) << "Map"
+              << std::setw(14) << "Lookups/s"
+              << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << std::setw(12) << "p99.9 ns" << "\n";
+
+    auto print_row = [](double load, const char* name, const LoadFactorResult& r) {
+        std::cout << std::setw(8) << std::fixed << std::setprecision(2) << load
+                  << std::setw(16) << name
+                  << std::setw(14) << static_cast<long>(r.throughput)
+                  << std::setw(10) << static_cast<long>(r.p50)
+                  << std::setw(10) << static_cast<long>(r.p99)
+                  << std::setw(12) << static_cast<long>(r.p999) << "\n";
+    };
+
+    for (double load : {0.5, 0.7, 0.8, 0.9, 0.95}) {
+        size_t present = static_cast<size_t>(slots * load);
+        auto chained = measure_at_load<AtomicHashMap<uint64_t, uint64_t>>(slots, present, keys);
+        auto cuckoo = measure_at_load<AtomicCuckooHashMap<uint64_t, uint64_t>>(slots, present, keys);
+        print_row(load, "AtomicHashMap", chained);
+        print_row(load, "Cuckoo", cuckoo);
+    }
+    std::cout << "\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+// Replace a key's value the same way on both maps: erase, then insert
+template<typename MapType>
+void replace_key(MapType& map, int key, int value) {
+    map.erase(key);
+    map.insert(key, value);
+}
+
+// The RCU map publishes both changes as one version
+void replace_key(AtomicRcuHashMap<int, int>& map, int key, int value) {
+    AtomicRcuHashMap<int, int>::WriteBatch batch;
+    batch.erase(key);
+    batch.put(key, value);
+    map.apply(batch);
+}
+
+template<typename MapType>
+double read_mostly_throughput(int num_threads, int operations_per_thread) {
+    constexpr int key_count = 100000;
+    constexpr int writes_per_million = 1000;    // 0.1% writes
+    MapType map(key_count * 2);
+    for (int key = 0; key < key_count; ++key) {
+        map.insert(key, key);
+    }
+    if constexpr (std::is_same_v<MapType, AtomicRcuHashMap<int, int>>) {
+        map.offline();  // The loading thread does not read during the run
+    }
+
+    std::atomic<bool> start_flag{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t + 1);
+            std::vector<uint32_t> draws(4096);
+            for (auto& draw : draws) {
+                draw = gen();
+            }
+            while (!start_flag.load(std::memory_order_acquire)) {
+                // Spin wait
+            }
+            long found = 0;
+            for (int i = 0; i < operations_per_thread; ++i) {
+                uint32_t draw = draws[i & 4095] ^ static_cast<uint32_t>(i * 2654435761u);
+                int key = static_cast<int>(draw % key_count);
+                if (draw % 1000000 < writes_per_million) {
+                    replace_key(map, key, i);
+                } else {
+                    int value;
+                    found += map.find(key, value);
+                }
+            }
+            volatile long sink = found;
+            (void)sink;
+        });
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    start_flag.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    return num_threads * static_cast<double>(operations_per_thread) / seconds;
+}
+
+void benchmark_read_mostly_scaling() {
+    std::cout << "=== Read-Mostly Scaling (99.9% reads, 100K keys) ===\n\n";
+
+    constexpr int ops_per_thread = 200000;
+    std::cout << std::setw(10) << "Threads"
+              << std::setw(22) << "AtomicHashMap ops/s"
+              << std::setw(22) << "RCU HashMap ops/s"
+              << std::setw(10) << "Speedup" << "\n";
+
+    for (int threads : {1, 4, 16, 64}) {
+        double atomic_rate = read_mostly_throughput<AtomicHashMap<int, int>>(threads, ops_per_thread);
+        double rcu_rate = read_mostly_throughput<AtomicRcuHashMap<int, int>>(threads, ops_per_thread);
+        std::cout << std::setw(10) << threads
+                  << std::setw(22) << static_cast<long>(atomic_rate)
+                  << std::setw(22) << static_cast<long>(rcu_rate)
+                  << std::setw(9) << std::fixed << std::setprecision(2) << rcu_rate / atomic_rate << "x\n";
+    }
+    std::cout << "\n";
+}
+
 int main() {
     std::cout << "HashMap Performance Benchmark\n";
     std::cout << "============================\n\n";
@@ -384,6 +765,11 @@ int main() {
     benchmark_read_heavy_workload();
     benchmark_write_heavy_workload();
     benchmark_balanced_workload();
+    benchmark_long_string_keys();
+    benchmark_batch_lookup_sweep();
+    benchmark_load_factor_sweep();
+    benchmark_read_mostly_scaling();
+    benchmark_snapshot_warm_start();
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <random>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include "lockfree/concurrent_histogram.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Recording overhead of ConcurrentHistogram against a mutex-protected sample
+ * vector (the way latency results were aggregated before) at 1-64 threads.
+ */
+
+constexpr size_t RECORDS_PER_THREAD = 200000;
+
+// Latency-like values: mostly 100-2000, with a long tail
+std::vector<uint64_t> make_values() {
+    std::mt19937_64 rng(7);
+    std::lognormal_distribution<double> dist(6.0, 0.8);
+    std::vector<uint64_t> values(4096);
+    for (auto& v : values) {
+        v = static_cast<uint64_t>(dist(rng));
+    }
+    return values;
+}
+
+class MutexSamples {
+private:
+    std::mutex mutex_;
+    std::vector<uint64_t> samples_;
+
+public:
+    void record(uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_.push_back(value);
+    }
+
+    uint64_t percentile(double p) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::sort(samples_.begin(), samples_.end());
+        return samples_[std::min(samples_.size() - 1, static_cast<size_t>(p / 100.0 * samples_.size()))];
+    }
+};
+
+// Runs num_threads recorders; returns nanoseconds per record as seen by one thread
+template<typename Recorder>
+double measure(Recorder& recorder, int num_threads, const std::vector<uint64_t>& values) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < RECORDS_PER_THREAD; ++i) {
+                recorder.record(values[(i + t * 97) & (values.size() - 1)]);
+            }
+        });
+    }
+    while (ready.load() < num_threads) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    // Wall time times active cores over records: per-record cost on one thread
+    const double cores = std::min<double>(num_threads, std::max(1u, std::thread::hardware_concurrency()));
+    return ns * cores / (static_cast<double>(num_threads) * RECORDS_PER_THREAD);
+}
+
+void benchmark_recording() {
+    std::cout << "=== Recording Overhead (ns per record per thread) ===\n\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(16) << "mutex+vector"
+              << std::setw(16) << "1 stripe" << std::setw(16) << "64 stripes" << std::setw(12) << "speedup" << "\n";
+
+    const auto values = make_values();
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        auto samples = std::make_unique<MutexSamples>();
+        auto shared = std::make_unique<ConcurrentHistogram<>>(1);
+        auto striped = std::make_unique<ConcurrentHistogram<>>(64);
+
+        double mutex_ns = measure(*samples, threads, values);
+        double shared_ns = measure(*shared, threads, values);
+        double striped_ns = measure(*striped, threads, values);
+
+        std::cout << std::setw(8) << threads << std::setw(16) << mutex_ns << std::setw(16) << shared_ns
+                  << std::setw(16) << striped_ns << std::setw(11) << (mutex_ns / striped_ns) << "x\n";
+    }
+    std::cout << "\n";
+}
+
+void benchmark_queries() {
+    std::cout << "=== Percentile Queries (1M values) ===\n\n";
+
+    const auto values = make_values();
+    ConcurrentHistogram<> histogram;
+    MutexSamples samples;
+    for (size_t i = 0; i < 1000000; ++i) {
+        histogram.record(values[i & (values.size() - 1)]);
+        samples.record(values[i & (values.size() - 1)]);
+    }
+
+    auto start = Clock::now();
+    auto snap = histogram.snapshot();
+    uint64_t p50 = snap.value_at_percentile(50);
+    uint64_t p99 = snap.value_at_percentile(99);
+    uint64_t p999 = snap.value_at_percentile(99.9);
+    double histogram_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    start = Clock::now();
+    uint64_t exact_p50 = samples.percentile(50);
+    uint64_t exact_p99 = samples.percentile(99);
+    uint64_t exact_p999 = samples.percentile(99.9);
+    double sort_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    std::cout << "  snapshot + 3 percentiles : " << std::setw(10) << histogram_us << " us  (p50 " << p50
+              << ", p99 " << p99 << ", p99.9 " << p999 << ")\n";
+    std::cout << "  sort samples + 3 lookups : " << std::setw(10) << sort_us << " us  (p50 " << exact_p50
+              << ", p99 " << exact_p99 << ", p99.9 " << exact_p999 << ")\n\n";
+}
+
+int main() {
+    std::cout << "ConcurrentHistogram Benchmark\n";
+    std::cout << "=============================\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    benchmark_recording();
+    benchmark_queries();
+
+    std::cout << "Per-thread cost is wall time x min(threads, cores) / records. Histogram\n"
+                 "percentiles are within 1/128 (0.78%) of the exact sample percentiles.\n";
+    return 0;
+}
@@ -0,0 +1,258 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <random>
+#include <memory>
+#include <cstdint>
+#include "lockfree/atomic_interval_map.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Stabbing-query and mixed-workload throughput of AtomicIntervalMap, against a
+ * linear scan over a vector and a std::map keyed by the lower endpoint (the
+ * point-keyed ordered index one would otherwise reuse), both behind a
+ * shared_mutex.
+ */
+
+constexpr size_t INTERVALS = 100000;
+constexpr size_t QUERIES = 200000;
+
+struct Range {
+    uint32_t lo;
+    uint32_t hi;
+};
+
+// Log-uniform lengths from 1 to 2^20 over a 2^32 domain
+std::vector<Range> make_ranges(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<Range> ranges(count);
+    for (auto& range : ranges) {
+        const uint32_t length = rng() % (1u << (rng() % 21));
+        range.lo = rng() % (0xFFFFFFFFu - length);
+        range.hi = range.lo + length;
+    }
+    return ranges;
+}
+
+class VectorIndex {
+private:
+    mutable std::shared_mutex mutex_;
+    std::vector<Range> ranges_;
+
+public:
+    void insert(Range range) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ranges_.push_back(range);
+    }
+
+    bool erase(Range range) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto& candidate : ranges_) {
+            if (candidate.lo == range.lo && candidate.hi == range.hi) {
+                candidate = ranges_.back();
+                ranges_.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t stab(uint32_t point) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        size_t found = 0;
+        for (const auto& range : ranges_) {
+            found += range.lo <= point && point <= range.hi;
+        }
+        return found;
+    }
+};
+
+// Without a max-endpoint augmentation, a lo-keyed tree must scan every lo <= point
+class MapIndex {
+private:
+    mutable std::shared_mutex mutex_;
+    std::multimap<uint32_t, uint32_t> ranges_;
+
+public:
+    void insert(Range range) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ranges_.emplace(range.lo, range.hi);
+    }
+
+    bool erase(Range range) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto [first, last] = ranges_.equal_range(range.lo);
+        for (auto it = first; it != last; ++it) {
+            if (it->second == range.hi) {
+                ranges_.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t stab(uint32_t point) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        size_t found = 0;
+        for (auto it = ranges_.begin(); it != ranges_.end() && it->first <= point; ++it) {
+            found += it->second >= point;
+        }
+        return found;
+    }
+};
+
+class LockFreeIndex {
+private:
+    AtomicIntervalMap<uint32_t, uint32_t> map_;
+
+public:
+    void insert(Range range) { map_.insert(range.lo, range.hi, range.hi); }
+    bool erase(Range range) { return map_.erase(range.lo, range.hi); }
+    size_t stab(uint32_t point) const { return map_.count_overlapping(point, point); }
+};
+
+// Runs body(thread, begin, end) on num_threads threads over slices of total operations; returns K ops/s
+template<typename Body>
+double measure(int num_threads, size_t total, Body body) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    const size_t slice = total / num_threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            body(t, t * slice, (t + 1) * slice);
+        });
+    }
+    while (ready.load() < num_threads) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(slice * num_threads) / seconds / 1e3;
+}
+
+template<typename Index>
+std::unique_ptr<Index> build(const std::vector<Range>& ranges) {
+    auto index = std::make_unique<Index>();
+    for (const auto& range : ranges) {
+        index->insert(range);
+    }
+    return index;
+}
+
+// Stab queries; the baselines run fewer queries since each one is O(n)
+template<typename Index>
+double stab_rate(const Index& index, int threads, const std::vector<uint32_t>& points, size_t queries) {
+    std::atomic<size_t> sink{0};
+    double rate = measure(threads, queries, [&](int, size_t begin, size_t end) {
+        size_t found = 0;
+        for (size_t i = begin; i < end; ++i) {
+            found += index.stab(points[i % points.size()]);
+        }
+        sink.fetch_add(found);
+    });
+    return sink.load() ? rate : 0.0;
+}
+
+void benchmark_stabbing(const std::vector<Range>& ranges, const std::vector<uint32_t>& points) {
+    std::cout << "=== Stabbing Queries (K queries/s, " << INTERVALS / 1000 << "K intervals) ===\n\n";
+
+    auto vector_index = build<VectorIndex>(ranges);
+    auto map_index = build<MapIndex>(ranges);
+    auto lock_free = build<LockFreeIndex>(ranges);
+
+    size_t hits = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t expected = vector_index->stab(points[i]);
+        if (lock_free->stab(points[i]) != expected || map_index->stab(points[i]) != expected) {
+            std::cout << "Mismatch at query " << i << "\n";
+            return;
+        }
+        hits += expected;
+    }
+    std::cout << "Mean intervals per stab: " << static_cast<double>(hits) / 1000 << "\n";
+
+    std::cout << std::setw(8) << "Threads" << std::setw(14) << "vector scan" << std::setw(14) << "lo-keyed map"
+              << std::setw(14) << "interval map" << std::setw(10) << "speedup" << "\n";
+    for (int threads : {1, 2, 4, 8}) {
+        double vector_rate = stab_rate(*vector_index, threads, points, 2000);
+        double map_rate = stab_rate(*map_index, threads, points, 200);
+        double lock_free_rate = stab_rate(*lock_free, threads, points, QUERIES);
+        std::cout << std::setw(8) << threads << std::setw(14) << vector_rate << std::setw(14) << map_rate
+                  << std::setw(14) << lock_free_rate << std::setw(9) << lock_free_rate / map_rate << "x\n";
+    }
+    std::cout << "\n";
+}
+
+// 80% stabs; the rest insert a fresh interval or erase one inserted earlier by the same thread
+template<typename Index>
+double mixed_rate(int threads, const std::vector<Range>& ranges, const std::vector<uint32_t>& points,
+                  size_t operations) {
+    auto index = build<Index>(ranges);
+    const auto fresh = make_ranges(operations, 99);
+    std::atomic<size_t> sink{0};
+    double rate = measure(threads, operations, [&](int, size_t begin, size_t end) {
+        size_t inserted = begin;
+        size_t erased = begin;
+        size_t found = 0;
+        for (size_t i = begin; i < end; ++i) {
+            if (i % 10 == 0) {
+                index->insert(fresh[inserted++]);
+            } else if (i % 10 == 5 && erased < inserted) {
+                index->erase(fresh[erased++]);
+            } else {
+                found += index->stab(points[i % points.size()]);
+            }
+        }
+        sink.fetch_add(found);
+    });
+    return sink.load() ? rate : 0.0;
+}
+
+void benchmark_mixed(const std::vector<Range>& ranges, const std::vector<uint32_t>& points) {
+    std::cout << "=== Mixed Workload (K ops/s, 80% stab, 10% insert, 10% erase) ===\n\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(14) << "vector scan" << std::setw(14) << "lo-keyed map"
+              << std::setw(14) << "interval map" << "\n";
+    for (int threads : {1, 2, 4, 8}) {
+        double vector_rate = mixed_rate<VectorIndex>(threads, ranges, points, 2000);
+        double map_rate = mixed_rate<MapIndex>(threads, ranges, points, 200);
+        double lock_free_rate = mixed_rate<LockFreeIndex>(threads, ranges, points, 20000);
+        std::cout << std::setw(8) << threads << std::setw(14) << vector_rate << std::setw(14) << map_rate
+                  << std::setw(14) << lock_free_rate << "\n";
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    std::cout << "Interval Map Benchmark\n";
+    std::cout << "======================\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    const auto ranges = make_ranges(INTERVALS, 1);
+    std::vector<uint32_t> points(QUERIES);
+    std::mt19937 rng(2);
+    for (auto& point : points) {
+        point = rng();
+    }
+
+    benchmark_stabbing(ranges, points);
+    benchmark_mixed(ranges, points);
+    return 0;
+}
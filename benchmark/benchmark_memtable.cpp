@@ -0,0 +1,186 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <map>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <filesystem>
+#include "lockfree/atomic_memtable.hpp"
+
+using namespace lockfree;
+
+// Mutex-protected std::map write buffer for comparison (copied out under the lock)
+class MutexMemTable {
+private:
+    std::map<uint64_t, uint64_t> map_;
+    mutable std::mutex mutex_;
+    size_t bytes_ = 0;
+    size_t threshold_;
+    std::vector<std::map<uint64_t, uint64_t>> frozen_;
+
+public:
+    explicit MutexMemTable(size_t threshold) : threshold_(threshold) {}
+
+    bool put(uint64_t key, uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_[key] = value;
+        bytes_ += 64;
+        if (bytes_ >= threshold_) {
+            // Stall: writers wait while the full table is copied out
+            frozen_.push_back(map_);
+            map_.clear();
+            bytes_ = 0;
+        }
+        return true;
+    }
+
+    bool get(uint64_t key, uint64_t& value) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = map_.find(key);
+        if (it != map_.end()) {
+            value = it->second;
+            return true;
+        }
+        for (auto frozen = frozen_.rbegin(); frozen != frozen_.rend(); ++frozen) {
+            auto found = frozen->find(key);
+            if (found != frozen->end()) {
+                value = found->second;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+using MemTable = AtomicMemTable<uint64_t, uint64_t>;
+
+std::string bench_directory() {
+    auto path = std::filesystem::temp_directory_path() / "lockfree_memtable_benchmark";
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+template<typename Table>
+double run_writers(Table& table, int num_threads, int writes_per_thread) {
+    std::atomic<bool> start_flag{false};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937_64 gen(t + 1);
+            while (!start_flag.load(std::memory_order_acquire)) {
+                // Spin wait
+            }
+            for (int i = 0; i < writes_per_thread; ++i) {
+                uint64_t key = gen();
+                table.put(key, key);
+            }
+        });
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    start_flag.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    return num_threads * writes_per_thread / seconds;
+}
+
+void benchmark_write_throughput() {
+    std::cout << "=== Write Throughput (random keys, 4 MB freeze threshold) ===\n\n";
+
+    constexpr int writes_per_thread = 100000;
+    constexpr size_t threshold = 4 << 20;
+
+    std::cout << std::setw(10) << "Threads"
+              << std::setw(20) << "Lock-free ops/s"
+              << std::setw(20) << "Mutex ops/s"
+              << std::setw(10) << "Runs" << "\n";
+
+    for (int threads : {1, 2, 4, 8}) {
+        double lockfree_rate;
+        size_t runs;
+        {
+            MemTable table(bench_directory(), threshold);
+            lockfree_rate = run_writers(table, threads, writes_per_thread);
+            table.flush();
+            runs = table.run_count();
+        }
+
+        MutexMemTable mutex_table(threshold);
+        double mutex_rate = run_writers(mutex_table, threads, writes_per_thread);
+
+        std::cout << std::setw(10) << threads
+                  << std::setw(20) << static_cast<long>(lockfree_rate)
+                  << std::setw(20) << static_cast<long>(mutex_rate)
+                  << std::setw(10) << runs << "\n";
+    }
+    std::cout << "\n";
+}
+
+void benchmark_read_latency() {
+    std::cout << "=== Read Latency (memtable vs runs, Bloom-filtered misses) ===\n\n";
+
+    constexpr uint64_t num_keys = 400000;
+    constexpr int samples = 200000;
+    MemTable table(bench_directory(), 2 << 20);
+
+    std::vector<uint64_t> keys(num_keys);
+    std::mt19937_64 gen(42);
+    for (auto& key : keys) {
+        key = gen() | 1;    // Odd keys are present, even keys are guaranteed misses
+        table.put(key, key);
+    }
+
+    auto measure = [&](const std::string& label, auto&& pick) {
+        std::vector<double> latencies;
+        latencies.reserve(samples);
+        std::mt19937_64 rng(7);
+        size_t hits = 0;
+        for (int i = 0; i < samples; ++i) {
+            uint64_t key = pick(rng);
+            uint64_t value;
+            auto start = std::chrono::high_resolution_clock::now();
+            hits += table.get(key, value);
+            auto end = std::chrono::high_resolution_clock::now();
+            latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << std::setw(28) << std::left << label << std::right
+                  << "  p50: " << std::setw(8) << static_cast<long>(latencies[samples / 2]) << " ns"
+                  << "  p99: " << std::setw(8) << static_cast<long>(latencies[samples * 99 / 100]) << " ns"
+                  << "  hits: " << hits << "\n";
+    };
+
+    auto present = [&](std::mt19937_64& rng) { return keys[rng() % num_keys]; };
+    auto absent = [](std::mt19937_64& rng) { return rng() & ~1ULL; };
+
+    std::cout << "Before flush (" << table.frozen_count() + 1 << " tables, "
+              << table.run_count() << " runs):\n";
+    measure("  present keys", present);
+    measure("  absent keys", absent);
+
+    table.flush();
+    std::cout << "After flush (" << table.run_count() << " runs):\n";
+    measure("  present keys", present);
+    measure("  absent keys", absent);
+    std::cout << "\n";
+}
+
+int main() {
+    std::cout << "MemTable Performance Benchmarks\n";
+    std::cout << "===============================\n\n";
+
+    benchmark_write_throughput();
+    benchmark_read_latency();
+
+    std::filesystem::remove_all(std::filesystem::temp_directory_path() / "lockfree_memtable_benchmark");
+    return 0;
+}
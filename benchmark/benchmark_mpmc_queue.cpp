@@ -6,12 +6,41 @@
 #include <mutex>
 #include <queue>
 #include <atomic>
+#include <string>
+#include <cstdint>
+#include <type_traits>
 #include <limits>
 #include <condition_variable>
 #include "lockfree/atomic_mpmc_queue.hpp"
 
 using namespace lockfree;
 
+// 16-byte trivially copyable element for the inline-value comparison
+struct Pod16 {
+    uint64_t key;
+    uint64_t value;
+};
+
+// Same bytes as T, but the user-provided copy constructor makes it non-trivially
+// copyable, so the container takes its generic (pre-InlineValue) path
+template<typename T>
+struct Boxed {
+    T value{};
+    Boxed() = default;
+    Boxed(const T& v) : value(v) {}
+    Boxed(const Boxed& other) : value(other.value) {}
+    Boxed& operator=(const Boxed& other) = default;
+};
+
+template<typename T>
+T make_value(uint64_t i) {
+    if constexpr (std::is_same_v<T, Pod16>) {
+        return Pod16{i, ~i};
+    } else {
+        return static_cast<T>(i);
+    }
+}
+
 // Mutex-based queue for comparison
 template<typename T>
 class MutexQueue {
@@ -248,6 +277,48 @@ void benchmark_high_throughput() {
         "Mutex Queue", producers, consumers, ops_per_producer);
 }
 
+// Average ns per push/pop, filling and draining the container in batches
+template<typename QueueType, typename Element, typename T>
+double measure_inline_round_trips(int num_items) {
+    constexpr int batch = 512;
+    QueueType queue;
+    Element out{};
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int done = 0; done < num_items; done += batch) {
+        for (int i = 0; i < batch; ++i) {
+            queue.enqueue(Element(make_value<T>(done + i)));
+        }
+        for (int i = 0; i < batch; ++i) {
+            queue.dequeue(out);
+        }
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+    return static_cast<double>(duration.count()) / (num_items * 2.0);
+}
+
+template<typename T>
+void compare_inline_values(const std::string& name, int num_items) {
+    double generic_ns = measure_inline_round_trips<AtomicMPMCQueue<Boxed<T>, 1024>, Boxed<T>, T>(num_items);
+    double inline_ns = measure_inline_round_trips<AtomicMPMCQueue<T, 1024>, T, T>(num_items);
+    std::cout << "  " << std::left << std::setw(10) << name << std::right
+              << " generic: " << std::fixed << std::setprecision(1) << std::setw(6) << generic_ns << " ns/op"
+              << "  inline: " << std::setw(6) << inline_ns << " ns/op"
+              << "  speedup: " << std::setprecision(2) << (generic_ns / inline_ns) << "x\n";
+}
+
+void benchmark_inline_values() {
+    std::cout << "=== Trivially Copyable Fast Path (single thread, batches of 512) ===\n";
+    
+    constexpr int num_items = 1000000;
+    compare_inline_values<int>("int", num_items);
+    compare_inline_values<uint64_t>("uint64_t", num_items);
+    compare_inline_values<Pod16>("16B POD", num_items);
+    std::cout << "\n";
+}
+
 int main() {
     std::cout << "MPMC Queue Performance Benchmarks\n";
     std::cout << "==================================\n\n";
@@ -255,6 +326,7 @@ int main() {
     benchmark_scaling_performance();
     benchmark_mixed_contention();
     benchmark_high_throughput();
+    benchmark_inline_values();
     
     return 0;
 } 
\ No newline at end of file
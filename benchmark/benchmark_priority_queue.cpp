@@ -8,6 +8,10 @@
 #include <atomic>
 #include <random>
 #include <algorithm>
+#include <fstream>
+#ifdef __linux__
+#include <unistd.h>
+#endif
 #include "lockfree/atomic_priority_queue.hpp"
 
 using namespace lockfree;
@@ -162,6 +166,68 @@ void benchmark_scaling() {
     }
 }
 
+// Resident set size in MB, or -1 where /proc is unavailable
+double resident_mb() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    if (statm >> pages >> resident) {
+        return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+    }
+#endif
+    return -1.0;
+}
+
+// Push/pop pairs over a standing backlog; throughput and memory should stay flat per interval
+void benchmark_soak() {
+    constexpr int num_threads = 4;
+    constexpr int backlog = 10000;
+    constexpr int intervals = 10;
+    constexpr auto interval_length = std::chrono::milliseconds(500);
+    std::cout << "=== Push/Pop Soak (" << num_threads << " threads, backlog " << backlog << ", "
+              << interval_length.count() << " ms intervals) ===\n\n";
+    
+    AtomicPriorityQueue<int> pq;
+    for (int i = 0; i < backlog; ++i) {
+        pq.push(i);
+    }
+    
+    std::atomic<bool> stop{false};
+    std::atomic<long> operations{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t);
+            long local = 0;
+            int value = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                pq.push(static_cast<int>(gen() % 1000000));
+                pq.pop(value);
+                if (++local % 256 == 0) {
+                    operations.fetch_add(2 * 256, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    
+    std::cout << std::setw(10) << "Interval" << std::setw(14) << "M ops/s" << std::setw(12) << "RSS MB" << "\n";
+    long previous = 0;
+    for (int i = 1; i <= intervals; ++i) {
+        std::this_thread::sleep_for(interval_length);
+        long total = operations.load(std::memory_order_relaxed);
+        double rate = static_cast<double>(total - previous) / std::chrono::duration<double>(interval_length).count() / 1e6;
+        previous = total;
+        std::cout << std::setw(10) << i << std::fixed << std::setprecision(2) << std::setw(14) << rate
+                  << std::setprecision(1) << std::setw(12) << resident_mb() << "\n";
+    }
+    stop.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::cout << "Final queue size: " << pq.size() << "\n\n";
+}
+
 int main() {
     std::cout << "Priority Queue Performance Benchmark\n";
     std::cout << "====================================\n\n";
@@ -170,6 +236,7 @@ int main() {
     benchmark_read_heavy_workload();
     benchmark_write_heavy_workload();
     benchmark_balanced_workload();
+    benchmark_soak();
     
     return 0;
 } 
\ No newline at end of file
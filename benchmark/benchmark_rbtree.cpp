@@ -317,6 +317,139 @@ void benchmark_string_keys() {
     string_benchmark(mutex_tree, "Mutex RBTree");
 }
 
+// Newest n keys: a forward scan keeping the last n (the old workaround) against walking back from the end
+void benchmark_tail_queries() {
+    constexpr int tree_size = 200000;
+    std::cout << "=== Tail-N Queries: newest N keys (us/query, " << tree_size / 1000 << "K keys, 1 thread) ===\n\n";
+    
+    // Shuffled, since the tree does not rebalance sorted inserts
+    AtomicRBTree<int, int> tree;
+    std::vector<int> keys(tree_size);
+    for (int i = 0; i < tree_size; ++i) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+    for (int key : keys) {
+        tree.insert(key, key);
+    }
+    
+    auto time_queries = [](int queries, auto&& body) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        for (int q = 0; q < queries; ++q) {
+            body();
+        }
+        auto end_time = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::micro>(end_time - start_time).count() / queries;
+    };
+    
+    std::cout << std::setw(8) << "N" << std::setw(16) << "forward scan" << std::setw(12) << "rbegin()"
+              << std::setw(18) << "reverse_range()" << "\n";
+    for (int n : {10, 100, 1000}) {
+        long long sink = 0;
+        std::vector<int> ring(n);
+        double forward_us = time_queries(5, [&]() {
+            size_t seen = 0;
+            for (auto it = tree.begin(); it != tree.end(); ++it) {
+                ring[seen++ % n] = (*it).first;
+            }
+            sink += ring[(seen - 1) % n];
+        });
+        double iterator_us = time_queries(1000, [&]() {
+            auto it = tree.rbegin();
+            for (int i = 0; i < n && it != tree.rend(); ++i, ++it) {
+                sink += (*it).first;
+            }
+        });
+        double reverse_us = time_queries(1000, [&]() {
+            int taken = 0;
+            tree.reverse_range(tree_size, 0, [&](const int& key, const int&) {
+                sink += key;
+                return ++taken < n;
+            });
+        });
+        std::cout << std::setw(8) << n << std::fixed << std::setprecision(1) << std::setw(16) << forward_us
+                  << std::setw(12) << iterator_us << std::setw(18) << reverse_us
+                  << (sink ? "" : " (no keys)") << "\n";
+    }
+    std::cout << "\n";
+}
+
+// Runs body(key, i) for operations / num_threads random keys below key_count on each thread; M ops/s
+template<typename Body>
+double update_rate(int num_threads, int operations, int key_count, Body body) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t + 1);
+            std::uniform_int_distribution<int> key_dist(0, key_count - 1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < operations / num_threads; ++i) {
+                body(key_dist(gen), i);
+            }
+        });
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    const int performed = operations / num_threads * num_threads;
+    return performed / std::chrono::duration<double>(end_time - start_time).count() / 1e6;
+}
+
+// Every operation rewrites the value of a key that is already present
+void benchmark_update_heavy() {
+    constexpr int key_count = 10000;
+    constexpr int operations = 200000;
+    std::cout << "=== Update-Heavy: overwrite existing keys (M ops/s, " << key_count / 1000 << "K keys) ===\n\n";
+    
+    // Shuffled, since the tree does not rebalance sorted inserts
+    std::vector<int> keys(key_count);
+    for (int i = 0; i < key_count; ++i) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    
+    std::cout << std::setw(10) << "Threads" << std::setw(16) << "erase+insert" << std::setw(20) << "insert_or_assign()"
+              << std::setw(12) << "compute()" << std::setw(14) << "mutex map" << "\n";
+    for (int num_threads : {1, 2, 4, 8}) {
+        AtomicRBTree<int, long> replaced;
+        AtomicRBTree<int, long> assigned;
+        AtomicRBTree<int, long> computed;
+        std::map<int, long> locked;
+        for (int key : keys) {
+            replaced.insert(key, 0);
+            assigned.insert(key, 0);
+            computed.insert(key, 0);
+            locked.emplace(key, 0);
+        }
+        std::mutex mutex;
+        
+        double replace_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            replaced.erase(key);
+            replaced.insert(key, i);
+        });
+        double assign_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            assigned.insert_or_assign(key, i);
+        });
+        double compute_rate = update_rate(num_threads, operations, key_count, [&](int key, int) {
+            computed.compute(key, [](long current) { return current + 1; });
+        });
+        double mutex_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked[key] = i;
+        });
+        std::cout << std::setw(10) << num_threads << std::fixed << std::setprecision(2) << std::setw(16) << replace_rate
+                  << std::setw(20) << assign_rate << std::setw(12) << compute_rate << std::setw(14) << mutex_rate
+                  << "\n";
+    }
+    std::cout << "(erase+insert leaves a marked node per update, so every later search for the key walks past it)\n\n";
+}
+
 int main() {
     std::cout << "RBTree Performance Benchmark\n";
     std::cout << "============================\n\n";
@@ -326,6 +459,8 @@ int main() {
     benchmark_write_heavy_workload();
     benchmark_balanced_workload();
     benchmark_string_keys();
+    benchmark_tail_queries();
+    benchmark_update_heavy();
     
     return 0;
 }
@@ -7,6 +7,10 @@
 #include <atomic>
 #include <random>
 #include <algorithm>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <map>
 #include "lockfree/atomic_skiplist.hpp"
 
 using namespace lockfree;
@@ -247,6 +251,416 @@ void benchmark_scaling() {
     }
 }
 
+// Random lowercase keys; every key starts with the given shared prefix
+std::vector<std::string> make_string_keys(size_t count, const std::string& shared, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::vector<std::string> keys(count);
+    for (auto& key : keys) {
+        key = shared;
+        for (int i = 0; i < 16; ++i) {
+            key.push_back(static_cast<char>(letter(gen)));
+        }
+    }
+    return keys;
+}
+
+template<typename SkipListType>
+double string_lookup_rate(const std::vector<std::string>& keys, const std::vector<std::string>& probes) {
+    SkipListType skiplist;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        skiplist.insert(keys[i], static_cast<int>(i));
+    }
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    size_t found = 0;
+    for (const auto& probe : probes) {
+        int value;
+        found += skiplist.find(probe, value);
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    return found ? static_cast<double>(probes.size()) / seconds / 1e6 : 0.0;
+}
+
+void benchmark_string_keys() {
+    std::cout << "=== String Keys: find() (M lookups/s, 200K keys, 1 thread) ===\n\n";
+    
+    // std::less<std::string_view> orders std::string keys identically but turns off the
+    // cached key prefix, so this isolates the prefix from the rest of the search
+    using Cached = AtomicSkipList<std::string, int>;
+    using Uncached = AtomicSkipList<std::string, int, std::less<std::string_view>>;
+    
+    std::cout << std::setw(34) << "Keys" << std::setw(14) << "prefix cache" << std::setw(14) << "full compare"
+              << std::setw(14) << "mutex" << "\n";
+    for (const std::string shared : {"", "tenant/", "tenant/region-eu/"}) {
+        const auto keys = make_string_keys(200000, shared, 1);
+        std::vector<std::string> probes;
+        std::mt19937 gen(2);
+        std::uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+        for (int i = 0; i < 500000; ++i) {
+            probes.push_back(keys[pick(gen)]);
+        }
+        
+        double cached = string_lookup_rate<Cached>(keys, probes);
+        double uncached = string_lookup_rate<Uncached>(keys, probes);
+        double mutex = string_lookup_rate<MutexSkipList<std::string, int>>(keys, probes);
+        std::cout << std::setw(34) << ("\"" + shared + "\" + 16 random") << std::fixed << std::setprecision(2)
+                  << std::setw(14) << cached << std::setw(14) << uncached << std::setw(14) << mutex << "\n";
+    }
+    std::cout << "(a shared prefix of 8+ bytes ties every cached prefix, falling back to the full compare)\n\n";
+}
+
+// Sorted batches of batch_size keys drawn from a window of batch_size * spread list keys
+void benchmark_sorted_batches() {
+    constexpr int list_size = 1000000;
+    constexpr int batch_size = 4096;
+    constexpr int batches = 64;
+    std::cout << "=== Sorted Batches (M keys/s, " << list_size / 1000 << "K keys, batches of " << batch_size
+              << ", 1 thread) ===\n\n";
+    
+    AtomicSkipList<int, int> skiplist;
+    std::vector<std::pair<int, int>> initial;
+    for (int i = 0; i < list_size; ++i) {
+        initial.emplace_back(i * 2, i);   // Even keys; odd probes miss
+    }
+    skiplist.insert_sorted_batch(initial.data(), initial.size());
+    
+    std::cout << std::setw(10) << "Spread" << std::setw(12) << "find()" << std::setw(14) << "find batch"
+              << std::setw(12) << "insert()" << std::setw(14) << "insert batch" << "\n";
+    std::mt19937 gen(3);
+    for (int spread : {1, 4, 16, 64, 244}) {
+        std::vector<std::vector<int>> key_batches(batches);
+        std::uniform_int_distribution<int> window_start(0, 2 * list_size - 2 * batch_size * spread);
+        std::uniform_int_distribution<int> offset(0, 2 * batch_size * spread - 1);
+        for (auto& keys : key_batches) {
+            const int start = window_start(gen);
+            for (int i = 0; i < batch_size; ++i) {
+                keys.push_back(start + offset(gen));
+            }
+            std::sort(keys.begin(), keys.end());
+        }
+        
+        auto time_batches = [&](auto&& body) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            for (const auto& keys : key_batches) {
+                body(keys);
+            }
+            auto end_time = std::chrono::high_resolution_clock::now();
+            double seconds = std::chrono::duration<double>(end_time - start_time).count();
+            return static_cast<double>(batches) * batch_size / seconds / 1e6;
+        };
+        
+        std::vector<int> values(batch_size);
+        std::unique_ptr<bool[]> found(new bool[batch_size]);
+        double scalar_find = time_batches([&](const std::vector<int>& keys) {
+            for (size_t i = 0; i < keys.size(); ++i) {
+                skiplist.find(keys[i], values[i]);
+            }
+        });
+        double batch_find = time_batches([&](const std::vector<int>& keys) {
+            skiplist.find_sorted_batch(keys.data(), keys.size(), values.data(), found.get());
+        });
+        
+        // Inserts go to fresh lists holding the same initial keys
+        AtomicSkipList<int, int> scalar_list;
+        AtomicSkipList<int, int> batch_list;
+        scalar_list.insert_sorted_batch(initial.data(), initial.size());
+        batch_list.insert_sorted_batch(initial.data(), initial.size());
+        std::vector<std::pair<int, int>> pairs(batch_size);
+        double scalar_insert = time_batches([&](const std::vector<int>& keys) {
+            for (int key : keys) {
+                scalar_list.insert(key | 1, key);
+            }
+        });
+        double batch_insert = time_batches([&](const std::vector<int>& keys) {
+            for (size_t i = 0; i < keys.size(); ++i) {
+                pairs[i] = {keys[i] | 1, keys[i]};
+            }
+            batch_list.insert_sorted_batch(pairs.data(), pairs.size());
+        });
+        
+        std::cout << std::setw(10) << spread << std::fixed << std::setprecision(2) << std::setw(12) << scalar_find
+                  << std::setw(14) << batch_find << std::setw(12) << scalar_insert << std::setw(14) << batch_insert
+                  << "\n";
+    }
+    std::cout << "(spread: list keys per batch key; 1 = dense run, 244 = one batch over the whole list)\n\n";
+}
+
+// Erase half the keys in random order, then look up every key; ns per operation against list size
+template<typename List>
+std::pair<double, double> delete_heavy_costs(int list_size) {
+    std::vector<int> keys(list_size);
+    for (int i = 0; i < list_size; ++i) {
+        keys[i] = i;
+    }
+    std::mt19937 gen(4);
+    std::shuffle(keys.begin(), keys.end(), gen);
+    
+    List list;
+    for (int key : keys) {
+        list.insert(key, key);
+    }
+    std::shuffle(keys.begin(), keys.end(), gen);
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    size_t erased = 0;
+    for (int i = 0; i < list_size / 2; ++i) {
+        erased += list.erase(keys[i]);
+    }
+    auto mid_time = std::chrono::high_resolution_clock::now();
+    size_t found = 0;
+    int value = 0;
+    for (int key : keys) {
+        found += list.find(key, value);
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    
+    if (erased != static_cast<size_t>(list_size / 2) || found != static_cast<size_t>(list_size - list_size / 2)) {
+        std::cout << "  (unexpected counts: " << erased << " erased, " << found << " found)\n";
+    }
+    double erase_ns = std::chrono::duration<double, std::nano>(mid_time - start_time).count() / (list_size / 2);
+    double find_ns = std::chrono::duration<double, std::nano>(end_time - mid_time).count() / list_size;
+    return {erase_ns, find_ns};
+}
+
+void benchmark_delete_heavy() {
+    std::cout << "=== Delete-Heavy: erase half, then find all (ns/op, 1 thread) ===\n\n";
+    std::cout << std::setw(10) << "Keys" << std::setw(12) << "erase()" << std::setw(14) << "find() after"
+              << std::setw(14) << "mutex erase" << std::setw(14) << "mutex find" << "\n";
+    for (int list_size : {10000, 100000, 1000000}) {
+        auto [erase_ns, find_ns] = delete_heavy_costs<AtomicSkipList<int, int>>(list_size);
+        auto [mutex_erase_ns, mutex_find_ns] = delete_heavy_costs<MutexSkipList<int, int>>(list_size);
+        std::cout << std::setw(10) << list_size << std::fixed << std::setprecision(0) << std::setw(12) << erase_ns
+                  << std::setw(14) << find_ns << std::setw(14) << mutex_erase_ns << std::setw(14) << mutex_find_ns
+                  << "\n";
+    }
+    std::cout << "(erase cost should grow with log n; erased towers are unlinked, so finds do not slow down)\n\n";
+}
+
+// Random inserts and erases over 2 * list_size keys from many threads, then single-threaded finds; M ops/s
+std::pair<double, double> write_scalability_rates(IndexMode mode, int num_threads, int list_size, int operations) {
+    AtomicSkipList<int, int> skiplist(mode);
+    std::vector<std::pair<int, int>> initial;
+    for (int i = 0; i < list_size; ++i) {
+        initial.emplace_back(i * 2, i);
+    }
+    skiplist.insert_sorted_batch(initial.data(), initial.size());
+    if (mode == IndexMode::BACKGROUND) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));   // Let the maintainer index the initial keys
+    }
+    
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t + 1);
+            std::uniform_int_distribution<int> key_dist(0, 2 * list_size - 1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < operations / num_threads; ++i) {
+                const int key = key_dist(gen);
+                if (i % 2 == 0) {
+                    skiplist.insert(key, i);
+                } else {
+                    skiplist.erase(key);
+                }
+            }
+        });
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto mid_time = std::chrono::high_resolution_clock::now();
+    
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> key_dist(0, 2 * list_size - 1);
+    int value = 0;
+    size_t found = 0;
+    for (int i = 0; i < operations; ++i) {
+        found += skiplist.find(key_dist(gen), value);
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    
+    const int performed = operations / num_threads * num_threads;
+    double write_rate = performed / std::chrono::duration<double>(mid_time - start_time).count() / 1e6;
+    double find_rate = operations / std::chrono::duration<double>(end_time - mid_time).count() / 1e6;
+    return {write_rate, found > 0 ? find_rate : 0.0};
+}
+
+void benchmark_write_scalability() {
+    constexpr int list_size = 100000;
+    constexpr int operations = 400000;
+    std::cout << "=== Write Scalability: 50% insert / 50% erase (M ops/s, " << list_size / 1000
+              << "K keys) ===\n\n";
+    std::cout << std::setw(10) << "Threads" << std::setw(12) << "eager" << std::setw(14) << "background"
+              << std::setw(14) << "eager find" << std::setw(16) << "background find" << "\n";
+    for (int num_threads : {1, 8, 32, 64}) {
+        auto [eager_rate, eager_find] = write_scalability_rates(IndexMode::EAGER, num_threads, list_size, operations);
+        auto [background_rate, background_find] =
+            write_scalability_rates(IndexMode::BACKGROUND, num_threads, list_size, operations);
+        std::cout << std::setw(10) << num_threads << std::fixed << std::setprecision(2) << std::setw(12) << eager_rate
+                  << std::setw(14) << background_rate << std::setw(14) << eager_find << std::setw(16)
+                  << background_find << "\n";
+    }
+    std::cout << "(background: writers touch level 0 only; find columns are 1-thread lookups right after the writes)\n\n";
+}
+
+// Newest n keys: a forward scan keeping the last n (the old workaround) against walking back from the end
+void benchmark_tail_queries() {
+    constexpr int list_size = 1000000;
+    std::cout << "=== Tail-N Queries: newest N keys (us/query, " << list_size / 1000 << "K keys, 1 thread) ===\n\n";
+    
+    AtomicSkipList<int, int> skiplist;
+    std::vector<std::pair<int, int>> events;
+    for (int i = 0; i < list_size; ++i) {
+        events.emplace_back(i, i);   // Keys are timestamps
+    }
+    skiplist.insert_sorted_batch(events.data(), events.size());
+    
+    auto time_queries = [](int queries, auto&& body) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        for (int q = 0; q < queries; ++q) {
+            body();
+        }
+        auto end_time = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::micro>(end_time - start_time).count() / queries;
+    };
+    
+    std::cout << std::setw(8) << "N" << std::setw(16) << "forward scan" << std::setw(12) << "rbegin()"
+              << std::setw(18) << "reverse_range()" << "\n";
+    for (int n : {10, 100, 1000}) {
+        long long sink = 0;
+        std::vector<int> ring(n);
+        double forward_us = time_queries(5, [&]() {
+            size_t seen = 0;
+            skiplist.range(0, list_size, [&](const int& key, const int&) {
+                ring[seen++ % n] = key;
+                return true;
+            });
+            sink += ring[(seen - 1) % n];
+        });
+        double iterator_us = time_queries(1000, [&]() {
+            auto it = skiplist.rbegin();
+            for (int i = 0; i < n && it != skiplist.rend(); ++i, ++it) {
+                sink += (*it).first;
+            }
+        });
+        double reverse_us = time_queries(1000, [&]() {
+            int taken = 0;
+            skiplist.reverse_range(list_size, 0, [&](const int& key, const int&) {
+                sink += key;
+                return ++taken < n;
+            });
+        });
+        std::cout << std::setw(8) << n << std::fixed << std::setprecision(1) << std::setw(16) << forward_us
+                  << std::setw(12) << iterator_us << std::setw(18) << reverse_us
+                  << (sink ? "" : " (no keys)") << "\n";
+    }
+    std::cout << "(rbegin() descends the index per step; reverse_range() once per run of about 16 keys)\n\n";
+    
+    // No index yet (IndexMode::MANUAL before maintain()): every pass walks level 0 from the head
+    AtomicSkipList<int, int> unindexed(IndexMode::MANUAL);
+    unindexed.insert_sorted_batch(events.data(), events.size());
+    std::cout << "Before the index is built (IndexMode::MANUAL, no maintain() yet):\n";
+    std::cout << std::setw(8) << "N" << std::setw(18) << "reverse_range()" << std::setw(18) << "after maintain()" << "\n";
+    std::vector<double> unindexed_us;
+    long long sink = 0;
+    auto tail_query = [&](int n) {
+        int taken = 0;
+        unindexed.reverse_range(list_size, 0, [&](const int& key, const int&) {
+            sink += key;
+            return ++taken < n;
+        });
+    };
+    for (int n : {10, 100, 1000}) {
+        unindexed_us.push_back(time_queries(5, [&]() { tail_query(n); }));
+    }
+    while (unindexed.maintain() > 0) {
+    }
+    size_t row = 0;
+    for (int n : {10, 100, 1000}) {
+        double indexed_us = time_queries(1000, [&]() { tail_query(n); });
+        std::cout << std::setw(8) << n << std::fixed << std::setprecision(1) << std::setw(18) << unindexed_us[row++]
+                  << std::setw(18) << indexed_us << (sink ? "" : " (no keys)") << "\n";
+    }
+    std::cout << "(without an index one pass walks every key, and a pass keeps at most max(64, 2N) nodes)\n\n";
+}
+
+// Runs body(key, i) for operations / num_threads random keys below key_count on each thread; M ops/s
+template<typename Body>
+double update_rate(int num_threads, int operations, int key_count, Body body) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t + 1);
+            std::uniform_int_distribution<int> key_dist(0, key_count - 1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < operations / num_threads; ++i) {
+                body(key_dist(gen), i);
+            }
+        });
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    const int performed = operations / num_threads * num_threads;
+    return performed / std::chrono::duration<double>(end_time - start_time).count() / 1e6;
+}
+
+// Every operation rewrites the value of a key that is already present
+void benchmark_update_heavy() {
+    constexpr int key_count = 10000;
+    constexpr int operations = 400000;
+    std::cout << "=== Update-Heavy: overwrite existing keys (M ops/s, " << key_count / 1000 << "K keys) ===\n\n";
+    
+    std::vector<std::pair<int, long>> initial;
+    for (int i = 0; i < key_count; ++i) {
+        initial.emplace_back(i, 0);
+    }
+    
+    std::cout << std::setw(10) << "Threads" << std::setw(16) << "erase+insert" << std::setw(20) << "insert_or_assign()"
+              << std::setw(12) << "compute()" << std::setw(14) << "mutex map" << "\n";
+    for (int num_threads : {1, 2, 4, 8}) {
+        AtomicSkipList<int, long> replaced;
+        AtomicSkipList<int, long> assigned;
+        AtomicSkipList<int, long> computed;
+        replaced.insert_sorted_batch(initial.data(), initial.size());
+        assigned.insert_sorted_batch(initial.data(), initial.size());
+        computed.insert_sorted_batch(initial.data(), initial.size());
+        std::map<int, long> locked(initial.begin(), initial.end());
+        std::mutex mutex;
+        
+        double replace_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            replaced.erase(key);
+            replaced.insert(key, i);
+        });
+        double assign_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            assigned.insert_or_assign(key, i);
+        });
+        double compute_rate = update_rate(num_threads, operations, key_count, [&](int key, int) {
+            computed.compute(key, [](long current) { return current + 1; });
+        });
+        double mutex_rate = update_rate(num_threads, operations, key_count, [&](int key, int i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked[key] = i;
+        });
+        std::cout << std::setw(10) << num_threads << std::fixed << std::setprecision(2) << std::setw(16) << replace_rate
+                  << std::setw(20) << assign_rate << std::setw(12) << compute_rate << std::setw(14) << mutex_rate
+                  << "\n";
+    }
+    std::cout << "(erase+insert searches twice, retires a node per update and leaves the key missing in between)\n\n";
+}
+
 int main() {
     std::cout << "SkipList Performance Benchmark\n";
     std::cout << "==============================\n\n";
@@ -255,6 +669,12 @@ int main() {
     benchmark_read_heavy_workload();
     benchmark_write_heavy_workload();
     benchmark_balanced_workload();
+    benchmark_string_keys();
+    benchmark_sorted_batches();
+    benchmark_delete_heavy();
+    benchmark_write_scalability();
+    benchmark_tail_queries();
+    benchmark_update_heavy();
     
     return 0;
 } 
\ No newline at end of file
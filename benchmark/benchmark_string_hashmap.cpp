@@ -0,0 +1,157 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <new>
+#include "lockfree/atomic_hashmap.hpp"
+#include "lockfree/atomic_set.hpp"
+#include "lockfree/atomic_string_hashmap.hpp"
+#include "lockfree/atomic_string_set.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::high_resolution_clock;
+
+// Count live heap bytes and allocations so the footprint of each layout can be measured
+static std::atomic<size_t> g_heap_bytes{0};
+static std::atomic<size_t> g_heap_allocations{0};
+
+static void* counted_alloc(size_t size, size_t alignment) {
+    // Store the size in a header so delete can subtract it
+    size_t header = alignment > sizeof(size_t) ? alignment : sizeof(size_t);
+    void* raw = std::aligned_alloc(header, ((size + header + header - 1) / header) * header);
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(raw) = size;
+    g_heap_bytes.fetch_add(size, std::memory_order_relaxed);
+    g_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<char*>(raw) + header;
+}
+
+static void counted_free(void* ptr, size_t alignment) {
+    if (!ptr) {
+        return;
+    }
+    size_t header = alignment > sizeof(size_t) ? alignment : sizeof(size_t);
+    void* raw = static_cast<char*>(ptr) - header;
+    g_heap_bytes.fetch_sub(*static_cast<size_t*>(raw), std::memory_order_relaxed);
+    g_heap_allocations.fetch_sub(1, std::memory_order_relaxed);
+    std::free(raw);
+}
+
+void* operator new(size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<size_t>(al)); }
+void operator delete(void* ptr) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, size_t) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr, size_t) noexcept { counted_free(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, std::align_val_t al) noexcept { counted_free(ptr, static_cast<size_t>(al)); }
+void operator delete(void* ptr, size_t, std::align_val_t al) noexcept { counted_free(ptr, static_cast<size_t>(al)); }
+
+// Random printable keys of a fixed length
+std::vector<std::string> make_keys(size_t count, size_t length, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<std::string> keys(count);
+    for (auto& key : keys) {
+        key.resize(length);
+        for (char& c : key) {
+            c = static_cast<char>('a' + gen() % 26);
+        }
+    }
+    return keys;
+}
+
+struct Measurement {
+    double bytes_per_entry;
+    double allocations_per_entry;
+    double lookup_ns;
+};
+
+// Populate a container, then time shuffled successful lookups over it
+template<typename Container, typename Insert, typename Lookup>
+Measurement measure(const std::vector<std::string>& keys, Insert insert, Lookup lookup) {
+    constexpr size_t num_lookups = 2000000;
+
+    size_t bytes_before = g_heap_bytes.load();
+    size_t allocations_before = g_heap_allocations.load();
+    auto* container = new Container(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        insert(*container, keys[i], i);
+    }
+    size_t bytes = g_heap_bytes.load() - bytes_before;
+    size_t allocations = g_heap_allocations.load() - allocations_before;
+
+    std::vector<uint32_t> order(num_lookups);
+    std::mt19937 gen(11);
+    for (auto& index : order) {
+        index = static_cast<uint32_t>(gen() % keys.size());
+    }
+
+    uint64_t sum = 0;
+    auto start = Clock::now();
+    for (uint32_t index : order) {
+        sum += lookup(*container, keys[index]);
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / num_lookups;
+    if (sum == 42) {
+        std::cout << "";    // Keep the lookups observable
+    }
+
+    delete container;
+    return {static_cast<double>(bytes) / keys.size(), static_cast<double>(allocations) / keys.size(), ns};
+}
+
+void print_row(const char* name, const Measurement& m) {
+    std::cout << "  " << std::left << std::setw(34) << name << std::right
+              << std::setw(12) << m.bytes_per_entry
+              << std::setw(12) << m.allocations_per_entry
+              << std::setw(12) << m.lookup_ns << "\n";
+}
+
+void benchmark_key_lengths() {
+    constexpr size_t num_keys = 500000;
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (size_t length : {16, 32, 64, 128}) {
+        const auto keys = make_keys(num_keys, length, static_cast<unsigned>(length));
+
+        std::cout << "=== " << num_keys << " keys of " << length << " bytes ===\n";
+        std::cout << "  " << std::left << std::setw(34) << "Container" << std::right
+                  << std::setw(12) << "bytes/key" << std::setw(12) << "allocs/key"
+                  << std::setw(12) << "find ns" << "\n";
+
+        print_row("AtomicHashMap<std::string, u64>", measure<AtomicHashMap<std::string, uint64_t>>(keys,
+            [](auto& map, const std::string& key, size_t i) { map.insert(key, i); },
+            [](auto& map, const std::string& key) { uint64_t v = 0; map.find(key, v); return v; }));
+
+        print_row("AtomicStringHashMap<u64>", measure<AtomicStringHashMap<uint64_t>>(keys,
+            [](auto& map, const std::string& key, size_t i) { map.insert(key, i); },
+            [](auto& map, const std::string& key) { uint64_t v = 0; map.find(key, v); return v; }));
+
+        print_row("AtomicSet<std::string>", measure<AtomicSet<std::string>>(keys,
+            [](auto& set, const std::string& key, size_t) { set.insert(key); },
+            [](auto& set, const std::string& key) { return static_cast<uint64_t>(set.contains(key)); }));
+
+        print_row("AtomicStringSet", measure<AtomicStringSet<>>(keys,
+            [](auto& set, const std::string& key, size_t) { set.insert(key); },
+            [](auto& set, const std::string& key) { return static_cast<uint64_t>(set.contains(key)); }));
+
+        std::cout << "\n";
+    }
+    std::cout.unsetf(std::ios::fixed);
+}
+
+int main() {
+    std::cout << "Inline String Key Benchmark\n";
+    std::cout << "===========================\n\n";
+    std::cout << "Heap bytes include the bucket array; allocator overhead is not counted.\n\n";
+
+    benchmark_key_lengths();
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <random>
+#include <string>
+#include "lockfree/string_interner.hpp"
+#include "lockfree/atomic_hashmap.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::high_resolution_clock;
+
+// Metric-style names: long shared prefixes, small vocabulary
+std::vector<std::string> make_vocabulary(size_t count) {
+    static const char* services[] = {"checkout", "search", "inventory", "payments", "gateway"};
+    static const char* metrics[] = {"latency.p99", "latency.p50", "requests.total", "errors.total"};
+    std::vector<std::string> words;
+    for (size_t i = 0; i < count; ++i) {
+        words.push_back(std::string("prod.eu-west.") + services[i % 5] + ".instance-" +
+                        std::to_string(i / 20) + "." + metrics[(i / 5) % 4]);
+    }
+    return words;
+}
+
+// Heap footprint of a std::string, ignoring allocator overhead
+size_t string_bytes(const std::string& s) {
+    return sizeof(std::string) + (s.capacity() > 15 ? s.capacity() + 1 : 0);
+}
+
+void benchmark_memory() {
+    std::cout << "=== Memory: 1M records referencing 10k distinct names ===\n\n";
+
+    constexpr size_t num_records = 1000000;
+    const auto vocabulary = make_vocabulary(10000);
+
+    std::mt19937 gen(3);
+    std::vector<size_t> picks(num_records);
+    for (auto& pick : picks) {
+        pick = gen() % vocabulary.size();
+    }
+
+    // Every record owns a copy of its name
+    std::vector<std::string> copies;
+    copies.reserve(num_records);
+    size_t copy_bytes = 0;
+    for (size_t pick : picks) {
+        copies.push_back(vocabulary[pick]);
+        copy_bytes += string_bytes(copies.back());
+    }
+
+    // Every record holds a 4-byte ID into one shared interner
+    StringInterner interner(vocabulary.size());
+    std::vector<StringInterner::Id> ids;
+    ids.reserve(num_records);
+    for (size_t pick : picks) {
+        ids.push_back(interner.intern(vocabulary[pick]));
+    }
+    size_t id_bytes = ids.size() * sizeof(StringInterner::Id) + interner.memory_usage();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  std::string per record:  " << copy_bytes / 1048576.0 << " MiB\n";
+    std::cout << "  Interned ID per record:  " << id_bytes / 1048576.0 << " MiB ("
+              << interner.arena_bytes() / 1024 << " KiB arena, "
+              << interner.memory_usage() / 1024 << " KiB interner total)\n";
+    std::cout << "  Reduction:               " << static_cast<double>(copy_bytes) / id_bytes << "x\n\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+void benchmark_intern_throughput() {
+    std::cout << "=== intern() / resolve() Throughput ===\n\n";
+
+    const auto vocabulary = make_vocabulary(10000);
+    constexpr size_t ops_per_thread = 1000000;
+
+    std::cout << std::setw(10) << "Threads" << std::setw(18) << "intern hit ops/s"
+              << std::setw(20) << "intern new ops/s" << std::setw(18) << "resolve ops/s" << "\n";
+
+    for (int num_threads : {1, 2, 4}) {
+        StringInterner interner(vocabulary.size());
+        for (const auto& word : vocabulary) {
+            interner.intern(word);
+        }
+
+        // Hit path: names that are already interned
+        std::atomic<size_t> checksum{0};
+        auto start = Clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                size_t local = 0;
+                for (size_t i = 0; i < ops_per_thread; ++i) {
+                    local += interner.intern(vocabulary[(i * 7919 + t) % vocabulary.size()]);
+                }
+                checksum.fetch_add(local);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double hit_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        // Miss path: every thread interns distinct new strings
+        StringInterner fresh(num_threads * 100000);
+        threads.clear();
+        start = Clock::now();
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                std::string name = "prod.eu-west.session-";
+                for (int i = 0; i < 100000; ++i) {
+                    name.resize(21);
+                    name += std::to_string(t * 100000 + i);
+                    fresh.intern(name);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double new_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        threads.clear();
+        start = Clock::now();
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                size_t local = 0;
+                for (size_t i = 0; i < ops_per_thread; ++i) {
+                    local += interner.resolve(static_cast<StringInterner::Id>((i * 7919 + t) % vocabulary.size())).size();
+                }
+                checksum.fetch_add(local);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double resolve_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << std::setw(10) << num_threads
+                  << std::setw(18) << static_cast<long>(num_threads * ops_per_thread / hit_seconds)
+                  << std::setw(20) << static_cast<long>(num_threads * 100000 / new_seconds)
+                  << std::setw(18) << static_cast<long>(num_threads * ops_per_thread / resolve_seconds) << "\n";
+    }
+    std::cout << "\n";
+}
+
+void benchmark_keyed_lookups() {
+    std::cout << "=== Map Lookups: std::string keys vs interned IDs ===\n\n";
+
+    const auto vocabulary = make_vocabulary(10000);
+    constexpr size_t num_lookups = 2000000;
+
+    StringInterner interner(vocabulary.size());
+    AtomicHashMap<std::string, uint64_t> by_name(vocabulary.size() * 2);
+    AtomicHashMap<StringInterner::Id, uint64_t> by_id(vocabulary.size() * 2);
+    std::vector<StringInterner::Id> ids;
+    for (size_t i = 0; i < vocabulary.size(); ++i) {
+        by_name.insert(vocabulary[i], i);
+        ids.push_back(interner.intern(vocabulary[i]));
+        by_id.insert(ids.back(), i);
+    }
+
+    uint64_t value = 0;
+    uint64_t sum = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < num_lookups; ++i) {
+        by_name.find(vocabulary[(i * 7919) % vocabulary.size()], value);
+        sum += value;
+    }
+    double name_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / num_lookups;
+
+    start = Clock::now();
+    for (size_t i = 0; i < num_lookups; ++i) {
+        by_id.find(ids[(i * 7919) % ids.size()], value);
+        sum += value;
+    }
+    double id_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / num_lookups;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  AtomicHashMap<std::string, V>::find:  " << name_ns << " ns\n";
+    std::cout << "  AtomicHashMap<Id, V>::find:           " << id_ns << " ns\n";
+    std::cout << "  (checksum " << sum % 1000 << ")\n\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+int main() {
+    std::cout << "StringInterner Performance Benchmark\n";
+    std::cout << "====================================\n\n";
+
+    benchmark_memory();
+    benchmark_intern_throughput();
+    benchmark_keyed_lookups();
+
+    return 0;
+}
@@ -254,6 +254,68 @@ void benchmark_scaling() {
     }
 }
 
+// Dictionary-like words: shared syllable prefixes, mostly distinct endings
+std::vector<std::string> make_dictionary(size_t count) {
+    static const char* syllables[] = {"an", "be", "con", "de", "ex", "for", "in", "lo", "ma", "pre",
+                                      "re", "sta", "tion", "un", "ver", "ing", "al", "ic", "ous", "ly"};
+    std::mt19937 gen(42);
+    std::vector<std::string> words(count);
+    for (size_t i = 0; i < count; ++i) {
+        const int parts = 2 + static_cast<int>(gen() % 3);
+        for (int j = 0; j < parts; ++j) {
+            words[i] += syllables[gen() % 20];
+        }
+        words[i] += static_cast<char>('a' + gen() % 26);
+    }
+    return words;
+}
+
+// Seconds to load words into a fresh trie; the trie is destroyed before the next build
+template<typename Load>
+double load_seconds(Load load) {
+    AtomicTrie<char> trie;
+    auto start = std::chrono::steady_clock::now();
+    load(trie);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (trie.empty()) {
+        std::cout << "  (empty trie)\n";
+    }
+    return seconds;
+}
+
+void benchmark_bulk_load() {
+    constexpr size_t word_count = 50000;
+    std::cout << "=== Bulk Load (" << word_count / 1000 << "K words, ms) ===\n\n";
+    const auto words = make_dictionary(word_count);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::setw(8) << "Threads" << std::setw(14) << "insert loop" << std::setw(14) << "bulk_insert"
+              << std::setw(10) << "speedup" << "\n";
+    for (int num_threads : {1, 2, 4, 8}) {
+        double insert_time = load_seconds([&](AtomicTrie<char>& trie) {
+            std::vector<std::thread> threads;
+            const size_t slice = (words.size() + num_threads - 1) / num_threads;
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    const size_t end = std::min(words.size(), (t + 1) * slice);
+                    for (size_t i = t * slice; i < end; ++i) {
+                        trie.insert(words[i]);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        });
+        double bulk_time = load_seconds([&](AtomicTrie<char>& trie) {
+            trie.bulk_insert(words, num_threads);
+        });
+        std::cout << std::setw(8) << num_threads << std::setw(14) << insert_time * 1e3
+                  << std::setw(14) << bulk_time * 1e3 << std::setw(9) << insert_time / bulk_time << "x\n";
+    }
+    std::cout << "\n";
+}
+
 int main() {
     std::cout << "Trie Performance Benchmark\n";
     std::cout << "==========================\n\n";
@@ -261,6 +323,7 @@ int main() {
     benchmark_scaling();
     benchmark_insert_heavy_workload();
     benchmark_lookup_heavy_workload();
+    benchmark_bulk_load();
     
     return 0;
 } 
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include "lockfree/atomic_queue.hpp"
+#include "lockfree/atomic_mpmc_queue.hpp"
+#include "lockfree/atomic_waitfree_queue.hpp"
+
+using namespace lockfree;
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t MAX_BENCH_THREADS = 32;
+
+struct LatencyReport {
+    double p50_ns;
+    double p99_ns;
+    double p9999_ns;
+    double max_ns;
+    size_t failed;              // Enqueues that reported failure or were dropped
+    double mops;
+};
+
+// Adapters: AtomicQueue::enqueue returns void and drops the item after its retry budget
+template<typename Queue>
+bool do_enqueue(Queue& queue, int value) {
+    if constexpr (std::is_void_v<decltype(queue.enqueue(value))>) {
+        queue.enqueue(value);
+        return true;
+    } else {
+        return queue.enqueue(value);
+    }
+}
+
+// Every thread alternates enqueue and dequeue and times each operation individually
+template<typename Queue>
+LatencyReport measure(Queue& queue, size_t num_threads, size_t ops_per_thread) {
+    std::vector<std::vector<uint32_t>> samples(num_threads);
+    std::atomic<size_t> failed{0};
+    std::atomic<size_t> enqueued{0};
+    std::atomic<size_t> dequeued{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            auto& mine = samples[t];
+            mine.reserve(ops_per_thread);
+            size_t local_enqueued = 0;
+            size_t local_dequeued = 0;
+            int value;
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < ops_per_thread; ++i) {
+                auto start = Clock::now();
+                if (i % 2 == 0) {
+                    if (do_enqueue(queue, static_cast<int>(i))) {
+                        ++local_enqueued;
+                    } else {
+                        failed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } else if (queue.dequeue(value)) {
+                    ++local_dequeued;
+                }
+                auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+                mine.push_back(static_cast<uint32_t>(std::min<long long>(ns, UINT32_MAX)));
+            }
+            enqueued.fetch_add(local_enqueued);
+            dequeued.fetch_add(local_dequeued);
+        });
+    }
+
+    auto start = Clock::now();
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Drain and compare counts: AtomicQueue can drop items without telling the caller
+    int value;
+    size_t drained = 0;
+    while (queue.dequeue(value)) {
+        ++drained;
+    }
+    size_t lost = enqueued.load() - dequeued.load() - drained;
+
+    std::vector<uint32_t> all;
+    for (auto& mine : samples) {
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&](double p) {
+        return static_cast<double>(all[std::min(all.size() - 1, static_cast<size_t>(p * all.size()))]);
+    };
+    return {percentile(0.50), percentile(0.99), percentile(0.9999), static_cast<double>(all.back()),
+            failed.load() + lost, all.size() / seconds / 1e6};
+}
+
+void print_header() {
+    std::cout << "  " << std::left << std::setw(26) << "Queue" << std::right
+              << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << std::setw(12) << "p99.99 ns"
+              << std::setw(12) << "max ns" << std::setw(10) << "failed" << std::setw(10) << "Mops/s" << "\n";
+}
+
+void print_row(const char* name, const LatencyReport& r) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::setprecision(0)
+              << std::setw(10) << r.p50_ns << std::setw(10) << r.p99_ns << std::setw(12) << r.p9999_ns
+              << std::setw(12) << r.max_ns << std::setw(10) << r.failed
+              << std::setprecision(2) << std::setw(10) << r.mops << "\n";
+}
+
+void run_scenario(size_t num_threads, size_t ops_per_thread) {
+    std::cout << "\nThreads: " << num_threads << " (" << std::thread::hardware_concurrency()
+              << " hardware threads), " << ops_per_thread << " ops per thread\n";
+    print_header();
+    {
+        AtomicQueue<int> queue;
+        print_row("AtomicQueue", measure(queue, num_threads, ops_per_thread));
+    }
+    {
+        auto queue = std::make_unique<AtomicMPMCQueue<int, 65536>>();
+        print_row("AtomicMPMCQueue<65536>", measure(*queue, num_threads, ops_per_thread));
+    }
+    {
+        AtomicWaitFreeQueue<int, MAX_BENCH_THREADS + 1> queue;    // + 1 for the main thread draining
+        print_row("AtomicWaitFreeQueue", measure(queue, num_threads, ops_per_thread));
+    }
+}
+
+int main() {
+    std::cout << "Queue operation latency under oversubscription\n";
+    std::cout << "==============================================\n";
+    std::cout << std::fixed;
+
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    constexpr size_t ops_per_thread = 200000;
+
+    run_scenario(std::min(hardware, MAX_BENCH_THREADS), ops_per_thread);
+    run_scenario(std::min(hardware * 4, MAX_BENCH_THREADS), ops_per_thread);
+    run_scenario(MAX_BENCH_THREADS, ops_per_thread / 2);
+
+    std::cout << "\nfailed counts enqueues that reported failure plus items that were never dequeued.\n"
+                 "Latencies include one clock read (~20 ns).\n";
+    return 0;
+}
@@ -15,7 +15,7 @@ struct Task {
     std::string description;
     int task_id;
     
-    Task(int p, const std::string& desc, int id) 
+    Task(int p = 0, const std::string& desc = "", int id = 0) 
         : priority(p), description(desc), task_id(id) {}
     
     // Higher priority value = higher priority
@@ -4,6 +4,7 @@
 #include <vector>
 #include <chrono>
 #include <atomic>
+#include <cassert>
 #include <random>
 #include <string>
 #include <algorithm>
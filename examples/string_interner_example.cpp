@@ -0,0 +1,69 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include "lockfree/string_interner.hpp"
+#include "lockfree/atomic_hashmap.hpp"
+
+using namespace lockfree;
+
+void demo_basic_interning() {
+    std::cout << "=== Basic Interning ===\n";
+
+    StringInterner interner;
+
+    StringInterner::Id cpu = interner.intern("host.cpu.utilization");
+    StringInterner::Id mem = interner.intern("host.mem.used_bytes");
+    StringInterner::Id again = interner.intern("host.cpu.utilization");
+
+    std::cout << "  host.cpu.utilization -> " << cpu << "\n";
+    std::cout << "  host.mem.used_bytes  -> " << mem << "\n";
+    std::cout << "  interning the first name again returns " << again << "\n";
+    std::cout << "  resolve(" << mem << ") = " << interner.resolve(mem) << "\n";
+
+    StringInterner::Id id;
+    std::cout << "  host.disk.io interned? " << (interner.find("host.disk.io", id) ? "yes" : "no") << "\n\n";
+}
+
+void demo_id_keyed_map() {
+    std::cout << "=== IDs as Map Keys ===\n";
+
+    StringInterner names;
+    AtomicHashMap<StringInterner::Id, double> latest;
+
+    // Writers intern the metric name once and key the map by its 4-byte ID
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&names, &latest, t]() {
+            for (int i = 0; i < 5; ++i) {
+                std::string metric = "service.shard" + std::to_string(i) + ".requests";
+                StringInterner::Id id = names.intern(metric);
+                latest.insert(id, t * 100.0 + i);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    std::cout << "  " << names.size() << " distinct names, " << latest.size() << " map entries\n";
+    for (auto it = latest.begin(); it != latest.end(); ++it) {
+        auto [id, value] = *it;
+        std::cout << "  " << names.resolve(id) << " = " << value << "\n";
+    }
+    std::cout << "  arena: " << names.arena_bytes() << " bytes\n\n";
+}
+
+int main() {
+    std::cout << "Lock-free StringInterner Example\n";
+    std::cout << "================================\n\n";
+
+    demo_basic_interning();
+    demo_id_keyed_map();
+
+    std::cout << "All StringInterner examples completed!\n";
+    std::cout << "\nNote: Interned IDs are stable for the lifetime of the interner, so\n";
+    std::cout << "containers can store 4-byte IDs instead of duplicate strings.\n";
+
+    return 0;
+}
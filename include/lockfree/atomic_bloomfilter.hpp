@@ -6,6 +6,10 @@
 #include <functional>
 #include <cmath>
 #include <vector>
+#include <string>
+#include <cstring>
+#include "cpu_dispatch.hpp"
+#include "hash.hpp"
 
 namespace lockfree {
 
@@ -21,6 +25,7 @@ namespace lockfree {
  * @tparam Size The total number of bits in the filter. Must be a power of 2.
  * @tparam NumHashFunctions The number of hash functions to use (1-8). More functions
  *                          reduce false positives but increase computation and memory access.
+ * @tparam Hash Hash function for T. Defaults to Hasher<T> (hash.hpp).
  * 
  * Key Features:
  * - Lock-free: No blocking operations, guaranteed system-wide progress
@@ -38,7 +43,7 @@ namespace lockfree {
  * 
  * Algorithm Details:
  * - Uses bit array with atomic 64-bit words for thread-safe bit manipulation
- * - Multiple hash functions generated from single hash with different seeds
+ * - k bit indices derived by double hashing: h1 + i * h2, with h2 remixed from h1
  * - Power-of-2 size enables efficient bit indexing with mask operations
  * - Atomic fetch_or operations ensure thread-safe bit setting
  * 
@@ -73,7 +78,7 @@ namespace lockfree {
  * @note Bloom filters cannot remove elements. Use counting Bloom filters if deletion is needed.
  * @warning False positives are possible. Always verify positive results with authoritative source.
  */
-template<typename T, size_t Size = 8192, size_t NumHashFunctions = 3>
+template<typename T, size_t Size = 8192, size_t NumHashFunctions = 3, typename Hash = Hasher<T>>
 class AtomicBloomFilter {
 private:
     static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
@@ -83,18 +88,7 @@ private:
     
     BitArray bits_;                             ///< Atomic bit array for the filter
     std::atomic<size_t> approximate_count_;     ///< Approximate count of unique insertions
-    std::hash<T> hasher_;                       ///< Hash function for type T
-    
-    /**
-     * @brief Pre-computed hash seeds for generating multiple independent hash functions.
-     * 
-     * These seeds are used to create k independent hash functions from a single
-     * base hash value, following the double hashing technique.
-     */
-    static constexpr std::array<uint64_t, 8> hash_seeds_ = {
-        0x9e3779b9, 0x85ebca6b, 0xc2b2ae35, 0x27d4eb2f,
-        0x165667b1, 0xd3a2646c, 0xfd7046c5, 0xb55a4f09
-    };
+    Hash hasher_;                               ///< Hash function for type T
     
     static constexpr size_t BITS_PER_WORD = 64;         ///< Number of bits per atomic word
     static constexpr size_t WORD_COUNT = Size / BITS_PER_WORD;  ///< Number of atomic words
@@ -103,20 +97,21 @@ private:
     /**
      * @brief Generate multiple hash values for an item using different seeds.
      * 
-     * Creates k independent hash functions by combining the base hash with
-     * different predetermined seeds. This approach is more efficient than
-     * computing k completely independent hash functions.
+     * Uses double hashing (Kirsch-Mitzenmacher): index i is h1 + i * h2, where h1
+     * is the item's hash and h2 an odd remix of it. The k indices are spread
+     * independently over the filter, with the false positive rate of k separate
+     * hash functions for the cost of one.
      * 
      * @param item The item to hash
      * @return Array of k hash values for the item
      */
     std::array<size_t, NumHashFunctions> get_hash_values(const T& item) const {
         std::array<size_t, NumHashFunctions> hashes;
-        size_t base_hash = hasher_(item);
+        const uint64_t h1 = static_cast<uint64_t>(hasher_(item));
+        const uint64_t h2 = hash_u64(h1 ^ 0x9e3779b97f4a7c15ULL) | 1;   // Odd, so the k indices are distinct
         
         for (size_t i = 0; i < NumHashFunctions; ++i) {
-            // Use different seeds to generate independent hash functions
-            hashes[i] = (base_hash ^ hash_seeds_[i]) & BIT_MASK;
+            hashes[i] = static_cast<size_t>(h1 + i * h2) & BIT_MASK;
         }
         
         return hashes;
@@ -291,12 +286,7 @@ public:
      * @exception_safety No-throw guarantee
      */
     size_t bits_set() const {
-        size_t count = 0;
-        for (const auto& word : bits_) {
-            uint64_t value = word.load(std::memory_order_relaxed);
-            count += __builtin_popcountll(value);  // Count set bits
-        }
-        return count;
+        return kernels().popcount(bits_.data(), bits_.size());
     }
     
     /**
@@ -437,6 +427,66 @@ public:
         return bits_set() == 0;
     }
     
+    /**
+     * @brief Get the number of bytes written by serialize().
+     * 
+     * @return Size of the serialized bit array in bytes
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    static constexpr size_t serialized_size() {
+        return WORD_COUNT * sizeof(uint64_t);
+    }
+    
+    /**
+     * @brief Append the raw bit array to a byte buffer.
+     * 
+     * @param out Buffer to append serialized_size() bytes to
+     * @complexity O(Size/64)
+     * @thread_safety Safe but may be inconsistent during concurrent modifications
+     * @exception_safety Strong guarantee - out is unchanged if allocation throws
+     * 
+     * @note The bit layout depends on Hash, and a custom Hash must match in the
+     *       loading process. The default Hasher is only stable across processes for
+     *       the key types and hosts listed in hash.hpp: not for pointers or types
+     *       that fall back to std::hash, and only on little-endian 64-bit hosts.
+     */
+    void serialize(std::string& out) const {
+        out.reserve(out.size() + serialized_size());
+        for (const auto& word : bits_) {
+            uint64_t value = word.load(std::memory_order_relaxed);
+            out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+    }
+    
+    /**
+     * @brief Replace the bit array with one produced by serialize().
+     * 
+     * @param data Start of the serialized bits (no alignment requirement)
+     * @param size Number of bytes available at data
+     * @return true if the bits were loaded, false if size does not match serialized_size()
+     * @complexity O(Size/64)
+     * @thread_safety Not safe with concurrent operations
+     * @exception_safety No-throw guarantee
+     * 
+     * @note approximate_size() is re-estimated from the number of bits set.
+     */
+    bool deserialize(const char* data, size_t size) {
+        if (size != serialized_size()) {
+            return false;
+        }
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            uint64_t value;
+            std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+            bits_[i].store(value, std::memory_order_relaxed);
+        }
+        // No concurrent writers here, so the vector popcount kernel may be used
+        const size_t bits = kernels().popcount_quiescent(bits_.data(), bits_.size());
+        approximate_count_.store(bits / NumHashFunctions, std::memory_order_relaxed);
+        return true;
+    }
+    
     // Note: Union and intersection operations are not provided in the lock-free version
     // as they would require complex synchronization to maintain consistency.
     // Applications can implement these operations at a higher level by coordinating
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <utility>
+#include "node_arena.hpp"
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free linked list whose nodes live in a preallocated arena.
+ *
+ * The compact counterpart of AtomicLinkedList, with the same semantics: unique
+ * elements kept in insertion order. Each link is a 32-bit word whose top bit
+ * is the deletion mark (Harris-style), so marking a node and freezing its
+ * successor is one CAS and an append can never be lost behind a node that is
+ * being removed. A node holding an int is 8 bytes.
+ *
+ * Removed nodes are unlinked by the remover or by any traversal that passes
+ * them, and go back to the arena after an EpochDomain grace period. Every
+ * operation pins the calling thread for its duration.
+ *
+ * @tparam T The type of elements stored in the list.
+ * @tparam Compare Equality predicate for elements. Defaults to std::equal_to<T>.
+ *
+ * Key Features:
+ * - Allocation-free once the arena is warm, including under churn
+ * - 4-byte links, with the mark in the link word
+ * - Fixed capacity chosen at construction; insert reports a full arena
+ *
+ * Performance Characteristics:
+ * - Insert: O(n) - checks for a duplicate, then appends
+ * - Remove: O(n)
+ * - Find: O(n)
+ * - Memory: capacity slots of sizeof(T) + 4 bytes (rounded to alignment), plus a
+ *   4-byte free-list link, committed as they are first used
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCompactLinkedList<int> list(1024);
+ *
+ * list.insert(42);
+ * if (list.contains(42)) {
+ *     list.remove(42);
+ * }
+ * list.for_each([](const int& item) { std::cout << item << "\n"; });
+ * @endcode
+ *
+ * @note Iteration is through for_each(), which keeps the thread pinned while it runs.
+ */
+template<typename T, typename Compare = std::equal_to<T>>
+class AtomicCompactLinkedList {
+private:
+    /**
+     * @brief List node: marked next link and inline storage for the element.
+     */
+    struct Node {
+        std::atomic<uint32_t> next{0};                  ///< Successor index; top bit marks this node removed
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element, constructed while the node is in use
+
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        /**
+         * @brief Destroy the element once no reader can reach the node (called by the arena).
+         */
+        void reclaim() {
+            item()->~T();
+        }
+    };
+
+    using Arena = NodeArena<Node>;
+    using Index = typename Arena::Index;
+
+    static constexpr uint32_t MARK = 1u << 31;              ///< Deletion mark in a link word
+    static constexpr uint32_t NIL = MARK - 1;               ///< End of list
+    static constexpr int MAX_INSERT_ATTEMPTS = 1000;        ///< Append CAS retries before giving up
+
+    std::atomic<uint32_t> head_{NIL};           ///< First node (never marked)
+    std::atomic<size_t> size_{0};               ///< Number of elements
+    Compare comparator_;                        ///< Equality predicate
+    EpochDomain& epochs_;                       ///< Grace periods for removed nodes
+    Arena arena_;                               ///< Node storage
+
+    static bool is_marked(uint32_t link) {
+        return (link & MARK) != 0;
+    }
+
+    static uint32_t unmarked(uint32_t link) {
+        return link & ~MARK;
+    }
+
+    /**
+     * @brief Find a live node equal to key, unlinking marked nodes along the way.
+     *
+     * @return The link that points to the match (or the last link if none) and the match or NIL
+     */
+    std::pair<std::atomic<uint32_t>*, uint32_t> search(const T& key) {
+        while (true) {
+            std::atomic<uint32_t>* prev = &head_;
+            uint32_t current = prev->load(std::memory_order_acquire);
+            bool restart = false;
+
+            while (current != NIL) {
+                Node& node = arena_.node(current);
+                uint32_t next = node.next.load(std::memory_order_acquire);
+                if (is_marked(next)) {
+                    uint32_t expected = current;
+                    if (!prev->compare_exchange_strong(expected, unmarked(next),
+                                                       std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        restart = true;     // prev changed or was marked itself
+                        break;
+                    }
+                    arena_.retire(current);
+                    current = unmarked(next);
+                    continue;
+                }
+                if (comparator_(*node.item(), key)) {
+                    return {prev, current};
+                }
+                prev = &node.next;
+                current = next;
+            }
+
+            if (!restart) {
+                return {prev, NIL};
+            }
+        }
+    }
+
+    /**
+     * @brief Append an already-constructed node unless an equal element exists.
+     */
+    bool link(Index index) {
+        Node& node = arena_.node(index);
+        for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS; ++attempts) {
+            auto [prev, current] = search(*node.item());
+            if (current != NIL) {
+                break;
+            }
+            node.next.store(NIL, std::memory_order_relaxed);
+            uint32_t expected = NIL;
+            // Fails if another node was appended or the last node was marked meanwhile
+            if (prev->compare_exchange_strong(expected, index,
+                                              std::memory_order_release, std::memory_order_relaxed)) {
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        // Never published, so it can be reused at once
+        node.item()->~T();
+        arena_.release(index);
+        return false;
+    }
+
+    template<typename... Args>
+    bool construct_and_link(Args&&... args) {
+        // Allocate before pinning so the arena can advance the epoch to reuse removed nodes
+        Index index = arena_.allocate();
+        if (index == Arena::NULL_INDEX) {
+            return false;
+        }
+        try {
+            ::new (arena_.node(index).storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            arena_.release(index);
+            throw;
+        }
+        auto guard = epochs_.pin();
+        return link(index);
+    }
+
+public:
+    /**
+     * @brief Create an empty list that can hold up to capacity elements.
+     *
+     * @param capacity Maximum number of nodes, clamped to [1, 2^31 - 1]. Removed
+     *                 nodes count until their grace period ends.
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    explicit AtomicCompactLinkedList(size_t capacity)
+        : epochs_(EpochDomain::global()), arena_(std::min<size_t>(capacity, NIL)) {}
+
+    /**
+     * @brief Destructor. Destroys the elements still linked.
+     *
+     * @complexity O(n)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicCompactLinkedList() {
+        for (uint32_t i = head_.load(std::memory_order_relaxed); i != NIL;
+             i = unmarked(arena_.node(i).next.load(std::memory_order_relaxed))) {
+            arena_.node(i).item()->~T();
+        }
+    }
+
+    AtomicCompactLinkedList(const AtomicCompactLinkedList&) = delete;
+    AtomicCompactLinkedList& operator=(const AtomicCompactLinkedList&) = delete;
+
+    /**
+     * @brief Insert a copy of the item if no equal element is present.
+     *
+     * @param item The item to copy and insert
+     * @return true if inserted; false if present, the arena is full, or after 1000 failed appends
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's copy constructor throws, the list is unchanged
+     */
+    bool insert(const T& item) {
+        return construct_and_link(item);
+    }
+
+    /**
+     * @brief Insert an item by moving it if no equal element is present.
+     *
+     * @param item The item to move and insert
+     * @return true if inserted; false if present, the arena is full, or after 1000 failed appends
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's move constructor throws, the list is unchanged
+     */
+    bool insert(T&& item) {
+        return construct_and_link(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place and insert it if no equal element is present.
+     *
+     * @param args Arguments to forward to T's constructor
+     * @return true if inserted; false if present, the arena is full, or after 1000 failed appends
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's constructor throws, the list is unchanged
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        return construct_and_link(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove the element equal to item.
+     *
+     * @param item The item to remove
+     * @return true if this call removed it, false if it was not present
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    bool remove(const T& item) {
+        auto guard = epochs_.pin();
+        auto [prev, current] = search(item);
+        if (current == NIL) {
+            return false;
+        }
+
+        Node& node = arena_.node(current);
+        uint32_t next = node.next.load(std::memory_order_acquire);
+        while (!is_marked(next)) {
+            // Marking freezes the successor link, so nothing can be appended after a removed node
+            if (node.next.compare_exchange_weak(next, next | MARK,
+                                                std::memory_order_acq_rel, std::memory_order_acquire)) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                uint32_t expected = current;
+                if (prev->compare_exchange_strong(expected, next,
+                                                  std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    arena_.retire(current);
+                } else {
+                    search(item);   // Unlinks it now that prev has moved on
+                }
+                return true;
+            }
+        }
+        return false;   // A concurrent remove won
+    }
+
+    /**
+     * @brief Search for an element.
+     *
+     * @param item The item to search for
+     * @return true if an equal element is present
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    bool find(const T& item) const {
+        auto guard = epochs_.pin();
+        uint32_t current = head_.load(std::memory_order_acquire);
+        while (current != NIL) {
+            Node& node = arena_.node(current);
+            uint32_t next = node.next.load(std::memory_order_acquire);
+            if (!is_marked(next) && comparator_(*node.item(), item)) {
+                return true;
+            }
+            current = unmarked(next);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check if the list contains an element (alias for find).
+     *
+     * @param item The item to check for
+     * @return true if an equal element is present
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    bool contains(const T& item) const {
+        return find(item);
+    }
+
+    /**
+     * @brief Visit every element in insertion order.
+     *
+     * @tparam Func Callable as void(const T&)
+     * @param func Visitor applied to each element
+     * @complexity O(n)
+     * @thread_safety Safe - weakly consistent under concurrent writes
+     * @exception_safety Depends on visitor function's exception safety
+     */
+    template<typename Func>
+    void for_each(Func&& func) const {
+        auto guard = epochs_.pin();
+        uint32_t current = head_.load(std::memory_order_acquire);
+        while (current != NIL) {
+            Node& node = arena_.node(current);
+            uint32_t next = node.next.load(std::memory_order_acquire);
+            if (!is_marked(next)) {
+                func(static_cast<const T&>(*node.item()));
+            }
+            current = unmarked(next);
+        }
+    }
+
+    /**
+     * @brief Check if the list is empty.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of elements.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the maximum number of nodes.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return arena_.capacity();
+    }
+
+    /**
+     * @brief Approximate bytes used by the nodes handed out so far.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        return sizeof(*this) - sizeof(Arena) + arena_.memory_usage();
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <new>
+#include <utility>
+#include "node_arena.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free Michael & Scott queue whose nodes live in a preallocated arena.
+ *
+ * The compact counterpart of AtomicQueue. Head, tail and every next link are
+ * 64-bit words holding a 32-bit node index and a 32-bit ABA tag. This is the
+ * counted-pointer form of the original algorithm, which needs a double-width
+ * CAS when links are real pointers. Elements are stored inline in the nodes,
+ * so an enqueue costs no heap allocation once the arena is warm.
+ *
+ * A dequeued node is reused only after two things have happened: the dequeuer
+ * has moved the element out, and the node has been unlinked as the old dummy
+ * head. Whichever of the two finishes last returns the node to the arena.
+ *
+ * @tparam T The type of elements stored in the queue. Must be constructible,
+ *           destructible, and either copyable or movable.
+ *
+ * Key Features:
+ * - Allocation-free enqueue/dequeue once the arena is warm
+ * - One node per element (the original allocates the element separately)
+ * - ABA-safe with single-word CAS
+ * - Fixed capacity chosen at construction; enqueue reports a full arena
+ *
+ * Performance Characteristics:
+ * - Enqueue: O(1) amortized
+ * - Dequeue: O(1) amortized
+ * - Memory: capacity + 1 slots of sizeof(T) + 12 bytes (rounded to alignment),
+ *   plus a 4-byte free-list link, committed as they are first used
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCompactQueue<uint64_t> queue(1 << 16);
+ *
+ * queue.enqueue(7);
+ * uint64_t value;
+ * if (queue.dequeue(value)) {
+ *     std::cout << "Dequeued: " << value << std::endl;
+ * }
+ * @endcode
+ *
+ * @note There is no front(): with node reuse a peek could observe a node that
+ *       is being recycled. Close to full capacity, an enqueue can fail while a
+ *       concurrent dequeue still holds the node it is about to free.
+ */
+template<typename T>
+class AtomicCompactQueue {
+private:
+    /**
+     * @brief Queue node: tagged next link, reuse handoff and inline element storage.
+     */
+    struct Node {
+        std::atomic<uint64_t> next{0};                  ///< Successor index and ABA tag
+        std::atomic<uint32_t> handoffs{0};              ///< Steps done out of: element taken, unlinked
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element, constructed while queued
+
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using Arena = NodeArena<Node>;
+    using Index = typename Arena::Index;
+
+    static constexpr Index NULL_INDEX = Arena::NULL_INDEX;
+
+    alignas(64) std::atomic<uint64_t> head_;    ///< Dummy head index and ABA tag
+    alignas(64) std::atomic<uint64_t> tail_;    ///< Tail index and ABA tag
+    Arena arena_;                               ///< Node storage
+
+    static uint64_t pack(Index index, uint32_t tag) {
+        return Arena::pack(index, tag);
+    }
+
+    static Index index_of(uint64_t word) {
+        return Arena::index_of(word);
+    }
+
+    static uint32_t tag_of(uint64_t word) {
+        return Arena::tag_of(word);
+    }
+
+    /**
+     * @brief Record one of the two steps that must finish before a node is reused.
+     */
+    void finish(Index index) {
+        if (arena_.node(index).handoffs.fetch_add(1, std::memory_order_acq_rel) == 1) {
+            arena_.release(index);
+        }
+    }
+
+public:
+    /**
+     * @brief Create an empty queue that can hold up to capacity elements.
+     *
+     * @param capacity Maximum number of elements, clamped to [1, 2^32 - 2]
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    explicit AtomicCompactQueue(size_t capacity)
+        : arena_(std::min(capacity, Arena::MAX_CAPACITY - 1) + 1) {
+        Index dummy = arena_.allocate();
+        // The dummy holds no element, so its "element taken" step is already done
+        arena_.node(dummy).handoffs.store(1, std::memory_order_relaxed);
+        arena_.node(dummy).next.store(pack(NULL_INDEX, 0), std::memory_order_relaxed);
+        head_.store(pack(dummy, 0), std::memory_order_relaxed);
+        tail_.store(pack(dummy, 0), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destructor. Destroys the remaining elements.
+     *
+     * @complexity O(n)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicCompactQueue() {
+        Index i = index_of(arena_.node(index_of(head_.load(std::memory_order_relaxed))).next.load(std::memory_order_relaxed));
+        while (i != NULL_INDEX) {
+            arena_.node(i).item()->~T();
+            i = index_of(arena_.node(i).next.load(std::memory_order_relaxed));
+        }
+    }
+
+    AtomicCompactQueue(const AtomicCompactQueue&) = delete;
+    AtomicCompactQueue& operator=(const AtomicCompactQueue&) = delete;
+
+    /**
+     * @brief Enqueue a copy of the item.
+     *
+     * @param item The item to copy and enqueue
+     * @return true if enqueued, false if the arena is full
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's copy constructor throws, the queue is unchanged
+     */
+    bool enqueue(const T& item) {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Enqueue an item by moving it.
+     *
+     * @param item The item to move and enqueue
+     * @return true if enqueued, false if the arena is full (item is not moved from)
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's move constructor throws, the queue is unchanged
+     */
+    bool enqueue(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the back of the queue.
+     *
+     * @param args Arguments to forward to T's constructor
+     * @return true if enqueued, false if the arena is full
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's constructor throws, the queue is unchanged
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        Index index = arena_.allocate();
+        if (index == NULL_INDEX) {
+            return false;
+        }
+        Node& node = arena_.node(index);
+        try {
+            ::new (node.storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            arena_.release(index);
+            throw;
+        }
+        node.handoffs.store(0, std::memory_order_relaxed);
+        // Bumping the tag fails any stale CAS from a thread that saw this node's previous life
+        uint64_t old_next = node.next.load(std::memory_order_relaxed);
+        node.next.store(pack(NULL_INDEX, tag_of(old_next) + 1), std::memory_order_relaxed);
+
+        while (true) {
+            uint64_t tail = tail_.load(std::memory_order_acquire);
+            Node& last = arena_.node(index_of(tail));
+            uint64_t next = last.next.load(std::memory_order_acquire);
+            if (tail != tail_.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (index_of(next) == NULL_INDEX) {
+                if (last.next.compare_exchange_weak(next, pack(index, tag_of(next) + 1),
+                                                    std::memory_order_release, std::memory_order_relaxed)) {
+                    tail_.compare_exchange_strong(tail, pack(index, tag_of(tail) + 1),
+                                                  std::memory_order_release, std::memory_order_relaxed);
+                    return true;
+                }
+            } else {
+                // Tail is lagging, help advance it
+                tail_.compare_exchange_strong(tail, pack(index_of(next), tag_of(tail) + 1),
+                                              std::memory_order_release, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Dequeue the front element.
+     *
+     * @param result Receives the dequeued element
+     * @return true if an element was dequeued, false if the queue was empty
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - if T's move assignment throws, the element and its slot are lost
+     */
+    bool dequeue(T& result) {
+        while (true) {
+            uint64_t head = head_.load(std::memory_order_acquire);
+            uint64_t tail = tail_.load(std::memory_order_acquire);
+            Index first = index_of(head);
+            uint64_t next = arena_.node(first).next.load(std::memory_order_acquire);
+            if (head != head_.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (first == index_of(tail)) {
+                if (index_of(next) == NULL_INDEX) {
+                    return false;
+                }
+                tail_.compare_exchange_strong(tail, pack(index_of(next), tag_of(tail) + 1),
+                                              std::memory_order_release, std::memory_order_relaxed);
+            } else if (index_of(next) != NULL_INDEX &&
+                       head_.compare_exchange_weak(head, pack(index_of(next), tag_of(head) + 1),
+                                                   std::memory_order_acquire, std::memory_order_relaxed)) {
+                // next is the new dummy; its element is ours alone
+                T* item = arena_.node(index_of(next)).item();
+                result = std::move(*item);
+                item->~T();
+                finish(index_of(next));
+                finish(first);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     *
+     * @note Result may be immediately outdated in concurrent environment.
+     */
+    bool empty() const {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        return index_of(arena_.node(index_of(head)).next.load(std::memory_order_acquire)) == NULL_INDEX;
+    }
+
+    /**
+     * @brief Count the elements by walking the queue.
+     *
+     * @return Number of elements; approximate under concurrent modification
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        size_t count = 0;
+        Index i = index_of(arena_.node(index_of(head_.load(std::memory_order_acquire))).next.load(std::memory_order_acquire));
+        // Bounded by capacity: a concurrently recycled node can redirect the walk
+        while (i != NULL_INDEX && count < capacity()) {
+            ++count;
+            i = index_of(arena_.node(i).next.load(std::memory_order_acquire));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get the maximum number of elements.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return arena_.capacity() - 1;
+    }
+
+    /**
+     * @brief Approximate bytes used by the nodes handed out so far.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        return sizeof(*this) - sizeof(Arena) + arena_.memory_usage();
+    }
+};
+
+} // namespace lockfree
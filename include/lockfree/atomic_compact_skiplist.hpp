@@ -0,0 +1,573 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <new>
+#include <random>
+#include <utility>
+#include "node_arena.hpp"
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free skip list whose nodes live in a preallocated arena.
+ *
+ * The compact counterpart of AtomicSkipList. A node's tower is 32 links of
+ * 4 bytes instead of 8, so a node with 8-byte keys and values shrinks from
+ * 288 to 152 bytes. The top bit of each link is the Harris deletion mark for
+ * that level.
+ *
+ * erase() marks a node's links from the top level down; marking level 0 is the
+ * linearization point. It then runs a search that unlinks the node at every
+ * level. A node goes back to the arena once both its inserter (which may still
+ * be linking upper levels) and its eraser are done with it, and an EpochDomain
+ * grace period has passed. Every operation pins the calling thread.
+ *
+ * @tparam Key The type of keys used for ordering.
+ * @tparam Value The type of values stored.
+ * @tparam Compare Comparison function for keys. Defaults to std::less<Key>.
+ *
+ * Key Features:
+ * - Allocation-free once the arena is warm, including under insert/erase churn
+ * - Erased nodes are unlinked at every level, not only at the bottom
+ * - Fixed capacity chosen at construction; insert reports a full arena
+ *
+ * Performance Characteristics:
+ * - Insert: O(log n) expected
+ * - Find: O(log n) expected
+ * - Erase: O(log n) expected
+ * - Size: O(n) traversal
+ * - Memory: capacity slots of sizeof(Key) + sizeof(Value) + 132 bytes (rounded
+ *   to alignment), plus a 4-byte free-list link, committed as they are first used
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCompactSkipList<uint64_t, uint64_t> index(1 << 20);
+ *
+ * index.insert(42, 7);
+ * uint64_t value;
+ * if (index.find(42, value)) {
+ *     index.erase(42);
+ * }
+ * @endcode
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class AtomicCompactSkipList {
+private:
+    static constexpr int MAX_LEVEL = 32;                    ///< Maximum number of levels
+    static constexpr uint32_t MARK = 1u << 31;              ///< Deletion mark in a link word
+    static constexpr uint32_t NIL = MARK - 1;               ///< End of a level
+    static constexpr int MAX_INSERT_ATTEMPTS = 1000;        ///< Level-0 CAS retries before giving up
+    static constexpr int MAX_LEVEL_ATTEMPTS = 100;          ///< Retries per upper level (best effort)
+
+    using Links = std::array<std::atomic<uint32_t>, MAX_LEVEL>;
+
+    /**
+     * @brief Skip list node: key, value and a tower of 32-bit links.
+     */
+    struct Node {
+        alignas(Key) unsigned char key_storage[sizeof(Key)];        ///< Key, constructed while in use
+        alignas(Value) unsigned char value_storage[sizeof(Value)];  ///< Value, constructed while in use
+        std::atomic<uint8_t> owners{0};     ///< Inserter and eraser still using the node
+        uint8_t top_level = 0;              ///< Highest level this node is linked on
+        Links next{};                       ///< Successor index per level; top bit marks removal
+
+        Key& key() {
+            return *std::launder(reinterpret_cast<Key*>(key_storage));
+        }
+
+        Value& value() {
+            return *std::launder(reinterpret_cast<Value*>(value_storage));
+        }
+
+        /**
+         * @brief Destroy key and value once no reader can reach the node (called by the arena).
+         */
+        void reclaim() {
+            key().~Key();
+            value().~Value();
+        }
+    };
+
+    using Arena = NodeArena<Node>;
+    using Index = typename Arena::Index;
+
+    Links head_;                                ///< Head tower (the head holds no key)
+    Compare comparator_;                        ///< Key ordering
+    EpochDomain& epochs_;                       ///< Grace periods for erased nodes
+    Arena arena_;                               ///< Node storage
+
+    static bool is_marked(uint32_t link) {
+        return (link & MARK) != 0;
+    }
+
+    static uint32_t unmarked(uint32_t link) {
+        return link & ~MARK;
+    }
+
+    /**
+     * @brief Generate a random level: level k with probability 2^-(k+1).
+     */
+    static int random_level() {
+        static thread_local std::mt19937 rng(std::random_device{}());
+        return std::min(std::countr_one(static_cast<uint32_t>(rng())), MAX_LEVEL - 1);
+    }
+
+    bool less(const Key& a, const Key& b) const {
+        return comparator_(a, b);
+    }
+
+    bool equal(const Key& a, const Key& b) const {
+        return !comparator_(a, b) && !comparator_(b, a);
+    }
+
+    /**
+     * @brief Locate key's predecessors and successors at every level, unlinking marked nodes.
+     *
+     * @param key The key to search for
+     * @param preds Receives the tower whose link at each level precedes key
+     * @param succs Receives the first node at each level not ordered before key
+     * @return true if an unmarked node with an equal key follows at level 0
+     */
+    bool locate(const Key& key, std::array<Links*, MAX_LEVEL>& preds, std::array<uint32_t, MAX_LEVEL>& succs) {
+        while (true) {
+            Links* pred = &head_;
+            bool restart = false;
+
+            for (int level = MAX_LEVEL - 1; level >= 0 && !restart; --level) {
+                uint32_t current = unmarked((*pred)[level].load(std::memory_order_acquire));
+                while (current != NIL) {
+                    Node& node = arena_.node(current);
+                    uint32_t next = node.next[level].load(std::memory_order_acquire);
+                    if (is_marked(next)) {
+                        uint32_t expected = current;
+                        if (!(*pred)[level].compare_exchange_strong(expected, unmarked(next),
+                                                                    std::memory_order_acq_rel,
+                                                                    std::memory_order_acquire)) {
+                            restart = true;     // pred changed or was marked itself
+                            break;
+                        }
+                        current = unmarked(next);
+                        continue;
+                    }
+                    if (!less(node.key(), key)) {
+                        break;
+                    }
+                    pred = &node.next;
+                    current = next;
+                }
+                preds[level] = pred;
+                succs[level] = current;
+            }
+
+            if (!restart) {
+                return succs[0] != NIL && equal(arena_.node(succs[0]).key(), key);
+            }
+        }
+    }
+
+    /**
+     * @brief Drop one of the two ownership references; the last one retires the node.
+     */
+    void release_owner(Index index) {
+        if (arena_.node(index).owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            arena_.retire(index);
+        }
+    }
+
+    /**
+     * @brief Find the unmarked node with an equal key without modifying links.
+     */
+    uint32_t find_node(const Key& key) const {
+        const Links* pred = &head_;
+        uint32_t current = NIL;
+        for (int level = MAX_LEVEL - 1; level >= 0; --level) {
+            current = unmarked((*pred)[level].load(std::memory_order_acquire));
+            while (current != NIL) {
+                Node& node = arena_.node(current);
+                uint32_t next = node.next[level].load(std::memory_order_acquire);
+                if (is_marked(next)) {
+                    current = unmarked(next);
+                    continue;
+                }
+                if (!less(node.key(), key)) {
+                    break;
+                }
+                pred = &node.next;
+                current = next;
+            }
+        }
+        if (current != NIL && equal(arena_.node(current).key(), key) &&
+            !is_marked(arena_.node(current).next[0].load(std::memory_order_acquire))) {
+            return current;
+        }
+        return NIL;
+    }
+
+    template<typename K, typename... Args>
+    bool insert_impl(K&& key, Args&&... args) {
+        // Allocate before pinning so the arena can advance the epoch to reuse erased nodes
+        Index index = arena_.allocate();
+        if (index == Arena::NULL_INDEX) {
+            return false;
+        }
+        Node& node = arena_.node(index);
+
+        auto guard = epochs_.pin();
+        std::array<Links*, MAX_LEVEL> preds;
+        std::array<uint32_t, MAX_LEVEL> succs;
+        if (locate(key, preds, succs)) {
+            arena_.release(index);
+            return false;
+        }
+        try {
+            ::new (node.key_storage) Key(std::forward<K>(key));
+            try {
+                ::new (node.value_storage) Value(std::forward<Args>(args)...);
+            } catch (...) {
+                node.key().~Key();
+                throw;
+            }
+        } catch (...) {
+            arena_.release(index);
+            throw;
+        }
+        int top = random_level();
+        node.top_level = static_cast<uint8_t>(top);
+        node.owners.store(2, std::memory_order_relaxed);
+
+        for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS; ++attempts) {
+            if (attempts > 0 && locate(node.key(), preds, succs)) {
+                break;
+            }
+            for (int level = 0; level <= top; ++level) {
+                node.next[level].store(succs[level], std::memory_order_relaxed);
+            }
+            uint32_t expected = succs[0];
+            if (!(*preds[0])[0].compare_exchange_strong(expected, index,
+                                                        std::memory_order_release, std::memory_order_relaxed)) {
+                continue;
+            }
+
+            // Linked at level 0: the node is in the list. Upper levels are best effort.
+            link_upper_levels(index, top, preds, succs);
+            // Pairs with the fence in erase(): either we see its mark or its search sees our links
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (is_marked(node.next[0].load(std::memory_order_acquire))) {
+                // Erased while we were linking: make sure no level still points to it
+                locate(node.key(), preds, succs);
+            }
+            release_owner(index);
+            return true;
+        }
+
+        // Never published, so it can be reused at once
+        node.reclaim();
+        arena_.release(index);
+        return false;
+    }
+
+    void link_upper_levels(Index index, int top, std::array<Links*, MAX_LEVEL>& preds,
+                           std::array<uint32_t, MAX_LEVEL>& succs) {
+        Node& node = arena_.node(index);
+        for (int level = 1; level <= top; ++level) {
+            for (int attempts = 0; attempts < MAX_LEVEL_ATTEMPTS; ++attempts) {
+                uint32_t link = node.next[level].load(std::memory_order_acquire);
+                if (is_marked(link)) {
+                    return;     // Being erased; stop growing the tower
+                }
+                if (link != succs[level] &&
+                    !node.next[level].compare_exchange_strong(link, succs[level], std::memory_order_acq_rel,
+                                                              std::memory_order_acquire)) {
+                    return;     // Marked concurrently
+                }
+                uint32_t expected = succs[level];
+                if ((*preds[level])[level].compare_exchange_strong(expected, index, std::memory_order_release,
+                                                                   std::memory_order_relaxed)) {
+                    break;
+                }
+                // Refresh the neighbourhood; stop if the node has meanwhile been erased
+                if (!locate(node.key(), preds, succs) || succs[0] != index) {
+                    return;
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Create an empty skip list that can hold up to capacity elements.
+     *
+     * @param capacity Maximum number of nodes, clamped to [1, 2^31 - 1]. Erased
+     *                 nodes count until their grace period ends.
+     * @complexity O(MAX_LEVEL)
+     * @thread_safety Safe
+     */
+    explicit AtomicCompactSkipList(size_t capacity)
+        : epochs_(EpochDomain::global()), arena_(std::min<size_t>(capacity, NIL)) {
+        for (auto& link : head_) {
+            link.store(NIL, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor. Destroys the elements still linked.
+     *
+     * @complexity O(n)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicCompactSkipList() {
+        for (uint32_t i = unmarked(head_[0].load(std::memory_order_relaxed)); i != NIL;
+             i = unmarked(arena_.node(i).next[0].load(std::memory_order_relaxed))) {
+            arena_.node(i).reclaim();
+        }
+    }
+
+    AtomicCompactSkipList(const AtomicCompactSkipList&) = delete;
+    AtomicCompactSkipList& operator=(const AtomicCompactSkipList&) = delete;
+
+    /**
+     * @brief Insert a key-value pair by copying.
+     *
+     * @param key The key to insert
+     * @param value The value to associate with the key
+     * @return true if inserted; false if the key exists, the arena is full, or after 1000 failed attempts
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if a copy constructor throws, the list is unchanged
+     */
+    bool insert(const Key& key, const Value& value) {
+        return insert_impl(key, value);
+    }
+
+    /**
+     * @brief Insert a key-value pair by moving.
+     *
+     * @param key The key to insert
+     * @param value The value to associate with the key
+     * @return true if inserted; false if the key exists, the arena is full, or after 1000 failed attempts
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if a move constructor throws, the list is unchanged
+     */
+    bool insert(Key&& key, Value&& value) {
+        return insert_impl(std::move(key), std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place for the given key.
+     *
+     * @param key The key to insert
+     * @param args Arguments to forward to Value's constructor
+     * @return true if inserted; false if the key exists, the arena is full, or after 1000 failed attempts
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if a constructor throws, the list is unchanged
+     */
+    template<typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        return insert_impl(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Find the value associated with a key.
+     *
+     * @param key The key to search for
+     * @param result Receives a copy of the value
+     * @return true if the key was found
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - if Value's copy assignment throws
+     */
+    bool find(const Key& key, Value& result) const {
+        auto guard = epochs_.pin();
+        uint32_t index = find_node(key);
+        if (index == NIL) {
+            return false;
+        }
+        result = arena_.node(index).value();
+        return true;
+    }
+
+    /**
+     * @brief Check if the skip list contains a key.
+     *
+     * @param key The key to search for
+     * @return true if the key is present
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    bool contains(const Key& key) const {
+        auto guard = epochs_.pin();
+        return find_node(key) != NIL;
+    }
+
+    /**
+     * @brief Apply a predicate to the value associated with a key.
+     *
+     * @param key The key to search for
+     * @param func Predicate called with the value if the key is found
+     * @return true if the key was found and the predicate returned true
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety Depends on predicate function's exception safety
+     */
+    template<typename Func>
+    bool find_if(const Key& key, Func&& func) const {
+        auto guard = epochs_.pin();
+        uint32_t index = find_node(key);
+        return index != NIL && func(static_cast<const Value&>(arena_.node(index).value()));
+    }
+
+    /**
+     * @brief Visit every key-value pair with lo <= key <= hi in ascending order.
+     *
+     * @tparam Func Callable as bool(const Key&, const Value&); returning false stops the scan
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @param func Visitor applied to each active pair in the range
+     * @return Number of pairs passed to func
+     * @complexity O(log n + k) expected where k is the number of pairs visited
+     * @thread_safety Safe - weakly consistent under concurrent writes
+     * @exception_safety Depends on visitor function's exception safety
+     */
+    template<typename Func>
+    size_t range(const Key& lo, const Key& hi, Func&& func) const {
+        auto guard = epochs_.pin();
+        const Links* pred = &head_;
+        for (int level = MAX_LEVEL - 1; level >= 0; --level) {
+            uint32_t current = unmarked((*pred)[level].load(std::memory_order_acquire));
+            while (current != NIL && less(arena_.node(current).key(), lo)) {
+                pred = &arena_.node(current).next;
+                current = unmarked((*pred)[level].load(std::memory_order_acquire));
+            }
+        }
+
+        size_t visited = 0;
+        uint32_t current = unmarked((*pred)[0].load(std::memory_order_acquire));
+        while (current != NIL) {
+            Node& node = arena_.node(current);
+            if (less(hi, node.key())) {
+                break;
+            }
+            uint32_t next = node.next[0].load(std::memory_order_acquire);
+            if (!is_marked(next)) {
+                ++visited;
+                if (!func(static_cast<const Key&>(node.key()), static_cast<const Value&>(node.value()))) {
+                    break;
+                }
+            }
+            current = unmarked(next);
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Remove a key and unlink its node at every level.
+     *
+     * @param key The key to remove
+     * @return true if this call removed the key, false if it was not present
+     * @complexity O(log n) expected
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    bool erase(const Key& key) {
+        auto guard = epochs_.pin();
+        std::array<Links*, MAX_LEVEL> preds;
+        std::array<uint32_t, MAX_LEVEL> succs;
+        if (!locate(key, preds, succs)) {
+            return false;
+        }
+
+        Index index = succs[0];
+        Node& node = arena_.node(index);
+        for (int level = node.top_level; level >= 1; --level) {
+            uint32_t link = node.next[level].load(std::memory_order_acquire);
+            while (!is_marked(link) &&
+                   !node.next[level].compare_exchange_weak(link, link | MARK, std::memory_order_acq_rel,
+                                                           std::memory_order_acquire)) {
+            }
+        }
+
+        uint32_t link = node.next[0].load(std::memory_order_acquire);
+        while (!is_marked(link)) {
+            if (node.next[0].compare_exchange_weak(link, link | MARK, std::memory_order_acq_rel,
+                                                   std::memory_order_acquire)) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                locate(key, preds, succs);  // Unlinks the node at every level
+                release_owner(index);
+                return true;
+            }
+        }
+        return false;   // A concurrent erase won
+    }
+
+    /**
+     * @brief Check if the skip list is empty.
+     *
+     * @complexity O(n) worst case - skips erased nodes still linked
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        auto guard = epochs_.pin();
+        for (uint32_t i = unmarked(head_[0].load(std::memory_order_acquire)); i != NIL;) {
+            uint32_t next = arena_.node(i).next[0].load(std::memory_order_acquire);
+            if (!is_marked(next)) {
+                return false;
+            }
+            i = unmarked(next);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Count the key-value pairs.
+     *
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        auto guard = epochs_.pin();
+        size_t count = 0;
+        for (uint32_t i = unmarked(head_[0].load(std::memory_order_acquire)); i != NIL;) {
+            uint32_t next = arena_.node(i).next[0].load(std::memory_order_acquire);
+            if (!is_marked(next)) {
+                ++count;
+            }
+            i = unmarked(next);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get the maximum number of nodes.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return arena_.capacity();
+    }
+
+    /**
+     * @brief Approximate bytes used by the nodes handed out so far.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        return sizeof(*this) - sizeof(Arena) + arena_.memory_usage();
+    }
+};
+
+} // namespace lockfree
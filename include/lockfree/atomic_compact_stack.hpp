@@ -0,0 +1,238 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "node_arena.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free stack whose nodes live in a preallocated arena.
+ *
+ * The compact counterpart of AtomicStack. Nodes are slots in a NodeArena and
+ * link to each other by 32-bit index, so a node holding an int is 8 bytes
+ * instead of a 16-byte heap block plus allocator overhead. The head is one
+ * 64-bit word holding the top index and a 32-bit ABA tag. Popped nodes go
+ * straight back to the arena: a pop that read a recycled node fails its CAS on
+ * the tag rather than touching freed memory.
+ *
+ * @tparam T The type of elements stored in the stack. Must be constructible,
+ *           destructible, and either copyable or movable.
+ *
+ * Key Features:
+ * - Allocation-free push/pop once the arena is warm
+ * - ABA-safe with a single-word CAS
+ * - Fixed capacity chosen at construction; push reports a full arena
+ *
+ * Performance Characteristics:
+ * - Push: O(1) amortized
+ * - Pop: O(1) amortized
+ * - Memory: capacity slots of sizeof(T) + 4 bytes (rounded to alignment), plus a
+ *   4-byte free-list link, committed as they are first used
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCompactStack<int> stack(1 << 20);
+ *
+ * if (!stack.push(42)) {
+ *     // Arena full
+ * }
+ * int value;
+ * if (stack.pop(value)) {
+ *     std::cout << "Popped: " << value << std::endl;
+ * }
+ * @endcode
+ *
+ * @note There is no top(): with immediate node reuse a peek could observe a
+ *       node that is being recycled. The tag wraps after 2^32 operations, so a
+ *       thread would have to stall across that many pops for ABA to occur.
+ */
+template<typename T>
+class alignas(64) AtomicCompactStack {
+private:
+    /**
+     * @brief Stack node: next index and inline storage for the element.
+     */
+    struct Node {
+        std::atomic<uint32_t> next{0};                  ///< Index of the node below
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element, constructed while on the stack
+
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using Arena = NodeArena<Node>;
+    using Index = typename Arena::Index;
+
+    alignas(64) std::atomic<uint64_t> head_{Arena::pack(Arena::NULL_INDEX, 0)};   ///< Top index and ABA tag
+    Arena arena_;                               ///< Node storage
+
+public:
+    /**
+     * @brief Create an empty stack that can hold up to capacity elements.
+     *
+     * @param capacity Maximum number of elements, clamped to [1, 2^32 - 1]
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    explicit AtomicCompactStack(size_t capacity) : arena_(capacity) {}
+
+    /**
+     * @brief Destructor. Destroys the remaining elements.
+     *
+     * @complexity O(n)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicCompactStack() {
+        for (Index i = Arena::index_of(head_.load(std::memory_order_relaxed)); i != Arena::NULL_INDEX;
+             i = arena_.node(i).next.load(std::memory_order_relaxed)) {
+            arena_.node(i).item()->~T();
+        }
+    }
+
+    AtomicCompactStack(const AtomicCompactStack&) = delete;
+    AtomicCompactStack& operator=(const AtomicCompactStack&) = delete;
+
+    /**
+     * @brief Push a copy of the item.
+     *
+     * @param item The item to copy and push
+     * @return true if pushed, false if the arena is full
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's copy constructor throws, the stack is unchanged
+     */
+    bool push(const T& item) {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Push an item by moving it.
+     *
+     * @param item The item to move and push
+     * @return true if pushed, false if the arena is full (item is not moved from)
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's move constructor throws, the stack is unchanged
+     */
+    bool push(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the top of the stack.
+     *
+     * @param args Arguments to forward to T's constructor
+     * @return true if pushed, false if the arena is full
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's constructor throws, the stack is unchanged
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        Index index = arena_.allocate();
+        if (index == Arena::NULL_INDEX) {
+            return false;
+        }
+        Node& node = arena_.node(index);
+        try {
+            ::new (node.storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            arena_.release(index);
+            throw;
+        }
+
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        do {
+            node.next.store(Arena::index_of(head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, Arena::pack(index, Arena::tag_of(head) + 1),
+                                              std::memory_order_release, std::memory_order_relaxed));
+        return true;
+    }
+
+    /**
+     * @brief Pop the top element.
+     *
+     * @param result Receives the popped element
+     * @return true if an element was popped, false if the stack was empty
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - if T's move assignment throws, the element and its slot are lost
+     */
+    bool pop(T& result) {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        while (true) {
+            Index index = Arena::index_of(head);
+            if (index == Arena::NULL_INDEX) {
+                return false;
+            }
+            // The node may be popped and reused meanwhile; the tag then fails the CAS
+            Index next = arena_.node(index).next.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, Arena::pack(next, Arena::tag_of(head) + 1),
+                                            std::memory_order_acquire, std::memory_order_acquire)) {
+                T* item = arena_.node(index).item();
+                result = std::move(*item);
+                item->~T();
+                arena_.release(index);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if the stack is empty.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return Arena::index_of(head_.load(std::memory_order_acquire)) == Arena::NULL_INDEX;
+    }
+
+    /**
+     * @brief Count the elements by walking the stack.
+     *
+     * @return Number of elements; approximate under concurrent modification
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        size_t count = 0;
+        Index i = Arena::index_of(head_.load(std::memory_order_acquire));
+        // Bounded by capacity: a concurrently recycled node can redirect the walk
+        while (i != Arena::NULL_INDEX && count < arena_.capacity()) {
+            ++count;
+            i = arena_.node(i).next.load(std::memory_order_acquire);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get the maximum number of elements.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return arena_.capacity();
+    }
+
+    /**
+     * @brief Approximate bytes used by the nodes handed out so far.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        return sizeof(*this) - sizeof(Arena) + arena_.memory_usage();
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <memory>
+#include <span>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include "cpu_dispatch.hpp"
+#include "hash.hpp"
+#include "prefetch.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free Count-Min sketch: approximate frequency counts in fixed memory.
+ *
+ * The sketch keeps Depth rows of Width atomic counters. Adding an item bumps
+ * one counter per row; its estimated frequency is the smallest of those
+ * counters. Counters are only ever shared with other items, never lost, so an
+ * estimate is never below the true count, and with probability 1 - e^-Depth it
+ * exceeds it by at most (e / Width) * total_count() (Cormode & Muthukrishnan).
+ *
+ * @tparam T Type of the counted items. Must be hashable by Hash.
+ * @tparam Width Counters per row; a power of two. Sets the error: e / Width of the stream.
+ * @tparam Depth Number of rows (1-8). Sets the confidence: 1 - e^-Depth.
+ * @tparam ConservativeUpdate When true, an add raises each row only as far as the
+ *                            new estimate requires instead of incrementing every
+ *                            row. Estimates are tighter (often several times so on
+ *                            skewed streams); adds use CAS instead of fetch_add.
+ * @tparam Hash Hash function for T. Defaults to Hasher<T> (hash.hpp).
+ *
+ * Key Features:
+ * - Lock-free add() and estimate(); memory fixed at construction
+ * - No underestimates, also with conservative update under concurrency
+ * - add_batch()/estimate_batch() hash with the SIMD hash_batch kernel and
+ *   prefetch every row's counter before touching it
+ * - merge() of sketches with the same parameters, e.g. per-shard sketches
+ *
+ * Performance Characteristics:
+ * - add(): O(Depth) - Depth fetch_adds, or Depth loads plus CAS on the rows that
+ *   need raising with ConservativeUpdate
+ * - estimate(): O(Depth) relaxed loads
+ * - Memory: Width * Depth * 8 bytes
+ *
+ * Algorithm Details:
+ * - Row r indexes counter (h1 + r * h2) & (Width - 1), where h1 is the item's
+ *   hash and h2 an odd remix of it (double hashing, as in AtomicBloomFilter)
+ * - Conservative update reads the Depth counters, takes their minimum m, and
+ *   CASes every counter below m + count up to it. A failed CAS means another
+ *   add moved a counter, so the add re-reads and retries; this keeps concurrent
+ *   conservative adds from collapsing into one increment
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCountMinSketch<std::string, 4096, 4> sketch;   // 128 KB
+ *
+ * // Any number of threads
+ * sketch.add(request.path);
+ *
+ * // Estimated hits, at most e/4096 of all hits too high with 98% confidence
+ * uint64_t hits = sketch.estimate("/index.html");
+ * @endcode
+ *
+ * @note Use AtomicTopK (atomic_top_k.hpp) to track the most frequent items.
+ */
+template<typename T, size_t Width = 2048, size_t Depth = 4, bool ConservativeUpdate = false,
+         typename Hash = Hasher<T>>
+class AtomicCountMinSketch {
+    static_assert(Width >= 64 && (Width & (Width - 1)) == 0, "Width must be a power of 2, at least 64");
+    static_assert(Depth >= 1 && Depth <= 8, "Depth must be between 1 and 8");
+
+public:
+    static constexpr size_t WIDTH = Width;                   ///< Counters per row
+    static constexpr size_t DEPTH = Depth;                   ///< Number of rows
+    static constexpr size_t BATCH_GROUP_SIZE = 16;           ///< Items whose counter misses a batch overlaps
+    static constexpr size_t MAX_CAS_RETRIES = 64;            ///< Conservative retries before falling back to fetch_add
+
+private:
+    static constexpr size_t INDEX_MASK = Width - 1;
+    static constexpr uint64_t ROW_SEED = 0x9e3779b97f4a7c15ULL;   ///< Same remix as AtomicBloomFilter
+    static constexpr size_t TOTAL_STRIPES = 16;              ///< Stream-length counters (conservative mode)
+
+    struct alignas(64) PaddedCounter {
+        std::atomic<uint64_t> value{0};
+    };
+
+    std::unique_ptr<std::atomic<uint64_t>[]> counters_;     ///< Depth rows of Width counters, row-major
+    std::array<PaddedCounter, TOTAL_STRIPES> totals_;        ///< Stream length, striped by row-0 counter
+    Hash hasher_;                                             ///< Hash function for T
+
+    /**
+     * @brief Counter positions of one item, one per row (already offset by row * Width).
+     */
+    using Slots = std::array<size_t, Depth>;
+
+    static Slots slots_for(uint64_t h1, uint64_t h2) {
+        Slots slots;
+        h2 |= 1;   // Odd, so the rows use distinct offsets
+        for (size_t r = 0; r < Depth; ++r) {
+            slots[r] = r * Width + (static_cast<size_t>(h1 + r * h2) & INDEX_MASK);
+        }
+        return slots;
+    }
+
+    Slots slots_for(const T& item) const {
+        const uint64_t h1 = static_cast<uint64_t>(hasher_(item));
+        return slots_for(h1, hash_u64(h1 ^ ROW_SEED));
+    }
+
+    /**
+     * @brief Add count at the given counters and return the item's new estimate.
+     */
+    uint64_t update(const Slots& slots, uint64_t count) {
+        if constexpr (ConservativeUpdate) {
+            totals_[slots[0] % TOTAL_STRIPES].value.fetch_add(count, std::memory_order_relaxed);
+            for (size_t attempt = 0; attempt < MAX_CAS_RETRIES; ++attempt) {
+                std::array<uint64_t, Depth> seen;
+                uint64_t estimate = UINT64_MAX;
+                for (size_t r = 0; r < Depth; ++r) {
+                    seen[r] = counters_[slots[r]].load(std::memory_order_relaxed);
+                    estimate = std::min(estimate, seen[r]);
+                }
+                const uint64_t target = estimate + count;
+                bool raised = true;
+                for (size_t r = 0; r < Depth && raised; ++r) {
+                    if (seen[r] < target) {
+                        raised = counters_[slots[r]].compare_exchange_strong(seen[r], target,
+                                                                             std::memory_order_relaxed);
+                    }
+                }
+                if (raised) {
+                    return target;
+                }
+            }
+            // Heavy contention on this item's counters: a plain add is always safe
+        }
+        uint64_t estimate = UINT64_MAX;
+        for (size_t r = 0; r < Depth; ++r) {
+            estimate = std::min(estimate, counters_[slots[r]].fetch_add(count, std::memory_order_relaxed) + count);
+        }
+        return estimate;
+    }
+
+    uint64_t read(const Slots& slots) const {
+        uint64_t estimate = UINT64_MAX;
+        for (size_t r = 0; r < Depth; ++r) {
+            estimate = std::min(estimate, counters_[slots[r]].load(std::memory_order_relaxed));
+        }
+        return estimate;
+    }
+
+    /**
+     * @brief Hash a group of items (SIMD for integer keys) and prefetch their counters.
+     */
+    void prepare_group(const T* items, size_t group, Slots* out) const {
+        size_t h1[BATCH_GROUP_SIZE];
+        uint64_t mixed[BATCH_GROUP_SIZE];
+        uint64_t h2[BATCH_GROUP_SIZE];
+        hash_batch(std::span<const T>(items, group), std::span<size_t>(h1, group), hasher_);
+        for (size_t i = 0; i < group; ++i) {
+            mixed[i] = static_cast<uint64_t>(h1[i]) ^ ROW_SEED;
+        }
+        kernels().hash_batch(mixed, h2, group);   // The row remix, four items per AVX2 step
+        for (size_t i = 0; i < group; ++i) {
+            out[i] = slots_for(h1[i], h2[i]);
+            for (size_t r = 0; r < Depth; ++r) {
+                prefetch_write(&counters_[out[i][r]]);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Create an empty sketch.
+     *
+     * @complexity O(Width * Depth)
+     * @thread_safety Not applicable (constructor)
+     * @exception_safety Strong guarantee - may throw std::bad_alloc
+     */
+    explicit AtomicCountMinSketch(const Hash& hasher = Hash{})
+        : counters_(std::make_unique<std::atomic<uint64_t>[]>(Width * Depth)), hasher_(hasher) {
+        clear();
+    }
+
+    AtomicCountMinSketch(const AtomicCountMinSketch&) = delete;
+    AtomicCountMinSketch& operator=(const AtomicCountMinSketch&) = delete;
+
+    /**
+     * @brief Count occurrences of an item.
+     *
+     * @param item The item
+     * @param count Number of occurrences
+     * @return The item's estimated frequency after this add
+     * @complexity O(Depth)
+     * @thread_safety Safe - lock-free
+     * @exception_safety No-throw guarantee (if Hash does not throw)
+     */
+    uint64_t add(const T& item, uint64_t count = 1) {
+        return update(slots_for(item), count);
+    }
+
+    /**
+     * @brief Count one occurrence of each item in a batch.
+     *
+     * Items are processed in groups of BATCH_GROUP_SIZE: the group is hashed in
+     * one hash_batch() call and every counter it touches is prefetched before
+     * the first update, so the cache misses of a group overlap.
+     *
+     * @param items Items to count
+     * @param count Number of items
+     * @param out_estimates Optional; receives each item's estimate right after its add
+     * @complexity O(count * Depth)
+     * @thread_safety Safe - lock-free
+     * @exception_safety No-throw guarantee (if Hash does not throw)
+     */
+    void add_batch(const T* items, size_t count, uint64_t* out_estimates = nullptr) {
+        Slots slots[BATCH_GROUP_SIZE];
+        for (size_t base = 0; base < count; base += BATCH_GROUP_SIZE) {
+            const size_t group = std::min(BATCH_GROUP_SIZE, count - base);
+            prepare_group(items + base, group, slots);
+            for (size_t i = 0; i < group; ++i) {
+                const uint64_t estimate = update(slots[i], 1);
+                if (out_estimates) {
+                    out_estimates[base + i] = estimate;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Estimated frequency of an item.
+     *
+     * @param item The item
+     * @return Never less than the item's true count (for adds that completed
+     *         before the call); 0 if the item's counters were never touched
+     * @complexity O(Depth)
+     * @thread_safety Safe - lock-free
+     * @exception_safety No-throw guarantee (if Hash does not throw)
+     */
+    uint64_t estimate(const T& item) const {
+        return read(slots_for(item));
+    }
+
+    /**
+     * @brief Estimated frequencies of a batch of items.
+     *
+     * @param items Items to look up
+     * @param count Number of items
+     * @param out_estimates Receives one estimate per item
+     * @complexity O(count * Depth)
+     * @thread_safety Safe - lock-free
+     * @exception_safety No-throw guarantee (if Hash does not throw)
+     */
+    void estimate_batch(const T* items, size_t count, uint64_t* out_estimates) const {
+        Slots slots[BATCH_GROUP_SIZE];
+        for (size_t base = 0; base < count; base += BATCH_GROUP_SIZE) {
+            const size_t group = std::min(BATCH_GROUP_SIZE, count - base);
+            prepare_group(items + base, group, slots);
+            for (size_t i = 0; i < group; ++i) {
+                out_estimates[base + i] = read(slots[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Total number of occurrences added (the stream length N).
+     *
+     * @complexity O(Width) without conservative update (row 0 sums to N), O(1) with it
+     * @thread_safety Safe - concurrent adds may or may not be included
+     * @exception_safety No-throw guarantee
+     */
+    uint64_t total_count() const {
+        uint64_t total = 0;
+        if constexpr (ConservativeUpdate) {
+            for (const auto& stripe : totals_) {
+                total += stripe.value.load(std::memory_order_relaxed);
+            }
+        } else {
+            for (size_t i = 0; i < Width; ++i) {
+                total += counters_[i].load(std::memory_order_relaxed);
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Relative error bound: estimates exceed true counts by at most epsilon() * N.
+     */
+    static constexpr double epsilon() {
+        return 2.718281828459045 / static_cast<double>(Width);
+    }
+
+    /**
+     * @brief Probability that an estimate is within the epsilon() bound.
+     */
+    static double confidence() {
+        return 1.0 - std::exp(-static_cast<double>(Depth));
+    }
+
+    /**
+     * @brief Absolute error bound for the current stream: epsilon() * total_count().
+     *
+     * @complexity Same as total_count()
+     * @thread_safety Safe
+     */
+    double error_bound() const {
+        return epsilon() * static_cast<double>(total_count());
+    }
+
+    /**
+     * @brief Get the counter memory in bytes.
+     */
+    static constexpr size_t memory_bytes() {
+        return Width * Depth * sizeof(uint64_t);
+    }
+
+    /**
+     * @brief Add another sketch's counts into this one.
+     *
+     * Both sketches must use the same hash function (the default Hasher always
+     * agrees). The result bounds the combined stream like a sketch that saw
+     * both streams; with conservative update it may be slightly looser.
+     *
+     * @param other Sketch with the same parameters
+     * @complexity O(Width * Depth)
+     * @thread_safety Safe with concurrent use of either sketch
+     * @exception_safety No-throw guarantee
+     */
+    void merge(const AtomicCountMinSketch& other) {
+        if (&other == this) {
+            return;
+        }
+        for (size_t i = 0; i < Width * Depth; ++i) {
+            const uint64_t count = other.counters_[i].load(std::memory_order_relaxed);
+            if (count) {
+                counters_[i].fetch_add(count, std::memory_order_relaxed);
+            }
+        }
+        for (size_t s = 0; s < TOTAL_STRIPES; ++s) {
+            totals_[s].value.fetch_add(other.totals_[s].value.load(std::memory_order_relaxed),
+                                       std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Reset every counter to zero.
+     *
+     * @complexity O(Width * Depth)
+     * @thread_safety Not safe with concurrent add()
+     * @exception_safety No-throw guarantee
+     */
+    void clear() {
+        for (size_t i = 0; i < Width * Depth; ++i) {
+            counters_[i].store(0, std::memory_order_relaxed);
+        }
+        for (auto& stripe : totals_) {
+            stripe.value.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,780 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <array>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <type_traits>
+#include "cpu_dispatch.hpp"
+#include "epoch_reclamation.hpp"
+#include "hash.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A concurrent bucketized cuckoo hash map with bounded lookups.
+ *
+ * Every key lives in one of exactly two buckets, chosen by two hash functions, and
+ * each bucket holds SlotsPerBucket entries. A lookup therefore inspects at most
+ * 2 * SlotsPerBucket slots no matter how full the table is, which removes the long
+ * chains that dominate AtomicHashMap's tail latency.
+ *
+ * Entries are stored inline in the buckets. A separate, dense array keeps one tag
+ * byte per slot (zero for free slots), so most mismatches and misses are rejected
+ * without touching the bucket at all.
+ *
+ * Readers never lock. Buckets map onto striped version counters (seqlock style):
+ * a reader records the versions of its two stripes, copies the matching entry and
+ * re-checks the versions, retrying if a writer touched either bucket meanwhile.
+ * Writers take the two stripe locks of the key's buckets; when both buckets are
+ * full, a breadth-first search finds a short cuckoo path to a free slot and moves
+ * entries one pair of buckets at a time. If no path exists the table doubles;
+ * replaced tables are freed through QsbrDomain.
+ *
+ * @tparam Key The type of keys. Must be trivially copyable and hashable.
+ * @tparam Value The type of values. Must be trivially copyable.
+ * @tparam Hash Hash function for keys. Defaults to Hasher<Key> (hash.hpp).
+ * @tparam KeyEqual Equality comparison for keys. Defaults to std::equal_to<Key>.
+ * @tparam SlotsPerBucket Entries per bucket (4 to 8).
+ *
+ * Key Features:
+ * - Worst-case two-bucket lookups: O(1) probes independent of load
+ * - Optimistic reads: no locks, no atomic RMW and no stores to the table
+ * - Tag filter: a miss usually reads two tag words and no entries
+ * - Fine-grained writers: two stripe locks per operation, BFS cuckoo paths
+ * - Automatic resize when no displacement path is found
+ *
+ * Performance Characteristics:
+ * - find/contains: O(1) worst case (two buckets)
+ * - insert/erase: O(1) expected; a displacement moves at most MAX_PATH_DEPTH entries
+ * - Resize: O(n), blocks writers while the table is rebuilt
+ * - Sustains load factors above 0.9 with 4 or more slots per bucket
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicCuckooHashMap<uint64_t, uint32_t> owners(1 << 20);
+ *
+ * owners.insert(order_id, trader_id);
+ *
+ * uint32_t trader;
+ * if (owners.find(order_id, trader)) {
+ *     notify(trader);
+ * }
+ * owners.erase(order_id);
+ * @endcode
+ *
+ * @note Use AtomicHashMap for keys or values that are not trivially copyable.
+ *       KeyEqual may be called on a torn copy of a key that is being rewritten
+ *       (the result is then discarded), so it must not dereference pointers.
+ */
+template<typename Key, typename Value, typename Hash = Hasher<Key>,
+         typename KeyEqual = std::equal_to<Key>, size_t SlotsPerBucket = 4>
+class AtomicCuckooHashMap {
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "AtomicCuckooHashMap stores entries inline; use AtomicHashMap for other types");
+    static_assert(SlotsPerBucket >= 4 && SlotsPerBucket <= 8, "SlotsPerBucket must be between 4 and 8");
+
+private:
+    static constexpr size_t ENTRY_WORDS = (sizeof(Key) + sizeof(Value) + 7) / 8;   ///< Words per slot
+
+    /**
+     * @brief Raw copy of one slot.
+     */
+    using EntryWords = std::array<uint64_t, ENTRY_WORDS>;
+
+    /**
+     * @brief Inline entries of one bucket; 4 slots of 16-byte entries fill one cache line.
+     */
+    struct alignas(64) Bucket {
+        std::array<std::atomic<uint64_t>, SlotsPerBucket * ENTRY_WORDS> words{};   ///< Key then value, per slot
+    };
+
+    /**
+     * @brief Version counter guarding a group of buckets; odd while a writer holds it.
+     */
+    struct alignas(64) LockStripe {
+        std::atomic<uint64_t> version{0};
+    };
+
+    static constexpr size_t MIN_BUCKET_COUNT = 16;          ///< Smallest table
+    static constexpr size_t MAX_LOCK_STRIPES = 2048;        ///< Upper bound on stripes per table
+    static constexpr size_t MAX_PATH_DEPTH = 5;             ///< Longest displacement path
+    static constexpr size_t MAX_PATH_SEARCH = 512;          ///< Buckets examined by one path search
+    static constexpr size_t MAX_REHASH_KICKS = 500;         ///< Evictions per entry while rebuilding
+    static constexpr int MAX_OPTIMISTIC_READS = 100;        ///< Read attempts before locking
+    static constexpr int MAX_WRITE_ATTEMPTS = 1000;         ///< Write retries before giving up
+    static constexpr int SPINS_BEFORE_YIELD = 64;           ///< Lock spins before yielding
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    /**
+     * @brief One table generation. Replaced (not modified in place) when resizing.
+     */
+    struct Table {
+        size_t bucket_mask;                             ///< bucket_count - 1 (power of two)
+        size_t stripe_mask;                             ///< stripe_count - 1 (power of two)
+        std::unique_ptr<std::atomic<uint64_t>[]> tags;  ///< Byte s of tags[b] tags slot s of bucket b
+        std::unique_ptr<Bucket[]> buckets;              ///< Entry storage
+        std::unique_ptr<LockStripe[]> stripes;          ///< Version counters
+
+        explicit Table(size_t bucket_count)
+            : bucket_mask(bucket_count - 1),
+              stripe_mask((bucket_count < MAX_LOCK_STRIPES ? bucket_count : MAX_LOCK_STRIPES) - 1),
+              tags(new std::atomic<uint64_t>[bucket_count]()),
+              buckets(new Bucket[bucket_count]),
+              stripes(new LockStripe[stripe_mask + 1]) {}
+    };
+
+    /**
+     * @brief The two candidate buckets and the tag of a key in one table.
+     */
+    struct Probe {
+        size_t first;       ///< Primary bucket
+        size_t second;      ///< Alternate bucket (differs from first)
+        uint8_t tag;        ///< Slot tag, never zero
+    };
+
+    /**
+     * @brief A slot position within a table.
+     */
+    struct Location {
+        size_t bucket = 0;          ///< Bucket index
+        size_t slot = NO_SLOT;      ///< Slot index, NO_SLOT if absent
+    };
+
+    /**
+     * @brief One step of a breadth-first displacement search.
+     */
+    struct PathStep {
+        size_t bucket;      ///< Bucket reached by this step
+        size_t parent;      ///< Index of the step whose entry moves here (NO_SLOT for roots)
+        size_t slot;        ///< Slot of that entry in the parent's bucket
+        size_t depth;       ///< Number of moves from a root
+    };
+
+    /**
+     * @brief Holds the stripe locks of two buckets; releases them on destruction.
+     */
+    class StripeLocks {
+    public:
+        StripeLocks(const AtomicCuckooHashMap& map, const Table* table, size_t first, size_t second) {
+            size_t a = first & table->stripe_mask;
+            size_t b = second & table->stripe_mask;
+            if (a > b) {
+                std::swap(a, b);    // Ascending order, matching the resizer
+            }
+            first_ = &table->stripes[a];
+            second_ = a == b ? nullptr : &table->stripes[b];
+            if (!map.lock_stripe(table, *first_)) {
+                first_ = second_ = nullptr;
+                return;
+            }
+            if (second_ && !map.lock_stripe(table, *second_)) {
+                unlock_stripe(*first_);
+                first_ = second_ = nullptr;
+            }
+        }
+
+        ~StripeLocks() {
+            unlock();
+        }
+
+        StripeLocks(const StripeLocks&) = delete;
+        StripeLocks& operator=(const StripeLocks&) = delete;
+
+        /**
+         * @brief Check whether the locks were acquired (false if the table was replaced).
+         */
+        explicit operator bool() const {
+            return first_ != nullptr;
+        }
+
+        /**
+         * @brief Release the locks early.
+         */
+        void unlock() {
+            if (second_) {
+                unlock_stripe(*second_);
+            }
+            if (first_) {
+                unlock_stripe(*first_);
+            }
+            first_ = second_ = nullptr;
+        }
+
+    private:
+        LockStripe* first_;     ///< Lower stripe
+        LockStripe* second_;    ///< Higher stripe, nullptr if both buckets share one
+    };
+
+    alignas(64) std::atomic<Table*> table_;     ///< Current table generation
+    alignas(64) std::atomic<size_t> size_{0};   ///< Number of entries
+    Hash hasher_;                               ///< Hash function instance
+    KeyEqual key_equal_;                        ///< Key equality comparison function instance
+    QsbrDomain& rcu_;                           ///< Reclamation for replaced tables
+
+    /**
+     * @brief Mix a hash into the independent second hash function.
+     */
+    static size_t mix(size_t hash) {
+        return static_cast<size_t>(hash_u64(static_cast<uint64_t>(hash)));
+    }
+
+    static Probe probe(const Table* table, size_t hash) {
+        const size_t mixed = mix(hash);
+        const size_t first = hash & table->bucket_mask;
+        size_t second = mixed & table->bucket_mask;
+        if (second == first) {
+            second = first ^ 1;
+        }
+        const uint8_t tag = static_cast<uint8_t>(mixed >> 56);
+        return {first, second, tag ? tag : uint8_t{1}};
+    }
+
+    size_t alternate(const Table* table, const Key& key, size_t bucket) const {
+        const Probe p = probe(table, hasher_(key));
+        return bucket == p.first ? p.second : p.first;
+    }
+
+    /**
+     * @brief Bit mask with the high bit of byte s set for every slot s whose tag equals tag.
+     */
+    static uint64_t match_tags(uint64_t tags, uint8_t tag) {
+        constexpr uint64_t LOW = 0x0101010101010101ULL;
+        constexpr uint64_t HIGH_BITS = 0x7f7f7f7f7f7f7f7fULL;
+        constexpr uint64_t SLOT_BYTES = SlotsPerBucket == 8 ? ~0ULL : (1ULL << (8 * SlotsPerBucket)) - 1;
+        const uint64_t x = tags ^ (LOW * tag);   // Matching bytes become zero
+        return ~(((x & HIGH_BITS) + HIGH_BITS) | x | HIGH_BITS) & SLOT_BYTES;
+    }
+
+    static uint8_t tag_at(const Table* table, size_t bucket, size_t slot) {
+        return static_cast<uint8_t>(table->tags[bucket].load(std::memory_order_relaxed) >> (8 * slot));
+    }
+
+    /**
+     * @brief Set the tag of one slot (caller holds the bucket's stripe or owns the table).
+     */
+    static void set_tag(Table* table, size_t bucket, size_t slot, uint8_t tag) {
+        const size_t shift = 8 * slot;
+        const uint64_t tags = table->tags[bucket].load(std::memory_order_relaxed);
+        table->tags[bucket].store((tags & ~(0xffULL << shift)) | (uint64_t{tag} << shift),
+                                  std::memory_order_relaxed);
+    }
+
+    static EntryWords read_entry(const Table* table, size_t bucket, size_t slot) {
+        EntryWords words;
+        const auto* source = &table->buckets[bucket].words[slot * ENTRY_WORDS];
+        for (size_t w = 0; w < ENTRY_WORDS; ++w) {
+            words[w] = source[w].load(std::memory_order_relaxed);
+        }
+        return words;
+    }
+
+    static void write_entry(Table* table, size_t bucket, size_t slot, const EntryWords& words) {
+        auto* target = &table->buckets[bucket].words[slot * ENTRY_WORDS];
+        for (size_t w = 0; w < ENTRY_WORDS; ++w) {
+            target[w].store(words[w], std::memory_order_relaxed);
+        }
+    }
+
+    static EntryWords pack(const Key& key, const Value& value) {
+        EntryWords words{};
+        std::memcpy(words.data(), &key, sizeof(Key));
+        std::memcpy(reinterpret_cast<char*>(words.data()) + sizeof(Key), &value, sizeof(Value));
+        return words;
+    }
+
+    template<typename T>
+    static T unpack(const EntryWords& words, size_t offset) {
+        std::array<char, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), reinterpret_cast<const char*>(words.data()) + offset, sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
+    static Key key_of(const EntryWords& words) {
+        return unpack<Key>(words, 0);
+    }
+
+    static Value value_of(const EntryWords& words) {
+        return unpack<Value>(words, sizeof(Key));
+    }
+
+    static void unlock_stripe(LockStripe& stripe) {
+        stripe.version.store(stripe.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Acquire a stripe of the given table.
+     * @return false if the table was replaced while waiting
+     */
+    bool lock_stripe(const Table* table, LockStripe& stripe) const {
+        for (int spins = 0;; ++spins) {
+            uint64_t version = stripe.version.load(std::memory_order_relaxed);
+            if (!(version & 1) &&
+                stripe.version.compare_exchange_weak(version, version + 1,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed)) {
+                // Order the odd version before the relaxed slot and tag stores that
+                // follow, so a reader that sees any of them also sees the stripe move
+                std::atomic_thread_fence(std::memory_order_release);
+                return true;
+            }
+            if (table_.load(std::memory_order_acquire) != table) {
+                return false;   // Stripes of a replaced table stay locked
+            }
+            if (spins >= SPINS_BEFORE_YIELD) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Search both buckets of a probe for a key.
+     * @param words Receives the entry when found
+     * @return Where the key is stored, slot == NO_SLOT if absent
+     */
+    Location locate(const Table* table, const Probe& p, const Key& key, EntryWords& words) const {
+        for (size_t bucket : {p.first, p.second}) {
+            for (uint64_t matches = match_tags(table->tags[bucket].load(std::memory_order_relaxed), p.tag);
+                 matches; matches &= matches - 1) {
+                const size_t slot = static_cast<size_t>(std::countr_zero(matches)) / 8;
+                words = read_entry(table, bucket, slot);
+                if (key_equal_(key_of(words), key)) {
+                    return {bucket, slot};
+                }
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Put an entry into a free slot of a bucket (caller holds its stripe or owns the table).
+     */
+    static bool place(Table* table, size_t bucket, const EntryWords& words, uint8_t tag) {
+        const uint64_t tags = table->tags[bucket].load(std::memory_order_relaxed);
+        for (size_t slot = 0; slot < SlotsPerBucket; ++slot) {
+            if (!((tags >> (8 * slot)) & 0xff)) {
+                write_entry(table, bucket, slot, words);
+                set_tag(table, bucket, slot, tag);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Find a cuckoo path from the probe's buckets to a free slot and shift entries along it.
+     * @return false if no path exists within MAX_PATH_DEPTH moves (the table must grow)
+     */
+    bool make_room(Table* table, const Probe& p) {
+        std::array<PathStep, MAX_PATH_SEARCH> steps;
+        size_t head = 0;
+        size_t tail = 0;
+        steps[tail++] = {p.first, NO_SLOT, 0, 0};
+        steps[tail++] = {p.second, NO_SLOT, 0, 0};
+
+        while (head < tail) {
+            const size_t current = head++;
+            const size_t bucket = steps[current].bucket;
+            for (size_t slot = 0; slot < SlotsPerBucket; ++slot) {
+                if (!tag_at(table, bucket, slot)) {
+                    move_along(table, steps, current, slot);
+                    return true;
+                }
+            }
+            if (steps[current].depth == MAX_PATH_DEPTH) {
+                continue;
+            }
+            // Unlocked peek: a torn key only sends the search down a useless branch,
+            // and every move is re-validated under the stripe locks
+            for (size_t slot = 0; slot < SlotsPerBucket && tail < MAX_PATH_SEARCH; ++slot) {
+                const Key key = key_of(read_entry(table, bucket, slot));
+                steps[tail++] = {alternate(table, key, bucket), current, slot, steps[current].depth + 1};
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Shift entries backwards along a path so its root bucket gains a free slot.
+     *
+     * Each move locks just the two buckets involved and re-validates the entry, so a
+     * concurrent change simply cuts the path short; the caller retries its insert.
+     */
+    void move_along(Table* table, const std::array<PathStep, MAX_PATH_SEARCH>& steps,
+                    size_t step, size_t free_slot) {
+        while (steps[step].parent != NO_SLOT) {
+            const size_t from = steps[steps[step].parent].bucket;
+            const size_t from_slot = steps[step].slot;
+            const size_t to = steps[step].bucket;
+
+            StripeLocks locks(*this, table, from, to);
+            if (!locks) {
+                return;
+            }
+            const uint8_t tag = tag_at(table, from, from_slot);
+            if (!tag || tag_at(table, to, free_slot)) {
+                return;     // Path went stale
+            }
+            const EntryWords words = read_entry(table, from, from_slot);
+            if (alternate(table, key_of(words), from) != to) {
+                return;
+            }
+            write_entry(table, to, free_slot, words);
+            set_tag(table, to, free_slot, tag);
+            set_tag(table, from, from_slot, 0);
+
+            free_slot = from_slot;
+            step = steps[step].parent;
+        }
+    }
+
+    /**
+     * @brief Insert an entry into a private table that no other thread can see yet.
+     * @return false if the entry (or one it evicted) found no slot; the table must be discarded
+     */
+    bool place_private(Table* table, EntryWords words) const {
+        Probe p = probe(table, hasher_(key_of(words)));
+        size_t bucket = p.first;
+        for (size_t kick = 0; kick < MAX_REHASH_KICKS; ++kick) {
+            const size_t other = bucket == p.first ? p.second : p.first;
+            if (place(table, bucket, words, p.tag) || place(table, other, words, p.tag)) {
+                return true;
+            }
+            // Evict a victim from the other bucket and continue with it
+            const size_t slot = kick % SlotsPerBucket;
+            const EntryWords victim = read_entry(table, other, slot);
+            write_entry(table, other, slot, words);
+            set_tag(table, other, slot, p.tag);
+            words = victim;
+            p = probe(table, hasher_(key_of(words)));
+            bucket = other == p.first ? p.second : p.first;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Replace a full table with one of at least twice the buckets.
+     *
+     * Locks every stripe of the old table in ascending order, which waits out all
+     * writers. The old stripes are never released: optimistic readers fail their
+     * version check and writers notice the new table, both retrying on it.
+     */
+    void grow(Table* table) {
+        for (size_t i = 0; i <= table->stripe_mask; ++i) {
+            if (!lock_stripe(table, table->stripes[i])) {
+                for (size_t j = 0; j < i; ++j) {
+                    unlock_stripe(table->stripes[j]);
+                }
+                return;     // Another thread already replaced this table
+            }
+        }
+
+        size_t bucket_count = (table->bucket_mask + 1) * 2;
+        std::unique_ptr<Table> next;
+        while (!next) {
+            next = std::make_unique<Table>(bucket_count);
+            for (size_t bucket = 0; bucket <= table->bucket_mask && next; ++bucket) {
+                for (size_t slot = 0; slot < SlotsPerBucket; ++slot) {
+                    if (tag_at(table, bucket, slot) &&
+                        !place_private(next.get(), read_entry(table, bucket, slot))) {
+                        next.reset();   // Pathological collisions: try a larger table
+                        bucket_count *= 2;
+                        break;
+                    }
+                }
+            }
+        }
+
+        table_.store(next.release(), std::memory_order_release);
+        std::vector<QsbrDomain::Retired> retired;
+        retired.push_back({table, [](void* p) { delete static_cast<Table*>(p); }});
+        rcu_.retire(std::move(retired));
+    }
+
+    /**
+     * @brief Locate a key and copy its entry out, validated against concurrent writers.
+     *
+     * Records both stripe versions, searches, and accepts the result (hit or miss)
+     * only if neither version moved. Falls back to the stripe locks after
+     * MAX_OPTIMISTIC_READS.
+     */
+    bool read(const Key& key, EntryWords& words) const {
+        auto section = rcu_.read();
+        const size_t hash = hasher_(key);
+
+        for (int attempt = 0; attempt < MAX_OPTIMISTIC_READS; ++attempt) {
+            const Table* table = table_.load(std::memory_order_acquire);
+            const Probe p = probe(table, hash);
+            const LockStripe& first = table->stripes[p.first & table->stripe_mask];
+            const LockStripe& second = table->stripes[p.second & table->stripe_mask];
+            const uint64_t first_version = first.version.load(std::memory_order_acquire);
+            const uint64_t second_version = second.version.load(std::memory_order_acquire);
+            if ((first_version | second_version) & 1) {
+                continue;   // A writer is changing these buckets
+            }
+
+            const bool found = locate(table, p, key, words).slot != NO_SLOT;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (first.version.load(std::memory_order_relaxed) == first_version &&
+                second.version.load(std::memory_order_relaxed) == second_version) {
+                return found;
+            }
+        }
+
+        // Persistent interference: read under the stripe locks
+        for (int attempt = 0; attempt < MAX_WRITE_ATTEMPTS; ++attempt) {
+            const Table* table = table_.load(std::memory_order_acquire);
+            const Probe p = probe(table, hash);
+            StripeLocks locks(*this, table, p.first, p.second);
+            if (locks) {
+                return locate(table, p, key, words).slot != NO_SLOT;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Shared implementation of insert and insert_or_assign.
+     */
+    bool upsert(const Key& key, const Value& value, bool assign) {
+        auto section = rcu_.read();
+        const size_t hash = hasher_(key);
+        const EntryWords entry = pack(key, value);
+
+        for (int attempt = 0; attempt < MAX_WRITE_ATTEMPTS; ++attempt) {
+            Table* table = table_.load(std::memory_order_acquire);
+            const Probe p = probe(table, hash);
+            {
+                StripeLocks locks(*this, table, p.first, p.second);
+                if (!locks) {
+                    continue;   // Table was replaced; retry on the new one
+                }
+                EntryWords existing;
+                const Location location = locate(table, p, key, existing);
+                if (location.slot != NO_SLOT) {
+                    if (assign) {
+                        write_entry(table, location.bucket, location.slot, entry);
+                    }
+                    return assign;
+                }
+                if (place(table, p.first, entry, p.tag) || place(table, p.second, entry, p.tag)) {
+                    size_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            // Both buckets are full: shift entries out of the way or grow
+            if (!make_room(table, p)) {
+                grow(table);
+            }
+        }
+        return false;
+    }
+
+    static size_t normalize_bucket_count(size_t capacity) {
+        size_t count = MIN_BUCKET_COUNT;
+        while (count * SlotsPerBucket < capacity) {
+            count *= 2;
+        }
+        return count;
+    }
+
+public:
+    /**
+     * @brief Constructor with a capacity hint.
+     *
+     * @param initial_capacity Number of entries the table can hold before its first resize
+     *        (rounded up so bucket_count() is a power of two)
+     * @complexity O(initial_capacity)
+     * @thread_safety Safe
+     */
+    explicit AtomicCuckooHashMap(size_t initial_capacity = 1024)
+        : table_(new Table(normalize_bucket_count(initial_capacity))),
+          rcu_(QsbrDomain::global()) {}
+
+    /**
+     * @brief Destructor. Frees the current table; replaced tables are freed by QsbrDomain.
+     *
+     * @complexity O(1)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicCuckooHashMap() {
+        delete table_.load(std::memory_order_acquire);
+    }
+
+    // Non-copyable and non-movable
+    AtomicCuckooHashMap(const AtomicCuckooHashMap&) = delete;
+    AtomicCuckooHashMap& operator=(const AtomicCuckooHashMap&) = delete;
+    AtomicCuckooHashMap(AtomicCuckooHashMap&&) = delete;
+    AtomicCuckooHashMap& operator=(AtomicCuckooHashMap&&) = delete;
+
+    /**
+     * @brief Insert a key-value pair if the key is not present.
+     *
+     * @param key The key to insert
+     * @param value The value to associate with the key
+     * @return true if inserted, false if the key exists (or after MAX_WRITE_ATTEMPTS)
+     * @complexity O(1) expected, O(n) when the insert triggers a resize
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - only a resize allocates, before anything is published
+     */
+    bool insert(const Key& key, const Value& value) {
+        return upsert(key, value, false);
+    }
+
+    /**
+     * @brief Insert a key-value pair or overwrite the existing value in place.
+     *
+     * @param key The key to write
+     * @param value The value to associate with the key
+     * @return true if the map was updated (false only after MAX_WRITE_ATTEMPTS)
+     * @complexity O(1) expected, O(n) when the insert triggers a resize
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - only a resize allocates, before anything is published
+     */
+    bool insert_or_assign(const Key& key, const Value& value) {
+        return upsert(key, value, true);
+    }
+
+    /**
+     * @brief Find the value associated with a key.
+     *
+     * @param key The key to search for
+     * @param result Reference to store the found value
+     * @return true if the key was found and its value copied to result
+     * @complexity O(1) worst case - two buckets
+     * @thread_safety Safe - lock-free unless a read keeps colliding with writers
+     * @exception_safety No-throw guarantee
+     */
+    bool find(const Key& key, Value& result) const {
+        EntryWords words;
+        if (!read(key, words)) {
+            return false;
+        }
+        result = value_of(words);
+        return true;
+    }
+
+    /**
+     * @brief Check if the map contains a key.
+     *
+     * @param key The key to search for
+     * @return true if the key is present
+     * @complexity O(1) worst case - two buckets
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool contains(const Key& key) const {
+        EntryWords words;
+        return read(key, words);
+    }
+
+    /**
+     * @brief Remove a key.
+     *
+     * @param key The key to remove
+     * @return true if the key was present and removed, false otherwise
+     * @complexity O(1) worst case - two buckets
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool erase(const Key& key) {
+        auto section = rcu_.read();
+        const size_t hash = hasher_(key);
+
+        for (int attempt = 0; attempt < MAX_WRITE_ATTEMPTS; ++attempt) {
+            Table* table = table_.load(std::memory_order_acquire);
+            const Probe p = probe(table, hash);
+            StripeLocks locks(*this, table, p.first, p.second);
+            if (!locks) {
+                continue;
+            }
+            EntryWords words;
+            const Location location = locate(table, p, key, words);
+            if (location.slot == NO_SLOT) {
+                return false;
+            }
+            set_tag(table, location.bucket, location.slot, 0);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get the number of entries.
+     *
+     * @return Approximate number of entries (exact when no writes are in flight)
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return true if the map holds no entries
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of buckets in the current table.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t bucket_count() const {
+        auto section = rcu_.read();
+        return table_.load(std::memory_order_acquire)->bucket_mask + 1;
+    }
+
+    /**
+     * @brief Get the number of slots in the current table.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return bucket_count() * SlotsPerBucket;
+    }
+
+    /**
+     * @brief Get the current load factor.
+     *
+     * @return size() / capacity(), between 0 and 1
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    double load_factor() const {
+        return static_cast<double>(size()) / capacity();
+    }
+
+    /**
+     * @brief Declare that the calling thread will not use the map for a while.
+     *
+     * Lets a replaced table be freed without waiting for this thread's next operation.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    void offline() const {
+        rcu_.offline();
+    }
+};
+
+} // namespace lockfree
@@ -5,9 +5,26 @@
 #include <functional>
 #include <vector>
 #include <type_traits>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include "binary_io.hpp"
+#include "hash.hpp"
+#include "prefetch.hpp"
 
 namespace lockfree {
 
+/**
+ * @brief How AtomicHashMap::load_snapshot() makes snapshot entries visible.
+ */
+enum class SnapshotMode {
+    EAGER,  ///< Decode every record into nodes before returning
+    LAZY    ///< Serve reads from the mapped file; promote a bucket to nodes on first write
+};
+
 /**
  * @brief A lock-free, thread-safe hash map implementation using separate chaining.
  * 
@@ -18,7 +35,7 @@ namespace lockfree {
  * 
  * @tparam Key The type of keys. Must be hashable and comparable.
  * @tparam Value The type of values stored. Must be constructible and destructible.
- * @tparam Hash Hash function for keys. Defaults to std::hash<Key>.
+ * @tparam Hash Hash function for keys. Defaults to Hasher<Key> (hash.hpp).
  * @tparam KeyEqual Equality comparison for keys. Defaults to std::equal_to<Key>.
  * 
  * Key Features:
@@ -39,6 +56,9 @@ namespace lockfree {
  * 
  * Algorithm Details:
  * - Uses separate chaining with linked lists for collision resolution
+ * - Each node caches its key's full hash; KeyEqual only runs when the hashes match
+ * - find_batch()/contains_batch() hash a group of keys, prefetch all their bucket
+ *   heads, then all their first nodes, so the misses of one group overlap
  * - Logical deletion (marking) for safe concurrent access
  * - Compare-and-swap operations for atomic pointer updates
  * - Load factor monitoring for performance optimization
@@ -80,39 +100,54 @@ namespace lockfree {
  * }
  * @endcode
  * 
+ * Snapshots:
+ * - save_snapshot() dumps the live entries bucket-parallel while writers keep running
+ * - load_snapshot() maps a snapshot file and bulk-publishes whole bucket chains
+ * - SnapshotMode::LAZY answers reads straight from the mapped file (trivially copyable
+ *   keys and values only) and promotes a bucket to nodes the first time it is written
+ *
  * @note This implementation uses logical deletion for safe concurrent access.
  * @note This implementation provides reliable concurrent access for fixed-capacity use cases.
+ * @note Snapshots store keys by bucket together with a fingerprint of the hash
+ *       function that wrote them. A map whose Hash disagrees rehashes every record
+ *       on load instead of trusting the saved buckets (SnapshotMode::LAZY then
+ *       falls back to SnapshotMode::EAGER).
  */
-template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+template<typename Key, typename Value, typename Hash = Hasher<Key>, typename KeyEqual = std::equal_to<Key>>
 class AtomicHashMap {
 private:
     /**
      * @brief Internal node structure for key-value pairs.
      * 
-     * Each node contains a key-value pair, an atomic pointer to the next node
-     * in the collision chain, and an atomic deletion flag for logical deletion.
+     * Each node contains a key-value pair, the full hash of its key, an atomic
+     * pointer to the next node in the collision chain, and an atomic deletion flag
+     * for logical deletion. The chain fields come first so that walking past a
+     * mismatching node only reads its first cache line and never the key itself.
      */
     struct Node {
-        Key key;                        ///< The stored key
-        Value value;                    ///< The stored value
+        size_t hash;                    ///< Cached hash_key(key), compared before the key
         std::atomic<Node*> next;        ///< Atomic pointer to next node in bucket chain
         std::atomic<bool> deleted;      ///< Atomic flag indicating logical deletion
+        Key key;                        ///< The stored key
+        Value value;                    ///< The stored value
         
         /**
          * @brief Construct node with copied key and value.
+         * @param h Hash of the key
          * @param k The key to copy
          * @param v The value to copy
          */
-        Node(const Key& k, const Value& v) 
-            : key(k), value(v), next(nullptr), deleted(false) {}
+        Node(size_t h, const Key& k, const Value& v) 
+            : hash(h), next(nullptr), deleted(false), key(k), value(v) {}
         
         /**
          * @brief Construct node with moved key and value.
+         * @param h Hash of the key
          * @param k The key to move
          * @param v The value to move
          */
-        Node(Key&& k, Value&& v) 
-            : key(std::move(k)), value(std::move(v)), next(nullptr), deleted(false) {}
+        Node(size_t h, Key&& k, Value&& v) 
+            : hash(h), next(nullptr), deleted(false), key(std::move(k)), value(std::move(v)) {}
     };
     
     /**
@@ -129,6 +164,7 @@ private:
     
     static constexpr size_t INITIAL_BUCKET_COUNT = 1024;     ///< Increased from 16 for better performance
     static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 50;    ///< Reduced from 75 for optimal performance
+    static constexpr size_t BATCH_GROUP_SIZE = 16;           ///< Keys whose misses a batched lookup overlaps
     
     std::vector<Bucket> buckets_;           ///< Dynamic array of hash table buckets
     std::atomic<size_t> size_;              ///< Atomic counter for number of key-value pairs
@@ -144,19 +180,46 @@ private:
     size_t hash_key(const Key& key) const;
     
     /**
-     * @brief Get bucket index for a key.
-     * @param key The key to get bucket index for
+     * @brief Get bucket index for a hash value.
+     * @param hash Hash value from hash_key()
      * @return Bucket index (0 to bucket_count-1)
      */
-    size_t get_bucket_index(const Key& key) const;
+    size_t get_bucket_index(size_t hash) const;
+    
+    /**
+     * @brief Check whether a node holds a key, comparing the cached hash first.
+     * @param node The node to test
+     * @param key The key to compare against
+     * @param hash Hash of key
+     * @return true if the node's key equals key
+     */
+    bool node_matches(const Node* node, const Key& key, size_t hash) const;
     
     /**
      * @brief Find node with matching key in a bucket.
      * @param key The key to search for
+     * @param hash Hash of key
      * @param bucket The bucket to search in
      * @return Pointer to matching node or nullptr if not found
      */
-    Node* find_node(const Key& key, Bucket& bucket) const;
+    Node* find_node(const Key& key, size_t hash, Bucket& bucket) const;
+    
+    /**
+     * @brief Find node with matching key in a chain.
+     * @param head First node of the chain (may be nullptr)
+     * @param key The key to search for
+     * @param hash Hash of key
+     * @return Pointer to matching node or nullptr if not found
+     */
+    Node* find_in_chain(Node* head, const Key& key, size_t hash) const;
+    
+    /**
+     * @brief Shared implementation of find_batch() and contains_batch().
+     * @param on_hit Called as on_hit(index, node) for every key that is present
+     * @return Number of keys found
+     */
+    template<typename OnHit>
+    size_t lookup_batch(const Key* keys, size_t count, bool* out_found, OnHit&& on_hit) const;
     
     /**
      * @brief Check if resize is needed based on load factor.
@@ -169,6 +232,139 @@ private:
      */
     void resize_if_needed();
     
+    using KeyCodec = io::Codec<Key>;
+    using ValueCodec = io::Codec<Value>;
+    
+    /// Fixed-size records can be queried in place, which SnapshotMode::LAZY relies on
+    static constexpr bool SNAPSHOT_ZERO_COPY = KeyCodec::fixed_size && ValueCodec::fixed_size;
+    
+    static constexpr char SNAPSHOT_MAGIC[8] = {'L', 'F', 'H', 'M', 'S', 'N', 'A', 'P'};
+    static constexpr uint32_t SNAPSHOT_VERSION = 2;
+    static constexpr uint16_t SNAPSHOT_BYTE_ORDER = 0x0102; ///< Reads back as 0x0201 on a host of the other byte order
+    static constexpr uint16_t SNAPSHOT_FIXED_RECORDS = 1;   ///< Header flag: all records have the same size
+    static constexpr size_t SNAPSHOT_CHUNK_BUCKETS = 4096;  ///< Buckets handed to a worker at a time
+    static constexpr size_t SNAPSHOT_FINGERPRINT_RECORDS = 4;   ///< Leading records whose hashes fingerprint Hash
+    
+    /**
+     * @brief On-disk snapshot header, followed by the bucket index and the records.
+     * 
+     * The index holds bucket_count + 1 byte offsets (relative to data_offset) so that
+     * the records of bucket b occupy [index[b], index[b + 1]).
+     */
+    struct SnapshotHeader {
+        char magic[8];              ///< SNAPSHOT_MAGIC
+        uint32_t version;           ///< SNAPSHOT_VERSION
+        uint16_t byte_order;        ///< SNAPSHOT_BYTE_ORDER as written by the saving host
+        uint16_t flags;             ///< SNAPSHOT_FIXED_RECORDS or 0
+        uint32_t key_size;          ///< Encoded key size for fixed records, 0 otherwise
+        uint32_t value_size;        ///< Encoded value size for fixed records, 0 otherwise
+        uint64_t bucket_count;      ///< Bucket count of the map that wrote the snapshot
+        uint64_t entry_count;       ///< Number of records
+        uint64_t data_offset;       ///< File offset of the first record
+        uint64_t data_size;         ///< Total size of all records in bytes
+        uint64_t hash_fingerprint;  ///< Hashes of the first SNAPSHOT_FINGERPRINT_RECORDS records, folded
+    };
+    static_assert(sizeof(SnapshotHeader) == 64, "SnapshotHeader must stay 64 bytes");
+    
+    /**
+     * @brief Validated view of a mapped snapshot file.
+     */
+    struct SnapshotView {
+        const uint64_t* index = nullptr;    ///< Per-bucket record offsets
+        const char* data = nullptr;         ///< First record
+        uint64_t bucket_count = 0;          ///< Bucket count recorded in the header
+        uint64_t entry_count = 0;           ///< Number of records
+        uint64_t hash_fingerprint = 0;      ///< Fingerprint recorded in the header
+    };
+    
+    /**
+     * @brief Mapped snapshot attached in SnapshotMode::LAZY.
+     * 
+     * Until promoted[b] is set, bucket b has no live nodes and is answered from the
+     * mapped records. Every write promotes its bucket first, so a live chain never
+     * coexists with unpromoted records of the same bucket.
+     */
+    struct LazySnapshot {
+        io::MappedFile file;                                ///< Keeps the records mapped
+        SnapshotView view;                                  ///< Parsed header and index
+        std::unique_ptr<std::atomic<bool>[]> promoted;      ///< Per-bucket promotion flags
+    };
+    
+    std::unique_ptr<LazySnapshot> lazy_;    ///< Attached lazy snapshot, nullptr when none
+    
+    /**
+     * @brief Check that a mapped file is a snapshot this map can decode.
+     * @param file The mapped file
+     * @param view Receives the parsed layout on success
+     * @return true if the header, index and record sizes are consistent
+     */
+    static bool parse_snapshot(const io::MappedFile& file, SnapshotView& view);
+    
+    /**
+     * @brief Fold this map's hashes of a snapshot's first records, in file order.
+     * 
+     * Records are placed by the bucket they were saved in only if the result
+     * matches the header, i.e. this map's Hash agrees with the writer's.
+     * @param view Parsed snapshot
+     * @return hash_combine() of up to SNAPSHOT_FINGERPRINT_RECORDS key hashes
+     */
+    uint64_t snapshot_fingerprint(const SnapshotView& view) const;
+    
+    /**
+     * @brief Run fn(chunk) for every chunk in [0, chunk_count) on up to num_threads threads.
+     * @param num_threads Requested worker count (0 selects hardware concurrency)
+     * @param chunk_count Number of chunks to process
+     * @param fn Callable invoked once per chunk; chunks are claimed in increasing order
+     */
+    template<typename Func>
+    static void parallel_chunks(size_t num_threads, size_t chunk_count, Func&& fn);
+    
+    /**
+     * @brief Prepend a privately built chain to a bucket.
+     * 
+     * Nodes whose key was inserted concurrently are dropped from the chain before
+     * each retry, so the splice never introduces duplicate keys.
+     * 
+     * @param bucket Destination bucket
+     * @param first First node of the private chain
+     * @param last Last node of the private chain
+     * @param count Number of nodes in the chain
+     */
+    void splice_chain(Bucket& bucket, Node* first, Node* last, size_t count);
+    
+    /**
+     * @brief Decode the records of one snapshot bucket and publish them.
+     * @param view Snapshot being loaded
+     * @param source_bucket Bucket index within the snapshot
+     * @param same_layout true if the snapshot and this map have the same bucket count
+     */
+    void publish_snapshot_bucket(const SnapshotView& view, size_t source_bucket, bool same_layout);
+    
+    /**
+     * @brief Locate a key among the unpromoted records of a lazy snapshot bucket.
+     * @param key The key to search for
+     * @param bucket_index Bucket the key hashes to
+     * @return Pointer to the encoded value, or nullptr if the key is not in the bucket
+     */
+    const char* find_snapshot_record(const Key& key, size_t bucket_index) const;
+    
+    /**
+     * @brief Check whether a bucket must still be answered from the lazy snapshot.
+     * @param bucket_index Bucket to check
+     * @return true if a lazy snapshot is attached and the bucket is not promoted yet
+     */
+    bool in_lazy_snapshot(size_t bucket_index) const;
+    
+    /**
+     * @brief Materialize the lazy snapshot records of a bucket as nodes.
+     * 
+     * Several threads may race to promote the same bucket; only one chain is
+     * published and the others are discarded.
+     * 
+     * @param bucket_index Bucket to promote
+     */
+    void promote_bucket(size_t bucket_index);
+    
 public:
     /**
      * @brief Default constructor. Creates an empty hash map with default bucket count.
@@ -292,6 +488,41 @@ public:
     template<typename Func>
     bool find_if(const Key& key, Func&& func) const;
     
+    /**
+     * @brief Look up many keys at once, overlapping their cache misses.
+     * 
+     * Keys are processed in groups of BATCH_GROUP_SIZE: every key of a group is
+     * hashed and its bucket head prefetched, then every head is read and its first
+     * node prefetched, and only then are the chains walked. Independent lookups thus
+     * wait on memory together instead of one after another.
+     * 
+     * @param keys Array of count keys to look up
+     * @param count Number of keys
+     * @param out_values Array of count values; out_values[i] receives the value of
+     *        keys[i] if it is found and is left untouched otherwise
+     * @param out_found Array of count flags; out_found[i] is set to whether keys[i] was found
+     * @return Number of keys found
+     * @complexity O(count) average
+     * @thread_safety Safe - each key is looked up as by find()
+     * @exception_safety Basic guarantee - depends on Value's copy assignment
+     */
+    size_t find_batch(const Key* keys, size_t count, Value* out_values, bool* out_found) const;
+    
+    /**
+     * @brief Check many keys at once, overlapping their cache misses.
+     * 
+     * @param keys Array of count keys to check
+     * @param count Number of keys
+     * @param out_found Array of count flags; out_found[i] is set to whether keys[i] is present
+     * @return Number of keys present
+     * @complexity O(count) average
+     * @thread_safety Safe - each key is checked as by contains()
+     * @exception_safety No-throw guarantee
+     * 
+     * @see find_batch() for how lookups are interleaved.
+     */
+    size_t contains_batch(const Key* keys, size_t count, bool* out_found) const;
+    
     /**
      * @brief Remove a key-value pair from the hash map.
      * 
@@ -354,6 +585,94 @@ public:
      */
     double load_factor() const;
     
+    /**
+     * @brief Write all live key-value pairs to a snapshot file.
+     * 
+     * Buckets are split into chunks that worker threads encode in parallel and
+     * append to the file in bucket order, so memory use stays bounded by the
+     * chunks in flight. Writers are never blocked; each bucket chain is captured
+     * as it is at the moment its worker walks it, so entries inserted or erased
+     * during the save may or may not appear. Buckets still served from an
+     * attached lazy snapshot are copied from the mapped records without
+     * promoting them.
+     * 
+     * @param path Destination file, replaced only once the new snapshot is complete
+     * @param num_threads Number of worker threads, 0 for hardware concurrency
+     * @return true if the whole snapshot was written, false on I/O error
+     * @complexity O(n + m) where n is key-value pairs, m is buckets
+     * @thread_safety Safe with concurrent reads and writes
+     * @exception_safety Basic guarantee - path is untouched on failure, but an exception
+     *                    may leave path + ".tmp" behind
+     * 
+     * @note The file is written to path + ".tmp" and renamed over path, so saving to
+     *       the file this map has attached as a lazy snapshot is safe.
+     * @note Key and Value need an io::Codec: trivially copyable types and
+     *       std::basic_string are supported out of the box.
+     * @note Records are raw host-order bytes. The header carries a byte-order
+     *       marker, so a host of the other byte order rejects the file.
+     */
+    bool save_snapshot(const std::string& path, size_t num_threads = 0) const;
+    
+    /**
+     * @brief Load the entries of a snapshot file into the map.
+     * 
+     * The file is memory-mapped. In SnapshotMode::EAGER each snapshot bucket is
+     * decoded into a private chain and published with a single CAS, in parallel
+     * across buckets. In SnapshotMode::LAZY the mapping is attached instead and
+     * lookups read records directly from it until a write (or promote_snapshot())
+     * converts the bucket into nodes, making the map ready immediately.
+     * 
+     * Keys already present in the map are kept and the snapshot copy is skipped.
+     * 
+     * @param path Snapshot file written by save_snapshot()
+     * @param mode EAGER to publish all entries now, LAZY to serve them from the mapping
+     * @param num_threads Number of worker threads for EAGER loading, 0 for hardware concurrency
+     * @return true if the snapshot was loaded, false if the file is missing, not a
+     *         compatible snapshot, written with the other byte order, or corrupt
+     * @complexity EAGER: O(n) work spread across threads; LAZY: O(m) to validate the index
+     * @thread_safety EAGER is safe with concurrent access. LAZY must be requested before
+     *                the map is shared with other threads.
+     * @exception_safety Basic guarantee - entries published before a failure remain
+     * 
+     * @note LAZY needs trivially copyable Key and Value, an empty map, the same
+     *       bucket count as the saved map and a Hash whose fingerprint matches the
+     *       file's; otherwise the load silently falls back to EAGER.
+     */
+    bool load_snapshot(const std::string& path, SnapshotMode mode = SnapshotMode::EAGER,
+                       size_t num_threads = 0);
+    
+    /**
+     * @brief Convert every bucket still served from a lazy snapshot into nodes.
+     * 
+     * @param num_threads Number of worker threads, 0 for hardware concurrency
+     * @complexity O(n + m)
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee
+     * 
+     * @note No-op when no lazy snapshot is attached. The mapping stays open because
+     *       concurrent readers may still be reading it; see release_snapshot().
+     */
+    void promote_snapshot(size_t num_threads = 0);
+    
+    /**
+     * @brief Promote any remaining lazy snapshot buckets and unmap the file.
+     * 
+     * @complexity O(n + m)
+     * @thread_safety Not safe - no other thread may access the map during the call
+     * @exception_safety Basic guarantee
+     */
+    void release_snapshot();
+    
+    /**
+     * @brief Check whether a lazy snapshot mapping is attached.
+     * 
+     * @return true if load_snapshot() attached a mapping that has not been released
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool snapshot_attached() const;
+    
     /**
      * @brief Forward iterator for traversing the hash map.
      * 
@@ -412,6 +731,10 @@ public:
      * 
      * @return Iterator pointing to first active key-value pair, or end() if hash map is empty
      * @complexity O(bucket_count) worst case - may need to skip empty buckets
+     * 
+     * @note Iteration only visits nodes. Entries still served from an attached lazy
+     *       snapshot are skipped, so call promote_snapshot() (or release_snapshot())
+     *       before iterating a map loaded with SnapshotMode::LAZY.
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
      */
@@ -454,20 +777,32 @@ size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::hash_key(const Key& key) const
 }
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
-size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::get_bucket_index(const Key& key) const {
-    return hash_key(key) % bucket_count_.load(std::memory_order_acquire);
+size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::get_bucket_index(size_t hash) const {
+    return hash % bucket_count_.load(std::memory_order_acquire);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::node_matches(const Node* node, const Key& key, size_t hash) const {
+    // Different hashes prove different keys without touching the key's storage
+    return node->hash == hash && key_equal_(node->key, key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename AtomicHashMap<Key, Value, Hash, KeyEqual>::Node* 
+AtomicHashMap<Key, Value, Hash, KeyEqual>::find_node(const Key& key, size_t hash, Bucket& bucket) const {
+    return find_in_chain(bucket.head.load(std::memory_order_acquire), key, hash);
 }
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 typename AtomicHashMap<Key, Value, Hash, KeyEqual>::Node* 
-AtomicHashMap<Key, Value, Hash, KeyEqual>::find_node(const Key& key, Bucket& bucket) const {
-    Node* current = bucket.head.load(std::memory_order_acquire);
+AtomicHashMap<Key, Value, Hash, KeyEqual>::find_in_chain(Node* head, const Key& key, size_t hash) const {
+    Node* current = head;
     
     while (current) {
         // Check if current node matches and is not deleted
         // Use relaxed ordering for better performance in hot path
         if (!current->deleted.load(std::memory_order_relaxed) && 
-            key_equal_(current->key, key)) {
+            node_matches(current, key, hash)) {
             return current;
         }
         
@@ -479,30 +814,45 @@ AtomicHashMap<Key, Value, Hash, KeyEqual>::find_node(const Key& key, Bucket& buc
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::insert(const Key& key, const Value& value) {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (lazy_) {
+            promote_bucket(bucket_index);
+        }
+    }
+    
     // Pre-check for existing key using optimized find
-    if (find_node(key, bucket) != nullptr) {
+    Node* checked = bucket.head.load(std::memory_order_acquire);
+    if (find_in_chain(checked, key, hash) != nullptr) {
         return false; // Key already exists
     }
     
-    Node* new_node = new Node(key, value);
+    Node* new_node = new Node(hash, key, value);
+    Node* head = checked;
     
     // Try to insert at head of bucket using compare_exchange
     for (int attempts = 0; attempts < 100; ++attempts) { // Reduced from 1000
-        Node* head = bucket.head.load(std::memory_order_acquire);
-        
         // Try to insert at head
         new_node->next.store(head, std::memory_order_relaxed);
         
         if (bucket.head.compare_exchange_weak(head, new_node,
                                             std::memory_order_release,
-                                            std::memory_order_relaxed)) {
+                                            std::memory_order_acquire)) {
             size_.fetch_add(1, std::memory_order_relaxed);
             return true;
         }
-        // If CAS failed, head changed, so retry
+        
+        // If CAS failed, head changed: nodes prepended since the last check may carry our key
+        for (Node* node = head; node != checked; node = node->next.load(std::memory_order_acquire)) {
+            if (!node->deleted.load(std::memory_order_acquire) && node_matches(node, key, hash)) {
+                delete new_node;
+                return false;
+            }
+        }
+        checked = head;
     }
     
     // Failed after max attempts
@@ -512,10 +862,17 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::insert(const Key& key, const Val
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::insert(Key&& key, Value&& value) {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
-    Node* new_node = new Node(std::move(key), std::move(value));
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (lazy_) {
+            promote_bucket(bucket_index);
+        }
+    }
+    
+    Node* new_node = new Node(hash, std::move(key), std::move(value));
     
     // Try to insert at head of bucket using compare_exchange
     for (int attempts = 0; attempts < 1000; ++attempts) {
@@ -525,7 +882,7 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::insert(Key&& key, Value&& value)
         Node* existing = head;
         while (existing) {
             if (!existing->deleted.load(std::memory_order_acquire) && 
-                key_equal_(existing->key, new_node->key)) {
+                node_matches(existing, new_node->key, hash)) {
                 // Key already exists
                 delete new_node;
                 return false;
@@ -558,10 +915,23 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::emplace(const Key& key, Args&&..
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::find(const Key& key, Value& result) const {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
+    
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (in_lazy_snapshot(bucket_index)) {
+            const char* record = find_snapshot_record(key, bucket_index);
+            if (record) {
+                result = io::read_pod<Value>(record);
+                return true;
+            }
+            return false;
+        }
+    }
+    
     Bucket& bucket = const_cast<Bucket&>(buckets_[bucket_index]);
     
-    Node* node = find_node(key, bucket);
+    Node* node = find_node(key, hash, bucket);
     if (node) {
         result = node->value;  // Copy or move the value
         return true;
@@ -572,20 +942,41 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::find(const Key& key, Value& resu
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::contains(const Key& key) const {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
+    
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (in_lazy_snapshot(bucket_index)) {
+            return find_snapshot_record(key, bucket_index) != nullptr;
+        }
+    }
+    
     Bucket& bucket = const_cast<Bucket&>(buckets_[bucket_index]);
     
-    Node* node = find_node(key, bucket);
+    Node* node = find_node(key, hash, bucket);
     return node != nullptr;
 }
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 template<typename Func>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::find_if(const Key& key, Func&& func) const {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
+    
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (in_lazy_snapshot(bucket_index)) {
+            const char* record = find_snapshot_record(key, bucket_index);
+            if (record) {
+                Value value = io::read_pod<Value>(record);
+                return func(value);
+            }
+            return false;
+        }
+    }
+    
     Bucket& bucket = const_cast<Bucket&>(buckets_[bucket_index]);
     
-    Node* node = find_node(key, bucket);
+    Node* node = find_node(key, hash, bucket);
     if (node) {
         return func(node->value);
     }
@@ -593,12 +984,92 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::find_if(const Key& key, Func&& f
     return false;
 }
 
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename OnHit>
+size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::lookup_batch(const Key* keys, size_t count, bool* out_found,
+                                                              OnHit&& on_hit) const {
+    size_t hashes[BATCH_GROUP_SIZE];
+    Node* heads[BATCH_GROUP_SIZE];
+    size_t found = 0;
+    const size_t buckets = bucket_count_.load(std::memory_order_acquire);
+    
+    for (size_t base = 0; base < count; base += BATCH_GROUP_SIZE) {
+        const size_t group = std::min(BATCH_GROUP_SIZE, count - base);
+        
+        // Stage 1: hash the group (vectorized for integer keys) and start loading the bucket heads
+        hash_batch(std::span<const Key>(keys + base, group), std::span<size_t>(hashes, group), hasher_);
+        for (size_t i = 0; i < group; ++i) {
+            prefetch_read(&buckets_[hashes[i] % buckets]);
+        }
+        
+        // Stage 2: read the heads and start loading the first node of every chain
+        for (size_t i = 0; i < group; ++i) {
+            heads[i] = buckets_[hashes[i] % buckets].head.load(std::memory_order_acquire);
+            if (heads[i]) {
+                prefetch_read(heads[i]);
+            }
+        }
+        
+        // Stage 3: walk the chains, whose first nodes are now cached or in flight
+        for (size_t i = 0; i < group; ++i) {
+            Node* node = find_in_chain(heads[i], keys[base + i], hashes[i]);
+            out_found[base + i] = node != nullptr;
+            if (node) {
+                on_hit(base + i, node);
+                ++found;
+            }
+        }
+    }
+    
+    return found;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::find_batch(const Key* keys, size_t count,
+                                                            Value* out_values, bool* out_found) const {
+    if (lazy_) {
+        // Buckets may still be served from the mapped snapshot
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            out_found[i] = find(keys[i], out_values[i]);
+            found += out_found[i] ? 1 : 0;
+        }
+        return found;
+    }
+    
+    return lookup_batch(keys, count, out_found, [out_values](size_t i, const Node* node) {
+        out_values[i] = node->value;
+    });
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t AtomicHashMap<Key, Value, Hash, KeyEqual>::contains_batch(const Key* keys, size_t count, bool* out_found) const {
+    if (lazy_) {
+        // Buckets may still be served from the mapped snapshot
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            out_found[i] = contains(keys[i]);
+            found += out_found[i] ? 1 : 0;
+        }
+        return found;
+    }
+    
+    return lookup_batch(keys, count, out_found, [](size_t, const Node*) {});
+}
+
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
-    size_t bucket_index = get_bucket_index(key);
+    size_t hash = hash_key(key);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
-    Node* node = find_node(key, bucket);
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (lazy_) {
+            promote_bucket(bucket_index);
+        }
+    }
+    
+    Node* node = find_node(key, hash, bucket);
     if (node) {
         bool expected = false;
         if (node->deleted.compare_exchange_strong(expected, true,
@@ -615,6 +1086,17 @@ bool AtomicHashMap<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
 
 template<typename Key, typename Value, typename Hash, typename KeyEqual>
 bool AtomicHashMap<Key, Value, Hash, KeyEqual>::empty() const {
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (lazy_) {
+            const SnapshotView& view = lazy_->view;
+            for (size_t i = 0; i < buckets_.size(); ++i) {
+                if (in_lazy_snapshot(i) && view.index[i] != view.index[i + 1]) {
+                    return false;  // Unpromoted snapshot records are live entries
+                }
+            }
+        }
+    }
+    
     for (const auto& bucket : buckets_) {
         Node* current = bucket.head.load(std::memory_order_acquire);
         while (current) {
@@ -714,4 +1196,483 @@ typename AtomicHashMap<Key, Value, Hash, KeyEqual>::iterator AtomicHashMap<Key,
     return iterator(this, buckets_.size(), nullptr);
 }
 
+// Snapshot implementation
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::parse_snapshot(const io::MappedFile& file, SnapshotView& view) {
+    if (file.size() < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    
+    SnapshotHeader header = io::read_pod<SnapshotHeader>(file.data());
+    if (!std::equal(std::begin(header.magic), std::end(header.magic), std::begin(SNAPSHOT_MAGIC)) ||
+        header.version != SNAPSHOT_VERSION || header.byte_order != SNAPSHOT_BYTE_ORDER ||
+        header.bucket_count == 0) {
+        return false;
+    }
+    
+    // Record layout must match what this instantiation would have written
+    if (((header.flags & SNAPSHOT_FIXED_RECORDS) != 0) != SNAPSHOT_ZERO_COPY) {
+        return false;
+    }
+    if (SNAPSHOT_ZERO_COPY && (header.key_size != KeyCodec::encoded_size || header.value_size != ValueCodec::encoded_size)) {
+        return false;
+    }
+    
+    // Bound bucket_count by the file before any arithmetic on it, so a corrupt
+    // header cannot wrap index_bytes around and pass the offset checks
+    const uint64_t body_bytes = file.size() - sizeof(SnapshotHeader);
+    if (header.bucket_count >= body_bytes / sizeof(uint64_t)) {
+        return false;
+    }
+    const uint64_t index_bytes = (header.bucket_count + 1) * sizeof(uint64_t);
+    if (header.data_offset != sizeof(SnapshotHeader) + index_bytes ||
+        header.data_size > file.size() - header.data_offset) {
+        return false;
+    }
+    
+    const uint64_t* index = reinterpret_cast<const uint64_t*>(file.data() + sizeof(SnapshotHeader));
+    if (index[0] != 0 || index[header.bucket_count] != header.data_size) {
+        return false;
+    }
+    for (uint64_t i = 0; i < header.bucket_count; ++i) {
+        if (index[i] > index[i + 1]) {
+            return false;
+        }
+    }
+    if (SNAPSHOT_ZERO_COPY) {
+        constexpr uint64_t record_size = KeyCodec::encoded_size + ValueCodec::encoded_size;
+        if (header.data_size % record_size != 0 || header.entry_count != header.data_size / record_size) {
+            return false;
+        }
+    }
+    
+    view.index = index;
+    view.data = file.data() + header.data_offset;
+    view.bucket_count = header.bucket_count;
+    view.entry_count = header.entry_count;
+    view.hash_fingerprint = header.hash_fingerprint;
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+uint64_t AtomicHashMap<Key, Value, Hash, KeyEqual>::snapshot_fingerprint(const SnapshotView& view) const {
+    const char* pos = view.data;
+    const char* end = view.data + view.index[view.bucket_count];
+    uint64_t fingerprint = 0;
+    for (size_t i = 0; i < SNAPSHOT_FINGERPRINT_RECORDS && pos && pos < end; ++i) {
+        Key key{};
+        Value value{};
+        pos = KeyCodec::decode(pos, end, key);
+        if (pos) {
+            pos = ValueCodec::decode(pos, end, value);
+        }
+        if (!pos) {
+            break;
+        }
+        fingerprint = hash_combine(fingerprint, hash_key(key));
+    }
+    return fingerprint;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename Func>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::parallel_chunks(size_t num_threads, size_t chunk_count, Func&& fn) {
+    if (num_threads == 0) {
+        num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    num_threads = std::min(num_threads, chunk_count);
+    
+    std::atomic<size_t> next_chunk{0};
+    auto worker = [&]() {
+        for (size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count;
+             chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+            fn(chunk);
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();  // The calling thread works too
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::splice_chain(Bucket& bucket, Node* first, Node* last, size_t count) {
+    Node* head = bucket.head.load(std::memory_order_acquire);
+    Node* checked = head;  // Nodes from here on were already compared against the chain
+    
+    while (first) {
+        last->next.store(head, std::memory_order_relaxed);
+        if (bucket.head.compare_exchange_weak(head, first,
+                                              std::memory_order_release,
+                                              std::memory_order_acquire)) {
+            size_.fetch_add(count, std::memory_order_relaxed);
+            return;
+        }
+        last->next.store(nullptr, std::memory_order_relaxed);
+        
+        // Nodes prepended since the last attempt may carry keys that are also in our chain
+        for (Node* live = head; live != checked; live = live->next.load(std::memory_order_acquire)) {
+            if (live->deleted.load(std::memory_order_acquire)) {
+                continue;
+            }
+            Node* prev = nullptr;
+            for (Node* node = first; node; prev = node, node = node->next.load(std::memory_order_relaxed)) {
+                if (node_matches(node, live->key, live->hash)) {
+                    Node* after = node->next.load(std::memory_order_relaxed);
+                    if (prev) {
+                        prev->next.store(after, std::memory_order_relaxed);
+                    } else {
+                        first = after;
+                    }
+                    if (node == last) {
+                        last = prev;
+                    }
+                    delete node;
+                    --count;
+                    break;
+                }
+            }
+        }
+        checked = head;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::publish_snapshot_bucket(const SnapshotView& view,
+                                                                        size_t source_bucket, bool same_layout) {
+    const char* pos = view.data + view.index[source_bucket];
+    const char* end = view.data + view.index[source_bucket + 1];
+    
+    Node* first = nullptr;
+    Node* last = nullptr;
+    size_t count = 0;
+    Bucket& bucket = buckets_[source_bucket % buckets_.size()];
+    
+    while (pos && pos < end) {
+        Key key{};
+        Value value{};
+        pos = KeyCodec::decode(pos, end, key);
+        if (pos) {
+            pos = ValueCodec::decode(pos, end, value);
+        }
+        if (!pos) {
+            break;  // Truncated record; parse_snapshot() only validates fixed-size layouts
+        }
+        
+        if (!same_layout) {
+            insert(std::move(key), std::move(value));
+            continue;
+        }
+        
+        size_t hash = hash_key(key);
+        if (find_node(key, hash, bucket)) {
+            continue;  // Existing entries win over the snapshot
+        }
+        bool duplicate = false;
+        for (Node* node = first; node; node = node->next.load(std::memory_order_relaxed)) {
+            if (node_matches(node, key, hash)) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate) {
+            continue;
+        }
+        
+        Node* node = new Node(hash, std::move(key), std::move(value));
+        if (last) {
+            last->next.store(node, std::memory_order_relaxed);
+        } else {
+            first = node;
+        }
+        last = node;
+        ++count;
+    }
+    
+    if (first) {
+        splice_chain(bucket, first, last, count);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::in_lazy_snapshot(size_t bucket_index) const {
+    return lazy_ && !lazy_->promoted[bucket_index].load(std::memory_order_acquire);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const char* AtomicHashMap<Key, Value, Hash, KeyEqual>::find_snapshot_record(const Key& key, size_t bucket_index) const {
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        constexpr size_t record_size = KeyCodec::encoded_size + ValueCodec::encoded_size;
+        const SnapshotView& view = lazy_->view;
+        const char* end = view.data + view.index[bucket_index + 1];
+        
+        for (const char* pos = view.data + view.index[bucket_index]; pos < end; pos += record_size) {
+            if (key_equal_(io::read_pod<Key>(pos), key)) {
+                return pos + KeyCodec::encoded_size;
+            }
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::promote_bucket(size_t bucket_index) {
+    std::atomic<bool>& promoted = lazy_->promoted[bucket_index];
+    if (promoted.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    const SnapshotView& view = lazy_->view;
+    const char* pos = view.data + view.index[bucket_index];
+    const char* end = view.data + view.index[bucket_index + 1];
+    
+    constexpr size_t record_size = KeyCodec::encoded_size + ValueCodec::encoded_size;
+    
+    Node* first = nullptr;
+    Node* last = nullptr;
+    for (; pos < end; pos += record_size) {
+        Key key = io::read_pod<Key>(pos);
+        size_t hash = hash_key(key);
+        Node* node = new Node(hash, std::move(key), io::read_pod<Value>(pos + KeyCodec::encoded_size));
+        if (last) {
+            last->next.store(node, std::memory_order_relaxed);
+        } else {
+            first = node;
+        }
+        last = node;
+    }
+    
+    // Unpromoted buckets have no live nodes, and chains never become empty again once
+    // published, so exactly one promoter can install its chain over nullptr.
+    Node* expected = nullptr;
+    if (first && !buckets_[bucket_index].head.compare_exchange_strong(expected, first,
+                                                                      std::memory_order_release,
+                                                                      std::memory_order_relaxed)) {
+        while (first) {
+            Node* next = first->next.load(std::memory_order_relaxed);
+            delete first;
+            first = next;
+        }
+    }
+    
+    promoted.store(true, std::memory_order_release);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::save_snapshot(const std::string& path, size_t num_threads) const {
+    static_assert(KeyCodec::supported && ValueCodec::supported,
+                  "save_snapshot requires an io::Codec for Key and Value");
+    
+    // Written under a temporary name so that a failed save keeps the previous file,
+    // and a lazy snapshot mapped from path stays intact for its readers.
+    const std::string temp_path = path + ".tmp";
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    
+    const size_t bucket_total = buckets_.size();
+    std::vector<uint64_t> index(bucket_total + 1, 0);
+    const uint64_t data_offset = sizeof(SnapshotHeader) + index.size() * sizeof(uint64_t);
+    out.seekp(static_cast<std::streamoff>(data_offset));
+    
+    // Workers encode chunks in parallel but append them strictly in chunk order,
+    // handing the file over through write_turn.
+    const size_t chunk_count = (bucket_total + SNAPSHOT_CHUNK_BUCKETS - 1) / SNAPSHOT_CHUNK_BUCKETS;
+    std::atomic<size_t> write_turn{0};
+    std::atomic<uint64_t> entries{0};
+    uint64_t written = 0;   // Only touched by the worker holding the turn
+    bool failed = false;    // Only touched by the worker holding the turn
+    uint64_t fingerprint = 0;           // Only touched by the worker holding the turn
+    size_t fingerprint_records = 0;     // Only touched by the worker holding the turn
+    
+    parallel_chunks(num_threads, chunk_count, [&](size_t chunk) {
+        size_t first_bucket = chunk * SNAPSHOT_CHUNK_BUCKETS;
+        size_t last_bucket = std::min(bucket_total, first_bucket + SNAPSHOT_CHUNK_BUCKETS);
+        
+        std::string buffer;
+        std::vector<uint64_t> bucket_bytes(last_bucket - first_bucket);
+        uint64_t chunk_entries = 0;
+        std::array<size_t, SNAPSHOT_FINGERPRINT_RECORDS> leading_hashes{};
+        
+        for (size_t b = first_bucket; b < last_bucket; ++b) {
+            size_t before = buffer.size();
+            if constexpr (SNAPSHOT_ZERO_COPY) {
+                if (in_lazy_snapshot(b)) {
+                    // Unpromoted records are already in the on-disk layout; copy them as is
+                    constexpr size_t record_size = KeyCodec::encoded_size + ValueCodec::encoded_size;
+                    const SnapshotView& view = lazy_->view;
+                    const char* pos = view.data + view.index[b];
+                    const char* end = view.data + view.index[b + 1];
+                    buffer.append(pos, end);
+                    for (; pos < end; pos += record_size) {
+                        if (chunk_entries < SNAPSHOT_FINGERPRINT_RECORDS) {
+                            leading_hashes[chunk_entries] = hash_key(io::read_pod<Key>(pos));
+                        }
+                        ++chunk_entries;
+                    }
+                    bucket_bytes[b - first_bucket] = buffer.size() - before;
+                    continue;
+                }
+            }
+            for (Node* node = buckets_[b].head.load(std::memory_order_acquire); node;
+                 node = node->next.load(std::memory_order_acquire)) {
+                if (node->deleted.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                KeyCodec::encode(node->key, buffer);
+                ValueCodec::encode(node->value, buffer);
+                if (chunk_entries < SNAPSHOT_FINGERPRINT_RECORDS) {
+                    leading_hashes[chunk_entries] = node->hash;
+                }
+                ++chunk_entries;
+            }
+            bucket_bytes[b - first_bucket] = buffer.size() - before;
+        }
+        
+        while (write_turn.load(std::memory_order_acquire) != chunk) {
+            std::this_thread::yield();
+        }
+        
+        for (size_t b = first_bucket; b < last_bucket; ++b) {
+            index[b] = written;
+            written += bucket_bytes[b - first_bucket];
+        }
+        if (!failed && !out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            failed = true;
+        }
+        for (uint64_t i = 0; i < chunk_entries && fingerprint_records < SNAPSHOT_FINGERPRINT_RECORDS; ++i) {
+            fingerprint = hash_combine(fingerprint, leading_hashes[i]);
+            ++fingerprint_records;
+        }
+        entries.fetch_add(chunk_entries, std::memory_order_relaxed);
+        write_turn.store(chunk + 1, std::memory_order_release);
+    });
+    
+    if (failed) {
+        out.close();
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    index[bucket_total] = written;
+    
+    SnapshotHeader header{};
+    std::copy(std::begin(SNAPSHOT_MAGIC), std::end(SNAPSHOT_MAGIC), header.magic);
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        header.flags = SNAPSHOT_FIXED_RECORDS;
+        header.key_size = static_cast<uint32_t>(KeyCodec::encoded_size);
+        header.value_size = static_cast<uint32_t>(ValueCodec::encoded_size);
+    }
+    header.bucket_count = bucket_total;
+    header.entry_count = entries.load(std::memory_order_relaxed);
+    header.data_offset = data_offset;
+    header.data_size = written;
+    header.hash_fingerprint = fingerprint;
+    
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()),
+              static_cast<std::streamsize>(index.size() * sizeof(uint64_t)));
+    out.flush();
+    bool ok = out.good();
+    out.close();
+    if (!ok) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::load_snapshot(const std::string& path, SnapshotMode mode,
+                                                              size_t num_threads) {
+    static_assert(KeyCodec::supported && ValueCodec::supported,
+                  "load_snapshot requires an io::Codec for Key and Value");
+    
+    if (mode == SnapshotMode::LAZY && (!SNAPSHOT_ZERO_COPY || lazy_ || size() != 0)) {
+        mode = SnapshotMode::EAGER;
+    }
+    
+    io::MappedFile file;
+    if (!file.open(path, mode == SnapshotMode::LAZY ? io::MappedFile::Access::RANDOM
+                                                    : io::MappedFile::Access::SEQUENTIAL)) {
+        return false;
+    }
+    SnapshotView view;
+    if (!parse_snapshot(file, view)) {
+        return false;
+    }
+    
+    // A map with another Hash (or an older file without a fingerprint) rehashes every record
+    const bool same_layout = view.bucket_count == buckets_.size() &&
+                             snapshot_fingerprint(view) == view.hash_fingerprint;
+    
+    if (SNAPSHOT_ZERO_COPY && mode == SnapshotMode::LAZY && same_layout && empty()) {
+        auto lazy = std::make_unique<LazySnapshot>();
+        lazy->promoted = std::make_unique<std::atomic<bool>[]>(buckets_.size());
+        for (size_t i = 0; i < buckets_.size(); ++i) {
+            lazy->promoted[i].store(false, std::memory_order_relaxed);
+        }
+        lazy->file = std::move(file);
+        lazy->view = view;  // Points into the mapping, which moved without relocating
+        size_.fetch_add(view.entry_count, std::memory_order_relaxed);
+        lazy_ = std::move(lazy);
+        return true;
+    }
+    
+    if (lazy_) {
+        promote_snapshot(num_threads);
+    }
+    
+    const size_t chunk_count = (view.bucket_count + SNAPSHOT_CHUNK_BUCKETS - 1) / SNAPSHOT_CHUNK_BUCKETS;
+    parallel_chunks(num_threads, chunk_count, [&](size_t chunk) {
+        size_t first_bucket = chunk * SNAPSHOT_CHUNK_BUCKETS;
+        size_t last_bucket = std::min<size_t>(view.bucket_count, first_bucket + SNAPSHOT_CHUNK_BUCKETS);
+        for (size_t b = first_bucket; b < last_bucket; ++b) {
+            publish_snapshot_bucket(view, b, same_layout);
+        }
+    });
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::promote_snapshot(size_t num_threads) {
+    if constexpr (SNAPSHOT_ZERO_COPY) {
+        if (!lazy_) {
+            return;
+        }
+        
+        const size_t bucket_total = buckets_.size();
+        const size_t chunk_count = (bucket_total + SNAPSHOT_CHUNK_BUCKETS - 1) / SNAPSHOT_CHUNK_BUCKETS;
+        parallel_chunks(num_threads, chunk_count, [&](size_t chunk) {
+            size_t first_bucket = chunk * SNAPSHOT_CHUNK_BUCKETS;
+            size_t last_bucket = std::min(bucket_total, first_bucket + SNAPSHOT_CHUNK_BUCKETS);
+            for (size_t b = first_bucket; b < last_bucket; ++b) {
+                promote_bucket(b);
+            }
+        });
+    } else {
+        (void)num_threads;  // Lazy snapshots are only attached for fixed-size records
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void AtomicHashMap<Key, Value, Hash, KeyEqual>::release_snapshot() {
+    promote_snapshot();
+    lazy_.reset();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool AtomicHashMap<Key, Value, Hash, KeyEqual>::snapshot_attached() const {
+    return lazy_ != nullptr;
+}
+
 } // namespace lockfree
\ No newline at end of file
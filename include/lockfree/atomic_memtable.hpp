@@ -0,0 +1,1063 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <limits>
+#include "atomic_skiplist.hpp"
+#include "atomic_bloomfilter.hpp"
+#include "binary_io.hpp"
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief Immutable sorted run: an on-disk, key-ordered file produced by a memtable flush.
+ *
+ * A run stores records in fixed-budget blocks, followed by a block index (first key and
+ * offset of every block) and a serialized AtomicBloomFilter over all keys. Opening a run
+ * maps the file and loads the index and filter into memory; point lookups then cost one
+ * filter probe, one binary search and a scan of a single block.
+ *
+ * File layout:
+ * - Data blocks: records of [u8 flags][key][u32 value bytes][value]
+ * - Block index: per block [u64 offset][u32 size][first key]
+ * - Bloom filter: AtomicBloomFilter::serialize() bytes
+ * - Footer: magic, version, counts and section offsets
+ *
+ * @tparam Key The key type. Must have an io::Codec and be hashable by Hasher (hash.hpp).
+ * @tparam Value The value type. Must have an io::Codec.
+ * @tparam Compare Key ordering. Must match the order the run was written in.
+ * @tparam BloomBits Bloom filter size in bits (power of 2).
+ * @tparam BloomHashes Number of Bloom filter hash functions.
+ *
+ * @note Runs are never modified after they are written, so all const members are safe
+ *       to call concurrently.
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+         size_t BloomBits = (1 << 23), size_t BloomHashes = 5>
+class SortedRun {
+private:
+    static_assert(io::Codec<Key>::supported, "SortedRun requires an io::Codec for Key");
+    static_assert(io::Codec<Value>::supported, "SortedRun requires an io::Codec for Value");
+
+    using KeyCodec = io::Codec<Key>;
+    using ValueCodec = io::Codec<Value>;
+    using BloomFilter = AtomicBloomFilter<Key, BloomBits, BloomHashes>;
+
+    static constexpr char RUN_MAGIC[8] = {'L', 'F', 'M', 'T', 'R', 'U', 'N', 'S'};
+    static constexpr uint32_t RUN_VERSION = 1;
+    static constexpr uint8_t RECORD_TOMBSTONE = 1;      ///< Record flag: key was erased
+
+    /**
+     * @brief Fixed-size trailer at the end of every run file.
+     */
+    struct Footer {
+        char magic[8];              ///< RUN_MAGIC
+        uint32_t version;           ///< RUN_VERSION
+        uint32_t reserved;          ///< Zero
+        uint64_t entry_count;       ///< Number of records
+        uint64_t block_count;       ///< Number of data blocks
+        uint64_t index_offset;      ///< File offset of the block index
+        uint64_t bloom_offset;      ///< File offset of the Bloom filter bits
+        uint64_t bloom_size;        ///< Size of the Bloom filter bits
+    };
+    static_assert(sizeof(Footer) == 56, "Footer layout must be stable");
+
+    io::MappedFile file_;                       ///< Mapped run file
+    std::string path_;                          ///< Path of the run file
+    std::vector<Key> first_keys_;               ///< First key of every block
+    std::vector<uint64_t> block_offsets_;       ///< File offset of every block
+    std::vector<uint32_t> block_sizes_;         ///< Size of every block
+    std::unique_ptr<BloomFilter> bloom_;        ///< Filter over every key in the run
+    size_t entry_count_ = 0;                    ///< Number of records
+    Compare comparator_;                        ///< Key ordering
+
+    /**
+     * @brief Decode one record header.
+     * @return Pointer past the record, or nullptr if the block is corrupt
+     */
+    static const char* decode_record(const char* pos, const char* end, Key& key, bool& tombstone,
+                                     const char*& value_pos, uint32_t& value_size) {
+        if (pos >= end) {
+            return nullptr;
+        }
+        tombstone = (static_cast<uint8_t>(*pos) & RECORD_TOMBSTONE) != 0;
+        pos = KeyCodec::decode(pos + 1, end, key);
+        if (!pos || static_cast<size_t>(end - pos) < sizeof(uint32_t)) {
+            return nullptr;
+        }
+        value_size = io::read_pod<uint32_t>(pos);
+        pos += sizeof(uint32_t);
+        if (static_cast<size_t>(end - pos) < value_size) {
+            return nullptr;
+        }
+        value_pos = pos;
+        return pos + value_size;
+    }
+
+    /**
+     * @brief Index of the block that may contain key, or block_count if none can.
+     */
+    size_t find_block(const Key& key) const {
+        auto it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key, comparator_);
+        if (it == first_keys_.begin()) {
+            return first_keys_.size();
+        }
+        return static_cast<size_t>(it - first_keys_.begin()) - 1;
+    }
+
+public:
+    /**
+     * @brief Result of a point lookup in a run.
+     */
+    enum class Lookup {
+        MISSING,    ///< The run holds no record for the key
+        FOUND,      ///< The run holds a live value for the key
+        DELETED     ///< The run holds a tombstone for the key
+    };
+
+    /**
+     * @brief Streams strictly increasing keys into a new run file.
+     *
+     * The file is written under a temporary name and renamed into place by finish(),
+     * so a crash mid-flush never leaves a truncated run behind. A writer destroyed
+     * without a successful finish() removes its temporary file.
+     */
+    class Writer {
+    public:
+        /**
+         * @brief Start writing a run.
+         * @param path Final path of the run file
+         * @param block_bytes Target size of a data block
+         */
+        Writer(std::string path, size_t block_bytes)
+            : path_(std::move(path)),
+              temp_path_(path_ + ".tmp"),
+              out_(temp_path_, std::ios::binary | std::ios::trunc),
+              block_bytes_(std::max<size_t>(block_bytes, 64)),
+              bloom_(std::make_unique<BloomFilter>()) {}
+
+        ~Writer() {
+            if (!finished_) {
+                out_.close();
+                std::remove(temp_path_.c_str());
+            }
+        }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        /**
+         * @brief Append a record. Keys must be added in strictly increasing order.
+         * @param key The record key
+         * @param value The value, or nullptr for a tombstone
+         * @return true if the record was buffered or written, false on I/O error
+         */
+        bool add(const Key& key, const Value* value) {
+            if (block_.empty()) {
+                first_key_ = key;
+            }
+            block_.push_back(static_cast<char>(value ? 0 : RECORD_TOMBSTONE));
+            KeyCodec::encode(key, block_);
+            size_t size_pos = block_.size();
+            io::append_pod(block_, uint32_t{0});
+            if (value) {
+                ValueCodec::encode(*value, block_);
+                uint32_t value_size = static_cast<uint32_t>(block_.size() - size_pos - sizeof(uint32_t));
+                std::memcpy(block_.data() + size_pos, &value_size, sizeof(value_size));
+            }
+            bloom_->insert(key);
+            ++entry_count_;
+            if (block_.size() >= block_bytes_) {
+                return flush_block();
+            }
+            return static_cast<bool>(out_);
+        }
+
+        /**
+         * @brief Write the index, filter and footer and move the file into place.
+         * @return true if the run is complete on disk
+         */
+        bool finish() {
+            if (!block_.empty() && !flush_block()) {
+                return false;
+            }
+
+            Footer footer{};
+            std::memcpy(footer.magic, RUN_MAGIC, sizeof(RUN_MAGIC));
+            footer.version = RUN_VERSION;
+            footer.entry_count = entry_count_;
+            footer.block_count = block_count_;
+            footer.index_offset = offset_;
+            footer.bloom_offset = offset_ + index_.size();
+
+            std::string tail = std::move(index_);
+            bloom_->serialize(tail);
+            footer.bloom_size = BloomFilter::serialized_size();
+            io::append_pod(tail, footer);
+
+            out_.write(tail.data(), static_cast<std::streamsize>(tail.size()));
+            out_.flush();
+            bool ok = static_cast<bool>(out_);
+            out_.close();
+            finished_ = ok && std::rename(temp_path_.c_str(), path_.c_str()) == 0;
+            return finished_;
+        }
+
+        /**
+         * @brief Number of records added so far.
+         */
+        size_t entry_count() const {
+            return entry_count_;
+        }
+
+    private:
+        /**
+         * @brief Write the buffered block and record it in the index.
+         */
+        bool flush_block() {
+            io::append_pod(index_, offset_);
+            io::append_pod(index_, static_cast<uint32_t>(block_.size()));
+            KeyCodec::encode(first_key_, index_);
+            out_.write(block_.data(), static_cast<std::streamsize>(block_.size()));
+            offset_ += block_.size();
+            ++block_count_;
+            block_.clear();
+            return static_cast<bool>(out_);
+        }
+
+        std::string path_;                      ///< Final path
+        std::string temp_path_;                 ///< Path written until finish()
+        std::ofstream out_;                     ///< Output stream
+        bool finished_ = false;                 ///< finish() moved the file into place
+        size_t block_bytes_;                    ///< Target block size
+        std::string block_;                     ///< Block being filled
+        std::string index_;                     ///< Encoded block index
+        Key first_key_{};                       ///< First key of the current block
+        uint64_t offset_ = 0;                   ///< Bytes written so far
+        uint64_t block_count_ = 0;              ///< Blocks written so far
+        size_t entry_count_ = 0;                ///< Records added so far
+        std::unique_ptr<BloomFilter> bloom_;    ///< Filter over the added keys
+    };
+
+    SortedRun() = default;
+    SortedRun(const SortedRun&) = delete;
+    SortedRun& operator=(const SortedRun&) = delete;
+
+    /**
+     * @brief Map a run file and load its index and Bloom filter.
+     *
+     * @param path Path of a file produced by Writer
+     * @return true if the file is a valid run, false if it is missing or corrupt
+     * @complexity O(blocks + BloomBits/64)
+     * @thread_safety Not safe - call before sharing the run
+     */
+    bool open(const std::string& path) {
+        if (!file_.open(path, io::MappedFile::Access::RANDOM) || file_.size() < sizeof(Footer)) {
+            return false;
+        }
+        const char* base = file_.data();
+        Footer footer = io::read_pod<Footer>(base + file_.size() - sizeof(Footer));
+        if (std::memcmp(footer.magic, RUN_MAGIC, sizeof(RUN_MAGIC)) != 0 ||
+            footer.version != RUN_VERSION ||
+            footer.index_offset > footer.bloom_offset ||
+            footer.bloom_offset + footer.bloom_size != file_.size() - sizeof(Footer)) {
+            return false;
+        }
+
+        first_keys_.clear();
+        block_offsets_.clear();
+        block_sizes_.clear();
+        const char* pos = base + footer.index_offset;
+        const char* end = base + footer.bloom_offset;
+        for (uint64_t i = 0; i < footer.block_count; ++i) {
+            if (static_cast<size_t>(end - pos) < sizeof(uint64_t) + sizeof(uint32_t)) {
+                return false;
+            }
+            uint64_t offset = io::read_pod<uint64_t>(pos);
+            uint32_t size = io::read_pod<uint32_t>(pos + sizeof(uint64_t));
+            pos += sizeof(uint64_t) + sizeof(uint32_t);
+            Key first{};
+            pos = KeyCodec::decode(pos, end, first);
+            if (!pos || offset + size > footer.index_offset) {
+                return false;
+            }
+            first_keys_.push_back(std::move(first));
+            block_offsets_.push_back(offset);
+            block_sizes_.push_back(size);
+        }
+
+        bloom_ = std::make_unique<BloomFilter>();
+        if (!bloom_->deserialize(base + footer.bloom_offset, footer.bloom_size)) {
+            return false;
+        }
+        entry_count_ = footer.entry_count;
+        path_ = path;
+        return true;
+    }
+
+    /**
+     * @brief Look up a key.
+     *
+     * @param key The key to search for
+     * @param result Receives the value when the lookup returns FOUND
+     * @return MISSING, FOUND or DELETED
+     * @complexity O(k + log blocks + block size) where k is the number of hash functions
+     * @thread_safety Safe
+     */
+    Lookup get(const Key& key, Value& result) const {
+        if (!bloom_ || !bloom_->contains(key)) {
+            return Lookup::MISSING;
+        }
+        size_t block = find_block(key);
+        if (block == first_keys_.size()) {
+            return Lookup::MISSING;
+        }
+
+        const char* pos = file_.data() + block_offsets_[block];
+        const char* end = pos + block_sizes_[block];
+        Key record_key{};
+        while (pos < end) {
+            bool tombstone;
+            const char* value_pos;
+            uint32_t value_size;
+            pos = decode_record(pos, end, record_key, tombstone, value_pos, value_size);
+            if (!pos || comparator_(key, record_key)) {
+                return Lookup::MISSING;     // Corrupt block, or passed the key's position
+            }
+            if (!comparator_(record_key, key)) {
+                if (tombstone) {
+                    return Lookup::DELETED;
+                }
+                return ValueCodec::decode(value_pos, value_pos + value_size, result)
+                    ? Lookup::FOUND : Lookup::MISSING;
+            }
+        }
+        return Lookup::MISSING;
+    }
+
+    /**
+     * @brief Visit every record with lo <= key <= hi in ascending order.
+     *
+     * @tparam Func Callable as bool(const Key&, const Value*); the value pointer is
+     *              nullptr for tombstones and returning false stops the scan
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @param func Visitor
+     * @complexity O(log blocks + k) where k is the number of records visited
+     * @thread_safety Safe
+     */
+    template<typename Func>
+    void range(const Key& lo, const Key& hi, Func&& func) const {
+        size_t block = find_block(lo);
+        if (block == first_keys_.size()) {
+            block = 0;  // lo sorts before every key in the run
+        }
+        Key record_key{};
+        Value value{};
+        for (; block < first_keys_.size(); ++block) {
+            const char* pos = file_.data() + block_offsets_[block];
+            const char* end = pos + block_sizes_[block];
+            while (pos < end) {
+                bool tombstone;
+                const char* value_pos;
+                uint32_t value_size;
+                pos = decode_record(pos, end, record_key, tombstone, value_pos, value_size);
+                if (!pos || comparator_(hi, record_key)) {
+                    return;
+                }
+                if (comparator_(record_key, lo)) {
+                    continue;
+                }
+                if (tombstone) {
+                    if (!func(static_cast<const Key&>(record_key), static_cast<const Value*>(nullptr))) {
+                        return;
+                    }
+                } else if (ValueCodec::decode(value_pos, value_pos + value_size, value)) {
+                    if (!func(static_cast<const Key&>(record_key), static_cast<const Value*>(&value))) {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Number of records (live values and tombstones) in the run.
+     */
+    size_t entry_count() const {
+        return entry_count_;
+    }
+
+    /**
+     * @brief Number of data blocks in the run.
+     */
+    size_t block_count() const {
+        return first_keys_.size();
+    }
+
+    /**
+     * @brief Path of the run file.
+     */
+    const std::string& path() const {
+        return path_;
+    }
+};
+
+/**
+ * @brief LSM-style write buffer: a lock-free skip-list memtable that flushes to sorted runs.
+ *
+ * Writes go to an active AtomicSkipList. When the active table grows past a byte
+ * threshold it is frozen by atomically swapping in a fresh table, so writers never wait
+ * for the copy-out. A background flusher streams each frozen table, in key order, into
+ * an immutable SortedRun file with a block index and a Bloom filter, then drops the
+ * table. Reads consult the active table, the frozen tables and the runs from newest to
+ * oldest and return the first version they find.
+ *
+ * Every write is stored under a unique (key, sequence) pair, so overwriting a key and
+ * erasing it (a tombstone record) are ordinary skip-list inserts that never conflict
+ * with each other. The set of tables and runs is published as an immutable version
+ * object; retired versions and flushed tables are freed through EpochDomain once no
+ * reader can still be using them.
+ *
+ * @tparam Key The key type. Must be default constructible, copyable, and have an
+ *             io::Codec and be hashable by Hasher (hash.hpp).
+ * @tparam Value The value type. Must be default constructible, copyable, and have an io::Codec.
+ * @tparam Compare Key ordering. Defaults to std::less<Key>.
+ * @tparam BloomBits Bloom filter size per run in bits (power of 2).
+ * @tparam BloomHashes Number of Bloom filter hash functions per run.
+ *
+ * Key Features:
+ * - Lock-free writes: put and erase are skip-list inserts; freezing is one CAS
+ * - Non-blocking flush: frozen tables stay readable while the flusher writes them out
+ * - Bloom filters and block indexes: point reads skip runs that cannot hold the key
+ * - Merged reads: get() and scan() see the newest version across tables and runs
+ * - Durable runs: run files are reopened when a memtable is created on the same directory
+ *
+ * Performance Characteristics:
+ * - put/erase: O(log n) average in the active table
+ * - get: O(T log n + R) where T is the number of tables and R the number of runs
+ * - scan: O(total records in range) with O(range) temporary memory
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicMemTable<uint64_t, std::string> table("/var/lib/app/lsm");
+ *
+ * table.put(42, "answer");
+ * table.erase(7);
+ *
+ * std::string value;
+ * if (table.get(42, value)) {
+ *     std::cout << value << std::endl;
+ * }
+ *
+ * table.flush();  // Persist everything buffered so far
+ * @endcode
+ *
+ * @note There is no write-ahead log: writes still in memtables are lost if the process
+ *       exits before flush(). Runs are not compacted, so reads slow down as runs accumulate.
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+         size_t BloomBits = (1 << 23), size_t BloomHashes = 5>
+class AtomicMemTable {
+public:
+    using Run = SortedRun<Key, Value, Compare, BloomBits, BloomHashes>;   ///< On-disk run type
+
+    static constexpr size_t DEFAULT_MEMTABLE_BYTES = 64 << 20;  ///< Freeze threshold
+    static constexpr size_t DEFAULT_BLOCK_BYTES = 4096;         ///< Target run block size
+
+private:
+    /**
+     * @brief Skip-list key: user key plus a sequence number, newest version first.
+     */
+    struct InternalKey {
+        Key key{};
+        uint64_t sequence = 0;
+    };
+
+    /**
+     * @brief Orders by user key ascending, then by sequence descending.
+     */
+    struct InternalCompare {
+        Compare less;
+
+        bool operator()(const InternalKey& a, const InternalKey& b) const {
+            if (less(a.key, b.key)) {
+                return true;
+            }
+            if (less(b.key, a.key)) {
+                return false;
+            }
+            return a.sequence > b.sequence;
+        }
+    };
+
+    /**
+     * @brief Skip-list value: the user value or a tombstone.
+     */
+    struct Record {
+        Value value{};
+        bool tombstone = false;
+    };
+
+    /**
+     * @brief A memtable: one skip list plus its approximate memory footprint.
+     */
+    struct MemTable {
+        AtomicSkipList<InternalKey, Record, InternalCompare> list;
+        std::atomic<size_t> bytes{0};
+    };
+
+    /**
+     * @brief Immutable snapshot of the tables and runs that make up the store.
+     */
+    struct Version {
+        MemTable* active = nullptr;                 ///< Table receiving writes
+        std::vector<MemTable*> frozen;              ///< Tables awaiting flush, newest first
+        std::vector<std::shared_ptr<const Run>> runs;   ///< Flushed runs, newest first
+    };
+
+    using Lookup = typename Run::Lookup;
+
+    static constexpr size_t NODE_OVERHEAD_BYTES = 320;  ///< Approximate skip-list node size
+
+    std::string directory_;                     ///< Directory holding run files
+    size_t memtable_bytes_;                     ///< Freeze threshold
+    size_t block_bytes_;                        ///< Target run block size
+    Compare comparator_;                        ///< User key ordering
+    EpochDomain& epochs_;                       ///< Reclamation for versions and tables
+
+    alignas(64) std::atomic<Version*> version_;         ///< Current version
+    alignas(64) std::atomic<uint64_t> sequence_{0};     ///< Last assigned sequence number
+    std::atomic<uint64_t> next_run_id_{1};              ///< Id of the next run file
+    std::atomic<uint64_t> flush_requests_{0};           ///< Bumped to wake the flusher
+    std::atomic<uint64_t> flushes_completed_{0};        ///< Bumped after each flush attempt
+    std::atomic<bool> flush_failed_{false};             ///< Last flush attempt failed
+    std::atomic<bool> stop_{false};                     ///< Flusher shutdown flag
+    std::thread flusher_;                               ///< Background flush thread
+
+    /**
+     * @brief Approximate memory charged to the active table for one entry.
+     */
+    template<typename T>
+    static size_t payload_bytes(const T& value) {
+        if constexpr (requires { value.size(); value.data(); }) {
+            return value.size() * sizeof(*value.data());
+        } else {
+            (void)value;
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Find the newest record for key in a table.
+     */
+    Lookup lookup(const MemTable* table, const Key& key, Value& result) const {
+        Lookup outcome = Lookup::MISSING;
+        InternalKey lo{key, std::numeric_limits<uint64_t>::max()};
+        InternalKey hi{key, 0};
+        table->list.range(lo, hi, [&](const InternalKey&, const Record& record) {
+            if (record.tombstone) {
+                outcome = Lookup::DELETED;
+            } else {
+                result = record.value;
+                outcome = Lookup::FOUND;
+            }
+            return false;   // The first record is the newest
+        });
+        return outcome;
+    }
+
+    /**
+     * @brief Insert a record into the active table and freeze it if it is full.
+     */
+    bool write(const Key& key, const Value& value, bool tombstone) {
+        auto guard = epochs_.pin();
+        MemTable* table = version_.load(std::memory_order_acquire)->active;
+        uint64_t sequence = sequence_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (!table->list.insert(InternalKey{key, sequence}, Record{tombstone ? Value{} : value, tombstone})) {
+            return false;
+        }
+
+        size_t charge = NODE_OVERHEAD_BYTES + payload_bytes(key) + (tombstone ? 0 : payload_bytes(value));
+        size_t before = table->bytes.fetch_add(charge, std::memory_order_relaxed);
+        if (before < memtable_bytes_ && before + charge >= memtable_bytes_) {
+            freeze_table(table);    // Only the writer that crosses the threshold freezes
+        }
+        return true;
+    }
+
+    /**
+     * @brief Replace the active table with a fresh one if it is still active.
+     * @return true if table was frozen by this call
+     */
+    bool freeze_table(MemTable* table) {
+        MemTable* fresh = new MemTable();
+        Version* current = version_.load(std::memory_order_acquire);
+        while (current->active == table) {
+            Version* next = new Version(*current);
+            next->active = fresh;
+            next->frozen.insert(next->frozen.begin(), table);
+            if (version_.compare_exchange_strong(current, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                epochs_.retire(current);
+                flush_requests_.fetch_add(1, std::memory_order_release);
+                flush_requests_.notify_one();
+                return true;
+            }
+            delete next;
+        }
+        delete fresh;
+        return false;
+    }
+
+    /**
+     * @brief Path of the run file with the given id.
+     */
+    std::string run_path(uint64_t id) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "run-%012llu.sst", static_cast<unsigned long long>(id));
+        return (std::filesystem::path(directory_) / name).string();
+    }
+
+    /**
+     * @brief Write the oldest frozen table to a run and swap the run in for it.
+     * @return true if a table was flushed, false if none was waiting or the write failed
+     */
+    bool flush_oldest() {
+        MemTable* table;
+        {
+            auto guard = epochs_.pin();
+            Version* current = version_.load(std::memory_order_acquire);
+            if (current->frozen.empty()) {
+                return false;
+            }
+            table = current->frozen.back();
+        }
+
+        // Writers that saw the table while it was active may still be inserting;
+        // after a grace period the table is immutable.
+        epochs_.synchronize();
+
+        std::shared_ptr<Run> run;
+        if (!table->list.empty()) {
+            uint64_t id = next_run_id_.fetch_add(1, std::memory_order_relaxed);
+            typename Run::Writer writer(run_path(id), block_bytes_);
+            bool ok = true;
+            bool have_previous = false;
+            Key previous{};
+            for (auto it = table->list.begin(); ok && it != table->list.end(); ++it) {
+                auto [internal, record] = *it;
+                if (have_previous && !comparator_(previous, internal.key)) {
+                    continue;   // Older version of the key just written
+                }
+                ok = writer.add(internal.key, record.tombstone ? nullptr : &record.value);
+                previous = std::move(internal.key);
+                have_previous = true;
+            }
+            run = std::make_shared<Run>();
+            if (!ok || !writer.finish()) {
+                return false;   // The writer removes its temporary file
+            }
+            if (!run->open(run_path(id))) {
+                // Drop the unreadable run so a retry does not leave the table on disk twice
+                std::remove(run_path(id).c_str());
+                return false;
+            }
+        }
+
+        Version* current = version_.load(std::memory_order_acquire);
+        while (true) {
+            Version* next = new Version(*current);
+            next->frozen.erase(std::find(next->frozen.begin(), next->frozen.end(), table));
+            if (run) {
+                next->runs.insert(next->runs.begin(), run);
+            }
+            if (version_.compare_exchange_strong(current, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                break;
+            }
+            delete next;
+        }
+        epochs_.retire(current);
+        epochs_.retire(table);
+        return true;
+    }
+
+    /**
+     * @brief Background flusher: drains frozen tables whenever it is signalled.
+     */
+    void flusher_loop() {
+        while (true) {
+            uint64_t seen = flush_requests_.load(std::memory_order_acquire);
+            if (stop_.load(std::memory_order_acquire)) {
+                break;
+            }
+            bool ok = true;
+            while (!stop_.load(std::memory_order_acquire)) {
+                uint64_t pending;
+                {
+                    auto guard = epochs_.pin();
+                    pending = version_.load(std::memory_order_acquire)->frozen.size();
+                }
+                if (pending == 0) {
+                    break;
+                }
+                ok = flush_oldest();
+                flush_failed_.store(!ok, std::memory_order_release);
+                flushes_completed_.fetch_add(1, std::memory_order_release);
+                flushes_completed_.notify_all();
+                if (!ok) {
+                    break;  // Keep the table readable in memory; retry on the next signal
+                }
+            }
+            flush_requests_.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Load the runs left in the directory by earlier instances.
+     */
+    void open_existing_runs(Version& version) {
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        std::vector<uint64_t> ids;
+        for (const auto& entry : std::filesystem::directory_iterator(directory_, error)) {
+            unsigned long long id;
+            char tail;
+            std::string name = entry.path().filename().string();
+            if (std::sscanf(name.c_str(), "run-%llu.ss%c", &id, &tail) == 2 && tail == 't' &&
+                name.size() == 20) {
+                ids.push_back(id);
+            }
+        }
+        std::sort(ids.rbegin(), ids.rend());
+        for (uint64_t id : ids) {
+            auto run = std::make_shared<Run>();
+            if (run->open(run_path(id))) {
+                version.runs.push_back(std::move(run));
+            }
+        }
+        if (!ids.empty()) {
+            next_run_id_.store(ids.front() + 1, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    /**
+     * @brief Open a memtable over a run directory.
+     *
+     * Runs already present in the directory are reopened and consulted by reads. The
+     * background flusher thread is started immediately.
+     *
+     * @param directory Directory for run files (created if missing)
+     * @param memtable_bytes Approximate size at which the active table is frozen
+     * @param block_bytes Target size of run data blocks
+     * @complexity O(existing runs)
+     * @thread_safety Not safe - construct before sharing
+     */
+    explicit AtomicMemTable(std::string directory,
+                            size_t memtable_bytes = DEFAULT_MEMTABLE_BYTES,
+                            size_t block_bytes = DEFAULT_BLOCK_BYTES)
+        : directory_(std::move(directory)),
+          memtable_bytes_(std::max<size_t>(memtable_bytes, 1)),
+          block_bytes_(block_bytes),
+          epochs_(EpochDomain::global()) {
+        auto* version = new Version();
+        version->active = new MemTable();
+        open_existing_runs(*version);
+        version_.store(version, std::memory_order_release);
+        flusher_ = std::thread([this] { flusher_loop(); });
+    }
+
+    /**
+     * @brief Destructor. Stops the flusher and frees all tables.
+     *
+     * Frozen tables that were not flushed yet and the active table are discarded; call
+     * flush() first to persist them.
+     *
+     * @complexity O(n) where n is the number of buffered records
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicMemTable() {
+        stop_.store(true, std::memory_order_release);
+        flush_requests_.fetch_add(1, std::memory_order_release);
+        flush_requests_.notify_all();
+        flusher_.join();
+
+        Version* version = version_.load(std::memory_order_acquire);
+        delete version->active;
+        for (MemTable* table : version->frozen) {
+            delete table;
+        }
+        delete version;
+    }
+
+    AtomicMemTable(const AtomicMemTable&) = delete;
+    AtomicMemTable& operator=(const AtomicMemTable&) = delete;
+    AtomicMemTable(AtomicMemTable&&) = delete;
+    AtomicMemTable& operator=(AtomicMemTable&&) = delete;
+
+    /**
+     * @brief Insert or overwrite a key.
+     *
+     * @param key The key to write
+     * @param value The value to associate with the key
+     * @return true if the write was recorded, false if the skip list insert gave up
+     *         under extreme contention
+     * @complexity O(log n) average
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee
+     */
+    bool put(const Key& key, const Value& value) {
+        return write(key, value, false);
+    }
+
+    /**
+     * @brief Erase a key by writing a tombstone.
+     *
+     * @param key The key to erase
+     * @return true if the tombstone was recorded (whether or not the key existed)
+     * @complexity O(log n) average
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee
+     */
+    bool erase(const Key& key) {
+        return write(key, Value{}, true);
+    }
+
+    /**
+     * @brief Read the newest value of a key across memtables and runs.
+     *
+     * @param key The key to look up
+     * @param result Receives the value if found
+     * @return true if the key has a live value, false if it is missing or erased
+     * @complexity O(T log n + R) - see class documentation
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - if Value's copy assignment throws
+     */
+    bool get(const Key& key, Value& result) const {
+        auto guard = epochs_.pin();
+        const Version* version = version_.load(std::memory_order_acquire);
+
+        Lookup outcome = lookup(version->active, key, result);
+        for (size_t i = 0; outcome == Lookup::MISSING && i < version->frozen.size(); ++i) {
+            outcome = lookup(version->frozen[i], key, result);
+        }
+        for (size_t i = 0; outcome == Lookup::MISSING && i < version->runs.size(); ++i) {
+            outcome = version->runs[i]->get(key, result);
+        }
+        return outcome == Lookup::FOUND;
+    }
+
+    /**
+     * @brief Check whether a key has a live value.
+     *
+     * @param key The key to look up
+     * @return true if get() would succeed
+     * @complexity Same as get()
+     * @thread_safety Safe
+     */
+    bool contains(const Key& key) const {
+        Value ignored{};
+        return get(key, ignored);
+    }
+
+    /**
+     * @brief Visit the newest live value of every key in [lo, hi] in ascending order.
+     *
+     * Collects the range from every table and run, then merges them so that the newest
+     * source wins and erased keys are skipped.
+     *
+     * @tparam Func Callable as bool(const Key&, const Value&); returning false stops the scan
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @param func Visitor
+     * @return Number of pairs passed to func
+     * @complexity O(m log S) where m is the number of records in range and S the number of sources
+     * @thread_safety Safe - observes one version of the table and run set
+     * @exception_safety Basic guarantee
+     */
+    template<typename Func>
+    size_t scan(const Key& lo, const Key& hi, Func&& func) const {
+        struct Entry {
+            Key key;
+            Record record;
+        };
+        std::vector<std::vector<Entry>> sources;    // Newest source first
+
+        {
+            auto guard = epochs_.pin();
+            const Version* version = version_.load(std::memory_order_acquire);
+            auto collect_table = [&](const MemTable* table) {
+                auto& entries = sources.emplace_back();
+                table->list.range(InternalKey{lo, std::numeric_limits<uint64_t>::max()}, InternalKey{hi, 0},
+                                  [&](const InternalKey& internal, const Record& record) {
+                    if (entries.empty() || comparator_(entries.back().key, internal.key)) {
+                        entries.push_back({internal.key, record});
+                    }
+                    return true;
+                });
+            };
+            collect_table(version->active);
+            for (const MemTable* table : version->frozen) {
+                collect_table(table);
+            }
+            for (const auto& run : version->runs) {
+                auto& entries = sources.emplace_back();
+                run->range(lo, hi, [&](const Key& key, const Value* value) {
+                    entries.push_back({key, value ? Record{*value, false} : Record{Value{}, true}});
+                    return true;
+                });
+            }
+        }
+
+        // K-way merge; on equal keys the lowest (newest) source index wins
+        std::vector<size_t> cursor(sources.size(), 0);
+        auto later = [&](size_t a, size_t b) {
+            const Key& ka = sources[a][cursor[a]].key;
+            const Key& kb = sources[b][cursor[b]].key;
+            if (comparator_(ka, kb)) return false;
+            if (comparator_(kb, ka)) return true;
+            return a > b;
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+        for (size_t s = 0; s < sources.size(); ++s) {
+            if (!sources[s].empty()) {
+                heap.push(s);
+            }
+        }
+
+        size_t visited = 0;
+        while (!heap.empty()) {
+            size_t s = heap.top();
+            heap.pop();
+            const Entry& winner = sources[s][cursor[s]];
+
+            // Drop older versions of the same key from the other sources
+            while (!heap.empty()) {
+                size_t other = heap.top();
+                if (comparator_(winner.key, sources[other][cursor[other]].key)) {
+                    break;
+                }
+                heap.pop();
+                if (++cursor[other] < sources[other].size()) {
+                    heap.push(other);
+                }
+            }
+
+            bool keep_going = true;
+            if (!winner.record.tombstone) {
+                ++visited;
+                keep_going = func(static_cast<const Key&>(winner.key), static_cast<const Value&>(winner.record.value));
+            }
+            if (!keep_going) {
+                break;
+            }
+            if (++cursor[s] < sources[s].size()) {
+                heap.push(s);
+            }
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Freeze the active table now, regardless of its size.
+     *
+     * @return true if a non-empty table was frozen and handed to the flusher
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     */
+    bool freeze() {
+        auto guard = epochs_.pin();
+        MemTable* table = version_.load(std::memory_order_acquire)->active;
+        if (table->bytes.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        return freeze_table(table);
+    }
+
+    /**
+     * @brief Freeze the active table and wait until every frozen table is on disk.
+     *
+     * @return true if all buffered writes made before the call are persisted in runs,
+     *         false if the flusher failed to write a run
+     * @complexity O(n) where n is the number of buffered records
+     * @thread_safety Safe, but must not be called from inside a scan() visitor
+     *
+     * @note Writes that race with flush() may land in the new active table.
+     */
+    bool flush() {
+        freeze();
+        while (true) {
+            uint64_t completed = flushes_completed_.load(std::memory_order_acquire);
+            {
+                auto guard = epochs_.pin();
+                if (version_.load(std::memory_order_acquire)->frozen.empty()) {
+                    return true;
+                }
+            }
+            flush_requests_.fetch_add(1, std::memory_order_release);
+            flush_requests_.notify_one();
+            flushes_completed_.wait(completed, std::memory_order_acquire);
+            if (flush_failed_.load(std::memory_order_acquire)) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Number of run files consulted by reads.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    size_t run_count() const {
+        auto guard = epochs_.pin();
+        return version_.load(std::memory_order_acquire)->runs.size();
+    }
+
+    /**
+     * @brief Number of frozen tables waiting for the flusher.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    size_t frozen_count() const {
+        auto guard = epochs_.pin();
+        return version_.load(std::memory_order_acquire)->frozen.size();
+    }
+
+    /**
+     * @brief Approximate bytes buffered in the active table.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    size_t active_bytes() const {
+        auto guard = epochs_.pin();
+        return version_.load(std::memory_order_acquire)->active->bytes.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Directory holding the run files.
+     */
+    const std::string& directory() const {
+        return directory_;
+    }
+};
+
+} // namespace lockfree
@@ -8,6 +8,9 @@
 #include <thread>
 #include <chrono>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include "inline_value.hpp"
 
 namespace lockfree {
 
@@ -45,7 +48,10 @@ namespace lockfree {
  * - Bounded retry logic prevents infinite loops under contention
  * 
  * Memory Management:
- * - Uses in-place construction for optimal performance
+ * - Uses in-place construction for optimal performance: slots are raw storage,
+ *   an element is constructed on enqueue and destroyed on dequeue
+ * - InlineValue elements (trivially copyable, at most 16 bytes) are copied into
+ *   atomic words instead, with no construction or destruction
  * - Fixed-size buffer eliminates allocation overhead
  * - All memory is properly cleaned up in destructor
  * - Buffer capacity is fixed at compile time
@@ -77,6 +83,15 @@ private:
     static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
     static_assert(Size > 1, "Size must be greater than 1");
     
+    static constexpr bool INLINE_VALUES = InlineValue<T>;   ///< Copy elements into atomic words
+    
+    /**
+     * @brief Uninitialized storage for one element of a non-inline type.
+     */
+    struct RawStorage {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+    
     /**
      * @brief Internal slot structure for queue elements.
      * 
@@ -85,7 +100,18 @@ private:
      */
     struct Slot {
         std::atomic<size_t> sequence{0};  ///< Sequence number for synchronization
-        T data;                           ///< Storage for the actual data
+        std::conditional_t<INLINE_VALUES, AtomicInlineValue<T>, RawStorage> data;  ///< Storage for the actual data
+        
+        /**
+         * @brief The element constructed in data (non-inline types only).
+         */
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(data.bytes));
+        }
+        
+        const T* item() const {
+            return std::launder(reinterpret_cast<const T*>(data.bytes));
+        }
     };
     
     alignas(64) std::array<Slot, Size> buffer_;       ///< Fixed-size circular buffer
@@ -151,7 +177,11 @@ private:
                                                             std::memory_order_acq_rel,
                                                             std::memory_order_relaxed))) {
                     // Successfully claimed, construct the element
-                    new (&slot.data) T(std::forward<Args>(args)...);
+                    if constexpr (INLINE_VALUES) {
+                        slot.data.store(T(std::forward<Args>(args)...));
+                    } else {
+                        ::new (slot.data.bytes) T(std::forward<Args>(args)...);
+                    }
                     slot.sequence.store(pos + 1, std::memory_order_release);
                     return true;
                 }
@@ -318,10 +348,15 @@ AtomicMPMCQueue<T, Size>::AtomicMPMCQueue() {
 
 template<typename T, size_t Size>
 AtomicMPMCQueue<T, Size>::~AtomicMPMCQueue() {
-    // Clean up any remaining elements
-    T temp;
-    while (dequeue(temp)) {
-        // Destructor will be called automatically for temp
+    // Clean up any remaining elements; inline values need no destruction
+    if constexpr (!INLINE_VALUES) {
+        size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+        for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+            Slot& slot = buffer_[pos & INDEX_MASK];
+            if (slot.sequence.load(std::memory_order_relaxed) == pos + 1) {
+                slot.item()->~T();
+            }
+        }
     }
 }
 
@@ -360,8 +395,12 @@ bool AtomicMPMCQueue<T, Size>::dequeue(T& result) {
                                                         std::memory_order_acq_rel,
                                                         std::memory_order_relaxed))) {
                 // Successfully claimed, extract the element
-                result = std::move(slot.data);
-                slot.data.~T();
+                if constexpr (INLINE_VALUES) {
+                    result = slot.data.load();
+                } else {
+                    result = std::move(*slot.item());
+                    slot.item()->~T();
+                }
                 slot.sequence.store(pos + Size, std::memory_order_release);
                 return true;
             }
@@ -421,7 +460,11 @@ bool AtomicMPMCQueue<T, Size>::front(T& result) const {
     
     const size_t expected_seq = pos + 1;
     if (LIKELY(seq == expected_seq)) {
-        result = slot.data;
+        if constexpr (INLINE_VALUES) {
+            result = slot.data.load();
+        } else {
+            result = *slot.item();
+        }
         return true;
     }
     
@@ -6,6 +6,9 @@
 #include <random>
 #include <array>
 #include <thread>
+#include <cstdint>
+#include <type_traits>
+#include "epoch_reclamation.hpp"
 
 namespace lockfree {
 
@@ -16,8 +19,8 @@ namespace lockfree {
  * It uses a simplified skip list structure to maintain priority ordering without traditional
  * locking mechanisms, providing true lock-free performance characteristics.
  * 
- * @tparam T The type of elements stored in the priority queue. Must be constructible,
- *           destructible, and comparable according to the Compare function.
+ * @tparam T The type of elements stored in the priority queue. Must be default
+ *           constructible, copyable, and comparable according to the Compare function.
  * @tparam Compare A binary predicate that returns true if the first argument is considered
  *                 to have higher priority than the second. Defaults to std::greater<T>.
  * 
@@ -26,32 +29,45 @@ namespace lockfree {
  * - Thread-safe: Safe concurrent access from multiple threads
  * - Priority ordering: Elements are always popped in priority order
  * - Exception-safe: Basic exception safety guarantee
- * - Move semantics: Efficient for move-only and expensive-to-copy types
+ * - Move semantics: push(T&&) and emplace() move elements in; pop() copies them out
  * - Scalable: Performance scales well with thread count
  * 
  * Performance Characteristics:
  * - Push: O(log n) average, may retry under contention with progressive backoff
- * - Pop: O(log n) average, may retry under contention with progressive backoff
- * - Top: O(1) constant time peek at highest priority
- * - Size: O(n) linear traversal to count unmarked nodes
+ * - Pop: O(1) amortized - walks a popped prefix of about HEAD_ADVANCE_BOUND nodes
+ * - Top: O(1) amortized peek at highest priority
+ * - Size: O(n) linear traversal to count live nodes
  * - Memory: O(n) where n is the number of elements
  * 
  * Algorithm Details:
- * - Uses atomic pointers and compare-and-swap operations
- * - Simplified skip list structure for efficient ordered access
- * - Logical deletion (marking) for safe concurrent removal
+ * - Skip list with the deletion mark in the low bit of the predecessor's
+ *   level-0 pointer (Lindén and Jonsson), so popped nodes form a prefix
+ * - pop() claims the first live node by marking the pointer to it, then
+ *   leaves it linked; only when the popped prefix exceeds HEAD_ADVANCE_BOUND
+ *   does one CAS move the head past the whole prefix, after which the head's
+ *   upper levels are advanced as well. Pops therefore contend on one pointer
+ *   per batch instead of unlinking every node at every level
  * - Progressive backoff strategy: CPU pause → progressive delay → thread yield
  * - CPU-specific optimizations: x86/ARM pause instructions for reduced power consumption
  * 
  * Memory Management:
- * - Dynamic allocation for nodes with atomic cleanup
- * - Memory is properly cleaned up in destructor
- * - Safe concurrent memory access patterns
+ * - Dynamic allocation for nodes
+ * - Nodes cut off by a head advance are retired through EpochDomain, so
+ *   memory stays bounded under a steady push/pop load
+ * - pop() copies the element out: a concurrent push or top() may still read
+ *   a popped node's element until it is reclaimed, so it must stay intact.
+ *   For this reason T must be copyable; move-only types are not supported
+ * - Remaining nodes are cleaned up in the destructor
  */
 template<typename T, typename Compare = std::greater<T>>
 class AtomicPriorityQueue {
+    static_assert(std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>,
+                  "AtomicPriorityQueue copies popped elements out, so T must be copyable");
+
 private:
     static constexpr int MAX_LEVEL = 16;        ///< Maximum number of levels in the skip list
+    static constexpr size_t HEAD_ADVANCE_BOUND = 32;    ///< Popped prefix length that triggers a head advance
+    static constexpr uintptr_t MARK = 1;        ///< Deletion mark: the node this pointer leads to was popped
     
     /**
      * @brief Internal node structure for priority queue elements.
@@ -59,8 +75,8 @@ private:
     struct Node {
         T data;                                             ///< The stored element
         std::atomic<int> level;                             ///< The level (height) of this node
-        std::array<std::atomic<Node*>, MAX_LEVEL> next;     ///< Atomic pointers to next nodes at each level
-        std::atomic<bool> marked;                           ///< Atomic flag indicating logical deletion
+        std::array<std::atomic<Node*>, MAX_LEVEL> next;     ///< Atomic pointers to next nodes at each level; level 0 may be marked
+        std::atomic<bool> inserting;                        ///< Upper levels still being linked by push()
         
         /**
          * @brief Construct node with copied data.
@@ -68,9 +84,9 @@ private:
          * @param lvl The level (height) for this node
          */
         Node(const T& item, int lvl) 
-            : data(item), level(lvl), marked(false) {
+            : data(item), level(lvl), inserting(true) {
             for (int i = 0; i < MAX_LEVEL; ++i) {
-                next[i].store(nullptr);
+                next[i].store(nullptr, std::memory_order_relaxed);
             }
         }
         
@@ -80,9 +96,9 @@ private:
          * @param lvl The level (height) for this node
          */
         Node(T&& item, int lvl) 
-            : data(std::move(item)), level(lvl), marked(false) {
+            : data(std::move(item)), level(lvl), inserting(true) {
             for (int i = 0; i < MAX_LEVEL; ++i) {
-                next[i].store(nullptr);
+                next[i].store(nullptr, std::memory_order_relaxed);
             }
         }
     };
@@ -90,6 +106,7 @@ private:
     Node* head_;                                ///< Sentinel head node
     Node* tail_;                                ///< Sentinel tail node
     Compare comparator_;                        ///< Comparison function for priority
+    EpochDomain& epochs_;                       ///< Grace periods for nodes cut off by a head advance
     
     /**
      * @brief Thread-local random number generator for level generation.
@@ -117,6 +134,35 @@ private:
         }
     #endif
     
+    static void backoff(int attempts) {
+        if (attempts < 10) {
+            cpu_pause();
+        } else if (attempts < 100) {
+            for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    
+    static bool is_marked(Node* link) {
+        return (reinterpret_cast<uintptr_t>(link) & MARK) != 0;
+    }
+    
+    static Node* unmarked(Node* link) {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) & ~MARK);
+    }
+    
+    static Node* with_mark(Node* link) {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) | MARK);
+    }
+    
+    /**
+     * @brief Whether the node is in the popped prefix and is not its last node.
+     */
+    static bool before_popped(const Node* node) {
+        return is_marked(node->next[0].load(std::memory_order_acquire));
+    }
+    
     /**
      * @brief Generate a random level for a new node.
      * @return Random level between 0 and MAX_LEVEL-1
@@ -131,36 +177,110 @@ private:
     }
     
     /**
-     * @brief Find predecessor nodes for insertion point.
+     * @brief Find the insertion point of an item at every level.
+     * 
+     * Nodes in the popped prefix are passed regardless of priority, so a new
+     * node is always linked after every popped node at level 0.
+     * 
      * @param item The item to find predecessors for
-     * @return Array of predecessor nodes at each level
+     * @param preds Receives the predecessor at each level
+     * @param succs Receives the successor at each level
+     * @return The last popped node passed at level 0, or nullptr
      */
-    std::array<Node*, MAX_LEVEL> find_predecessors(const T& item) {
-        std::array<Node*, MAX_LEVEL> predecessors;
-        Node* current = head_;
+    Node* locate(const T& item, std::array<Node*, MAX_LEVEL>& preds, std::array<Node*, MAX_LEVEL>& succs) {
+        Node* x = head_;
+        Node* last_popped = nullptr;
         
         for (int level = MAX_LEVEL - 1; level >= 0; --level) {
-            while (true) {
-                Node* next = current->next[level].load(std::memory_order_acquire);
-                
-                if (next == tail_ || !comparator_(next->data, item)) {
-                    break;
-                }
-                
-                if (next->marked.load(std::memory_order_acquire)) {
-                    // Help remove marked node
-                    current->next[level].compare_exchange_weak(next, next->next[level].load(),
-                                                             std::memory_order_release,
-                                                             std::memory_order_relaxed);
-                    continue;
+            Node* link = x->next[level].load(std::memory_order_acquire);
+            Node* current = unmarked(link);
+            // Deletion state is checked first, so a popped node's element is compared only when unavoidable
+            while ((level == 0 && is_marked(link)) || (current != tail_ && before_popped(current)) ||
+                   (current != tail_ && comparator_(current->data, item))) {
+                if (level == 0 && is_marked(link)) {
+                    last_popped = current;
                 }
-                
-                current = next;
+                x = current;
+                link = x->next[level].load(std::memory_order_acquire);
+                current = unmarked(link);
+            }
+            preds[level] = x;
+            succs[level] = current;
+        }
+        
+        return last_popped;
+    }
+    
+    /**
+     * @brief Link a new node at level 0, retrying until it is in, then best effort at upper levels.
+     */
+    void link_node(Node* node) {
+        auto guard = epochs_.pin();
+        std::array<Node*, MAX_LEVEL> preds;
+        std::array<Node*, MAX_LEVEL> succs;
+        Node* last_popped = nullptr;
+        
+        // Level 0 is the linearization point. A failed CAS means another push
+        // or pop made progress, so retrying keeps the queue lock-free.
+        for (int attempts = 0; ; ++attempts) {
+            last_popped = locate(node->data, preds, succs);
+            node->next[0].store(succs[0], std::memory_order_relaxed);
+            Node* expected = succs[0];
+            if (preds[0]->next[0].compare_exchange_strong(expected, node,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed)) {
+                break;
+            }
+            backoff(attempts);
+        }
+        
+        const int top = node->level.load(std::memory_order_relaxed);
+        for (int i = 1; i <= top; ) {
+            node->next[i].store(succs[i], std::memory_order_relaxed);
+            // Never link a node that is already popped, or in front of a popped node
+            if (before_popped(node) || (succs[i] != tail_ && before_popped(succs[i])) || succs[i] == last_popped) {
+                break;
+            }
+            Node* expected = succs[i];
+            if (preds[i]->next[i].compare_exchange_strong(expected, node,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed)) {
+                ++i;
+                continue;
+            }
+            last_popped = locate(node->data, preds, succs);
+            if (succs[0] != node) {
+                break;   // Popped meanwhile
             }
-            predecessors[level] = current;
         }
         
-        return predecessors;
+        // Until now pop() would not move the head past this node
+        node->inserting.store(false, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Advance the head's upper levels past nodes of the popped prefix.
+     */
+    void restructure() {
+        Node* pred = head_;
+        int level = MAX_LEVEL - 1;
+        while (level > 0) {
+            Node* first = head_->next[level].load(std::memory_order_acquire);
+            if (first == tail_ || !before_popped(first)) {
+                --level;
+                continue;
+            }
+            Node* current = pred->next[level].load(std::memory_order_acquire);
+            while (current != tail_ && before_popped(current)) {
+                pred = current;
+                current = pred->next[level].load(std::memory_order_acquire);
+            }
+            if (head_->next[level].compare_exchange_strong(first, current,
+                                                           std::memory_order_acq_rel,
+                                                           std::memory_order_relaxed)) {
+                --level;
+            }
+        }
     }
     
 public:
@@ -170,10 +290,14 @@ public:
      * @complexity O(MAX_LEVEL)
      * @thread_safety Safe
      */
-    AtomicPriorityQueue() {
+    AtomicPriorityQueue() : epochs_(EpochDomain::global()) {
+        static_assert(alignof(Node) > MARK, "next pointers need a free low bit for the deletion mark");
+        
         // Create sentinel nodes with default values
         head_ = new Node(T{}, MAX_LEVEL - 1);
         tail_ = new Node(T{}, MAX_LEVEL - 1);
+        head_->inserting.store(false, std::memory_order_relaxed);
+        tail_->inserting.store(false, std::memory_order_relaxed);
         
         // Connect head to tail at all levels
         for (int i = 0; i < MAX_LEVEL; ++i) {
@@ -184,13 +308,15 @@ public:
     /**
      * @brief Destructor. Cleans up all nodes including sentinels.
      * 
+     * Nodes already cut off by a head advance belong to EpochDomain.
+     * 
      * @complexity O(n) where n is the number of elements
      * @thread_safety Not safe - should only be called when no other threads are accessing
      */
     ~AtomicPriorityQueue() {
         Node* current = head_;
         while (current) {
-            Node* next = current->next[0].load();
+            Node* next = unmarked(current->next[0].load());
             delete current;
             current = next;
         }
@@ -212,57 +338,7 @@ public:
      *                  the queue remains unchanged
      */
     void push(const T& item) {
-        for (int attempts = 0; attempts < 1000; ++attempts) {
-            int level = random_level();
-            Node* new_node = new Node(item, level);
-            auto predecessors = find_predecessors(item);
-            
-            // Link new node at all levels
-            for (int i = 0; i <= level; ++i) {
-                new_node->next[i].store(predecessors[i]->next[i].load(std::memory_order_relaxed));
-            }
-            
-            // Try to insert at level 0 first (linearization point)
-            Node* expected = new_node->next[0].load();
-            if (predecessors[0]->next[0].compare_exchange_weak(expected, new_node,
-                                                              std::memory_order_release,
-                                                              std::memory_order_relaxed)) {
-                
-                // Insert at higher levels (best effort)
-                for (int i = 1; i <= level; ++i) {
-                    int level_attempts = 0;
-                    while (level_attempts < 50) {
-                        Node* level_expected = new_node->next[i].load();
-                        if (predecessors[i]->next[i].compare_exchange_weak(level_expected, new_node,
-                                                                         std::memory_order_release,
-                                                                         std::memory_order_relaxed)) {
-                            break;
-                        }
-                        // Re-find predecessors for this level if CAS failed
-                        auto new_predecessors = find_predecessors(item);
-                        predecessors[i] = new_predecessors[i];
-                        new_node->next[i].store(predecessors[i]->next[i].load());
-                        level_attempts++;
-                    }
-                }
-                
-                return;
-            } else {
-                // Failed to insert at level 0, clean up and retry
-                delete new_node;
-            }
-            
-            // Progressive backoff strategy
-            if (attempts < 10) {
-                cpu_pause();
-            } else if (attempts < 100) {
-                for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
-            } else {
-                std::this_thread::yield();
-            }
-        }
-        
-        // Failed after max attempts - should be extremely rare
+        link_node(new Node(item, random_level()));
     }
 
     /**
@@ -275,57 +351,7 @@ public:
      *                  the queue remains unchanged
      */
     void push(T&& item) {
-        for (int attempts = 0; attempts < 1000; ++attempts) {
-            int level = random_level();
-            Node* new_node = new Node(std::move(item), level);
-            auto predecessors = find_predecessors(new_node->data);
-            
-            // Link new node at all levels
-            for (int i = 0; i <= level; ++i) {
-                new_node->next[i].store(predecessors[i]->next[i].load(std::memory_order_relaxed));
-            }
-            
-            // Try to insert at level 0 first (linearization point)
-            Node* expected = new_node->next[0].load();
-            if (predecessors[0]->next[0].compare_exchange_weak(expected, new_node,
-                                                              std::memory_order_release,
-                                                              std::memory_order_relaxed)) {
-                
-                // Insert at higher levels (best effort)
-                for (int i = 1; i <= level; ++i) {
-                    int level_attempts = 0;
-                    while (level_attempts < 50) {
-                        Node* level_expected = new_node->next[i].load();
-                        if (predecessors[i]->next[i].compare_exchange_weak(level_expected, new_node,
-                                                                         std::memory_order_release,
-                                                                         std::memory_order_relaxed)) {
-                            break;
-                        }
-                        // Re-find predecessors for this level if CAS failed
-                        auto new_predecessors = find_predecessors(new_node->data);
-                        predecessors[i] = new_predecessors[i];
-                        new_node->next[i].store(predecessors[i]->next[i].load());
-                        level_attempts++;
-                    }
-                }
-                
-                return;
-            } else {
-                // Failed to insert at level 0, clean up and retry
-                delete new_node;
-                // Need to restore item for retry
-                // For move semantics, this path should be rare due to pre-allocation
-            }
-            
-            // Progressive backoff strategy
-            if (attempts < 10) {
-                cpu_pause();
-            } else if (attempts < 100) {
-                for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
-            } else {
-                std::this_thread::yield();
-            }
-        }
+        link_node(new Node(std::move(item), random_level()));
     }
 
     /**
@@ -348,56 +374,65 @@ public:
      * 
      * @param result Reference to store the popped element
      * @return true if an element was successfully popped, false if queue was empty
-     * @complexity O(log n) average, may retry under contention
+     * @complexity O(1) amortized when uncontended: the popped prefix is at most
+     *             HEAD_ADVANCE_BOUND long plus the pops racing with this one
      * @thread_safety Safe
-     * @exception_safety Strong guarantee - if operation fails, queue is unchanged
+     * @exception_safety Basic guarantee - the element is removed even if copying it into result throws
+     * 
+     * @note The element is copied, not moved: concurrent pushes may still compare
+     *       against the popped node until its grace period ends.
      */
     bool pop(T& result) {
-        for (int attempts = 0; attempts < 1000; ++attempts) {
-            Node* current = head_;
-            Node* next = current->next[0].load(std::memory_order_acquire);
-            
-            if (next == tail_) {
+        auto guard = epochs_.pin();
+        Node* observed_head = head_->next[0].load(std::memory_order_acquire);
+        Node* new_head = nullptr;
+        Node* x = head_;
+        size_t offset = 0;
+        
+        // Walk the popped prefix and claim the first live node by marking the pointer to it
+        while (true) {
+            Node* next = x->next[0].load(std::memory_order_acquire);
+            if (unmarked(next) == tail_) {
                 return false; // Queue is empty
             }
-            
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Help remove marked node
-                Node* skip_to = next->next[0].load(std::memory_order_acquire);
-                current->next[0].compare_exchange_weak(next, skip_to,
-                                                     std::memory_order_release,
-                                                     std::memory_order_relaxed);
+            if (!new_head && x->inserting.load(std::memory_order_acquire)) {
+                new_head = x;   // The head must not move past a node push() is still linking
+            }
+            if (is_marked(next)) {
+                x = unmarked(next);
+                ++offset;
                 continue;
             }
-            
-            // Try to mark the highest priority node for deletion
-            bool expected = false;
-            if (next->marked.compare_exchange_strong(expected, true,
-                                                   std::memory_order_release,
-                                                   std::memory_order_relaxed)) {
-                // Successfully marked, extract data
-                result = std::move(next->data);
-                
-                // Help remove from level 0 (physical removal will happen gradually)
-                Node* skip_to = next->next[0].load(std::memory_order_acquire);
-                current->next[0].compare_exchange_weak(next, skip_to,
-                                                     std::memory_order_release,
-                                                     std::memory_order_relaxed);
-                
-                return true;
+            if (x->next[0].compare_exchange_strong(next, with_mark(next),
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire)) {
+                x = next;
+                ++offset;
+                break;
             }
-            
-            // Progressive backoff strategy
-            if (attempts < 10) {
-                cpu_pause();
-            } else if (attempts < 100) {
-                for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
-            } else {
-                std::this_thread::yield();
+            // Another pop claimed it or a push linked a node right behind x; retry from x
+        }
+        result = x->data;
+        
+        if (!new_head) {
+            new_head = x;
+        }
+        
+        // Batched head advance: one CAS cuts off the whole popped prefix
+        if (offset > HEAD_ADVANCE_BOUND && new_head != unmarked(observed_head) &&
+            head_->next[0].load(std::memory_order_relaxed) == observed_head &&
+            head_->next[0].compare_exchange_strong(observed_head, with_mark(new_head),
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed)) {
+            restructure();
+            for (Node* current = unmarked(observed_head); current != new_head; ) {
+                Node* next = unmarked(current->next[0].load(std::memory_order_acquire));
+                epochs_.retire(current);
+                current = next;
             }
         }
         
-        return false; // Failed after max attempts
+        return true;
     }
 
     /**
@@ -405,81 +440,67 @@ public:
      * 
      * @param result Reference to store a copy of the highest priority element
      * @return true if top element was successfully read, false if queue was empty
-     * @complexity O(1) - constant time access to highest priority
+     * @complexity O(1) amortized - skips the popped prefix
      * @thread_safety Safe
      * @exception_safety Basic guarantee
      */
     bool top(T& result) const {
-        Node* current = head_;
-        
-        while (true) {
-            Node* next = current->next[0].load(std::memory_order_acquire);
-            
-            if (next == tail_) {
-                return false; // Queue is empty
-            }
-            
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Skip marked nodes
-                Node* skip_to = next->next[0].load(std::memory_order_acquire);
-                // Help remove marked node (cast away const for cleanup)
-                const_cast<AtomicPriorityQueue*>(this)->head_->next[0].compare_exchange_weak(
-                    next, skip_to, std::memory_order_release, std::memory_order_relaxed);
-                continue;
-            }
-            
-            result = next->data;
-            return true;
+        auto guard = epochs_.pin();
+        Node* first = first_live();
+        if (first == tail_) {
+            return false; // Queue is empty
         }
+        result = first->data;
+        return true;
     }
 
     /**
      * @brief Check if the priority queue is empty.
      * 
      * @return true if the queue contains no elements, false otherwise
-     * @complexity O(1) average, may need to skip marked nodes
+     * @complexity O(1) amortized - skips the popped prefix
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
      * 
      * @note Result may be immediately outdated in concurrent environment.
      */
     bool empty() const {
-        Node* current = head_->next[0].load(std::memory_order_acquire);
-        
-        while (current != tail_) {
-            if (!current->marked.load(std::memory_order_acquire)) {
-                return false; // Found an unmarked node
-            }
-            current = current->next[0].load(std::memory_order_acquire);
-        }
-        
-        return true; // No unmarked nodes found
+        auto guard = epochs_.pin();
+        return first_live() == tail_;
     }
 
     /**
      * @brief Get the current number of elements in the priority queue.
      * 
      * @return The number of elements currently in the queue
-     * @complexity O(n) - must traverse to count unmarked nodes
+     * @complexity O(n) - must traverse the live nodes
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
      * 
      * @note Result may be immediately outdated in concurrent environment.
-     *       This count excludes logically deleted (marked) elements.
+     *       This count excludes popped elements.
      */
     size_t size() const {
+        auto guard = epochs_.pin();
         size_t count = 0;
-        Node* current = head_->next[0].load(std::memory_order_acquire);
-        
-        while (current != tail_) {
-            if (!current->marked.load(std::memory_order_acquire)) {
-                count++;
-            }
-            current = current->next[0].load(std::memory_order_acquire);
+        for (Node* current = first_live(); current != tail_;
+             current = unmarked(current->next[0].load(std::memory_order_acquire))) {
+            count++;
         }
-        
         return count;
     }
+
+private:
+    /**
+     * @brief The first node after the popped prefix, or tail_. The caller must be pinned.
+     */
+    Node* first_live() const {
+        Node* link = head_->next[0].load(std::memory_order_acquire);
+        while (is_marked(link)) {
+            link = unmarked(link)->next[0].load(std::memory_order_acquire);
+        }
+        return link;
+    }
 };
 
 // Thread-local random number generator initialization
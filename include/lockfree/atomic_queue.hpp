@@ -4,6 +4,8 @@
 #include <memory>
 #include <utility>
 #include <thread>
+#include <type_traits>
+#include "inline_value.hpp"
 
 namespace lockfree {
 
@@ -42,6 +44,8 @@ namespace lockfree {
  * Memory Management:
  * - Uses dynamic allocation for nodes and data
  * - Data is allocated separately to handle the Michael & Scott algorithm requirements
+ * - InlineValue elements (trivially copyable, at most 16 bytes) are stored in
+ *   the node instead, with a claim flag in place of the data pointer
  * - Memory is freed during destruction
  * - Efficient memory management with proper cleanup on destruction
  * 
@@ -67,21 +71,34 @@ namespace lockfree {
 template<typename T>
 class AtomicQueue {
 private:
+    static constexpr bool INLINE_VALUES = InlineValue<T>;   ///< Store elements in the node instead of boxing them
+    
+    using Item = std::conditional_t<INLINE_VALUES, T, T*>;  ///< What a dequeuer claims from a node
+    
+    /**
+     * @brief Inline node payload: the element and a flag the dequeuer claims.
+     */
+    struct InlineData {
+        AtomicInlineValue<T> value;             ///< The stored element
+        std::atomic<bool> present{false};       ///< Set until a dequeuer claims the element
+    };
+    
     /**
      * @brief Internal node structure for the queue.
      * 
-     * Each node contains an atomic pointer to data and an atomic pointer to the next node.
+     * Each node contains an atomic pointer to data (or, for InlineValue types, the
+     * element itself) and an atomic pointer to the next node.
      * The data is allocated separately to conform to the Michael & Scott algorithm.
      * The atomic pointers ensure thread-safe traversal and modification.
      */
     struct Node {
-        std::atomic<T*> data;         ///< Atomic pointer to the stored data element
+        std::conditional_t<INLINE_VALUES, InlineData, std::atomic<T*>> data;  ///< Stored element, or atomic pointer to it
         std::atomic<Node*> next;      ///< Atomic pointer to next node
         
         /**
          * @brief Default constructor. Creates a node with null data and next pointers.
          */
-        Node() : data(nullptr), next(nullptr) {}
+        Node() : data(), next(nullptr) {}
     };
     
     std::atomic<Node*> head_;         ///< Atomic pointer to the head (dummy) node
@@ -108,6 +125,19 @@ private:
         }
     #endif
     
+    template<typename... Args>
+    static Node* make_node(Args&&... args);
+    static void destroy_node(Node* node);
+    static bool claim_item(Node* node, Item& item);
+    static void consume_item(Item item, T& result);
+    static bool has_item(const Node* node);
+    static bool peek_item(const Node* node, T& result);
+    
+    /**
+     * @brief Append a node with the Michael & Scott loop, freeing it if all 1000 attempts fail.
+     */
+    void link_node(Node* new_node);
+    
 public:
     /**
      * @brief Default constructor. Creates an empty queue with a dummy head node.
@@ -247,114 +277,109 @@ AtomicQueue<T>::~AtomicQueue() {
     Node* current = head_.load();
     while (current) {
         Node* next = current->next.load();
-        T* data = current->data.load();
+        destroy_node(current);
+        current = next;
+    }
+}
+
+template<typename T>
+template<typename... Args>
+typename AtomicQueue<T>::Node* AtomicQueue<T>::make_node(Args&&... args) {
+    if constexpr (INLINE_VALUES) {
+        T value(std::forward<Args>(args)...);
+        Node* new_node = new Node;
+        new_node->data.value.store(value);
+        new_node->data.present.store(true, std::memory_order_relaxed);
+        return new_node;
+    } else {
+        Node* new_node = new Node;
+        try {
+            new_node->data.store(new T(std::forward<Args>(args)...));
+        } catch (...) {
+            delete new_node;
+            throw;
+        }
+        return new_node;
+    }
+}
+
+template<typename T>
+void AtomicQueue<T>::destroy_node(Node* node) {
+    if constexpr (!INLINE_VALUES) {
+        T* data = node->data.load();
         if (data != nullptr) {
             delete data;
         }
-        delete current;
-        current = next;
     }
+    delete node;
 }
 
 template<typename T>
-void AtomicQueue<T>::enqueue(const T& item) {
-    Node* new_node = new Node;
-    T* data = new T(item);
-    new_node->data.store(data);
-    
-    for (int attempts = 0; attempts < 1000; ++attempts) {
-        Node* last = tail_.load(std::memory_order_acquire);
-        Node* next = last->next.load(std::memory_order_acquire);
-        
-        // Check if tail is still consistent
-        if (last == tail_.load(std::memory_order_acquire)) {
-            if (next == nullptr) {
-                // Try to insert new node at the end
-                if (last->next.compare_exchange_weak(next, new_node,
-                                                   std::memory_order_release,
-                                                   std::memory_order_relaxed)) {
-                    // Successfully linked new node, now advance tail
-                    tail_.compare_exchange_weak(last, new_node,
-                                              std::memory_order_release,
-                                              std::memory_order_relaxed);
-                    return;
-                }
-            } else {
-                // Tail is lagging, try to advance it
-                tail_.compare_exchange_weak(last, next,
-                                          std::memory_order_release,
-                                          std::memory_order_relaxed);
-            }
+bool AtomicQueue<T>::claim_item(Node* node, Item& item) {
+    if constexpr (INLINE_VALUES) {
+        bool expected = true;
+        if (!node->data.present.compare_exchange_weak(expected, false,
+                                                      std::memory_order_acquire,
+                                                      std::memory_order_relaxed)) {
+            return false;
         }
-        
-        // Progressive backoff strategy
-        if (attempts < 10) {
-            cpu_pause();
-        } else if (attempts < 100) {
-            for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
-        } else {
-            std::this_thread::yield();
+        item = node->data.value.load();
+        return true;
+    } else {
+        T* data = node->data.load(std::memory_order_acquire);
+        if (data == nullptr) {
+            return false;
         }
+        // Set data to null to mark it as consumed
+        if (!node->data.compare_exchange_weak(data, nullptr,
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed)) {
+            return false;
+        }
+        item = data;
+        return true;
     }
-    
-    // Failed after max attempts - clean up
-    delete data;
-    delete new_node;
 }
 
 template<typename T>
-void AtomicQueue<T>::enqueue(T&& item) {
-    Node* new_node = new Node;
-    T* data = new T(std::move(item));
-    new_node->data.store(data);
-    
-    for (int attempts = 0; attempts < 1000; ++attempts) {
-        Node* last = tail_.load(std::memory_order_acquire);
-        Node* next = last->next.load(std::memory_order_acquire);
-        
-        // Check if tail is still consistent
-        if (last == tail_.load(std::memory_order_acquire)) {
-            if (next == nullptr) {
-                // Try to insert new node at the end
-                if (last->next.compare_exchange_weak(next, new_node,
-                                                   std::memory_order_release,
-                                                   std::memory_order_relaxed)) {
-                    // Successfully linked new node, now advance tail
-                    tail_.compare_exchange_weak(last, new_node,
-                                              std::memory_order_release,
-                                              std::memory_order_relaxed);
-                    return;
-                }
-            } else {
-                // Tail is lagging, try to advance it
-                tail_.compare_exchange_weak(last, next,
-                                          std::memory_order_release,
-                                          std::memory_order_relaxed);
-            }
+void AtomicQueue<T>::consume_item(Item item, T& result) {
+    if constexpr (INLINE_VALUES) {
+        result = item;
+    } else {
+        result = std::move(*item);
+        delete item;
+    }
+}
+
+template<typename T>
+bool AtomicQueue<T>::has_item(const Node* node) {
+    if constexpr (INLINE_VALUES) {
+        return node->data.present.load(std::memory_order_acquire);
+    } else {
+        return node->data.load(std::memory_order_acquire) != nullptr;
+    }
+}
+
+template<typename T>
+bool AtomicQueue<T>::peek_item(const Node* node, T& result) {
+    if constexpr (INLINE_VALUES) {
+        if (!node->data.present.load(std::memory_order_acquire)) {
+            return false;
         }
-        
-        // Progressive backoff strategy
-        if (attempts < 10) {
-            cpu_pause();
-        } else if (attempts < 100) {
-            for (int i = 0; i < (attempts - 10); ++i) cpu_pause();
-        } else {
-            std::this_thread::yield();
+        result = node->data.value.load();
+        return true;
+    } else {
+        T* data = node->data.load(std::memory_order_acquire);
+        if (data == nullptr) {
+            return false;
         }
+        result = *data;  // Copy for peek operation
+        return true;
     }
-    
-    // Failed after max attempts - clean up
-    delete data;
-    delete new_node;
 }
 
 template<typename T>
-template<typename... Args>
-void AtomicQueue<T>::emplace(Args&&... args) {
-    Node* new_node = new Node;
-    T* data = new T(std::forward<Args>(args)...);
-    new_node->data.store(data);
-    
+void AtomicQueue<T>::link_node(Node* new_node) {
     for (int attempts = 0; attempts < 1000; ++attempts) {
         Node* last = tail_.load(std::memory_order_acquire);
         Node* next = last->next.load(std::memory_order_acquire);
@@ -391,8 +416,23 @@ void AtomicQueue<T>::emplace(Args&&... args) {
     }
     
     // Failed after max attempts - clean up
-    delete data;
-    delete new_node;
+    destroy_node(new_node);
+}
+
+template<typename T>
+void AtomicQueue<T>::enqueue(const T& item) {
+    link_node(make_node(item));
+}
+
+template<typename T>
+void AtomicQueue<T>::enqueue(T&& item) {
+    link_node(make_node(std::move(item)));
+}
+
+template<typename T>
+template<typename... Args>
+void AtomicQueue<T>::emplace(Args&&... args) {
+    link_node(make_node(std::forward<Args>(args)...));
 }
 
 template<typename T>
@@ -420,19 +460,9 @@ bool AtomicQueue<T>::dequeue(T& result) {
                     continue;
                 }
                 
-                T* data = next->data.load(std::memory_order_acquire);
-                if (data == nullptr) {
-                    // Data was already consumed, retry
-                    cpu_pause();
-                    continue;
-                }
-                
-                // Try to set data to null to mark as consumed
-                T* expected_data = data;
-                if (!next->data.compare_exchange_weak(expected_data, nullptr,
-                                                    std::memory_order_acquire,
-                                                    std::memory_order_relaxed)) {
-                    // Someone else got it first, retry
+                // Claim the element; fails if it was already consumed or someone else got it first
+                Item item;
+                if (!claim_item(next, item)) {
                     cpu_pause();
                     continue;
                 }
@@ -442,8 +472,7 @@ bool AtomicQueue<T>::dequeue(T& result) {
                                               std::memory_order_release,
                                               std::memory_order_relaxed)) {
                     // Successfully dequeued
-                    result = std::move(*data);
-                    delete data;
+                    consume_item(item, result);
                     // Note: Not deleting the node immediately to avoid use-after-free
                     // Nodes will be cleaned up in destructor
                     return true;
@@ -478,8 +507,7 @@ size_t AtomicQueue<T>::size() const {
     Node* next = current->next.load(std::memory_order_acquire);
     
     while (next != nullptr) {
-        T* data = next->data.load(std::memory_order_acquire);
-        if (data != nullptr) {
+        if (has_item(next)) {
             count++;
         }
         current = next;
@@ -498,13 +526,7 @@ bool AtomicQueue<T>::front(T& result) const {
         return false;
     }
     
-    T* data = next->data.load(std::memory_order_acquire);
-    if (data == nullptr) {
-        return false;
-    }
-    
-    result = *data;  // Copy for peek operation
-    return true;
+    return peek_item(next, result);
 }
 
 } // namespace lockfree
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <functional>
 #include <type_traits>
 #include <vector>
+#include "inline_value.hpp"
 
 namespace lockfree {
 
@@ -28,8 +29,13 @@ namespace lockfree {
  * - Logarithmic performance: O(log n) guaranteed operations
  * - Exception-safe: Basic exception safety guarantee
  * - Move semantics: Efficient for move-only and expensive-to-copy types
- * - Iterator support: Forward iteration through sorted elements
+ * - Iterator support: Forward iteration through sorted elements, and reverse
+ *   iteration (rbegin()/rend(), reverse_range()) by in-order predecessor
  * - Template predicates: Support for custom search predicates
+ * - In-place updates: for word-sized trivially copyable values, insert_or_assign()
+ *   and compute() swap the value of an existing key with one CAS after one descent;
+ *   iterators still hand out a plain Value&, and reading or writing through it races
+ *   with them on that key; find() and reverse_range() load the value atomically
  * 
  * Performance Characteristics:
  * - Insert: O(log n) guaranteed
@@ -90,6 +96,8 @@ namespace lockfree {
  * @endcode
  * 
  * @note This implementation uses logical deletion for safe concurrent access.
+ *       An erased key stays in the tree as a marked node; inserting it again
+ *       attaches a new node in the marked node's right subtree.
  * @warning Complex balancing operations under high contention may require multiple retries.
  */
 template<typename Key, typename Value, typename Compare = std::less<Key>>
@@ -108,7 +116,7 @@ private:
      */
     struct Node {
         Key key;                            ///< The stored key
-        Value value;                        ///< The stored value
+        alignas(atomic_word_alignment<Value>()) Value value;   ///< The stored value; accessed atomically for an AtomicWordValue
         std::atomic<Color> color;           ///< Atomic Red-Black Tree color
         std::atomic<Node*> left;            ///< Atomic pointer to left child
         std::atomic<Node*> right;           ///< Atomic pointer to right child
@@ -153,6 +161,34 @@ private:
      */
     Node* find_node(const Key& key) const;
     
+    /**
+     * @brief Read a node's value; an AtomicWordValue is loaded atomically, anything else is referenced.
+     */
+    static decltype(auto) read_value(Node* node) {
+        if constexpr (AtomicWordValue<Value>) {
+            return std::atomic_ref<Value>(node->value).load(std::memory_order_acquire);
+        } else {
+            return (node->value);
+        }
+    }
+    
+    /**
+     * @brief Replace a live node's value with func(current value) by compare-and-swap.
+     * @return true once replaced, false if the node is marked first
+     */
+    template<typename Func>
+    static bool replace_value(Node* node, Func& func) {
+        std::atomic_ref<Value> slot(node->value);
+        Value current = slot.load(std::memory_order_acquire);
+        while (!node->marked.load(std::memory_order_acquire)) {
+            if (slot.compare_exchange_weak(current, func(static_cast<const Value&>(current)),
+                                           std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     /**
      * @brief Find the minimum node in a subtree.
      * @param node Root of the subtree to search
@@ -167,6 +203,13 @@ private:
      */
     Node* maximum(Node* node) const;
     
+    /**
+     * @brief Find the in-order predecessor of a node, marked or not.
+     * @param node The node to start from
+     * @return Pointer to the predecessor or nullptr if node holds the smallest key
+     */
+    static Node* predecessor(Node* node);
+    
 public:
     /**
      * @brief Default constructor. Creates an empty Red-Black Tree.
@@ -240,6 +283,48 @@ public:
     template<typename... Args>
     bool emplace(const Key& key, Args&&... args);
     
+    /**
+     * @brief Insert a key-value pair or replace the value of an existing key in place.
+     * 
+     * Equivalent to compute(key, [&](const Value&) { return value; }).
+     * 
+     * @param key The key to write
+     * @param value The value to associate with the key
+     * @return true if the tree was updated, false only under extreme contention after
+     *         1000 retry attempts
+     * @complexity O(h) where h is the tree height, one descent
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - may throw std::bad_alloc when the key is new
+     * 
+     * @note Available when Value is an AtomicWordValue (see inline_value.hpp).
+     */
+    bool insert_or_assign(const Key& key, const Value& value) requires AtomicWordValue<Value>;
+    
+    /**
+     * @brief Atomically replace the value of a key with func(current value).
+     * 
+     * A single descent finds the key. If it is present, its value is replaced by
+     * compare-and-swap, so the key never disappears and concurrent compute()
+     * calls on one key never lose an update. Otherwise a node holding
+     * func(Value{}) is attached where the descent ended, as insert() does.
+     * 
+     * @tparam Func Callable as Value(const Value&); may be called again after a
+     *         failed swap, and only the value of its last call is stored
+     * @param key The key to update
+     * @param func Maps the current value (Value{} for a new key) to the new one
+     * @return true if the tree was updated, false only under extreme contention after
+     *         1000 retry attempts
+     * @complexity O(h) where h is the tree height, plus one CAS per contended retry
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - nothing is changed if func throws
+     * 
+     * @note Available when Value is an AtomicWordValue (see inline_value.hpp).
+     *       Updating an existing key reuses its node; erase() followed by insert()
+     *       instead leaves the erased node in the tree.
+     */
+    template<typename Func>
+    bool compute(const Key& key, Func&& func) requires AtomicWordValue<Value>;
+    
     // For copyable types
     /**
      * @brief Find and copy the value associated with a key (for copyable Value types).
@@ -259,7 +344,7 @@ public:
     find(const Key& key, Value& result) const {
         Node* node = find_node(key);
         if (node && !node->marked.load(std::memory_order_acquire)) {
-            result = node->value;
+            result = read_value(node);
             return true;
         }
         return false;
@@ -323,6 +408,24 @@ public:
     template<typename Predicate>
     bool find_if(const Key& key, Predicate pred) const;
     
+    /**
+     * @brief Visit every key-value pair with lo <= key <= hi in descending order.
+     * 
+     * Descends to the last key not greater than hi, then follows in-order
+     * predecessors through the parent pointers, skipping logically deleted nodes.
+     * 
+     * @tparam Func Callable as bool(const Key&, const Value&); returning false stops the scan
+     * @param hi Inclusive upper bound, visited first
+     * @param lo Inclusive lower bound
+     * @param func Visitor applied to each active pair in the range
+     * @return Number of pairs passed to func
+     * @complexity O(h + k) where h is the tree height and k the number of nodes passed
+     * @thread_safety Safe - weakly consistent with concurrent inserts and erases
+     * @exception_safety Depends on visitor function's exception safety
+     */
+    template<typename Func>
+    size_t reverse_range(const Key& hi, const Key& lo, Func&& func) const;
+    
     /**
      * @brief Remove a key-value pair from the tree.
      * 
@@ -410,6 +513,11 @@ public:
         /**
          * @brief Dereference operator to access key-value pair.
          * @return Pair containing references to key and value
+         * 
+         * @note Reading or writing through the Value& is a plain access. It races with
+         *       a concurrent insert_or_assign() or compute() on the same key; use find()
+         *       or reverse_range(), which load the value atomically, to read it and
+         *       those methods to update it when other threads may do so.
          */
         std::pair<const Key&, Value&> operator*() {
             return {current_->key, current_->value};
@@ -481,6 +589,99 @@ public:
      * @exception_safety No-throw guarantee
      */
     iterator end() const;
+    
+    /**
+     * @brief Iterator traversing tree elements in descending key order.
+     * 
+     * Mirror of iterator: follows in-order predecessors and skips logically
+     * deleted nodes.
+     */
+    class reverse_iterator {
+    private:
+        Node* current_;                     ///< Current node being pointed to
+        
+        /**
+         * @brief Move back to the nearest non-deleted node.
+         */
+        void skip_marked() {
+            while (current_ && current_->marked.load(std::memory_order_acquire)) {
+                current_ = predecessor(current_);
+            }
+        }
+        
+    public:
+        /**
+         * @brief Construct reverse iterator pointing to a specific node.
+         * @param node The node to point to
+         */
+        reverse_iterator(Node* node) : current_(node) {
+            skip_marked();
+        }
+        
+        /**
+         * @brief Dereference operator to access key-value pair.
+         * @return Pair containing references to key and value
+         * 
+         * @note Reading or writing through the Value& is a plain access. It races with
+         *       a concurrent insert_or_assign() or compute() on the same key; use find()
+         *       or reverse_range(), which load the value atomically, to read it and
+         *       those methods to update it when other threads may do so.
+         */
+        std::pair<const Key&, Value&> operator*() {
+            return {current_->key, current_->value};
+        }
+        
+        /**
+         * @brief Pre-increment operator to move to the next smaller key.
+         * @return Reference to this iterator after advancement
+         */
+        reverse_iterator& operator++() {
+            current_ = predecessor(current_);
+            skip_marked();
+            return *this;
+        }
+        
+        /**
+         * @brief Equality comparison operator.
+         * @param other Iterator to compare with
+         * @return true if both iterators point to the same node
+         */
+        bool operator==(const reverse_iterator& other) const {
+            return current_ == other.current_;
+        }
+        
+        /**
+         * @brief Inequality comparison operator.
+         * @param other Iterator to compare with
+         * @return true if iterators point to different nodes
+         */
+        bool operator!=(const reverse_iterator& other) const {
+            return !(*this == other);
+        }
+    };
+    
+    /**
+     * @brief Get reverse iterator to the last element in sorted order.
+     * 
+     * @return Reverse iterator pointing to the largest key in the tree
+     * @complexity O(h) where h is the tree height
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     * 
+     * @note Returns rend() if tree is empty.
+     *       Automatically skips logically deleted nodes.
+     */
+    reverse_iterator rbegin() const;
+    
+    /**
+     * @brief Get reverse iterator representing the end of a descending traversal.
+     * 
+     * @return Reverse iterator representing one-before-the-first
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    reverse_iterator rend() const;
 };
 
 template<typename Key, typename Value, typename Compare>
@@ -526,7 +727,8 @@ bool AtomicRBTree<Key, Value, Compare>::insert(const Key& key, const Value& valu
             parent = current;
             if (comparator_(key, current->key)) {
                 current = current->left.load(std::memory_order_acquire);
-            } else if (comparator_(current->key, key)) {
+            } else if (comparator_(current->key, key) || current->marked.load(std::memory_order_acquire)) {
+                // An erased key is inserted again to the right of its marked node
                 current = current->right.load(std::memory_order_acquire);
             } else {
                 // Key already exists
@@ -590,7 +792,8 @@ bool AtomicRBTree<Key, Value, Compare>::insert(Key&& key, Value&& value) {
             parent = current;
             if (comparator_(new_node->key, current->key)) {
                 current = current->left.load(std::memory_order_acquire);
-            } else if (comparator_(current->key, new_node->key)) {
+            } else if (comparator_(current->key, new_node->key) || current->marked.load(std::memory_order_acquire)) {
+                // An erased key is inserted again to the right of its marked node
                 current = current->right.load(std::memory_order_acquire);
             } else {
                 // Key already exists
@@ -646,6 +849,68 @@ bool AtomicRBTree<Key, Value, Compare>::emplace(const Key& key, Args&&... args)
     return insert(key, Value(std::forward<Args>(args)...));
 }
 
+template<typename Key, typename Value, typename Compare>
+bool AtomicRBTree<Key, Value, Compare>::insert_or_assign(const Key& key, const Value& value)
+    requires AtomicWordValue<Value> {
+    return compute(key, [&](const Value&) { return value; });
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename Func>
+bool AtomicRBTree<Key, Value, Compare>::compute(const Key& key, Func&& func) requires AtomicWordValue<Value> {
+    Node* new_node = nullptr;   // Built on the first miss and reused by later attempts
+    
+    int attempts = 0;
+    while (attempts < 1000) {  // Bounded retry
+        Node* current = root_.load(std::memory_order_acquire);
+        Node* parent = nullptr;
+        
+        // Same descent as insert(), stopping at a live node with the key
+        while (current) {
+            if (comparator_(key, current->key)) {
+                parent = current;
+                current = current->left.load(std::memory_order_acquire);
+            } else if (comparator_(current->key, key) || current->marked.load(std::memory_order_acquire)) {
+                parent = current;
+                current = current->right.load(std::memory_order_acquire);
+            } else {
+                break;
+            }
+        }
+        
+        if (current) {
+            if (replace_value(current, func)) {
+                delete new_node;
+                return true;
+            }
+            attempts++;   // Erased before the swap; attach a fresh node instead
+            continue;
+        }
+        
+        if (!new_node) {
+            new_node = new Node(key, func(Value{}));
+        }
+        new_node->parent.store(parent, std::memory_order_release);
+        std::atomic<Node*>& link = !parent ? root_
+                                 : comparator_(key, parent->key) ? parent->left : parent->right;
+        Node* expected = nullptr;
+        if (link.compare_exchange_weak(expected, new_node, std::memory_order_release, std::memory_order_relaxed)) {
+            if (!parent) {
+                new_node->color.store(Color::BLACK, std::memory_order_release);
+            } else {
+                insert_fixup(new_node);
+            }
+            size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        attempts++;
+    }
+    
+    // Failed after max attempts
+    delete new_node;
+    return false;
+}
+
 template<typename Key, typename Value, typename Compare>
 typename AtomicRBTree<Key, Value, Compare>::Node* 
 AtomicRBTree<Key, Value, Compare>::find_node(const Key& key) const {
@@ -654,13 +919,10 @@ AtomicRBTree<Key, Value, Compare>::find_node(const Key& key) const {
     while (current) {
         if (comparator_(key, current->key)) {
             current = current->left.load(std::memory_order_acquire);
-        } else if (comparator_(current->key, key)) {
+        } else if (comparator_(current->key, key) || current->marked.load(std::memory_order_acquire)) {
+            // A deleted node's key may have been inserted again below it, to the right
             current = current->right.load(std::memory_order_acquire);
         } else {
-            // Found the key - check if node is marked for deletion
-            if (current->marked.load(std::memory_order_acquire)) {
-                return nullptr;  // Node was deleted
-            }
             return current;
         }
     }
@@ -679,11 +941,72 @@ template<typename Predicate>
 bool AtomicRBTree<Key, Value, Compare>::find_if(const Key& key, Predicate pred) const {
     Node* node = find_node(key);
     if (node && !node->marked.load(std::memory_order_acquire)) {
-        return pred(node->value);
+        return pred(read_value(node));
     }
     return false;
 }
 
+template<typename Key, typename Value, typename Compare>
+typename AtomicRBTree<Key, Value, Compare>::Node*
+AtomicRBTree<Key, Value, Compare>::maximum(Node* node) const {
+    Node* right = node->right.load(std::memory_order_acquire);
+    while (right) {
+        node = right;
+        right = node->right.load(std::memory_order_acquire);
+    }
+    return node;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicRBTree<Key, Value, Compare>::Node*
+AtomicRBTree<Key, Value, Compare>::predecessor(Node* node) {
+    Node* left = node->left.load(std::memory_order_acquire);
+    if (left) {
+        node = left;
+        Node* right = node->right.load(std::memory_order_acquire);
+        while (right) {
+            node = right;
+            right = node->right.load(std::memory_order_acquire);
+        }
+        return node;
+    }
+    
+    Node* parent = node->parent.load(std::memory_order_acquire);
+    while (parent && node == parent->left.load(std::memory_order_acquire)) {
+        node = parent;
+        parent = parent->parent.load(std::memory_order_acquire);
+    }
+    return parent;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename Func>
+size_t AtomicRBTree<Key, Value, Compare>::reverse_range(const Key& hi, const Key& lo, Func&& func) const {
+    // Last node whose key is not greater than hi
+    Node* node = nullptr;
+    Node* current = root_.load(std::memory_order_acquire);
+    while (current) {
+        if (comparator_(hi, current->key)) {
+            current = current->left.load(std::memory_order_acquire);
+        } else {
+            node = current;
+            current = current->right.load(std::memory_order_acquire);
+        }
+    }
+    
+    size_t visited = 0;
+    for (; node && !comparator_(node->key, lo); node = predecessor(node)) {
+        if (node->marked.load(std::memory_order_acquire)) {
+            continue;
+        }
+        ++visited;
+        if (!func(static_cast<const Key&>(node->key), static_cast<const Value&>(read_value(node)))) {
+            break;
+        }
+    }
+    return visited;
+}
+
 template<typename Key, typename Value, typename Compare>
 bool AtomicRBTree<Key, Value, Compare>::erase(const Key& key) {
     Node* node = find_node(key);
@@ -741,4 +1064,17 @@ AtomicRBTree<Key, Value, Compare>::end() const {
     return iterator(nullptr);
 }
 
-} // namespace lockfree
\ No newline at end of file
+template<typename Key, typename Value, typename Compare>
+typename AtomicRBTree<Key, Value, Compare>::reverse_iterator 
+AtomicRBTree<Key, Value, Compare>::rbegin() const {
+    Node* root = root_.load(std::memory_order_acquire);
+    return reverse_iterator(root ? maximum(root) : nullptr);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicRBTree<Key, Value, Compare>::reverse_iterator 
+AtomicRBTree<Key, Value, Compare>::rend() const {
+    return reverse_iterator(nullptr);
+}
+
+} // namespace lockfree
@@ -0,0 +1,774 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <vector>
+#include <array>
+#include <numeric>
+#include <algorithm>
+#include <new>
+#include <cstring>
+#include "epoch_reclamation.hpp"
+#include "hash.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A read-mostly concurrent hash map built on read-copy-update (RCU).
+ *
+ * The whole table is an immutable snapshot reached through a single atomic pointer.
+ * Readers load that pointer and search a plain array of entries: no node flags, no
+ * atomic read-modify-writes and, in the steady state, no stores to shared memory.
+ * Writers copy only the buckets they change (plus the small segment that points to
+ * them), publish the new snapshot with one CAS, and retire the replaced pieces through
+ * QsbrDomain so they are freed once every reader has moved on.
+ *
+ * Use it instead of AtomicHashMap when reads dominate (100:1 or more) and writes can
+ * be batched: a write costs O(bucket size + buckets / SEGMENT_SIZE) copying, which a
+ * WriteBatch amortizes over many changes.
+ *
+ * @tparam Key The type of keys. Must be copyable and hashable.
+ * @tparam Value The type of values. Must be copyable.
+ * @tparam Hash Hash function for keys. Defaults to Hasher<Key> (hash.hpp).
+ * @tparam KeyEqual Equality comparison for keys. Defaults to std::equal_to<Key>.
+ *
+ * Key Features:
+ * - Wait-free reads: one pointer load, then immutable data
+ * - Snapshot consistency: every read, size() and for_each() sees one published version
+ * - Batched writes: WriteBatch applies many puts/erases with a single publication
+ * - Copy-on-write per bucket: unchanged buckets are shared between versions
+ * - Lock-free writes: concurrent writers retry their CAS (bounded attempts)
+ *
+ * Performance Characteristics:
+ * - find/contains: O(1) average, no atomic RMW
+ * - insert/erase/apply: O(b + B/256) where b is the number of touched buckets and
+ *   B the bucket count; resizing rebuilds the table in O(n)
+ * - size/empty: O(1), exact for the observed version
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicRcuHashMap<std::string, int> routes;
+ *
+ * lockfree::AtomicRcuHashMap<std::string, int>::WriteBatch batch;
+ * batch.put("/", 1);
+ * batch.put("/health", 2);
+ * batch.erase("/old");
+ * routes.apply(batch);    // One publication for all three changes
+ *
+ * int handler;
+ * if (routes.find("/health", handler)) {
+ *     dispatch(handler);
+ * }
+ *
+ * routes.offline();       // Reader thread going idle for a while
+ * @endcode
+ *
+ * @note Reads are safe from any thread. A thread that stops reading for a long time
+ *       should call offline(), otherwise memory retired after its last read is only
+ *       freed when it reads again or exits.
+ */
+template<typename Key, typename Value, typename Hash = Hasher<Key>, typename KeyEqual = std::equal_to<Key>>
+class AtomicRcuHashMap {
+private:
+    /**
+     * @brief Kind of change carried by an operation.
+     */
+    enum class OpType { INSERT, ASSIGN, ERASE };
+
+    /**
+     * @brief One queued change. Its key is hashed by the map that applies it.
+     */
+    struct Op {
+        OpType type;        ///< What to do
+        Key key;            ///< Target key
+        Value value;        ///< New value (unused for ERASE)
+    };
+
+public:
+    /**
+     * @brief A group of changes published together by apply().
+     *
+     * Later changes to the same key win over earlier ones. A batch is a plain
+     * container and must not be shared between threads while it is being filled.
+     * Keys are hashed by apply() with the map's own hasher, so a batch works with
+     * seeded or otherwise stateful Hash objects.
+     */
+    class WriteBatch {
+    public:
+        /**
+         * @brief Queue an insert-or-overwrite.
+         * @param key The key to write
+         * @param value The value to associate with the key
+         */
+        void put(const Key& key, const Value& value) {
+            ops_.push_back({OpType::ASSIGN, key, value});
+        }
+
+        /**
+         * @brief Queue an erase.
+         * @param key The key to remove
+         */
+        void erase(const Key& key) {
+            ops_.push_back({OpType::ERASE, key, Value{}});
+        }
+
+        /**
+         * @brief Number of queued changes.
+         */
+        size_t size() const {
+            return ops_.size();
+        }
+
+        /**
+         * @brief Check whether no changes are queued.
+         */
+        bool empty() const {
+            return ops_.empty();
+        }
+
+        /**
+         * @brief Drop all queued changes.
+         */
+        void clear() {
+            ops_.clear();
+        }
+
+    private:
+        friend class AtomicRcuHashMap;
+        std::vector<Op> ops_;   ///< Changes in submission order
+    };
+
+private:
+    /**
+     * @brief An immutable key-value pair with its cached hash.
+     */
+    struct Entry {
+        size_t hash;        ///< Cached hash, compared before the key
+        Key key;            ///< The stored key
+        Value value;        ///< The stored value
+    };
+
+    /**
+     * @brief Immutable bucket contents, allocated together with its entries.
+     *
+     * Keeping the entries inline saves the reader one dependent load per lookup.
+     */
+    struct alignas(Entry) Bucket {
+        size_t count;                   ///< Number of entries that follow the header
+
+        const Entry* begin() const {
+            return std::launder(reinterpret_cast<const Entry*>(this + 1));
+        }
+
+        const Entry* end() const {
+            return begin() + count;
+        }
+
+        /**
+         * @brief Allocate a bucket holding the given entries.
+         */
+        static Bucket* create(std::vector<Entry>& entries) {
+            void* memory = ::operator new(sizeof(Bucket) + entries.size() * sizeof(Entry),
+                                          std::align_val_t{alignof(Bucket)});
+            Bucket* bucket = new (memory) Bucket{0};
+            Entry* slots = reinterpret_cast<Entry*>(bucket + 1);
+            try {
+                for (Entry& entry : entries) {
+                    new (slots + bucket->count) Entry(std::move_if_noexcept(entry));
+                    ++bucket->count;
+                }
+            } catch (...) {
+                destroy(bucket);
+                throw;
+            }
+            return bucket;
+        }
+
+        static void destroy(const Bucket* bucket) {
+            for (const Entry& entry : *bucket) {
+                entry.~Entry();
+            }
+            ::operator delete(const_cast<Bucket*>(bucket), std::align_val_t{alignof(Bucket)});
+        }
+    };
+
+    static constexpr size_t SEGMENT_BITS = 8;                       ///< log2 of buckets per segment
+    static constexpr size_t SEGMENT_SIZE = size_t{1} << SEGMENT_BITS;   ///< Buckets per segment
+    static constexpr size_t SEGMENT_MASK = SEGMENT_SIZE - 1;        ///< Bucket offset within a segment
+    static constexpr size_t INITIAL_BUCKET_COUNT = 1024;            ///< Default bucket count
+    static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;           ///< Resize threshold
+    static constexpr int MAX_PUBLISH_ATTEMPTS = 1000;               ///< CAS retries before giving up
+
+    /**
+     * @brief Immutable block of bucket pointers; copied when one of its buckets changes.
+     */
+    struct Segment {
+        std::array<const Bucket*, SEGMENT_SIZE> buckets{};  ///< nullptr for empty buckets
+
+        static void destroy(const Segment* segment) {
+            delete segment;
+        }
+    };
+
+    /**
+     * @brief Immutable published version of the map, allocated together with its
+     *        bucket_count / SEGMENT_SIZE segment pointers.
+     */
+    struct Table {
+        size_t bucket_mask;                     ///< bucket_count - 1 (power of two)
+        size_t size;                            ///< Number of entries in this version
+        size_t segment_count;                   ///< Number of segment pointers that follow
+
+        const Segment** segments() {
+            return reinterpret_cast<const Segment**>(this + 1);
+        }
+
+        const Segment* const* segments() const {
+            return reinterpret_cast<const Segment* const*>(this + 1);
+        }
+
+        /**
+         * @brief Allocate a table whose segment pointers are all nullptr.
+         */
+        static Table* create(size_t bucket_mask, size_t size) {
+            const size_t segment_count = (bucket_mask + 1) >> SEGMENT_BITS;
+            void* memory = ::operator new(sizeof(Table) + segment_count * sizeof(const Segment*));
+            Table* table = new (memory) Table{bucket_mask, size, segment_count};
+            std::memset(static_cast<void*>(table->segments()), 0, segment_count * sizeof(const Segment*));
+            return table;
+        }
+
+        static void destroy(const Table* table) {
+            ::operator delete(const_cast<Table*>(table));
+        }
+    };
+
+    /**
+     * @brief A new version under construction, with everything needed to publish or discard it.
+     */
+    struct Draft {
+        Table* table = nullptr;                     ///< New table
+        std::vector<Segment*> new_segments;         ///< Segments owned by the draft
+        std::vector<Bucket*> new_buckets;           ///< Buckets owned by the draft
+        std::vector<QsbrDomain::Retired> replaced;  ///< Old pieces to retire after publishing
+        size_t applied = 0;                         ///< Number of ops that changed the map
+
+        /**
+         * @brief Free a draft that was not published.
+         */
+        void discard() {
+            for (Bucket* bucket : new_buckets) {
+                Bucket::destroy(bucket);
+            }
+            for (Segment* segment : new_segments) {
+                Segment::destroy(segment);
+            }
+            if (table) {
+                Table::destroy(table);
+            }
+            *this = Draft{};
+        }
+    };
+
+    alignas(64) std::atomic<const Table*> table_;   ///< Current published version
+    Hash hasher_;                                   ///< Hash function instance
+    KeyEqual key_equal_;                            ///< Key equality comparison function instance
+    QsbrDomain& rcu_;                               ///< Deferred reclamation for old versions
+
+    template<typename T>
+    static QsbrDomain::Retired retired(const T* ptr) {
+        return {const_cast<T*>(ptr), [](void* p) { T::destroy(static_cast<T*>(p)); }};
+    }
+
+    static const Bucket* bucket_at(const Table* table, size_t index) {
+        return table->segments()[index >> SEGMENT_BITS]->buckets[index & SEGMENT_MASK];
+    }
+
+    /**
+     * @brief Search one version for a key.
+     */
+    const Entry* lookup(const Table* table, const Key& key, size_t hash) const {
+        const Bucket* bucket = bucket_at(table, hash & table->bucket_mask);
+        if (bucket) {
+            for (const Entry& entry : *bucket) {
+                if (entry.hash == hash && key_equal_(entry.key, key)) {
+                    return &entry;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Apply one op to a private copy of a bucket.
+     * @return 1 if the op changed the bucket, 0 otherwise
+     */
+    size_t apply_op(std::vector<Entry>& entries, const Op& op, size_t hash, size_t& size) const {
+        auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) {
+            return entry.hash == hash && key_equal_(entry.key, op.key);
+        });
+        switch (op.type) {
+            case OpType::INSERT:
+                if (it != entries.end()) {
+                    return 0;
+                }
+                break;
+            case OpType::ASSIGN:
+                if (it != entries.end()) {
+                    it->value = op.value;
+                    return 1;
+                }
+                break;
+            case OpType::ERASE:
+                if (it == entries.end()) {
+                    return 0;
+                }
+                *it = std::move(entries.back());
+                entries.pop_back();
+                --size;
+                return 1;
+        }
+        entries.push_back({hash, op.key, op.value});
+        ++size;
+        return 1;
+    }
+
+    /**
+     * @brief Build a version that copies only the buckets touched by ops.
+     * @param hashes hasher_(ops[i].key) for each op
+     */
+    void copy_on_write(const Table* current, const std::vector<Op>& ops, const std::vector<size_t>& hashes,
+                       Draft& draft) const {
+        const size_t mask = current->bucket_mask;
+        std::vector<size_t> order(ops.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return (hashes[a] & mask) < (hashes[b] & mask);
+        });
+
+        draft.table = Table::create(mask, current->size);
+        std::copy(current->segments(), current->segments() + current->segment_count, draft.table->segments());
+        Segment* segment_copy = nullptr;
+        size_t segment_index = current->segment_count;
+
+        for (size_t i = 0; i < order.size();) {
+            const size_t index = hashes[order[i]] & mask;
+            const Bucket* old_bucket = bucket_at(current, index);
+            std::vector<Entry> entries;
+            if (old_bucket) {
+                entries.assign(old_bucket->begin(), old_bucket->end());
+            }
+            size_t changes = 0;
+            for (; i < order.size() && (hashes[order[i]] & mask) == index; ++i) {
+                changes += apply_op(entries, ops[order[i]], hashes[order[i]], draft.table->size);
+            }
+            if (changes == 0) {
+                continue;
+            }
+            draft.applied += changes;
+
+            Bucket* new_bucket = nullptr;
+            if (!entries.empty()) {
+                draft.new_buckets.reserve(draft.new_buckets.size() + 1);
+                new_bucket = Bucket::create(entries);
+                draft.new_buckets.push_back(new_bucket);
+            }
+            if ((index >> SEGMENT_BITS) != segment_index) {
+                // Buckets are visited in order, so each segment is copied at most once
+                segment_index = index >> SEGMENT_BITS;
+                draft.new_segments.reserve(draft.new_segments.size() + 1);
+                segment_copy = new Segment(*current->segments()[segment_index]);
+                draft.new_segments.push_back(segment_copy);
+                draft.replaced.push_back(retired(current->segments()[segment_index]));
+                draft.table->segments()[segment_index] = segment_copy;
+            }
+            segment_copy->buckets[index & SEGMENT_MASK] = new_bucket;
+            if (old_bucket) {
+                draft.replaced.push_back(retired(old_bucket));
+            }
+        }
+        draft.replaced.push_back(retired(current));
+    }
+
+    /**
+     * @brief Build a version with a new bucket count, applying ops along the way.
+     * @param hashes hasher_(ops[i].key) for each op
+     */
+    void rebuild(const Table* current, const std::vector<Op>& ops, const std::vector<size_t>& hashes,
+                 size_t bucket_count, Draft& draft) const {
+        const size_t mask = bucket_count - 1;
+        std::vector<std::vector<Entry>> buckets(bucket_count);
+        draft.table = Table::create(mask, current->size);
+
+        for (size_t s = 0; s < current->segment_count; ++s) {
+            const Segment* segment = current->segments()[s];
+            for (const Bucket* bucket : segment->buckets) {
+                if (bucket) {
+                    for (const Entry& entry : *bucket) {
+                        buckets[entry.hash & mask].push_back(entry);
+                    }
+                    draft.replaced.push_back(retired(bucket));
+                }
+            }
+            draft.replaced.push_back(retired(segment));
+        }
+        draft.replaced.push_back(retired(current));
+
+        for (size_t i = 0; i < ops.size(); ++i) {
+            draft.applied += apply_op(buckets[hashes[i] & mask], ops[i], hashes[i], draft.table->size);
+        }
+
+        for (size_t s = 0; s < draft.table->segment_count; ++s) {
+            draft.new_segments.reserve(draft.new_segments.size() + 1);
+            Segment* segment = new Segment();
+            draft.new_segments.push_back(segment);
+            draft.table->segments()[s] = segment;
+            for (size_t b = 0; b < SEGMENT_SIZE; ++b) {
+                auto& entries = buckets[(s << SEGMENT_BITS) | b];
+                if (!entries.empty()) {
+                    draft.new_buckets.reserve(draft.new_buckets.size() + 1);
+                    Bucket* bucket = Bucket::create(entries);
+                    draft.new_buckets.push_back(bucket);
+                    segment->buckets[b] = bucket;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Publish ops as one new version.
+     * @param ops Changes in submission order
+     * @param applied Receives the number of ops that changed the map
+     * @return true if the ops were applied (or were all no-ops), false after MAX_PUBLISH_ATTEMPTS
+     */
+    bool commit(const std::vector<Op>& ops, size_t& applied) {
+        applied = 0;
+        if (ops.empty()) {
+            return true;
+        }
+        std::vector<size_t> hashes;
+        hashes.reserve(ops.size());
+        size_t growth = 0;
+        for (const Op& op : ops) {
+            hashes.push_back(hasher_(op.key));
+            growth += op.type != OpType::ERASE;
+        }
+
+        for (int attempt = 0; attempt < MAX_PUBLISH_ATTEMPTS; ++attempt) {
+            Draft draft;
+            {
+                auto section = rcu_.read();
+                const Table* current = table_.load(std::memory_order_acquire);
+                size_t bucket_count = current->bucket_mask + 1;
+                try {
+                    if ((current->size + growth) * 100 > bucket_count * MAX_LOAD_FACTOR_PERCENT) {
+                        while ((current->size + growth) * 100 > bucket_count * MAX_LOAD_FACTOR_PERCENT) {
+                            bucket_count *= 2;
+                        }
+                        rebuild(current, ops, hashes, bucket_count, draft);
+                    } else {
+                        copy_on_write(current, ops, hashes, draft);
+                    }
+                } catch (...) {
+                    draft.discard();
+                    throw;
+                }
+
+                if (draft.applied == 0) {
+                    draft.discard();
+                    return true;    // Nothing to publish
+                }
+                if (!table_.compare_exchange_strong(current, draft.table,
+                                                    std::memory_order_acq_rel,
+                                                    std::memory_order_relaxed)) {
+                    draft.discard();
+                    continue;       // Another writer published first; rebuild on the new version
+                }
+            }
+            applied = draft.applied;
+            rcu_.retire(std::move(draft.replaced));
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Publish a single op.
+     * @return true if the op changed the map
+     */
+    bool commit_one(OpType type, const Key& key, const Value& value) {
+        std::vector<Op> ops;
+        ops.push_back({type, key, value});
+        size_t applied;
+        return commit(ops, applied) && applied == 1;
+    }
+
+    /**
+     * @brief Create an empty version with the given bucket count.
+     */
+    static Table* make_empty_table(size_t bucket_count) {
+        Table* table = Table::create(bucket_count - 1, 0);
+        for (size_t s = 0; s < table->segment_count; ++s) {
+            table->segments()[s] = new Segment();
+        }
+        return table;
+    }
+
+    /**
+     * @brief Round a requested bucket count up to a power of two of at least SEGMENT_SIZE.
+     */
+    static size_t normalize_bucket_count(size_t requested) {
+        size_t count = SEGMENT_SIZE;
+        while (count < requested) {
+            count *= 2;
+        }
+        return count;
+    }
+
+public:
+    /**
+     * @brief Default constructor. Creates an empty map with INITIAL_BUCKET_COUNT buckets.
+     *
+     * @complexity O(INITIAL_BUCKET_COUNT / SEGMENT_SIZE)
+     * @thread_safety Safe
+     */
+    AtomicRcuHashMap() : AtomicRcuHashMap(INITIAL_BUCKET_COUNT) {}
+
+    /**
+     * @brief Constructor with a bucket count hint.
+     *
+     * @param initial_bucket_count Requested number of buckets (rounded up to a power of two)
+     * @complexity O(initial_bucket_count / SEGMENT_SIZE)
+     * @thread_safety Safe
+     */
+    explicit AtomicRcuHashMap(size_t initial_bucket_count)
+        : table_(make_empty_table(normalize_bucket_count(initial_bucket_count))),
+          rcu_(QsbrDomain::global()) {}
+
+    /**
+     * @brief Destructor. Frees the current version; older versions are freed by QsbrDomain.
+     *
+     * @complexity O(n + buckets / SEGMENT_SIZE)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicRcuHashMap() {
+        const Table* table = table_.load(std::memory_order_acquire);
+        for (size_t s = 0; s < table->segment_count; ++s) {
+            const Segment* segment = table->segments()[s];
+            for (const Bucket* bucket : segment->buckets) {
+                if (bucket) {
+                    Bucket::destroy(bucket);
+                }
+            }
+            Segment::destroy(segment);
+        }
+        Table::destroy(table);
+    }
+
+    // Non-copyable and non-movable: readers hold pointers into the published version
+    AtomicRcuHashMap(const AtomicRcuHashMap&) = delete;
+    AtomicRcuHashMap& operator=(const AtomicRcuHashMap&) = delete;
+    AtomicRcuHashMap(AtomicRcuHashMap&&) = delete;
+    AtomicRcuHashMap& operator=(AtomicRcuHashMap&&) = delete;
+
+    /**
+     * @brief Insert a key-value pair if the key is not present.
+     *
+     * @param key The key to insert
+     * @param value The value to associate with the key
+     * @return true if the pair was inserted, false if the key exists or publication gave up
+     * @complexity O(bucket size + buckets / SEGMENT_SIZE), O(n) when resizing
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - the map is unchanged if a copy throws
+     */
+    bool insert(const Key& key, const Value& value) {
+        return commit_one(OpType::INSERT, key, value);
+    }
+
+    /**
+     * @brief Insert a key-value pair or overwrite the existing value.
+     *
+     * @param key The key to write
+     * @param value The value to associate with the key
+     * @return true if the map was updated, false if publication gave up
+     * @complexity O(bucket size + buckets / SEGMENT_SIZE), O(n) when resizing
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - the map is unchanged if a copy throws
+     */
+    bool insert_or_assign(const Key& key, const Value& value) {
+        return commit_one(OpType::ASSIGN, key, value);
+    }
+
+    /**
+     * @brief Remove a key.
+     *
+     * @param key The key to remove
+     * @return true if the key was present and removed, false otherwise
+     * @complexity O(bucket size + buckets / SEGMENT_SIZE)
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - the map is unchanged if a copy throws
+     */
+    bool erase(const Key& key) {
+        return commit_one(OpType::ERASE, key, Value{});
+    }
+
+    /**
+     * @brief Publish every change in a batch as one new version.
+     *
+     * Readers observe either none or all of the batch.
+     *
+     * @param batch Changes to apply, in order
+     * @return true if the batch was applied, false if publication gave up under extreme
+     *         write contention after MAX_PUBLISH_ATTEMPTS
+     * @complexity O(touched buckets + buckets / SEGMENT_SIZE), O(n) when resizing
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - the map is unchanged if a copy throws
+     */
+    bool apply(const WriteBatch& batch) {
+        size_t applied;
+        return commit(batch.ops_, applied);
+    }
+
+    /**
+     * @brief Find the value associated with a key.
+     *
+     * @param key The key to search for
+     * @param result Reference to store the found value
+     * @return true if the key was found and its value copied to result
+     * @complexity O(1) average
+     * @thread_safety Safe - no atomic read-modify-write operations
+     * @exception_safety Basic guarantee - if Value's copy assignment throws
+     */
+    bool find(const Key& key, Value& result) const {
+        auto section = rcu_.read();
+        const Entry* entry = lookup(table_.load(std::memory_order_acquire), key, hasher_(key));
+        if (entry) {
+            result = entry->value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check if the map contains a key.
+     *
+     * @param key The key to search for
+     * @return true if the key is present
+     * @complexity O(1) average
+     * @thread_safety Safe - no atomic read-modify-write operations
+     * @exception_safety No-throw guarantee
+     */
+    bool contains(const Key& key) const {
+        auto section = rcu_.read();
+        return lookup(table_.load(std::memory_order_acquire), key, hasher_(key)) != nullptr;
+    }
+
+    /**
+     * @brief Apply a predicate to the value of a key without copying it.
+     *
+     * @tparam Func Callable as bool(const Value&)
+     * @param key The key to search for
+     * @param func Predicate applied to the value if the key is found
+     * @return true if the key was found and the predicate returned true
+     * @complexity O(1) average
+     * @thread_safety Safe - func must not call offline()
+     * @exception_safety Depends on predicate function's exception safety
+     */
+    template<typename Func>
+    bool find_if(const Key& key, Func&& func) const {
+        auto section = rcu_.read();
+        const Entry* entry = lookup(table_.load(std::memory_order_acquire), key, hasher_(key));
+        return entry && func(static_cast<const Value&>(entry->value));
+    }
+
+    /**
+     * @brief Visit every entry of one published version.
+     *
+     * @tparam Func Callable as void(const Key&, const Value&)
+     * @param func Visitor
+     * @complexity O(n + buckets)
+     * @thread_safety Safe - sees a consistent snapshot even while writers publish
+     * @exception_safety Depends on visitor function's exception safety
+     */
+    template<typename Func>
+    void for_each(Func&& func) const {
+        auto section = rcu_.read();
+        const Table* table = table_.load(std::memory_order_acquire);
+        for (size_t s = 0; s < table->segment_count; ++s) {
+            for (const Bucket* bucket : table->segments()[s]->buckets) {
+                if (bucket) {
+                    for (const Entry& entry : *bucket) {
+                        func(static_cast<const Key&>(entry.key), static_cast<const Value&>(entry.value));
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return true if the current version holds no entries
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of entries.
+     *
+     * @return Exact size of the current version
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        auto section = rcu_.read();
+        return table_.load(std::memory_order_acquire)->size;
+    }
+
+    /**
+     * @brief Get the number of buckets.
+     *
+     * @return Bucket count of the current version
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t bucket_count() const {
+        auto section = rcu_.read();
+        return table_.load(std::memory_order_acquire)->bucket_mask + 1;
+    }
+
+    /**
+     * @brief Get the current load factor.
+     *
+     * @return size() / bucket_count() of the current version
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    double load_factor() const {
+        auto section = rcu_.read();
+        const Table* table = table_.load(std::memory_order_acquire);
+        return static_cast<double>(table->size) / (table->bucket_mask + 1);
+    }
+
+    /**
+     * @brief Declare that the calling thread will not read for a while.
+     *
+     * Lets writers free old versions without waiting for this thread's next read.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe, but must not be called from inside find_if() or for_each()
+     */
+    void offline() const {
+        rcu_.offline();
+    }
+};
+
+} // namespace lockfree
@@ -4,6 +4,8 @@
 #include <memory>
 #include <array>
 #include <utility>
+#include <type_traits>
+#include "inline_value.hpp"
 
 namespace lockfree {
 
@@ -35,13 +37,15 @@ namespace lockfree {
  * 
  * Algorithm Details:
  * - Uses separate atomic head and tail counters for safe concurrent access
- * - Each slot stores a pointer to dynamically allocated data
+ * - Each slot stores a pointer to dynamically allocated data, or the element
+ *   itself for trivially copyable types of up to 16 bytes (see InlineValue)
  * - Power-of-2 size requirement enables efficient bit-mask indexing
  * - Cache-aligned structures minimize false sharing between threads
  * 
  * Memory Management:
  * - Uses dynamic allocation for data elements (not the slots themselves)
- * - Data is allocated on push and freed on pop
+ * - Data is allocated on push and freed on pop; InlineValue elements are
+ *   copied into the slot instead, with no allocation and no destructor call
  * - All memory is properly cleaned up in destructor
  * - Buffer capacity is fixed at compile time
  * 
@@ -81,8 +85,12 @@ private:
      * Each slot contains a pointer to data and a validity flag.
      * Cache-line alignment prevents false sharing between adjacent slots.
      */
+    static constexpr bool INLINE_VALUES = InlineValue<T>;   ///< Store elements in the slot instead of boxing them
+    
+    using Item = std::conditional_t<INLINE_VALUES, T, T*>;  ///< What moves through a slot
+    
     struct Slot {
-        alignas(64) std::atomic<T*> data{nullptr};  ///< Atomic pointer to stored data
+        alignas(64) std::conditional_t<INLINE_VALUES, AtomicInlineValue<T>, std::atomic<T*>> data{};  ///< Stored element or pointer to it
         std::atomic<bool> valid{false};             ///< Atomic flag indicating if slot contains valid data
     };
     
@@ -292,18 +300,73 @@ private:
     /**
      * @brief Internal implementation for push operations.
      * 
-     * @param item Pointer to the item to insert (takes ownership)
+     * @param item The item to insert, or a pointer to it (takes ownership)
      * @return true if successfully inserted, false if buffer is full
      */
-    bool push_impl(T* item);
+    bool push_impl(Item item);
     
     /**
      * @brief Internal implementation for pop operations.
      * 
-     * @param item Reference to pointer that will receive the popped item
+     * @param item Receives the popped item, or a pointer to it
      * @return true if successfully popped, false if buffer was empty
      */
-    bool pop_impl(T*& item);
+    bool pop_impl(Item& item);
+    
+    template<typename... Args>
+    static Item make_item(Args&&... args) {
+        if constexpr (INLINE_VALUES) {
+            return T(std::forward<Args>(args)...);
+        } else {
+            return new T(std::forward<Args>(args)...);
+        }
+    }
+    
+    static void discard_item(Item item) {
+        if constexpr (!INLINE_VALUES) {
+            delete item;
+        }
+    }
+    
+    // Publication is by the release store to slot.valid that follows
+    static void store_item(Slot& slot, Item item) {
+        if constexpr (INLINE_VALUES) {
+            slot.data.store(item);
+        } else {
+            slot.data.store(item, std::memory_order_relaxed);
+        }
+    }
+    
+    static Item take_item(Slot& slot) {
+        if constexpr (INLINE_VALUES) {
+            return slot.data.load();
+        } else {
+            return slot.data.exchange(nullptr, std::memory_order_acq_rel);
+        }
+    }
+    
+    static void consume_item(Item item, T& result) {
+        if constexpr (INLINE_VALUES) {
+            result = item;
+        } else {
+            result = std::move(*item);
+            delete item;
+        }
+    }
+    
+    static bool peek_item(const Slot& slot, T& result) {
+        if constexpr (INLINE_VALUES) {
+            result = slot.data.load();
+            return true;
+        } else {
+            T* item = slot.data.load(std::memory_order_acquire);
+            if (item) {
+                result = *item;
+                return true;
+            }
+            return false;
+        }
+    }
 };
 
 template<typename T, size_t Size>
@@ -311,7 +374,6 @@ AtomicRingBuffer<T, Size>::AtomicRingBuffer() {
     // Initialize all slots as invalid/empty
     for (size_t i = 0; i < Size; ++i) {
         buffer_[i].valid.store(false, std::memory_order_relaxed);
-        buffer_[i].data.store(nullptr, std::memory_order_relaxed);
     }
 }
 
@@ -325,25 +387,25 @@ AtomicRingBuffer<T, Size>::~AtomicRingBuffer() {
 
 template<typename T, size_t Size>
 bool AtomicRingBuffer<T, Size>::push(const T& item) {
-    return push_impl(new T(item));
+    return push_impl(make_item(item));
 }
 
 template<typename T, size_t Size>
 bool AtomicRingBuffer<T, Size>::push(T&& item) {
-    return push_impl(new T(std::move(item)));
+    return push_impl(make_item(std::move(item)));
 }
 
 template<typename T, size_t Size>
 template<typename... Args>
 bool AtomicRingBuffer<T, Size>::emplace(Args&&... args) {
-    return push_impl(new T(std::forward<Args>(args)...));
+    return push_impl(make_item(std::forward<Args>(args)...));
 }
 
 template<typename T, size_t Size>
-bool AtomicRingBuffer<T, Size>::push_impl(T* item) {
+bool AtomicRingBuffer<T, Size>::push_impl(Item item) {
     // Check if buffer is full
     if (size_.load(std::memory_order_acquire) >= Size) {
-        delete item;
+        discard_item(item);
         return false;
     }
     
@@ -355,7 +417,7 @@ bool AtomicRingBuffer<T, Size>::push_impl(T* item) {
         // Check if this would make us full
         uint64_t current_tail = tail_.load(std::memory_order_acquire);
         if ((next_head - current_tail) > Size) {
-            delete item;
+            discard_item(item);
             return false;
         }
         
@@ -369,7 +431,7 @@ bool AtomicRingBuffer<T, Size>::push_impl(T* item) {
                                           std::memory_order_acq_rel,
                                           std::memory_order_acquire)) {
                 // Successfully claimed slot
-                slot.data.store(item, std::memory_order_release);
+                store_item(slot, item);
                 slot.valid.store(true, std::memory_order_release);
                 size_.fetch_add(1, std::memory_order_acq_rel);
                 return true;
@@ -378,23 +440,22 @@ bool AtomicRingBuffer<T, Size>::push_impl(T* item) {
         attempts++;
     }
     
-    delete item;
+    discard_item(item);
     return false;
 }
 
 template<typename T, size_t Size>
 bool AtomicRingBuffer<T, Size>::pop(T& result) {
-    T* item;
+    Item item;
     if (pop_impl(item)) {
-        result = std::move(*item);
-        delete item;
+        consume_item(item, result);
         return true;
     }
     return false;
 }
 
 template<typename T, size_t Size>
-bool AtomicRingBuffer<T, Size>::pop_impl(T*& item) {
+bool AtomicRingBuffer<T, Size>::pop_impl(Item& item) {
     // Check if buffer is empty
     if (size_.load(std::memory_order_acquire) == 0) {
         return false;
@@ -413,15 +474,17 @@ bool AtomicRingBuffer<T, Size>::pop_impl(T*& item) {
             if (tail_.compare_exchange_weak(current_tail, next_tail,
                                           std::memory_order_acq_rel,
                                           std::memory_order_acquire)) {
-                // Successfully claimed slot - atomically extract the pointer
-                item = slot.data.exchange(nullptr, std::memory_order_acq_rel);
+                // Successfully claimed slot - atomically extract the item
+                item = take_item(slot);
                 slot.valid.store(false, std::memory_order_release);
                 size_.fetch_sub(1, std::memory_order_acq_rel);
                 
-                // Verify we got a valid pointer
-                if (item == nullptr) {
-                    // Race condition occurred, slot was already consumed
-                    return false;
+                if constexpr (!INLINE_VALUES) {
+                    // Verify we got a valid pointer
+                    if (item == nullptr) {
+                        // Race condition occurred, slot was already consumed
+                        return false;
+                    }
                 }
                 return true;
             }
@@ -439,12 +502,8 @@ bool AtomicRingBuffer<T, Size>::front(T& result) const {
     uint64_t current_tail = tail_.load(std::memory_order_acquire);
     const Slot& slot = buffer_[current_tail & INDEX_MASK];
     
-    if (slot.valid.load(std::memory_order_acquire)) {
-        T* item = slot.data.load(std::memory_order_acquire);
-        if (item) {
-            result = *item;
-            return true;
-        }
+    if (slot.valid.load(std::memory_order_acquire) && peek_item(slot, result)) {
+        return true;
     }
     
     return false;
@@ -457,12 +516,8 @@ bool AtomicRingBuffer<T, Size>::back(T& result) const {
     
     const Slot& slot = buffer_[(current_head - 1) & INDEX_MASK];
     
-    if (slot.valid.load(std::memory_order_acquire)) {
-        T* item = slot.data.load(std::memory_order_acquire);
-        if (item) {
-            result = *item;
-            return true;
-        }
+    if (slot.valid.load(std::memory_order_acquire) && peek_item(slot, result)) {
+        return true;
     }
     
     return false;
@@ -500,9 +555,7 @@ bool AtomicRingBuffer<T, Size>::spsc_push(const T& item) {
     }
     
     Slot& slot = buffer_[current_head & INDEX_MASK];
-    T* new_item = new T(item);
-    
-    slot.data.store(new_item, std::memory_order_relaxed);
+    store_item(slot, make_item(item));
     slot.valid.store(true, std::memory_order_release);
     head_.store(next_head, std::memory_order_relaxed);
     
@@ -521,9 +574,7 @@ bool AtomicRingBuffer<T, Size>::spsc_push(T&& item) {
     }
     
     Slot& slot = buffer_[current_head & INDEX_MASK];
-    T* new_item = new T(std::move(item));
-    
-    slot.data.store(new_item, std::memory_order_relaxed);
+    store_item(slot, make_item(std::move(item)));
     slot.valid.store(true, std::memory_order_release);
     head_.store(next_head, std::memory_order_relaxed);
     
@@ -540,11 +591,8 @@ bool AtomicRingBuffer<T, Size>::spsc_pop(T& result) {
         return false;
     }
     
-    T* item = slot.data.load(std::memory_order_relaxed);
-    result = std::move(*item);
-    delete item;
+    consume_item(take_item(slot), result);
     
-    slot.data.store(nullptr, std::memory_order_relaxed);
     slot.valid.store(false, std::memory_order_release);
     tail_.store(current_tail + 1, std::memory_order_relaxed);
     
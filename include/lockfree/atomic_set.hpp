@@ -4,18 +4,9 @@
 #include <memory>
 #include <functional>
 #include <vector>
-
-// Hash specialization for std::pair
-namespace std {
-    template<typename T1, typename T2>
-    struct hash<std::pair<T1, T2>> {
-        size_t operator()(const std::pair<T1, T2>& p) const {
-            auto h1 = std::hash<T1>{}(p.first);
-            auto h2 = std::hash<T2>{}(p.second);
-            return h1 ^ (h2 << 1);  // Simple combination
-        }
-    };
-}
+#include <algorithm>
+#include "hash.hpp"
+#include "prefetch.hpp"
 
 namespace lockfree {
 
@@ -28,7 +19,7 @@ namespace lockfree {
  * elements and supports efficient insertion, deletion, and lookup operations.
  * 
  * @tparam T The type of elements stored in the set. Must be hashable and comparable.
- * @tparam Hash Hash function for type T. Defaults to std::hash<T>.
+ * @tparam Hash Hash function for type T. Defaults to Hasher<T> (hash.hpp).
  * @tparam KeyEqual Equality comparison for type T. Defaults to std::equal_to<T>.
  * 
  * Key Features:
@@ -49,6 +40,9 @@ namespace lockfree {
  * 
  * Algorithm Details:
  * - Uses separate chaining with linked lists for collision resolution
+ * - Each node caches its element's full hash; KeyEqual only runs when the hashes match
+ * - contains_batch() hashes a group of elements, prefetches all their bucket heads,
+ *   then all their first nodes, so the misses of one group overlap
  * - Logical deletion (marking) for safe concurrent access
  * - Compare-and-swap operations for atomic pointer updates
  * - Load factor monitoring for performance optimization
@@ -94,31 +88,36 @@ namespace lockfree {
  * @note This implementation uses logical deletion for safe concurrent access.
  * @note This implementation provides reliable concurrent access for fixed-capacity use cases.
  */
-template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+template<typename T, typename Hash = Hasher<T>, typename KeyEqual = std::equal_to<T>>
 class AtomicSet {
 private:
     /**
      * @brief Internal node structure for set elements.
      * 
-     * Each node contains the data, an atomic pointer to the next node in the chain,
-     * and an atomic deletion flag for logical deletion.
+     * Each node contains the data, the full hash of the data, an atomic pointer to
+     * the next node in the chain, and an atomic deletion flag for logical deletion.
+     * The chain fields come first so that walking past a mismatching node only reads
+     * its first cache line and never the element itself.
      */
     struct Node {
-        T data;                         ///< The stored data element
+        size_t hash;                    ///< Cached hash_key(data), compared before the data
         std::atomic<Node*> next;        ///< Atomic pointer to next node in bucket chain
         std::atomic<bool> deleted;      ///< Atomic flag indicating logical deletion
+        T data;                         ///< The stored data element
         
         /**
          * @brief Construct node with copied data.
+         * @param h Hash of the data
          * @param item The data to copy into the node
          */
-        Node(const T& item) : data(item), next(nullptr), deleted(false) {}
+        Node(size_t h, const T& item) : hash(h), next(nullptr), deleted(false), data(item) {}
         
         /**
          * @brief Construct node with moved data.
+         * @param h Hash of the data
          * @param item The data to move into the node
          */
-        Node(T&& item) : data(std::move(item)), next(nullptr), deleted(false) {}
+        Node(size_t h, T&& item) : hash(h), next(nullptr), deleted(false), data(std::move(item)) {}
     };
     
     /**
@@ -135,6 +134,7 @@ private:
     
     static constexpr size_t INITIAL_BUCKET_COUNT = 1024;     ///< Increased from 16 for better performance
     static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 50;    ///< Reduced from 75 for optimal performance
+    static constexpr size_t BATCH_GROUP_SIZE = 16;           ///< Elements whose misses a batched lookup overlaps
     
     std::vector<Bucket> buckets_;           ///< Dynamic array of hash table buckets
     std::atomic<size_t> size_;              ///< Atomic counter for number of elements
@@ -150,19 +150,38 @@ private:
     size_t hash_key(const T& key) const;
     
     /**
-     * @brief Get bucket index for a key.
-     * @param key The key to get bucket index for
+     * @brief Get bucket index for a hash value.
+     * @param hash Hash value from hash_key()
      * @return Bucket index (0 to bucket_count-1)
      */
-    size_t get_bucket_index(const T& key) const;
+    size_t get_bucket_index(size_t hash) const;
+    
+    /**
+     * @brief Check whether a node holds a key, comparing the cached hash first.
+     * @param node The node to test
+     * @param key The key to compare against
+     * @param hash Hash of key
+     * @return true if the node's data equals key
+     */
+    bool node_matches(const Node* node, const T& key, size_t hash) const;
     
     /**
      * @brief Find node with matching key in a bucket.
      * @param key The key to search for
+     * @param hash Hash of key
      * @param bucket The bucket to search in
      * @return Pointer to matching node or nullptr if not found
      */
-    Node* find_node(const T& key, Bucket& bucket) const;
+    Node* find_node(const T& key, size_t hash, Bucket& bucket) const;
+    
+    /**
+     * @brief Find node with matching key in a chain.
+     * @param head First node of the chain (may be nullptr)
+     * @param key The key to search for
+     * @param hash Hash of key
+     * @return Pointer to matching node or nullptr if not found
+     */
+    Node* find_in_chain(Node* head, const T& key, size_t hash) const;
     
     /**
      * @brief Check if resize is needed based on load factor.
@@ -288,6 +307,39 @@ public:
      */
     bool find(const T& value) const;  // Alias for contains
     
+    /**
+     * @brief Check many elements at once, overlapping their cache misses.
+     * 
+     * Elements are processed in groups of BATCH_GROUP_SIZE: every element of a group
+     * is hashed and its bucket head prefetched, then every head is read and its first
+     * node prefetched, and only then are the chains walked. Independent lookups thus
+     * wait on memory together instead of one after another.
+     * 
+     * @param values Array of count elements to check
+     * @param count Number of elements
+     * @param out_found Array of count flags; out_found[i] is set to whether values[i] is present
+     * @return Number of elements present
+     * @complexity O(count) average
+     * @thread_safety Safe - each element is checked as by contains()
+     * @exception_safety No-throw guarantee
+     */
+    size_t contains_batch(const T* values, size_t count, bool* out_found) const;
+    
+    /**
+     * @brief Check many elements at once (alias for contains_batch).
+     * 
+     * @param values Array of count elements to check
+     * @param count Number of elements
+     * @param out_found Array of count flags; out_found[i] is set to whether values[i] is present
+     * @return Number of elements present
+     * @complexity O(count) average
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     * 
+     * @note This is an alias for contains_batch() for API consistency.
+     */
+    size_t find_batch(const T* values, size_t count, bool* out_found) const;
+    
     /**
      * @brief Check if the set is empty.
      * 
@@ -502,19 +554,31 @@ size_t AtomicSet<T, Hash, KeyEqual>::hash_key(const T& key) const {
 }
 
 template<typename T, typename Hash, typename KeyEqual>
-size_t AtomicSet<T, Hash, KeyEqual>::get_bucket_index(const T& key) const {
-    return hash_key(key) % bucket_count_.load(std::memory_order_acquire);
+size_t AtomicSet<T, Hash, KeyEqual>::get_bucket_index(size_t hash) const {
+    return hash % bucket_count_.load(std::memory_order_acquire);
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+bool AtomicSet<T, Hash, KeyEqual>::node_matches(const Node* node, const T& key, size_t hash) const {
+    // Different hashes prove different elements without touching the element's storage
+    return node->hash == hash && key_equal_(node->data, key);
 }
 
 template<typename T, typename Hash, typename KeyEqual>
 typename AtomicSet<T, Hash, KeyEqual>::Node*
-AtomicSet<T, Hash, KeyEqual>::find_node(const T& key, Bucket& bucket) const {
-    Node* current = bucket.head.load(std::memory_order_acquire);
+AtomicSet<T, Hash, KeyEqual>::find_node(const T& key, size_t hash, Bucket& bucket) const {
+    return find_in_chain(bucket.head.load(std::memory_order_acquire), key, hash);
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+typename AtomicSet<T, Hash, KeyEqual>::Node*
+AtomicSet<T, Hash, KeyEqual>::find_in_chain(Node* head, const T& key, size_t hash) const {
+    Node* current = head;
     
     while (current) {
         // Use relaxed ordering for better performance in hot path
         if (!current->deleted.load(std::memory_order_relaxed) && 
-            key_equal_(current->data, key)) {
+            node_matches(current, key, hash)) {
             return current;
         }
         
@@ -528,15 +592,16 @@ template<typename T, typename Hash, typename KeyEqual>
 bool AtomicSet<T, Hash, KeyEqual>::insert(const T& value) {
     resize_if_needed();
     
-    size_t bucket_index = get_bucket_index(value);
+    size_t hash = hash_key(value);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
     // Pre-check for existing value using optimized find
-    if (find_node(value, bucket) != nullptr) {
+    if (find_node(value, hash, bucket) != nullptr) {
         return false; // Value already exists
     }
     
-    Node* new_node = new Node(value);
+    Node* new_node = new Node(hash, value);
     
     int attempts = 0;
     while (attempts < 100) { // Reduced from 1000
@@ -561,24 +626,28 @@ template<typename T, typename Hash, typename KeyEqual>
 bool AtomicSet<T, Hash, KeyEqual>::insert(T&& value) {
     resize_if_needed();
     
-    size_t bucket_index = get_bucket_index(value);
+    size_t hash = hash_key(value);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
+    // Built once so a failed CAS does not leave value moved-from for the next attempt
+    Node* new_node = new Node(hash, std::move(value));
+    
     int attempts = 0;
     while (attempts < 1000) {
         // First check for duplicates
-        Node* current = bucket.head.load(std::memory_order_acquire);
+        Node* head = bucket.head.load(std::memory_order_acquire);
+        Node* current = head;
         while (current) {
             if (!current->deleted.load(std::memory_order_acquire) && 
-                key_equal_(current->data, value)) {
+                node_matches(current, new_node->data, hash)) {
+                delete new_node;
                 return false; // Duplicate found
             }
             current = current->next.load(std::memory_order_acquire);
         }
         
         // No duplicate found, try to insert
-        Node* new_node = new Node(std::move(value));
-        Node* head = bucket.head.load(std::memory_order_acquire);
         new_node->next.store(head, std::memory_order_relaxed);
         
         if (bucket.head.compare_exchange_weak(head, new_node,
@@ -588,10 +657,10 @@ bool AtomicSet<T, Hash, KeyEqual>::insert(T&& value) {
             return true;
         }
         
-        delete new_node;
         attempts++;
     }
     
+    delete new_node;
     return false;
 }
 
@@ -603,10 +672,11 @@ bool AtomicSet<T, Hash, KeyEqual>::emplace(Args&&... args) {
 
 template<typename T, typename Hash, typename KeyEqual>
 bool AtomicSet<T, Hash, KeyEqual>::erase(const T& value) {
-    size_t bucket_index = get_bucket_index(value);
+    size_t hash = hash_key(value);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = buckets_[bucket_index];
     
-    Node* node = find_node(value, bucket);
+    Node* node = find_node(value, hash, bucket);
     if (node) {
         bool expected = false;
         if (node->deleted.compare_exchange_strong(expected, true,
@@ -622,10 +692,11 @@ bool AtomicSet<T, Hash, KeyEqual>::erase(const T& value) {
 
 template<typename T, typename Hash, typename KeyEqual>
 bool AtomicSet<T, Hash, KeyEqual>::contains(const T& value) const {
-    size_t bucket_index = get_bucket_index(value);
+    size_t hash = hash_key(value);
+    size_t bucket_index = get_bucket_index(hash);
     Bucket& bucket = const_cast<Bucket&>(buckets_[bucket_index]);
     
-    Node* node = find_node(value, bucket);
+    Node* node = find_node(value, hash, bucket);
     return node != nullptr;
 }
 
@@ -634,6 +705,45 @@ bool AtomicSet<T, Hash, KeyEqual>::find(const T& value) const {
     return contains(value);
 }
 
+template<typename T, typename Hash, typename KeyEqual>
+size_t AtomicSet<T, Hash, KeyEqual>::contains_batch(const T* values, size_t count, bool* out_found) const {
+    size_t hashes[BATCH_GROUP_SIZE];
+    Node* heads[BATCH_GROUP_SIZE];
+    size_t found = 0;
+    const size_t buckets = bucket_count_.load(std::memory_order_acquire);
+    
+    for (size_t base = 0; base < count; base += BATCH_GROUP_SIZE) {
+        const size_t group = std::min(BATCH_GROUP_SIZE, count - base);
+        
+        // Stage 1: hash every element and start loading its bucket head
+        for (size_t i = 0; i < group; ++i) {
+            hashes[i] = hash_key(values[base + i]);
+            prefetch_read(&buckets_[hashes[i] % buckets]);
+        }
+        
+        // Stage 2: read the heads and start loading the first node of every chain
+        for (size_t i = 0; i < group; ++i) {
+            heads[i] = buckets_[hashes[i] % buckets].head.load(std::memory_order_acquire);
+            if (heads[i]) {
+                prefetch_read(heads[i]);
+            }
+        }
+        
+        // Stage 3: walk the chains, whose first nodes are now cached or in flight
+        for (size_t i = 0; i < group; ++i) {
+            out_found[base + i] = find_in_chain(heads[i], values[base + i], hashes[i]) != nullptr;
+            found += out_found[base + i] ? 1 : 0;
+        }
+    }
+    
+    return found;
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+size_t AtomicSet<T, Hash, KeyEqual>::find_batch(const T* values, size_t count, bool* out_found) const {
+    return contains_batch(values, count, out_found);
+}
+
 template<typename T, typename Hash, typename KeyEqual>
 bool AtomicSet<T, Hash, KeyEqual>::empty() const {
     for (const auto& bucket : buckets_) {
@@ -5,10 +5,30 @@
 #include <random>
 #include <functional>
 #include <array>
+#include <vector>
 #include <type_traits>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include "inline_value.hpp"
 
 namespace lockfree {
 
+/**
+ * @brief Who builds the index levels of an AtomicSkipList.
+ */
+enum class IndexMode {
+    EAGER,          ///< insert() links each node at a random height; erase() unlinks the whole tower
+    BACKGROUND,     ///< insert() and erase() touch level 0 only; a maintenance thread builds the index
+    MANUAL          ///< Like BACKGROUND, but the index is built only by calls to maintain()
+};
+
 /**
  * @brief A lock-free, thread-safe skip list implementation for ordered key-value storage.
  * 
@@ -31,6 +51,16 @@ namespace lockfree {
  * - Move semantics: Efficient for move-only and expensive-to-copy types
  * - Iterator support: Forward iteration through sorted elements
  * - Template predicates: Support for custom search predicates
+ * - Key prefix caching: std::string / std::string_view keys compare by a cached
+ *   8-byte prefix first, so most search steps never touch the key's heap buffer
+ * - Sorted batches: find_sorted_batch()/insert_sorted_batch() resume each search
+ *   from the previous key's predecessors instead of from the head
+ * - Reverse scans: rbegin()/rend() and reverse_range() walk keys newest-first
+ *   by descending the index to each predecessor; there are no back pointers
+ * - No-hot-spot mode: with IndexMode::BACKGROUND, writers touch level 0 only and
+ *   a maintenance thread raises, lowers and cleans the index levels
+ * - In-place updates: for word-sized trivially copyable values, insert_or_assign()
+ *   and compute() swap the value of an existing key with one CAS after one search
  * 
  * Performance Characteristics:
  * - Insert: O(log n) average, O(n) worst case
@@ -43,14 +73,21 @@ namespace lockfree {
  * - Uses probabilistic skip list algorithm with sentinel nodes
  * - Each node has a randomly determined level (height)
  * - Higher levels provide "express lanes" for faster traversal
- * - Logical deletion (marking) for safe concurrent access
+ * - Erase marks the low bit of each next pointer of a node's tower, top level
+ *   first, then unlinks the tower at every level (Harris-style marking)
  * - Compare-and-swap operations for atomic pointer updates
  * - No atomic size counter to eliminate contention bottleneck
  * 
  * Memory Management:
  * - Uses dynamic allocation for nodes with variable-height arrays
- * - Marked nodes are cleaned up during search operations
- * - All memory is properly cleaned up in destructor
+ * - Erased nodes are unlinked by erase() and insert(); lookups never write.
+ *   With a deferred index, erase() only marks and the maintainer unlinks
+ * - Erased nodes are kept on a retired list until the destructor, since
+ *   concurrent readers and iterators may still be standing on them. Memory
+ *   therefore grows with the total number of erases, not with size(): a list
+ *   with heavy insert/erase churn should be rebuilt periodically, and word-sized
+ *   values should be updated with compute() or insert_or_assign(), which reuse
+ *   the node
  * - Thread-local random number generation for level assignment
  * 
  * Usage Example:
@@ -85,7 +122,20 @@ namespace lockfree {
  * }
  * @endcode
  * 
- * @note This implementation uses logical deletion for safe concurrent access.
+ * @note An erased key can be inserted again at once; the new node does not
+ *       wait for the old one to be unlinked.
+ * 
+ * Index Modes:
+ * In IndexMode::EAGER every insert() links its node at up to 32 levels, so
+ * concurrent writers contend on the upper levels near the head. In
+ * IndexMode::BACKGROUND and IndexMode::MANUAL (after Crain, Gramoli and
+ * Raynal's no-hot-spot skip list) insert() links at level 0 only and erase()
+ * only marks the node. A single maintainer, either the background thread or
+ * maintain(), walks each level and raises a node once two unindexed nodes
+ * follow the last indexed one. It also lowers towers that end up adjacent and
+ * unlinks erased towers, so upper levels have exactly one writer. Searches
+ * stay O(log n) once the maintainer has caught up; keys inserted since then
+ * are found by a short walk along level 0.
  * @warning Random level generation uses thread-local storage and may not be fully deterministic.
  */
 template<typename Key, typename Value, typename Compare = std::less<Key>>
@@ -93,18 +143,33 @@ class AtomicSkipList {
 private:
     static constexpr int MAX_LEVEL = 32;        ///< Maximum number of levels in the skip list
     
+    /**
+     * @brief Whether nodes cache an order-preserving prefix of their key.
+     * 
+     * Enabled for std::string and std::string_view keys ordered by std::less,
+     * whose order is memcmp order on the key bytes. The first 8 bytes, zero
+     * padded and read big-endian, then order like the keys themselves: unequal
+     * prefixes decide a comparison with one integer compare, and only equal
+     * prefixes fall back to the full comparator.
+     */
+    static constexpr bool PREFIX_KEYS =
+        (std::is_same_v<Key, std::string> || std::is_same_v<Key, std::string_view>) &&
+        (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>);
+    
     /**
      * @brief Internal node structure for skip list elements.
      * 
-     * Each node contains a key-value pair, its level (height), an array of atomic
-     * pointers to next nodes at each level, and an atomic deletion flag.
+     * Each node contains a key-value pair, its level (height) and an array of atomic
+     * pointers to next nodes at each level. A node is erased once the low bit of
+     * its level-0 pointer is set; see MARK.
      */
     struct Node {
+        uint64_t prefix;                                    ///< Cached key prefix when PREFIX_KEYS, otherwise 0
         Key key;                                            ///< The stored key
-        Value value;                                        ///< The stored value
+        alignas(atomic_word_alignment<Value>()) Value value;  ///< The stored value; accessed atomically for an AtomicWordValue
         std::atomic<int> level;                             ///< The level (height) of this node
-        std::array<std::atomic<Node*>, MAX_LEVEL> next;     ///< Atomic pointers to next nodes at each level
-        std::atomic<bool> marked;                           ///< Atomic flag indicating logical deletion
+        std::array<std::atomic<Node*>, MAX_LEVEL> next;     ///< Atomic pointers to next nodes at each level, possibly marked
+        Node* retired_next = nullptr;                       ///< Next node in the retired list once erased
         
         /**
          * @brief Construct node with copied key and value.
@@ -113,9 +178,9 @@ private:
          * @param lvl The level (height) for this node
          */
         Node(const Key& k, const Value& v, int lvl) 
-            : key(k), value(v), level(lvl), marked(false) {
+            : prefix(key_prefix(k)), key(k), value(v), level(lvl) {
             for (int i = 0; i < MAX_LEVEL; ++i) {
-                next[i].store(nullptr);
+                next[i].store(nullptr, std::memory_order_relaxed);
             }
         }
         
@@ -126,18 +191,114 @@ private:
          * @param lvl The level (height) for this node
          */
         Node(Key&& k, Value&& v, int lvl) 
-            : key(std::move(k)), value(std::move(v)), level(lvl), marked(false) {
+            : prefix(key_prefix(k)), key(std::move(k)), value(std::move(v)), level(lvl) {
             for (int i = 0; i < MAX_LEVEL; ++i) {
-                next[i].store(nullptr);
+                next[i].store(nullptr, std::memory_order_relaxed);
             }
         }
     };
     
     Node* head_;                                ///< Sentinel head node
     Node* tail_;                                ///< Sentinel tail node
+    std::atomic<Node*> retired_{nullptr};       ///< Erased nodes, freed by the destructor
+    IndexMode mode_;                            ///< Who builds the index levels
+    std::atomic<bool> maintaining_{false};      ///< A maintain() pass is running
+    std::atomic<bool> stop_{false};             ///< Maintenance thread shutdown flag
+    std::mutex sleep_mutex_;                    ///< Guards the maintenance thread's idle wait
+    std::condition_variable sleep_cv_;          ///< Wakes the maintenance thread for shutdown
+    std::thread maintainer_;                    ///< Background maintenance thread (IndexMode::BACKGROUND)
     // Removed atomic size counter - O(n) size() to eliminate contention
     Compare comparator_;                        ///< Comparison function for keys
     
+    /**
+     * @brief A search key together with its prefix, computed once per operation.
+     */
+    struct Probe {
+        const Key& key;                         ///< The key being searched for
+        uint64_t prefix;                        ///< key_prefix(key)
+    };
+    
+    /**
+     * @brief Big-endian first 8 bytes of a string key, zero padded; 0 when !PREFIX_KEYS.
+     */
+    static uint64_t key_prefix(const Key& key) {
+        if constexpr (PREFIX_KEYS) {
+            const std::string_view bytes(key);
+            unsigned char buffer[8] = {};
+            std::memcpy(buffer, bytes.data(), std::min<size_t>(bytes.size(), sizeof(buffer)));
+            uint64_t prefix = 0;
+            for (unsigned char byte : buffer) {
+                prefix = (prefix << 8) | byte;
+            }
+            return prefix;
+        } else {
+            (void)key;
+            return 0;
+        }
+    }
+    
+    Probe probe(const Key& key) const {
+        return Probe{key, key_prefix(key)};
+    }
+    
+    /**
+     * @brief Whether the probe orders before the node's key.
+     */
+    bool probe_less(const Probe& target, const Node* node) const {
+        if constexpr (PREFIX_KEYS) {
+            if (target.prefix != node->prefix) {
+                return target.prefix < node->prefix;
+            }
+        }
+        return comparator_(target.key, node->key);
+    }
+    
+    /**
+     * @brief Whether the node's key orders before the probe.
+     */
+    bool node_less(const Node* node, const Probe& target) const {
+        if constexpr (PREFIX_KEYS) {
+            if (target.prefix != node->prefix) {
+                return node->prefix < target.prefix;
+            }
+        }
+        return comparator_(node->key, target.key);
+    }
+    
+    /**
+     * @brief Deletion mark in the low bit of a next pointer.
+     * 
+     * erase() marks a node's pointers top-down and then level 0, which is the
+     * linearization point. A marked pointer is never changed again, so a CAS
+     * that expects an unmarked successor cannot link a new node behind an
+     * erased one, and unlinking an erased node cannot lose a concurrent insert.
+     */
+    static constexpr uintptr_t MARK = 1;
+    static constexpr int MAX_INSERT_ATTEMPTS = 1000;    ///< Level-0 linking attempts before insert() gives up
+    static constexpr int MAX_LEVEL_ATTEMPTS = 100;      ///< Linking attempts per upper level (best effort)
+    static constexpr auto MAINTENANCE_IDLE_MAX = std::chrono::milliseconds(64);   ///< Longest idle wait between passes
+    static constexpr int REVERSE_CHUNK_LEVEL = 4;       ///< reverse_range() buffers the level-0 run below one node of this level
+    static constexpr size_t REVERSE_MIN_WINDOW = 64;    ///< Newest keys of a long run reverse_range() keeps on its first pass
+    
+    static bool is_marked(Node* link) {
+        return (reinterpret_cast<uintptr_t>(link) & MARK) != 0;
+    }
+    
+    static Node* unmarked(Node* link) {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) & ~MARK);
+    }
+    
+    static Node* with_mark(Node* link) {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) | MARK);
+    }
+    
+    /**
+     * @brief Whether the node has been erased (its level-0 pointer is marked).
+     */
+    static bool is_erased(const Node* node) {
+        return is_marked(node->next[0].load(std::memory_order_acquire));
+    }
+    
     /**
      * @brief Thread-local random number generator for level generation.
      */
@@ -150,34 +311,159 @@ private:
     int random_level();
     
     /**
-     * @brief Find predecessor nodes for a given key at all levels.
-     * @param key The key to search for predecessors of
-     * @return Array of predecessor nodes at each level
+     * @brief Locate the predecessors and successors of a key at every level, unlinking erased nodes.
+     * 
+     * @param target The key to search for
+     * @param preds Receives the last node ordered before target at each level
+     * @param succs Receives the first node not ordered before target at each level
+     * @return true if a live node with an equal key follows at level 0
+     */
+    bool locate(const Probe& target, std::array<Node*, MAX_LEVEL>& preds, std::array<Node*, MAX_LEVEL>& succs);
+    
+    /**
+     * @brief Find the live node with an equal key without modifying links.
+     * @return The node, or nullptr if the key is not present
+     */
+    Node* find_node(const Probe& target) const;
+    
+    /**
+     * @brief Descend to the last live node ordered before bound.
+     * 
+     * @param bound Key to stay before, or nullptr for the last node of the list
+     * @param inclusive Whether a node equal to bound counts as before it
+     * @param stop_level Level at which the descent stops; 0 for the exact predecessor
+     * @return The node, or head_ if there is none
+     */
+    Node* last_before(const Probe* bound, bool inclusive, int stop_level) const;
+    
+    /**
+     * @brief Link a new node at level 0 and then at its upper levels.
+     * 
+     * @param node Unpublished node; deleted if the key turns out to be present
+     * @param preds Predecessors from a locate() that did not find the key
+     * @param succs Successors from the same locate()
+     * @return true if linked, false if the key is present or the attempts ran out
+     */
+    bool link_node(Node* node, std::array<Node*, MAX_LEVEL>& preds, std::array<Node*, MAX_LEVEL>& succs);
+    
+    /**
+     * @brief Link a node already in level 0 into levels 1..level, best effort.
+     * 
+     * Stops growing the tower if the node is erased meanwhile, and makes sure
+     * an erased node is not left linked at any level.
+     */
+    void link_upper_levels(Node* node, const Probe& target, std::array<Node*, MAX_LEVEL>& preds,
+                           std::array<Node*, MAX_LEVEL>& succs);
+    
+    /**
+     * @brief Push an erased node onto the retired list.
+     */
+    void retire(Node* node);
+    
+    /**
+     * @brief Read a node's value; an AtomicWordValue is loaded atomically, anything else is referenced.
+     */
+    static decltype(auto) read_value(Node* node) {
+        if constexpr (AtomicWordValue<Value>) {
+            return std::atomic_ref<Value>(node->value).load(std::memory_order_acquire);
+        } else {
+            return (node->value);
+        }
+    }
+    
+    /**
+     * @brief Replace a live node's value with func(current value) by compare-and-swap.
+     * @return true once replaced, false if the node is erased first
+     */
+    template<typename Func>
+    static bool replace_value(Node* node, Func& func) {
+        std::atomic_ref<Value> slot(node->value);
+        Value current = slot.load(std::memory_order_acquire);
+        while (!is_erased(node)) {
+            if (slot.compare_exchange_weak(current, func(static_cast<const Value&>(current)),
+                                           std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Whether upper levels are left to the maintainer (IndexMode::BACKGROUND or MANUAL).
+     */
+    bool deferred_index() const {
+        return mode_ != IndexMode::EAGER;
+    }
+    
+    /**
+     * @brief Height for a new node: random when eager, level 0 when the maintainer builds the index.
+     */
+    int new_level() {
+        return deferred_index() ? 0 : random_level();
+    }
+    
+    /**
+     * @brief Unlink the erased nodes still in level 0.
+     * @return Number of nodes unlinked
      */
-    std::array<Node*, MAX_LEVEL> find_predecessors(const Key& key);
+    size_t clean_level0();
+    
+    /**
+     * @brief Rebuild one index level from the level below it.
+     * 
+     * Walks level - 1 and level together: erased nodes are unlinked from
+     * level, a node is raised once two nodes of level - 1 follow the last node
+     * of level, and the top of a tower directly behind another is lowered.
+     * 
+     * @return Number of links changed
+     */
+    size_t maintain_level(int level);
+    
+    /**
+     * @brief Body of the IndexMode::BACKGROUND thread; idles longer while passes find nothing to do.
+     */
+    void maintainer_loop();
+    
+    /**
+     * @brief Move a finger of per-level predecessors forward to target.
+     * 
+     * On entry every fingers[i] must be head_ or a node ordered before target.
+     * The search climbs from level 0 only until a level's successor is no longer
+     * before target, then descends from there, so a target at distance d from
+     * the previous one costs O(log d) instead of a descent from the head. On
+     * return fingers[0..climbed level] are the predecessors of target; the
+     * levels above are left as they were and remain ordered before target.
+     * 
+     * @param fingers Per-level predecessors, updated in place
+     * @param target The key to search for
+     * @return The first level-0 node not ordered before target (tail_ if none)
+     */
+    Node* advance_finger(std::array<Node*, MAX_LEVEL>& fingers, const Probe& target) const;
     
 public:
     /**
      * @brief Default constructor. Creates an empty skip list with sentinel nodes.
      * 
+     * @param mode Who builds the index levels; IndexMode::BACKGROUND starts the
+     *             maintenance thread immediately
      * @complexity O(MAX_LEVEL)
      * @thread_safety Safe
      */
-    AtomicSkipList();
+    explicit AtomicSkipList(IndexMode mode = IndexMode::EAGER);
     
     /**
-     * @brief Destructor. Cleans up all nodes including sentinels.
+     * @brief Destructor. Stops the maintenance thread and cleans up all nodes including sentinels.
      * 
      * @complexity O(n) where n is the number of elements
      * @thread_safety Not safe - should only be called when no other threads are accessing
      */
     ~AtomicSkipList();
     
-    // Non-copyable but movable for resource management
+    // Non-copyable and non-movable: the maintenance thread holds a pointer to this list
     AtomicSkipList(const AtomicSkipList&) = delete;
     AtomicSkipList& operator=(const AtomicSkipList&) = delete;
-    AtomicSkipList(AtomicSkipList&&) = default;
-    AtomicSkipList& operator=(AtomicSkipList&&) = default;
+    AtomicSkipList(AtomicSkipList&&) = delete;
+    AtomicSkipList& operator=(AtomicSkipList&&) = delete;
     
     /**
      * @brief Insert a key-value pair by copying.
@@ -227,7 +513,49 @@ public:
      */
     template<typename... Args>
     bool emplace(const Key& key, Args&&... args);
-    
+
+    /**
+     * @brief Insert a key-value pair or replace the value of an existing key in place.
+     *
+     * Equivalent to compute(key, [&](const Value&) { return value; }).
+     *
+     * @param key The key to write
+     * @param value The value to associate with the key
+     * @return true if the skip list was updated, false only if inserting a new node ran
+     *         out of attempts under extreme contention
+     * @complexity O(log n) average, one search
+     * @thread_safety Safe - lock-free
+     * @exception_safety Basic guarantee - may throw std::bad_alloc when the key is new
+     *
+     * @note Available when Value is an AtomicWordValue (see inline_value.hpp).
+     */
+    bool insert_or_assign(const Key& key, const Value& value) requires AtomicWordValue<Value>;
+
+    /**
+     * @brief Atomically replace the value of a key with func(current value).
+     *
+     * A single search finds the key. If it is present, its value is replaced by
+     * compare-and-swap, so the key never disappears and concurrent compute()
+     * calls on one key never lose an update. If it is absent, a node holding
+     * func(Value{}) is linked where the search ended.
+     *
+     * @tparam Func Callable as Value(const Value&); may be called more than once under
+     *         contention, and only the value of its last call is stored
+     * @param key The key to update
+     * @param func Maps the current value (Value{} for a new key) to the new one
+     * @return true if the skip list was updated, false only if inserting a new node ran
+     *         out of attempts under extreme contention
+     * @complexity O(log n) average, one search plus one CAS per contended retry
+     * @thread_safety Safe - lock-free
+     * @exception_safety Basic guarantee - nothing is changed if func throws
+     *
+     * @note Available when Value is an AtomicWordValue (see inline_value.hpp).
+     *       Updates to an existing key reuse its node, so unlike erase() followed by
+     *       insert() they retire nothing.
+     */
+    template<typename Func>
+    bool compute(const Key& key, Func&& func) requires AtomicWordValue<Value>;
+
     /**
      * @brief Find the value associated with a key.
      * 
@@ -247,7 +575,7 @@ public:
      * @brief Check if the skip list contains a key.
      * 
      * @param key The key to search for
-     * @return true if key is found and not marked for deletion, false otherwise
+     * @return true if key is found and not erased, false otherwise
      * @complexity O(log n) average, O(n) worst case
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
@@ -270,23 +598,138 @@ public:
     template<typename Func>
     bool find_if(const Key& key, Func&& func) const;
     
+    /**
+     * @brief Visit every key-value pair with lo <= key <= hi in ascending order.
+     * 
+     * @tparam Func Callable as bool(const Key&, const Value&); returning false stops the scan
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @param func Visitor applied to each active pair in the range
+     * @return Number of pairs passed to func
+     * @complexity O(log n + k) average where k is the number of pairs visited
+     * @thread_safety Safe
+     * @exception_safety Depends on visitor function's exception safety
+     * 
+     * @note Weakly consistent: concurrent inserts and erases may or may not be observed.
+     */
+    template<typename Func>
+    size_t range(const Key& lo, const Key& hi, Func&& func) const;
+    
+    /**
+     * @brief Visit every key-value pair with lo <= key <= hi in descending order.
+     * 
+     * Level 0 has no back pointers, so the scan descends the index to the
+     * last node of level REVERSE_CHUNK_LEVEL before the current bound, buffers
+     * the level-0 run from there up to the bound and visits it backwards; the
+     * start of the run becomes the next bound. Suited to "latest N" queries:
+     * stopping after N pairs costs O(log n + N) instead of a scan from lo.
+     * 
+     * A run longer than the window (REVERSE_MIN_WINDOW at first) keeps only its
+     * newest keys; the next pass walks the run again up to the oldest key kept,
+     * with the window doubled. This happens when the index is not built yet.
+     * 
+     * @tparam Func Callable as bool(const Key&, const Value&); returning false stops the scan
+     * @param hi Inclusive upper bound, visited first
+     * @param lo Inclusive lower bound
+     * @param func Visitor applied to each active pair in the range
+     * @return Number of pairs passed to func
+     * @complexity O(log n + k) average where k is the number of pairs visited, once the
+     *             index is built. In IndexMode::BACKGROUND or MANUAL, m keys not yet
+     *             indexed below hi cost O(m) time per pass, with O(log m) passes for a
+     *             full scan; stopping after N pairs takes O(m) time and O(N) memory
+     * @thread_safety Safe
+     * @exception_safety Depends on visitor function's exception safety; may throw std::bad_alloc
+     * 
+     * @note Weakly consistent like range(); every pair present for the whole scan is visited once.
+     */
+    template<typename Func>
+    size_t reverse_range(const Key& hi, const Key& lo, Func&& func) const;
+    
+    /**
+     * @brief Look up many keys given in ascending order.
+     * 
+     * Each lookup resumes from the predecessors found for the previous key,
+     * climbing only as many levels as the gap between the two keys requires,
+     * instead of descending from the head. For dense batches (keys close
+     * together in the list) k lookups cost O(k + log n) rather than O(k log n).
+     * 
+     * @param keys Array of count keys in ascending order; duplicates are allowed
+     * @param count Number of keys
+     * @param out_values Array of count values; out_values[i] receives the value of
+     *        keys[i] if it is found and is left untouched otherwise
+     * @param out_found Array of count flags; out_found[i] is set to whether keys[i] was found
+     * @return Number of keys found
+     * @complexity O(k log(n/k)) expected for k keys spread over the list, O(k + log n) when dense
+     * @thread_safety Safe - each key is looked up as by find()
+     * @exception_safety Basic guarantee - depends on Value's copy assignment
+     * 
+     * @note Keys out of order are still found correctly: the search restarts
+     *       from the head for a key that orders before its predecessor in the batch.
+     */
+    size_t find_sorted_batch(const Key* keys, size_t count, Value* out_values, bool* out_found) const;
+    
+    /**
+     * @brief Insert many key-value pairs given in ascending key order.
+     * 
+     * Like find_sorted_batch(), each insertion resumes from the predecessors of
+     * the previous key, so loading a sorted run costs O(k + log n) expected
+     * when the keys are dense. Pairs whose key is already present are skipped.
+     * 
+     * @param pairs Array of count key-value pairs in ascending key order
+     * @param count Number of pairs
+     * @return Number of pairs inserted
+     * @complexity O(k log(n/k)) expected for k keys spread over the list, O(k + log n) when dense
+     * @thread_safety Safe - each pair is inserted as by insert()
+     * @exception_safety Basic guarantee - pairs inserted before an exception remain
+     * 
+     * @note Out-of-order pairs are still inserted correctly, restarting the
+     *       search from the head. Under heavy contention a pair may fall back
+     *       to insert(), with its retry limit.
+     */
+    size_t insert_sorted_batch(const std::pair<Key, Value>* pairs, size_t count);
+    
     /**
      * @brief Remove a key-value pair from the skip list.
      * 
      * @param key The key to remove
-     * @return true if key was found and marked for deletion, false if key not found
+     * @return true if this call removed the key, false if it was not present or a concurrent erase won
      * @complexity O(log n) average, O(n) worst case
      * @thread_safety Safe
-     * @exception_safety Strong guarantee - if operation fails, skip list is unchanged
+     * @exception_safety No-throw guarantee (if Compare does not throw)
      * 
-     * @note Uses logical deletion (marking). Physical removal happens during search operations.
+     * @note Marks the node's next pointers from its top level down to level 0,
+     *       the linearization point, then unlinks it at every level before
+     *       returning. The node's memory is released only by the destructor, so
+     *       every successful erase() adds one node to the list's footprint.
      */
     bool erase(const Key& key);
     
+    /**
+     * @brief Run one index maintenance pass (IndexMode::BACKGROUND or MANUAL).
+     * 
+     * Unlinks erased nodes at every level and raises or lowers towers so
+     * that each index level holds about every other node of the level below.
+     * 
+     * @return Number of links changed; 0 once the index is up to date, in
+     *         IndexMode::EAGER, or if another pass is already running
+     * @complexity O(n)
+     * @thread_safety Safe - concurrent with all operations; concurrent calls
+     *                 return 0 at once instead of running a second pass
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    size_t maintain();
+    
+    /**
+     * @brief Get the index mode chosen at construction.
+     */
+    IndexMode index_mode() const {
+        return mode_;
+    }
+    
     /**
      * @brief Check if the skip list is empty.
      * 
-     * @return true if the skip list contains no unmarked key-value pairs, false otherwise
+     * @return true if the skip list contains no live key-value pairs, false otherwise
      * @complexity O(n)
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
@@ -303,15 +746,14 @@ public:
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
      * 
-     * @note This count may include logically deleted (marked) key-value pairs.
-     *       Result may be immediately outdated in concurrent environment.
+     * @note Result may be immediately outdated in concurrent environment.
      */
     size_t size() const;
     
     /**
      * @brief Forward iterator for traversing the skip list in sorted order.
      * 
-     * The iterator automatically skips over logically deleted (marked) nodes,
+     * The iterator automatically skips over erased nodes that are still linked,
      * providing access only to active key-value pairs in ascending key order.
      */
     class iterator {
@@ -374,7 +816,7 @@ public:
      * @brief Get iterator to the first element (smallest key).
      * 
      * @return Iterator pointing to first active element, or end() if skip list is empty
-     * @complexity O(log n) average - may need to skip marked nodes
+     * @complexity O(1) amortized - may need to skip erased nodes not yet unlinked
      * @thread_safety Safe
      * @exception_safety No-throw guarantee
      */
@@ -389,6 +831,83 @@ public:
      * @exception_safety No-throw guarantee
      */
     iterator end() const;
+    
+    /**
+     * @brief Iterator over the skip list in descending key order.
+     * 
+     * Each increment descends the index to the predecessor of the current
+     * key, so a step costs O(log n) rather than O(1). For long scans prefer
+     * reverse_range(), which descends once per run of keys.
+     * 
+     * @note In IndexMode::BACKGROUND or MANUAL, keys not yet indexed are reached
+     *       along level 0 only: rbegin() and each increment cost O(m) for m such
+     *       keys below the current one. reverse_range() bounds that work per key.
+     */
+    class reverse_iterator {
+    private:
+        const AtomicSkipList* list_;            ///< List being traversed
+        Node* current_;                         ///< Current node; the head sentinel past the smallest key
+        
+    public:
+        /**
+         * @brief Construct reverse iterator pointing to given node.
+         * @param list The list being traversed
+         * @param node The node to point to
+         */
+        reverse_iterator(const AtomicSkipList* list, Node* node);
+        
+        /**
+         * @brief Dereference operator to access current key-value pair.
+         * @return Pair containing the current key and value
+         */
+        std::pair<Key, Value> operator*() const;
+        
+        /**
+         * @brief Pre-increment operator to move to the next smaller key.
+         * @return Reference to this iterator after advancement
+         */
+        reverse_iterator& operator++();
+        
+        /**
+         * @brief Post-increment operator to move to the next smaller key.
+         * @return Copy of iterator before advancement
+         */
+        reverse_iterator operator++(int);
+        
+        /**
+         * @brief Equality comparison operator.
+         * @param other Iterator to compare with
+         * @return true if both iterators point to the same node
+         */
+        bool operator==(const reverse_iterator& other) const;
+        
+        /**
+         * @brief Inequality comparison operator.
+         * @param other Iterator to compare with
+         * @return true if iterators point to different nodes
+         */
+        bool operator!=(const reverse_iterator& other) const;
+    };
+    
+    /**
+     * @brief Get reverse iterator to the last element (largest key).
+     * 
+     * @return Reverse iterator pointing to the last active element, or rend() if skip list is empty
+     * @complexity O(log n) average once the index is built; O(m) for m unindexed keys
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee (if Compare does not throw)
+     */
+    reverse_iterator rbegin() const;
+    
+    /**
+     * @brief Get reverse iterator representing past-the-first.
+     * 
+     * @return Reverse iterator representing the end of a descending scan
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    reverse_iterator rend() const;
 };
 
 // Static member definition
@@ -398,7 +917,9 @@ thread_local std::mt19937 AtomicSkipList<Key, Value, Compare>::rng_(std::random_
 // Implementation starts here
 
 template<typename Key, typename Value, typename Compare>
-AtomicSkipList<Key, Value, Compare>::AtomicSkipList() {
+AtomicSkipList<Key, Value, Compare>::AtomicSkipList(IndexMode mode) : mode_(mode) {
+    static_assert(alignof(Node) > MARK, "next pointers need a free low bit for the deletion mark");
+    
     // Create sentinel nodes with default values
     head_ = new Node(Key{}, Value{}, MAX_LEVEL - 1);
     tail_ = new Node(Key{}, Value{}, MAX_LEVEL - 1);
@@ -407,13 +928,36 @@ AtomicSkipList<Key, Value, Compare>::AtomicSkipList() {
     for (int i = 0; i < MAX_LEVEL; ++i) {
         head_->next[i].store(tail_);
     }
+    
+    if (mode_ == IndexMode::BACKGROUND) {
+        maintainer_ = std::thread([this] { maintainer_loop(); });
+    }
 }
 
 template<typename Key, typename Value, typename Compare>
 AtomicSkipList<Key, Value, Compare>::~AtomicSkipList() {
+    if (maintainer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_.store(true, std::memory_order_release);
+        }
+        sleep_cv_.notify_all();
+        maintainer_.join();
+    }
+    
+    // Live nodes are freed along level 0; erased ones, linked or not, from the retired list
     Node* current = head_;
     while (current) {
         Node* next = current->next[0].load();
+        if (!is_marked(next)) {
+            delete current;
+        }
+        current = unmarked(next);
+    }
+    
+    current = retired_.load();
+    while (current) {
+        Node* next = current->retired_next;
         delete current;
         current = next;
     }
@@ -430,157 +974,333 @@ int AtomicSkipList<Key, Value, Compare>::random_level() {
 }
 
 template<typename Key, typename Value, typename Compare>
-std::array<typename AtomicSkipList<Key, Value, Compare>::Node*, AtomicSkipList<Key, Value, Compare>::MAX_LEVEL>
-AtomicSkipList<Key, Value, Compare>::find_predecessors(const Key& key) {
-    std::array<Node*, MAX_LEVEL> predecessors;
-    Node* current = head_;
+bool AtomicSkipList<Key, Value, Compare>::locate(const Probe& target, std::array<Node*, MAX_LEVEL>& preds,
+                                                 std::array<Node*, MAX_LEVEL>& succs) {
+    const bool deferred = deferred_index();
+    while (true) {
+        Node* pred = head_;
+        bool restart = false;
+        
+        for (int level = MAX_LEVEL - 1; level >= 0 && !restart; --level) {
+            Node* current = unmarked(pred->next[level].load(std::memory_order_acquire));
+            while (current != tail_) {
+                Node* next = current->next[level].load(std::memory_order_acquire);
+                if (deferred && level > 0) {
+                    if (is_marked(next) || is_erased(current)) {
+                        current = unmarked(next);   // Only the maintainer unlinks index levels
+                        continue;
+                    }
+                } else if (is_marked(next)) {
+                    Node* expected = current;
+                    if (!pred->next[level].compare_exchange_strong(expected, unmarked(next),
+                                                                   std::memory_order_acq_rel,
+                                                                   std::memory_order_acquire)) {
+                        restart = true;     // pred changed or was erased itself
+                        break;
+                    }
+                    current = unmarked(next);
+                    continue;
+                }
+                if (!node_less(current, target)) {
+                    break;
+                }
+                pred = current;
+                current = next;
+            }
+            preds[level] = pred;
+            succs[level] = current;
+        }
+        
+        if (!restart) {
+            return succs[0] != tail_ && !probe_less(target, succs[0]);
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::Node*
+AtomicSkipList<Key, Value, Compare>::find_node(const Probe& target) const {
+    const bool deferred = deferred_index();
+    Node* pred = head_;
+    Node* current = tail_;
     
     for (int level = MAX_LEVEL - 1; level >= 0; --level) {
-        while (true) {
+        current = unmarked(pred->next[level].load(std::memory_order_acquire));
+        while (current != tail_) {
             Node* next = current->next[level].load(std::memory_order_acquire);
-            
-            if (next == tail_ || comparator_(key, next->key)) {
-                break;
-            }
-            
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Help remove marked node
-                current->next[level].compare_exchange_weak(next, next->next[level].load(),
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
+            // A deferred index may still hold erased towers that level 0 has dropped
+            if (is_marked(next) || (deferred && level > 0 && is_erased(current))) {
+                current = unmarked(next);   // Step over erased nodes; erase() unlinks them
                 continue;
             }
-            
+            if (!node_less(current, target)) {
+                break;
+            }
+            pred = current;
             current = next;
         }
-        predecessors[level] = current;
     }
     
-    return predecessors;
+    if (current != tail_ && !probe_less(target, current) && !is_erased(current)) {
+        return current;
+    }
+    return nullptr;
 }
 
 template<typename Key, typename Value, typename Compare>
-bool AtomicSkipList<Key, Value, Compare>::insert(const Key& key, const Value& value) {
-    int attempts = 0;
-    while (attempts < 1000) {
-        // First check if key already exists
-        if (contains(key)) {
-            return false;
+typename AtomicSkipList<Key, Value, Compare>::Node*
+AtomicSkipList<Key, Value, Compare>::last_before(const Probe* bound, bool inclusive, int stop_level) const {
+    auto before = [&](const Node* node) {
+        return !bound || (inclusive ? !probe_less(*bound, node) : node_less(node, *bound));
+    };
+    
+    Node* current = head_;
+    for (int level = MAX_LEVEL - 1; level >= stop_level; --level) {
+        Node* next = unmarked(current->next[level].load(std::memory_order_acquire));
+        while (next != tail_ && before(next)) {
+            if (!is_erased(next)) {
+                current = next;
+            }
+            next = unmarked(next->next[level].load(std::memory_order_acquire));
         }
-        
-        int level = random_level();
-        Node* new_node = new Node(key, value, level);
-        auto predecessors = find_predecessors(key);
-        
-        // Double-check that key doesn't exist after finding predecessors
-        Node* successor = predecessors[0]->next[0].load(std::memory_order_acquire);
-        if (successor != tail_ && successor != head_ && 
-            !comparator_(key, successor->key) && !comparator_(successor->key, key)) {
-            // Key already exists
-            delete new_node;
-            return false;
+    }
+    return current;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::link_node(Node* node, std::array<Node*, MAX_LEVEL>& preds,
+                                                    std::array<Node*, MAX_LEVEL>& succs) {
+    const Probe target = probe(node->key);
+    const int top = node->level.load(std::memory_order_relaxed);
+    
+    for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS; ++attempts) {
+        if (attempts > 0 && locate(target, preds, succs)) {
+            break;
         }
-        
-        // Link new node at all levels
-        for (int i = 0; i <= level; ++i) {
-            new_node->next[i].store(predecessors[i]->next[i].load(std::memory_order_relaxed));
+        for (int i = 0; i <= top; ++i) {
+            node->next[i].store(succs[i], std::memory_order_relaxed);
         }
         
-        // Try to insert at level 0 first (linearization point)
-        Node* expected = new_node->next[0].load();
-        if (predecessors[0]->next[0].compare_exchange_weak(expected, new_node,
+        // Level 0 is the linearization point; fails if preds[0] changed or was erased
+        Node* expected = succs[0];
+        if (preds[0]->next[0].compare_exchange_strong(expected, node,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+            // Once published, a deferred index may raise the node; only the maintainer links it
+            if (!deferred_index()) {
+                link_upper_levels(node, target, preds, succs);
+            }
+            return true;
+        }
+    }
+    
+    delete node;   // Never published
+    return false;
+}
+
+template<typename Key, typename Value, typename Compare>
+void AtomicSkipList<Key, Value, Compare>::link_upper_levels(Node* node, const Probe& target,
+                                                            std::array<Node*, MAX_LEVEL>& preds,
+                                                            std::array<Node*, MAX_LEVEL>& succs) {
+    const int top = node->level.load(std::memory_order_relaxed);
+    bool growing = true;
+    for (int i = 1; i <= top && growing; ++i) {
+        growing = false;
+        for (int attempts = 0; attempts < MAX_LEVEL_ATTEMPTS; ++attempts) {
+            Node* link = node->next[i].load(std::memory_order_acquire);
+            if (is_marked(link)) {
+                break;   // Being erased; stop growing the tower
+            }
+            if (link != succs[i] &&
+                !node->next[i].compare_exchange_strong(link, succs[i], std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+                break;   // Marked concurrently
+            }
+            Node* expected = succs[i];
+            if (preds[i]->next[i].compare_exchange_strong(expected, node,
                                                           std::memory_order_release,
                                                           std::memory_order_relaxed)) {
-            
-            // Insert at higher levels (best effort)
-            for (int i = 1; i <= level; ++i) {
-                int level_attempts = 0;
-                while (level_attempts < 100) {
-                    Node* level_expected = new_node->next[i].load();
-                    if (predecessors[i]->next[i].compare_exchange_weak(level_expected, new_node,
-                                                                     std::memory_order_release,
-                                                                     std::memory_order_relaxed)) {
-                        break;
-                    }
-                    // Re-find predecessors for this level if CAS failed
-                    auto new_predecessors = find_predecessors(key);
-                    predecessors[i] = new_predecessors[i];
-                    new_node->next[i].store(predecessors[i]->next[i].load());
-                    level_attempts++;
-                }
+                growing = true;
+                break;
+            }
+            // Refresh the neighbourhood; stop if the node has meanwhile been erased
+            if (!locate(target, preds, succs) || succs[0] != node) {
+                break;
             }
-            
-            return true;
-        } else {
-            // Failed to insert at level 0, clean up and retry
-            delete new_node;
-            attempts++;
         }
     }
     
-    return false; // Failed after max attempts
+    // Pairs with the fence in erase(): either we see its mark or its search sees our links
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_erased(node)) {
+        locate(target, preds, succs);
+    }
 }
 
 template<typename Key, typename Value, typename Compare>
-bool AtomicSkipList<Key, Value, Compare>::insert(Key&& key, Value&& value) {
-    int attempts = 0;
-    while (attempts < 1000) {
-        // First check if key already exists
-        if (contains(key)) {
-            return false;
+void AtomicSkipList<Key, Value, Compare>::retire(Node* node) {
+    Node* head = retired_.load(std::memory_order_relaxed);
+    do {
+        node->retired_next = head;
+    } while (!retired_.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t AtomicSkipList<Key, Value, Compare>::clean_level0() {
+    size_t unlinked = 0;
+    Node* pred = head_;
+    Node* current = unmarked(pred->next[0].load(std::memory_order_acquire));
+    while (current != tail_) {
+        Node* next = current->next[0].load(std::memory_order_acquire);
+        if (is_marked(next)) {
+            // On failure pred changed or was erased; the next pass retries
+            Node* expected = current;
+            if (pred->next[0].compare_exchange_strong(expected, unmarked(next), std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+                ++unlinked;
+            }
+            current = unmarked(next);
+            continue;
         }
-        
-        int level = random_level();
-        Node* new_node = new Node(std::move(key), std::move(value), level);
-        auto predecessors = find_predecessors(new_node->key);
-        
-        // Double-check that key doesn't exist after finding predecessors
-        Node* successor = predecessors[0]->next[0].load(std::memory_order_acquire);
-        if (successor != tail_ && successor != head_ && 
-            !comparator_(new_node->key, successor->key) && !comparator_(successor->key, new_node->key)) {
-            // Key already exists
-            delete new_node;
-            return false;
+        pred = current;
+        current = next;
+    }
+    return unlinked;
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t AtomicSkipList<Key, Value, Compare>::maintain_level(int level) {
+    size_t changes = 0;
+    Node* up = head_;                                                       // Last node passed at level
+    Node* above = unmarked(up->next[level].load(std::memory_order_acquire));   // Its successor at level
+    int gap = 0;                                                            // Live nodes below level since up
+    
+    // Unlink above from level. Fails only if up is being erased, whose marked
+    // link can no longer change; above is then passed over like a kept node.
+    auto drop_above = [&]() {
+        Node* after = unmarked(above->next[level].load(std::memory_order_acquire));
+        Node* expected = above;
+        const bool dropped = up->next[level].compare_exchange_strong(expected, after, std::memory_order_acq_rel,
+                                                                     std::memory_order_acquire);
+        if (dropped) {
+            ++changes;
+        } else {
+            up = above;
+            gap = 0;
         }
+        above = after;
+        return dropped;
+    };
+    
+    auto keep_above = [&]() {
+        up = above;
+        gap = 0;
+        above = unmarked(above->next[level].load(std::memory_order_acquire));
+    };
+    
+    Node* current = unmarked(head_->next[level - 1].load(std::memory_order_acquire));
+    while (current != tail_) {
+        const Probe position{current->key, current->prefix};
         
-        // Link new node at all levels
-        for (int i = 0; i <= level; ++i) {
-            new_node->next[i].store(predecessors[i]->next[i].load(std::memory_order_relaxed));
+        // Towers ordered before current have already left level - 1, so they are erased
+        while (above != tail_ && above != current && node_less(above, position)) {
+            if (is_erased(above)) {
+                drop_above();
+            } else {
+                keep_above();
+            }
         }
         
-        // Try to insert at level 0 first (linearization point)
-        Node* expected = new_node->next[0].load();
-        if (predecessors[0]->next[0].compare_exchange_weak(expected, new_node,
-                                                          std::memory_order_release,
-                                                          std::memory_order_relaxed)) {
-            
-            // Insert at higher levels (best effort)
-            for (int i = 1; i <= level; ++i) {
-                int level_attempts = 0;
-                while (level_attempts < 100) {
-                    Node* level_expected = new_node->next[i].load();
-                    if (predecessors[i]->next[i].compare_exchange_weak(level_expected, new_node,
-                                                                     std::memory_order_release,
-                                                                     std::memory_order_relaxed)) {
-                        break;
-                    }
-                    // Re-find predecessors for this level if CAS failed
-                    auto new_predecessors = find_predecessors(new_node->key);
-                    predecessors[i] = new_predecessors[i];
-                    new_node->next[i].store(predecessors[i]->next[i].load());
-                    level_attempts++;
+        Node* next = unmarked(current->next[level - 1].load(std::memory_order_acquire));
+        if (current == above) {
+            if (is_erased(current)) {
+                drop_above();
+            } else if (gap == 0 && current->level.load(std::memory_order_relaxed) == level) {
+                // Directly behind the previous tower: lower this one
+                if (drop_above()) {
+                    current->level.store(level - 1, std::memory_order_relaxed);
+                    gap = 1;
                 }
+            } else {
+                keep_above();
             }
-            
-            return true;
+        } else if (!is_erased(current) && ++gap >= 2) {
+            // Two live nodes since the previous tower: raise this one
+            current->next[level].store(above, std::memory_order_relaxed);
+            current->level.store(level, std::memory_order_relaxed);
+            Node* expected = above;
+            if (up->next[level].compare_exchange_strong(expected, current, std::memory_order_release,
+                                                        std::memory_order_relaxed)) {
+                ++changes;
+                up = current;
+                gap = 0;
+            } else {
+                current->level.store(level - 1, std::memory_order_relaxed);   // up is being erased
+            }
+        }
+        current = next;
+    }
+    
+    // Anything left at level has left level - 1
+    while (above != tail_) {
+        if (is_erased(above)) {
+            drop_above();
         } else {
-            // Failed to insert at level 0, clean up and retry
-            delete new_node;
-            attempts++;
+            keep_above();
         }
     }
+    return changes;
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t AtomicSkipList<Key, Value, Compare>::maintain() {
+    if (!deferred_index() || maintaining_.exchange(true, std::memory_order_acquire)) {
+        return 0;
+    }
+    
+    // Upper levels have no other writer, so each is rebuilt from the one below it
+    size_t changes = clean_level0();
+    for (int level = 1; level < MAX_LEVEL; ++level) {
+        changes += maintain_level(level);
+    }
     
-    return false; // Failed after max attempts
+    maintaining_.store(false, std::memory_order_release);
+    return changes;
+}
+
+template<typename Key, typename Value, typename Compare>
+void AtomicSkipList<Key, Value, Compare>::maintainer_loop() {
+    auto idle = std::chrono::milliseconds(1);
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (maintain() > 0) {
+            idle = std::chrono::milliseconds(1);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.wait_for(lock, idle, [this] { return stop_.load(std::memory_order_acquire); });
+        idle = std::min(idle * 2, MAINTENANCE_IDLE_MAX);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::insert(const Key& key, const Value& value) {
+    std::array<Node*, MAX_LEVEL> preds;
+    std::array<Node*, MAX_LEVEL> succs;
+    if (locate(probe(key), preds, succs)) {
+        return false;
+    }
+    return link_node(new Node(key, value, new_level()), preds, succs);
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::insert(Key&& key, Value&& value) {
+    // Look up before moving, so a rejected key and value are left with the caller
+    std::array<Node*, MAX_LEVEL> preds;
+    std::array<Node*, MAX_LEVEL> succs;
+    if (locate(probe(key), preds, succs)) {
+        return false;
+    }
+    return link_node(new Node(std::move(key), std::move(value), new_level()), preds, succs);
 }
 
 template<typename Key, typename Value, typename Compare>
@@ -589,206 +1309,355 @@ bool AtomicSkipList<Key, Value, Compare>::emplace(const Key& key, Args&&... args
     return insert(key, Value(std::forward<Args>(args)...));
 }
 
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::insert_or_assign(const Key& key, const Value& value)
+    requires AtomicWordValue<Value> {
+    return compute(key, [&](const Value&) { return value; });
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename Func>
+bool AtomicSkipList<Key, Value, Compare>::compute(const Key& key, Func&& func) requires AtomicWordValue<Value> {
+    const Probe target = probe(key);
+    std::array<Node*, MAX_LEVEL> preds;
+    std::array<Node*, MAX_LEVEL> succs;
+    for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS; ++attempts) {
+        if (locate(target, preds, succs)) {
+            if (replace_value(succs[0], func)) {
+                return true;
+            }
+            continue;   // Erased before the swap; insert a fresh node instead
+        }
+        // link_node() gives up when the key appears meanwhile; the next search then updates it
+        if (link_node(new Node(key, func(Value{}), new_level()), preds, succs)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename Key, typename Value, typename Compare>
 bool AtomicSkipList<Key, Value, Compare>::find(const Key& key, Value& result) const {
+    Node* node = find_node(probe(key));
+    if (!node) {
+        return false;
+    }
+    result = read_value(node);
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::contains(const Key& key) const {
+    return find_node(probe(key)) != nullptr;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename Func>
+bool AtomicSkipList<Key, Value, Compare>::find_if(const Key& key, Func&& func) const {
+    Node* node = find_node(probe(key));
+    return node && func(read_value(node));
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename Func>
+size_t AtomicSkipList<Key, Value, Compare>::range(const Key& lo, const Key& hi, Func&& func) const {
+    // Descend the index to the last node ordered before lo
+    const Probe low = probe(lo);
+    const Probe high = probe(hi);
     Node* current = head_;
-    
     for (int level = MAX_LEVEL - 1; level >= 0; --level) {
-        while (true) {
-            Node* next = current->next[level].load(std::memory_order_acquire);
-            
-            if (next == tail_) {
-                break;
-            }
-            
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Skip marked nodes - advance current to next's next
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                // Use compare_exchange to safely update the link, bypassing marked node
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
-                continue;  // Retry from current position
+        Node* next = unmarked(current->next[level].load(std::memory_order_acquire));
+        while (next != tail_ && node_less(next, low)) {
+            if (!is_erased(next)) {
+                current = next;   // An erased node may be unlinked and miss newer nodes
             }
-            
-            if (comparator_(key, next->key)) {
+            next = unmarked(next->next[level].load(std::memory_order_acquire));
+        }
+    }
+    
+    // Walk level 0 until the upper bound
+    size_t visited = 0;
+    Node* node = unmarked(current->next[0].load(std::memory_order_acquire));
+    while (node != tail_ && !probe_less(high, node)) {
+        Node* next = node->next[0].load(std::memory_order_acquire);
+        if (!is_marked(next)) {
+            ++visited;
+            if (!func(static_cast<const Key&>(node->key), static_cast<const Value&>(read_value(node)))) {
                 break;
-            } else if (!comparator_(next->key, key)) {
-                // Found the key - double check it's not marked
-                if (!next->marked.load(std::memory_order_acquire)) {
-                    result = next->value;
-                    return true;
-                }
-                // If marked, continue searching
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
-                continue;
             }
-            
-            current = next;
         }
+        node = unmarked(next);
     }
     
-    return false;
+    return visited;
 }
 
 template<typename Key, typename Value, typename Compare>
-bool AtomicSkipList<Key, Value, Compare>::contains(const Key& key) const {
-    Node* current = head_;
+template<typename Func>
+size_t AtomicSkipList<Key, Value, Compare>::reverse_range(const Key& hi, const Key& lo, Func&& func) const {
+    const Probe low = probe(lo);
+    const Node* previous = nullptr;   // Start of the previous run, the exclusive bound of the next one
+    std::vector<Node*> run;           // Ring of the newest window live nodes of the run
+    size_t window = REVERSE_MIN_WINDOW;
+    size_t visited = 0;
     
-    for (int level = MAX_LEVEL - 1; level >= 0; --level) {
-        while (true) {
-            Node* next = current->next[level].load(std::memory_order_acquire);
-            
-            if (next == tail_) {
-                break;
+    while (true) {
+        const Probe bound = previous ? Probe{previous->key, previous->prefix} : probe(hi);
+        const bool inclusive = !previous;
+        Node* start = last_before(&bound, inclusive, REVERSE_CHUNK_LEVEL);
+        
+        // Buffer the live nodes from start up to the bound, keeping the newest window of them
+        run.clear();
+        size_t seen = 0;
+        Node* node = start == head_ ? unmarked(head_->next[0].load(std::memory_order_acquire)) : start;
+        while (node != tail_ && (inclusive ? !probe_less(bound, node) : node_less(node, bound))) {
+            Node* next = node->next[0].load(std::memory_order_acquire);
+            if (!is_marked(next) && !node_less(node, low)) {
+                if (run.size() < window) {
+                    run.push_back(node);
+                } else {
+                    run[seen % window] = node;
+                }
+                ++seen;
             }
-            
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Skip marked nodes - advance current to next's next
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                // Use compare_exchange to safely update the link, bypassing marked node
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
-                continue;  // Retry from current position
+            node = unmarked(next);
+        }
+        
+        for (size_t i = 0; i < run.size(); ++i) {
+            Node* current = run[(seen - 1 - i) % run.size()];
+            ++visited;
+            if (!func(static_cast<const Key&>(current->key), static_cast<const Value&>(read_value(current)))) {
+                return visited;
             }
-            
-            if (comparator_(key, next->key)) {
+        }
+        
+        if (seen > run.size()) {
+            // Unindexed stretch: resume below the oldest node kept, with a larger window
+            previous = run[seen % window];
+            window *= 2;
+            continue;
+        }
+        if (start == head_ || node_less(start, low)) {
+            return visited;
+        }
+        previous = start;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::Node*
+AtomicSkipList<Key, Value, Compare>::advance_finger(std::array<Node*, MAX_LEVEL>& fingers, const Probe& target) const {
+    // Climb until the successor at this level is no longer before target
+    int level = 0;
+    while (level < MAX_LEVEL - 1) {
+        Node* next = unmarked(fingers[level]->next[level].load(std::memory_order_acquire));
+        if (next == tail_ || !node_less(next, target)) {
+            break;
+        }
+        ++level;
+    }
+    
+    Node* current = fingers[level];
+    if (current != head_ && is_erased(current)) {
+        // An erased finger may already be unlinked and miss newer nodes; restart from the head
+        fingers.fill(head_);
+        level = MAX_LEVEL - 1;
+        current = head_;
+    }
+    
+    // Return the level-0 successor this walk compared, not a reload that a concurrent insert could precede
+    Node* successor = tail_;
+    for (int i = level; i >= 0; --i) {
+        // The old finger here may be past where the sparser level above reached
+        Node* finger = fingers[i];
+        if (finger != current && finger != head_ && !is_erased(finger) &&
+            (current == head_ || node_less(current, Probe{finger->key, finger->prefix}))) {
+            current = finger;
+        }
+        successor = unmarked(current->next[i].load(std::memory_order_acquire));
+        while (successor != tail_ && node_less(successor, target)) {
+            if (!is_erased(successor)) {
+                current = successor;   // Never leave a finger on an erased node
+            }
+            successor = unmarked(successor->next[i].load(std::memory_order_acquire));
+        }
+        fingers[i] = current;
+    }
+    
+    return successor;
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t AtomicSkipList<Key, Value, Compare>::find_sorted_batch(const Key* keys, size_t count,
+                                                             Value* out_values, bool* out_found) const {
+    std::array<Node*, MAX_LEVEL> fingers;
+    fingers.fill(head_);
+    
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0 && comparator_(keys[i], keys[i - 1])) {
+            fingers.fill(head_);   // Out of order: the fingers are past this key
+        }
+        
+        const Probe target = probe(keys[i]);
+        Node* node = advance_finger(fingers, target);
+        out_found[i] = false;
+        
+        // An erased node may still precede a live one with the same key
+        while (node != tail_ && !probe_less(target, node)) {
+            Node* next = node->next[0].load(std::memory_order_acquire);
+            if (!is_marked(next)) {
+                out_values[i] = read_value(node);
+                out_found[i] = true;
+                ++found;
                 break;
-            } else if (!comparator_(next->key, key)) {
-                // Found the key - double check it's not marked
-                if (!next->marked.load(std::memory_order_acquire)) {
-                    return true;
-                }
-                // If marked, continue searching
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
-                continue;
             }
-            
-            current = next;
+            node = unmarked(next);
         }
     }
     
-    return false;
+    return found;
 }
 
 template<typename Key, typename Value, typename Compare>
-template<typename Func>
-bool AtomicSkipList<Key, Value, Compare>::find_if(const Key& key, Func&& func) const {
-    Node* current = head_;
+size_t AtomicSkipList<Key, Value, Compare>::insert_sorted_batch(const std::pair<Key, Value>* pairs, size_t count) {
+    std::array<Node*, MAX_LEVEL> fingers;
+    std::array<Node*, MAX_LEVEL> succs;
+    fingers.fill(head_);
     
-    for (int level = MAX_LEVEL - 1; level >= 0; --level) {
-        while (true) {
-            Node* next = current->next[level].load(std::memory_order_acquire);
+    size_t inserted = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0 && comparator_(pairs[i].first, pairs[i - 1].first)) {
+            fingers.fill(head_);   // Out of order: the fingers are past this key
+        }
+        
+        const Probe target = probe(pairs[i].first);
+        Node* new_node = nullptr;
+        bool settled = false;
+        
+        for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS && !settled; ++attempts) {
+            Node* successor = advance_finger(fingers, target);
+            if (fingers[0] != head_ && is_erased(fingers[0])) {
+                fingers.fill(head_);   // A CAS on an erased finger's marked link can never succeed
+                continue;
+            }
             
-            if (next == tail_) {
+            // Present unless every node with this key is erased
+            bool present = false;
+            for (Node* equal = successor; equal != tail_ && !probe_less(target, equal);
+                 equal = unmarked(equal->next[0].load(std::memory_order_acquire))) {
+                if (!is_erased(equal)) {
+                    present = true;
+                    break;
+                }
+            }
+            if (present) {
+                settled = true;
                 break;
             }
             
-            if (next->marked.load(std::memory_order_acquire)) {
-                // Skip marked nodes - advance current to next's next
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                // Use compare_exchange to safely update the link, bypassing marked node
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
-                continue;  // Retry from current position
+            if (!new_node) {
+                new_node = new Node(pairs[i].first, pairs[i].second, new_level());
             }
             
-            if (comparator_(key, next->key)) {
-                break;
-            } else if (!comparator_(next->key, key)) {
-                // Found the key - double check it's not marked before applying predicate
-                if (!next->marked.load(std::memory_order_acquire)) {
-                    return func(next->value);
-                }
-                // If marked, continue searching
-                Node* skip_to = next->next[level].load(std::memory_order_acquire);
-                current->next[level].compare_exchange_weak(next, skip_to, 
-                                                         std::memory_order_release,
-                                                         std::memory_order_relaxed);
+            // Level 0 is the linearization point
+            new_node->next[0].store(successor, std::memory_order_relaxed);
+            if (!fingers[0]->next[0].compare_exchange_strong(successor, new_node,
+                                                              std::memory_order_release,
+                                                              std::memory_order_relaxed)) {
+                // Unlink any erased node in the way; locate() leaves valid fingers for target
+                locate(target, fingers, succs);
                 continue;
             }
             
-            current = next;
+            if (!deferred_index()) {
+                // Concurrent inserts may have moved a finger's successor before target
+                const int level = new_node->level.load(std::memory_order_relaxed);
+                for (int l = 1; l <= level; ++l) {
+                    Node* next = unmarked(fingers[l]->next[l].load(std::memory_order_acquire));
+                    while (next != tail_ && node_less(next, target)) {
+                        fingers[l] = next;
+                        next = unmarked(next->next[l].load(std::memory_order_acquire));
+                    }
+                    succs[l] = next;
+                }
+                link_upper_levels(new_node, target, fingers, succs);
+            }
+            
+            new_node = nullptr;
+            ++inserted;
+            settled = true;
+        }
+        
+        delete new_node;
+        if (!settled && insert(pairs[i].first, pairs[i].second)) {
+            ++inserted;
         }
     }
     
-    return false;
+    return inserted;
 }
 
 template<typename Key, typename Value, typename Compare>
 bool AtomicSkipList<Key, Value, Compare>::erase(const Key& key) {
-    // Simplified erase: search only at level 0 for reliable traversal
-    Node* current = head_;
+    const Probe target = probe(key);
+    std::array<Node*, MAX_LEVEL> preds;
+    std::array<Node*, MAX_LEVEL> succs;
+    if (!locate(target, preds, succs)) {
+        return false;
+    }
     
-    while (true) {
-        Node* next = current->next[0].load(std::memory_order_acquire);
-        
-        if (next == tail_) {
-            break;  // Reached end, key not found
-        }
-        
-        if (next->marked.load(std::memory_order_acquire)) {
-            // Skip marked nodes - advance current to next's next
-            Node* skip_to = next->next[0].load(std::memory_order_acquire);
-            // Use compare_exchange to safely update the link, bypassing marked node
-            current->next[0].compare_exchange_weak(next, skip_to, 
-                                                 std::memory_order_release,
-                                                 std::memory_order_relaxed);
-            continue;  // Retry from current position
+    // Mark the tower top-down so no insert can link behind the node at any level
+    Node* node = succs[0];
+    for (int level = node->level.load(std::memory_order_relaxed); level >= 1; --level) {
+        Node* link = node->next[level].load(std::memory_order_acquire);
+        while (!is_marked(link) &&
+               !node->next[level].compare_exchange_weak(link, with_mark(link), std::memory_order_acq_rel,
+                                                        std::memory_order_acquire)) {
         }
-        
-        if (comparator_(key, next->key)) {
-            break;  // Key would be before this node, so not found
-        } else if (!comparator_(next->key, key)) {
-            // Found the key - try to mark it for deletion
-            bool expected = false;
-            if (next->marked.compare_exchange_strong(expected, true,
-                                                   std::memory_order_release,
-                                                   std::memory_order_relaxed)) {
-                return true;
+    }
+    
+    Node* link = node->next[0].load(std::memory_order_acquire);
+    while (!is_marked(link)) {
+        if (node->next[0].compare_exchange_weak(link, with_mark(link), std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+            if (!deferred_index()) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                locate(target, preds, succs);   // Unlinks the tower at every level
             }
-            // If marking failed, node was already marked by another thread
-            return false;
+            retire(node);
+            return true;
         }
-        
-        current = next;
     }
-    
-    return false;  // Key not found
+    return false;   // A concurrent erase won
 }
 
 template<typename Key, typename Value, typename Compare>
 bool AtomicSkipList<Key, Value, Compare>::empty() const {
-    Node* current = head_->next[0].load(std::memory_order_acquire);
+    Node* current = unmarked(head_->next[0].load(std::memory_order_acquire));
     
     while (current != tail_) {
-        if (!current->marked.load(std::memory_order_acquire)) {
-            return false; // Found an unmarked node
+        Node* next = current->next[0].load(std::memory_order_acquire);
+        if (!is_marked(next)) {
+            return false; // Found a live node
         }
-        current = current->next[0].load(std::memory_order_acquire);
+        current = unmarked(next);
     }
     
-    return true; // No unmarked nodes found
+    return true; // No live nodes found
 }
 
 template<typename Key, typename Value, typename Compare>
 size_t AtomicSkipList<Key, Value, Compare>::size() const {
     size_t count = 0;
-    Node* current = head_->next[0].load(std::memory_order_acquire);
+    Node* current = unmarked(head_->next[0].load(std::memory_order_acquire));
     
     while (current != tail_) {
-        if (!current->marked.load(std::memory_order_acquire)) {
+        Node* next = current->next[0].load(std::memory_order_acquire);
+        if (!is_marked(next)) {
             count++;
         }
-        current = current->next[0].load(std::memory_order_acquire);
+        current = unmarked(next);
     }
     
     return count;
@@ -799,25 +1668,25 @@ size_t AtomicSkipList<Key, Value, Compare>::size() const {
 template<typename Key, typename Value, typename Compare>
 AtomicSkipList<Key, Value, Compare>::iterator::iterator(Node* node, Node* tail) 
     : current_(node), tail_(tail) {
-    // Skip to first non-marked node
-    while (current_ != tail_ && current_->marked.load(std::memory_order_acquire)) {
-        current_ = current_->next[0].load(std::memory_order_acquire);
+    // Skip to first live node
+    while (current_ != tail_ && is_erased(current_)) {
+        current_ = unmarked(current_->next[0].load(std::memory_order_acquire));
     }
 }
 
 template<typename Key, typename Value, typename Compare>
 std::pair<Key, Value> AtomicSkipList<Key, Value, Compare>::iterator::operator*() const {
-    return {current_->key, current_->value};
+    return {current_->key, read_value(current_)};
 }
 
 template<typename Key, typename Value, typename Compare>
 typename AtomicSkipList<Key, Value, Compare>::iterator& 
 AtomicSkipList<Key, Value, Compare>::iterator::operator++() {
     if (current_ != tail_) {
-        current_ = current_->next[0].load(std::memory_order_acquire);
-        // Skip marked nodes
-        while (current_ != tail_ && current_->marked.load(std::memory_order_acquire)) {
-            current_ = current_->next[0].load(std::memory_order_acquire);
+        current_ = unmarked(current_->next[0].load(std::memory_order_acquire));
+        // Skip erased nodes
+        while (current_ != tail_ && is_erased(current_)) {
+            current_ = unmarked(current_->next[0].load(std::memory_order_acquire));
         }
     }
     return *this;
@@ -843,7 +1712,7 @@ bool AtomicSkipList<Key, Value, Compare>::iterator::operator!=(const iterator& o
 
 template<typename Key, typename Value, typename Compare>
 typename AtomicSkipList<Key, Value, Compare>::iterator AtomicSkipList<Key, Value, Compare>::begin() const {
-    Node* first = head_->next[0].load(std::memory_order_acquire);
+    Node* first = unmarked(head_->next[0].load(std::memory_order_acquire));
     return iterator(first, tail_);
 }
 
@@ -852,4 +1721,53 @@ typename AtomicSkipList<Key, Value, Compare>::iterator AtomicSkipList<Key, Value
     return iterator(tail_, tail_);
 }
 
-} // namespace lockfree
\ No newline at end of file
+// Reverse iterator implementation
+
+template<typename Key, typename Value, typename Compare>
+AtomicSkipList<Key, Value, Compare>::reverse_iterator::reverse_iterator(const AtomicSkipList* list, Node* node)
+    : list_(list), current_(node) {}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<Key, Value> AtomicSkipList<Key, Value, Compare>::reverse_iterator::operator*() const {
+    return {current_->key, read_value(current_)};
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::reverse_iterator&
+AtomicSkipList<Key, Value, Compare>::reverse_iterator::operator++() {
+    if (current_ != list_->head_) {
+        const Probe bound{current_->key, current_->prefix};
+        current_ = list_->last_before(&bound, false, 0);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::reverse_iterator
+AtomicSkipList<Key, Value, Compare>::reverse_iterator::operator++(int) {
+    reverse_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::reverse_iterator::operator==(const reverse_iterator& other) const {
+    return current_ == other.current_;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool AtomicSkipList<Key, Value, Compare>::reverse_iterator::operator!=(const reverse_iterator& other) const {
+    return !(*this == other);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::reverse_iterator AtomicSkipList<Key, Value, Compare>::rbegin() const {
+    return reverse_iterator(this, last_before(nullptr, false, 0));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename AtomicSkipList<Key, Value, Compare>::reverse_iterator AtomicSkipList<Key, Value, Compare>::rend() const {
+    return reverse_iterator(this, head_);
+}
+
+} // namespace lockfree
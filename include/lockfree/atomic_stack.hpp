@@ -356,7 +356,8 @@ bool AtomicStack<T>::pop(T& result) {
 
 template<typename T>
 bool AtomicStack<T>::empty() const {
-    return head_.load(std::memory_order_seq_cst) == 0;
+    // The ABA counter keeps the packed word non-zero after pops, so test the pointer bits only
+    return PackedPtr(head_.load(std::memory_order_seq_cst)).get_ptr() == nullptr;
 }
 
 template<typename T>
@@ -0,0 +1,477 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <new>
+#include <cstdint>
+#include <cstring>
+#include "hash.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free hash map with string keys stored inline in the nodes.
+ *
+ * AtomicHashMap<std::string, V> keeps a std::string in every node, so any key
+ * longer than the small-string buffer costs a second heap allocation and a lookup
+ * goes bucket -> node -> string buffer. This map allocates each node with its key
+ * bytes directly behind it: one allocation per entry, and the hash, length, value
+ * and key of an entry sit in one contiguous run of cache lines.
+ *
+ * Keys are taken and returned as std::string_view, so lookups never construct a
+ * std::string. The concurrency design is the same as AtomicHashMap: prepend-only
+ * bucket chains published by CAS, logical deletion, and nodes freed when the map
+ * is destroyed.
+ *
+ * @tparam Value The type of values stored.
+ * @tparam Hash Hash function for std::string_view. Defaults to Hasher<std::string_view> (hash.hpp).
+ *
+ * Key Features:
+ * - One allocation per entry, whatever the key length
+ * - Heterogeneous lookup: find/contains/erase take std::string_view
+ * - Cached full hash and key length reject mismatches before any byte compare
+ * - Same lock-free insert/find/erase semantics as AtomicHashMap
+ *
+ * Performance Characteristics:
+ * - Insert: O(1) average, O(n) worst case (hash collisions)
+ * - Find: O(1) average, O(n) worst case (hash collisions)
+ * - Erase: O(1) average, O(n) worst case (hash collisions)
+ * - Memory: one node of sizeof(Node) + key length per entry, plus the bucket array
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicStringHashMap<uint64_t> counters(1 << 16);
+ *
+ * counters.insert("checkout.requests.total", 0);
+ *
+ * uint64_t value;
+ * std::string_view name = request.metric_name();
+ * if (counters.find(name, value)) {
+ *     report(name, value);
+ * }
+ * @endcode
+ *
+ * @note Keys are limited to MAX_KEY_LENGTH bytes.
+ * @note Like AtomicHashMap, the bucket count is fixed at construction.
+ */
+template<typename Value, typename Hash = Hasher<std::string_view>>
+class AtomicStringHashMap {
+private:
+    /**
+     * @brief Entry header; the key bytes follow it in the same allocation.
+     */
+    struct Node {
+        size_t hash;                            ///< Cached hash of the key
+        std::atomic<Node*> next;                ///< Atomic pointer to next node in bucket chain
+        std::atomic<bool> deleted;              ///< Atomic flag indicating logical deletion
+        uint32_t length;                        ///< Key length in bytes
+        [[no_unique_address]] Value value;      ///< The stored value
+
+        template<typename... Args>
+        Node(size_t h, uint32_t len, Args&&... args)
+            : hash(h), next(nullptr), deleted(false), length(len), value(std::forward<Args>(args)...) {}
+
+        const char* key_data() const {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+
+        std::string_view key() const {
+            return {key_data(), length};
+        }
+
+        /**
+         * @brief Allocate a node with room for the key and copy the key in.
+         */
+        template<typename... Args>
+        static Node* create(size_t hash, std::string_view key, Args&&... args) {
+            void* memory = ::operator new(sizeof(Node) + key.size(), std::align_val_t{alignof(Node)});
+            Node* node;
+            try {
+                node = ::new (memory) Node(hash, static_cast<uint32_t>(key.size()), std::forward<Args>(args)...);
+            } catch (...) {
+                ::operator delete(memory, std::align_val_t{alignof(Node)});
+                throw;
+            }
+            std::memcpy(reinterpret_cast<char*>(node + 1), key.data(), key.size());
+            return node;
+        }
+
+        static void destroy(Node* node) {
+            node->~Node();
+            ::operator delete(node, std::align_val_t{alignof(Node)});
+        }
+    };
+
+    /**
+     * @brief Hash table bucket containing the head of a collision chain.
+     */
+    struct Bucket {
+        std::atomic<Node*> head{nullptr};       ///< Atomic pointer to first node in bucket
+    };
+
+    static constexpr size_t INITIAL_BUCKET_COUNT = 1024;    ///< Default bucket count
+    static constexpr int MAX_INSERT_ATTEMPTS = 1000;        ///< Head CAS retries before giving up
+
+    std::vector<Bucket> buckets_;           ///< Fixed array of hash table buckets
+    std::atomic<size_t> size_{0};           ///< Number of live entries
+    Hash hasher_;                           ///< Hash function instance
+
+    Bucket& bucket_for(size_t hash) const {
+        return const_cast<Bucket&>(buckets_[hash % buckets_.size()]);
+    }
+
+    static bool node_matches(const Node* node, std::string_view key, size_t hash) {
+        // Hash and length are in the header; the bytes are only read when both match
+        return node->hash == hash && node->length == key.size() &&
+               std::memcmp(node->key_data(), key.data(), key.size()) == 0;
+    }
+
+    /**
+     * @brief Find a live node with a matching key in a chain.
+     */
+    static Node* find_in_chain(Node* current, std::string_view key, size_t hash) {
+        while (current) {
+            if (!current->deleted.load(std::memory_order_relaxed) && node_matches(current, key, hash)) {
+                return current;
+            }
+            current = current->next.load(std::memory_order_relaxed);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Publish a prepared node unless its key is already present.
+     * @return true if published; the node is destroyed otherwise
+     */
+    bool publish(Bucket& bucket, Node* node) {
+        const std::string_view key = node->key();
+        Node* checked = nullptr;
+        Node* head = bucket.head.load(std::memory_order_acquire);
+
+        for (int attempts = 0; attempts < MAX_INSERT_ATTEMPTS; ++attempts) {
+            // Only nodes prepended since the last check can hold the key
+            for (Node* current = head; current != checked; current = current->next.load(std::memory_order_acquire)) {
+                if (!current->deleted.load(std::memory_order_acquire) && node_matches(current, key, node->hash)) {
+                    Node::destroy(node);
+                    return false;
+                }
+            }
+            checked = head;
+
+            node->next.store(head, std::memory_order_relaxed);
+            if (bucket.head.compare_exchange_weak(head, node,
+                                                  std::memory_order_release,
+                                                  std::memory_order_acquire)) {
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        Node::destroy(node);
+        return false;
+    }
+
+public:
+    static constexpr size_t MAX_KEY_LENGTH = UINT32_MAX;    ///< Longest accepted key in bytes
+
+    /**
+     * @brief Iterator over the live entries; yields the key as a std::string_view.
+     */
+    class iterator {
+    private:
+        const AtomicStringHashMap* map_;    ///< Pointer to the owning map
+        size_t bucket_index_;               ///< Current bucket index
+        Node* current_;                     ///< Current node being pointed to
+
+        void advance_to_next_valid() {
+            while (current_ && current_->deleted.load(std::memory_order_acquire)) {
+                current_ = current_->next.load(std::memory_order_acquire);
+            }
+            while (!current_ && bucket_index_ + 1 < map_->buckets_.size()) {
+                current_ = map_->buckets_[++bucket_index_].head.load(std::memory_order_acquire);
+                while (current_ && current_->deleted.load(std::memory_order_acquire)) {
+                    current_ = current_->next.load(std::memory_order_acquire);
+                }
+            }
+            if (!current_) {
+                bucket_index_ = map_->buckets_.size();
+            }
+        }
+
+    public:
+        iterator(const AtomicStringHashMap* map, size_t bucket_idx, Node* node)
+            : map_(map), bucket_index_(bucket_idx), current_(node) {
+            if (bucket_index_ < map_->buckets_.size()) {
+                advance_to_next_valid();
+            }
+        }
+
+        /**
+         * @brief Dereference operator to access the current entry.
+         * @return Pair of the key (viewing the node's inline bytes) and a reference to the value
+         */
+        std::pair<std::string_view, Value&> operator*() const {
+            return {current_->key(), current_->value};
+        }
+
+        iterator& operator++() {
+            if (current_) {
+                current_ = current_->next.load(std::memory_order_acquire);
+                advance_to_next_valid();
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const {
+            return map_ == other.map_ && bucket_index_ == other.bucket_index_ && current_ == other.current_;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @brief Default constructor. Creates an empty map with the default bucket count.
+     *
+     * @complexity O(bucket_count)
+     * @thread_safety Safe
+     */
+    AtomicStringHashMap() : AtomicStringHashMap(INITIAL_BUCKET_COUNT) {}
+
+    /**
+     * @brief Constructor with custom bucket count.
+     *
+     * @param bucket_count Number of buckets (at least 1)
+     * @complexity O(bucket_count)
+     * @thread_safety Safe
+     */
+    explicit AtomicStringHashMap(size_t bucket_count)
+        : buckets_(bucket_count > 0 ? bucket_count : 1) {}
+
+    /**
+     * @brief Destructor. Frees every node, including logically deleted ones.
+     *
+     * @complexity O(n + m) where n is nodes, m is buckets
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicStringHashMap() {
+        for (auto& bucket : buckets_) {
+            Node* current = bucket.head.load(std::memory_order_acquire);
+            while (current) {
+                Node* next = current->next.load(std::memory_order_relaxed);
+                Node::destroy(current);
+                current = next;
+            }
+        }
+    }
+
+    // Non-copyable and non-movable: nodes are owned through the bucket array
+    AtomicStringHashMap(const AtomicStringHashMap&) = delete;
+    AtomicStringHashMap& operator=(const AtomicStringHashMap&) = delete;
+    AtomicStringHashMap(AtomicStringHashMap&&) = delete;
+    AtomicStringHashMap& operator=(AtomicStringHashMap&&) = delete;
+
+    /**
+     * @brief Insert a key-value pair if the key is not present.
+     *
+     * @param key The key; its bytes are copied into the node
+     * @param value The value to copy
+     * @return true if inserted, false if the key exists, is longer than MAX_KEY_LENGTH,
+     *         or the bucket stayed contended for MAX_INSERT_ATTEMPTS
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - may throw std::bad_alloc before anything is published
+     */
+    bool insert(std::string_view key, const Value& value) {
+        return emplace(key, value);
+    }
+
+    /**
+     * @brief Insert a key-value pair if the key is not present, moving the value.
+     *
+     * @param key The key; its bytes are copied into the node
+     * @param value The value to move
+     * @return true if inserted, false otherwise (see insert(std::string_view, const Value&))
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee
+     */
+    bool insert(std::string_view key, Value&& value) {
+        return emplace(key, std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place for a key if the key is not present.
+     *
+     * @param key The key; its bytes are copied into the node
+     * @param args Arguments forwarded to Value's constructor
+     * @return true if inserted, false otherwise (see insert(std::string_view, const Value&))
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee
+     */
+    template<typename... Args>
+    bool emplace(std::string_view key, Args&&... args) {
+        if (key.size() > MAX_KEY_LENGTH) {
+            return false;
+        }
+        const size_t hash = hasher_(key);
+        Bucket& bucket = bucket_for(hash);
+
+        // Cheap pre-check so duplicates do not allocate
+        if (find_in_chain(bucket.head.load(std::memory_order_acquire), key, hash)) {
+            return false;
+        }
+        return publish(bucket, Node::create(hash, key, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Find the value associated with a key.
+     *
+     * @param key The key to search for
+     * @param result Reference to store the found value
+     * @return true if the key was found and its value copied to result
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - depends on Value's copy assignment
+     */
+    bool find(std::string_view key, Value& result) const {
+        const size_t hash = hasher_(key);
+        Node* node = find_in_chain(bucket_for(hash).head.load(std::memory_order_acquire), key, hash);
+        if (node) {
+            result = node->value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check if the map contains a key.
+     *
+     * @param key The key to search for
+     * @return true if the key is present
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool contains(std::string_view key) const {
+        const size_t hash = hasher_(key);
+        return find_in_chain(bucket_for(hash).head.load(std::memory_order_acquire), key, hash) != nullptr;
+    }
+
+    /**
+     * @brief Apply a predicate to the value of a key.
+     *
+     * @tparam Func Function object type for testing values
+     * @param key The key to search for
+     * @param func Predicate applied to the value if the key is found
+     * @return true if the key was found and the predicate returned true
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Depends on predicate function's exception safety
+     */
+    template<typename Func>
+    bool find_if(std::string_view key, Func&& func) const {
+        const size_t hash = hasher_(key);
+        Node* node = find_in_chain(bucket_for(hash).head.load(std::memory_order_acquire), key, hash);
+        return node && func(node->value);
+    }
+
+    /**
+     * @brief Remove a key (logical deletion).
+     *
+     * @param key The key to remove
+     * @return true if the key was found and marked for deletion
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     *
+     * @note The node's memory is reclaimed when the map is destroyed.
+     */
+    bool erase(std::string_view key) {
+        const size_t hash = hasher_(key);
+        Node* node = find_in_chain(bucket_for(hash).head.load(std::memory_order_acquire), key, hash);
+        bool expected = false;
+        if (node && node->deleted.compare_exchange_strong(expected, true,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed)) {
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get the number of live entries.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check if the map has no live entries.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of buckets.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t bucket_count() const {
+        return buckets_.size();
+    }
+
+    /**
+     * @brief Get the current load factor (entries per bucket).
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    double load_factor() const {
+        return static_cast<double>(size()) / bucket_count();
+    }
+
+    /**
+     * @brief Get iterator to the first live entry.
+     *
+     * @complexity O(bucket_count) worst case - may need to skip empty buckets
+     * @thread_safety Safe - sees a weakly consistent view under concurrent writes
+     * @exception_safety No-throw guarantee
+     */
+    iterator begin() const {
+        return iterator(this, 0, buckets_[0].head.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Get iterator representing past-the-end.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    iterator end() const {
+        return iterator(this, buckets_.size(), nullptr);
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <string_view>
+#include <functional>
+#include "atomic_string_hashmap.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free set of strings stored inline in the nodes.
+ *
+ * The string counterpart of AtomicSet: every element is a single allocation
+ * holding the chain links, the cached hash, the length and the bytes, so a
+ * membership test never follows a pointer into a separate string buffer.
+ * Built on AtomicStringHashMap with an empty value type, which takes no space
+ * in the nodes.
+ *
+ * @tparam Hash Hash function for std::string_view. Defaults to Hasher<std::string_view> (hash.hpp).
+ *
+ * Key Features:
+ * - One allocation per element, whatever its length
+ * - Heterogeneous lookup: contains/erase take std::string_view
+ * - Same lock-free insert/contains/erase semantics as AtomicSet
+ *
+ * Performance Characteristics:
+ * - Insert: O(1) average, O(n) worst case (hash collisions)
+ * - Contains: O(1) average, O(n) worst case (hash collisions)
+ * - Erase: O(1) average, O(n) worst case (hash collisions)
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicStringSet seen(1 << 16);
+ *
+ * if (seen.insert(request.idempotency_key())) {
+ *     process(request);   // First time this key was seen
+ * }
+ * @endcode
+ */
+template<typename Hash = Hasher<std::string_view>>
+class AtomicStringSet {
+private:
+    struct Present {};      ///< Empty value type; occupies no space in the nodes
+
+    using Map = AtomicStringHashMap<Present, Hash>;
+
+    Map map_;               ///< Elements are the map's keys
+
+public:
+    /**
+     * @brief Iterator over the elements; yields each as a std::string_view.
+     */
+    class iterator {
+    private:
+        typename Map::iterator it_;     ///< Underlying map iterator
+
+    public:
+        explicit iterator(typename Map::iterator it) : it_(it) {}
+
+        std::string_view operator*() const {
+            return (*it_).first;
+        }
+
+        iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const {
+            return it_ == other.it_;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return it_ != other.it_;
+        }
+    };
+
+    /**
+     * @brief Default constructor. Creates an empty set with the default bucket count.
+     *
+     * @complexity O(bucket_count)
+     * @thread_safety Safe
+     */
+    AtomicStringSet() = default;
+
+    /**
+     * @brief Constructor with custom bucket count.
+     *
+     * @param bucket_count Number of buckets (at least 1)
+     * @complexity O(bucket_count)
+     * @thread_safety Safe
+     */
+    explicit AtomicStringSet(size_t bucket_count) : map_(bucket_count) {}
+
+    /**
+     * @brief Insert an element if it is not present.
+     *
+     * @param value The element; its bytes are copied into the node
+     * @return true if inserted, false if already present (or see AtomicStringHashMap::insert)
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee
+     */
+    bool insert(std::string_view value) {
+        return map_.emplace(value);
+    }
+
+    /**
+     * @brief Remove an element (logical deletion).
+     *
+     * @param value The element to remove
+     * @return true if the element was present and removed
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool erase(std::string_view value) {
+        return map_.erase(value);
+    }
+
+    /**
+     * @brief Check if the set contains an element.
+     *
+     * @param value The element to search for
+     * @return true if the element is present
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool contains(std::string_view value) const {
+        return map_.contains(value);
+    }
+
+    /**
+     * @brief Check if the set contains an element (alias for contains).
+     *
+     * @param value The element to search for
+     * @return true if the element is present
+     * @complexity O(1) average, O(n) worst case due to hash collisions
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool find(std::string_view value) const {
+        return contains(value);
+    }
+
+    /**
+     * @brief Get the number of elements.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        return map_.size();
+    }
+
+    /**
+     * @brief Check if the set is empty.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return map_.empty();
+    }
+
+    /**
+     * @brief Get the number of buckets.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t bucket_count() const {
+        return map_.bucket_count();
+    }
+
+    /**
+     * @brief Get the current load factor (elements per bucket).
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    double load_factor() const {
+        return map_.load_factor();
+    }
+
+    /**
+     * @brief Get iterator to the first element.
+     *
+     * @complexity O(bucket_count) worst case - may need to skip empty buckets
+     * @thread_safety Safe - sees a weakly consistent view under concurrent writes
+     * @exception_safety No-throw guarantee
+     */
+    iterator begin() const {
+        return iterator(map_.begin());
+    }
+
+    /**
+     * @brief Get iterator representing past-the-end.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    iterator end() const {
+        return iterator(map_.end());
+    }
+};
+
+} // namespace lockfree
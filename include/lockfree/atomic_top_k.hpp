@@ -0,0 +1,322 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include "atomic_count_min_sketch.hpp"
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free tracker of the K most frequent items in a stream.
+ *
+ * Frequencies come from a conservative-update AtomicCountMinSketch; K slots
+ * hold the current heavy hitters. As in Space-Saving, an item whose estimate
+ * beats the smallest tracked count replaces that slot's item. The common case
+ * - an item too rare to enter - costs one sketch add and one comparison
+ * against a cached admission threshold. A tracked item is found through a
+ * small hash-indexed hint table; the K slots are only scanned for items that
+ * may be about to enter.
+ *
+ * Memory is fixed: the sketch plus K entries, however many distinct items
+ * the stream has. Counts reported by top() are sketch estimates, so they are
+ * never below the true counts and at most epsilon() * N above them with
+ * high probability.
+ *
+ * @tparam T Type of the tracked items. Must be copy-constructible and hashable.
+ * @tparam K Number of items to track (1-1024)
+ * @tparam Width Sketch counters per row (a power of two)
+ * @tparam Depth Sketch rows (1-8)
+ * @tparam Hash Hash function for T. Defaults to Hasher<T> (hash.hpp).
+ * @tparam KeyEqual Equality for T
+ *
+ * Key Features:
+ * - Lock-free add() and add_batch(); batches use the sketch's SIMD hashing
+ * - Lock-free top() snapshot, sorted by estimated count
+ * - Replaced entries are reclaimed through EpochDomain
+ *
+ * Performance Characteristics:
+ * - add(): O(Depth) for items below the admission threshold or already tracked,
+ *   O(K + Depth) for items that may enter
+ * - top(): O(K log K)
+ * - Memory: Width * Depth * 8 bytes plus K entries
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicTopK<std::string, 100> hot_paths;
+ *
+ * // Any number of threads
+ * hot_paths.add(request.path);
+ *
+ * // Reporting thread
+ * for (const auto& [path, hits] : hot_paths.top()) {
+ *     std::cout << path << ": ~" << hits << "\n";
+ * }
+ * @endcode
+ *
+ * @note Two threads admitting the same new item at once can leave it in two
+ *       slots for a while; top() reports it once, and the stale copy is the
+ *       first to be replaced.
+ */
+template<typename T, size_t K = 100, size_t Width = 4096, size_t Depth = 4,
+         typename Hash = Hasher<T>, typename KeyEqual = std::equal_to<T>>
+class AtomicTopK {
+    static_assert(K >= 1 && K <= 1024, "K must be between 1 and 1024");
+
+public:
+    using Sketch = AtomicCountMinSketch<T, Width, Depth, true, Hash>;   ///< Conservative-update sketch
+
+private:
+    static constexpr size_t HINT_COUNT = std::bit_ceil(2 * K);   ///< Hint table size, at most half full
+    static constexpr size_t HINT_MASK = HINT_COUNT - 1;
+
+    /**
+     * @brief A tracked item; immutable except for its count.
+     */
+    struct Entry {
+        T item;                         ///< The heavy hitter
+        size_t hash;                    ///< Its hash, to skip most comparisons
+        std::atomic<uint64_t> count;    ///< Estimate when last seen
+
+        Entry(const T& i, size_t h, uint64_t c) : item(i), hash(h), count(c) {}
+    };
+
+    Sketch sketch_;                                     ///< Frequencies of all items
+    std::array<std::atomic<Entry*>, K> slots_;          ///< Tracked items, nullptr if free
+    std::array<std::atomic<Entry*>, HINT_COUNT> hints_; ///< Tracked entries by hash; may miss, never dangles
+    alignas(64) std::atomic<uint64_t> threshold_{0};    ///< Lower bound of the smallest tracked count
+    Hash hasher_;                                        ///< Hash function for T
+    KeyEqual key_equal_;                                 ///< Equality for T
+    EpochDomain& epochs_;                                ///< Reclamation for replaced entries
+
+    /**
+     * @brief Track item, or refresh its count, if its estimate may be in the top K.
+     */
+    void offer(const T& item, uint64_t estimate) {
+        if (estimate <= threshold_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const size_t hash = hasher_(item);
+        auto guard = epochs_.pin();
+
+        std::atomic<Entry*>& hint = hints_[hash & HINT_MASK];
+        if (Entry* entry = hint.load(std::memory_order_acquire);
+            entry && entry->hash == hash && key_equal_(entry->item, item)) {
+            raise_count(*entry, estimate);
+            return;
+        }
+
+        size_t victim = K;
+        Entry* victim_entry = nullptr;
+        uint64_t victim_count = UINT64_MAX;
+        for (size_t i = 0; i < K; ++i) {
+            Entry* entry = slots_[i].load(std::memory_order_acquire);
+            if (!entry) {
+                if (victim_count != 0) {
+                    victim = i;
+                    victim_entry = nullptr;
+                    victim_count = 0;
+                }
+                continue;
+            }
+            if (entry->hash == hash && key_equal_(entry->item, item)) {
+                raise_count(*entry, estimate);
+                // Re-hint, then make sure no eviction raced past the store (seq_cst pairs with it)
+                hint.store(entry, std::memory_order_seq_cst);
+                if (slots_[i].load(std::memory_order_seq_cst) != entry) {
+                    unhint(entry);
+                }
+                return;
+            }
+            const uint64_t count = entry->count.load(std::memory_order_relaxed);
+            if (count < victim_count) {
+                victim = i;
+                victim_entry = entry;
+                victim_count = count;
+            }
+        }
+
+        // Tracked counts only grow, so the smallest one seen is a safe admission bound
+        if (victim_count != 0 && victim_count > threshold_.load(std::memory_order_relaxed)) {
+            threshold_.store(victim_count, std::memory_order_relaxed);
+        }
+        if (estimate <= victim_count) {
+            return;
+        }
+        // Hint before publishing: whoever later evicts fresh from its slot then sees the hint
+        Entry* fresh = new Entry(item, hash, estimate);
+        hint.store(fresh, std::memory_order_seq_cst);
+        if (slots_[victim].compare_exchange_strong(victim_entry, fresh, std::memory_order_seq_cst)) {
+            if (victim_entry) {
+                unhint(victim_entry);
+                epochs_.retire(victim_entry);
+            }
+        } else {
+            // The slot changed; the item gets another chance on its next add
+            unhint(fresh);
+            epochs_.retire(fresh);   // Other threads may have found it through the hint
+        }
+    }
+
+    static void raise_count(Entry& entry, uint64_t estimate) {
+        uint64_t current = entry.count.load(std::memory_order_relaxed);
+        while (estimate > current && !entry.count.compare_exchange_weak(current, estimate, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Drop entry's hint (if it still has one) so it can be retired.
+     */
+    void unhint(Entry* entry) {
+        hints_[entry->hash & HINT_MASK].compare_exchange_strong(entry, nullptr, std::memory_order_seq_cst);
+    }
+
+public:
+    /**
+     * @brief Create an empty tracker.
+     *
+     * @complexity O(Width * Depth + K)
+     * @thread_safety Not applicable (constructor)
+     * @exception_safety Strong guarantee - may throw std::bad_alloc
+     */
+    explicit AtomicTopK(const Hash& hasher = Hash{}, const KeyEqual& key_equal = KeyEqual{})
+        : sketch_(hasher), hasher_(hasher), key_equal_(key_equal), epochs_(EpochDomain::global()) {
+        for (auto& slot : slots_) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+        for (auto& hint : hints_) {
+            hint.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor. Frees the tracked entries.
+     *
+     * @thread_safety Not safe - no other thread may use the tracker
+     */
+    ~AtomicTopK() {
+        for (auto& slot : slots_) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+
+    AtomicTopK(const AtomicTopK&) = delete;
+    AtomicTopK& operator=(const AtomicTopK&) = delete;
+
+    /**
+     * @brief Count occurrences of an item.
+     *
+     * @param item The item
+     * @param count Number of occurrences
+     * @complexity O(Depth), O(K + Depth) if the item may be in the top K
+     * @thread_safety Safe - lock-free
+     * @exception_safety Basic guarantee - the item is always counted in the sketch;
+     *                   if copying it into a new entry throws, it is not tracked yet
+     */
+    void add(const T& item, uint64_t count = 1) {
+        offer(item, sketch_.add(item, count));
+    }
+
+    /**
+     * @brief Count one occurrence of each item in a batch.
+     *
+     * @param items Items to count
+     * @param count Number of items
+     * @complexity O(count * Depth) plus O(K) per item that may be in the top K
+     * @thread_safety Safe - lock-free
+     * @exception_safety Basic guarantee
+     */
+    void add_batch(const T* items, size_t count) {
+        uint64_t estimates[Sketch::BATCH_GROUP_SIZE];
+        for (size_t base = 0; base < count; base += Sketch::BATCH_GROUP_SIZE) {
+            const size_t group = std::min(Sketch::BATCH_GROUP_SIZE, count - base);
+            sketch_.add_batch(items + base, group, estimates);
+            for (size_t i = 0; i < group; ++i) {
+                offer(items[base + i], estimates[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief The tracked items with their estimated counts, most frequent first.
+     *
+     * @return Up to K distinct items
+     * @complexity O(K log K + K * Depth)
+     * @thread_safety Safe - lock-free; concurrent adds may or may not be reflected
+     * @exception_safety Strong guarantee
+     */
+    std::vector<std::pair<T, uint64_t>> top() const {
+        std::vector<std::pair<T, uint64_t>> result;
+        result.reserve(K);
+        {
+            auto guard = epochs_.pin();
+            std::vector<const Entry*> entries;
+            entries.reserve(K);
+            for (const auto& slot : slots_) {
+                if (const Entry* entry = slot.load(std::memory_order_acquire)) {
+                    entries.push_back(entry);
+                }
+            }
+            // Copies of one item share a hash, so sorting by hash makes them neighbours
+            std::sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) {
+                return a->hash < b->hash;
+            });
+            for (size_t i = 0; i < entries.size(); ++i) {
+                bool duplicate = false;
+                for (size_t j = i; j-- > 0 && entries[j]->hash == entries[i]->hash;) {
+                    duplicate = duplicate || key_equal_(entries[j]->item, entries[i]->item);
+                }
+                if (!duplicate) {
+                    result.emplace_back(entries[i]->item, sketch_.estimate(entries[i]->item));
+                }
+            }
+        }
+        std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+            return a.second > b.second;
+        });
+        return result;
+    }
+
+    /**
+     * @brief Estimated frequency of any item, tracked or not.
+     *
+     * @complexity O(Depth)
+     * @thread_safety Safe - lock-free
+     */
+    uint64_t estimate(const T& item) const {
+        return sketch_.estimate(item);
+    }
+
+    /**
+     * @brief Total number of occurrences added.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    uint64_t total_count() const {
+        return sketch_.total_count();
+    }
+
+    /**
+     * @brief Get the underlying sketch, e.g. for its error bounds.
+     */
+    const Sketch& sketch() const {
+        return sketch_;
+    }
+
+    /**
+     * @brief Get the number of tracked slots.
+     */
+    static constexpr size_t capacity() {
+        return K;
+    }
+};
+
+} // namespace lockfree
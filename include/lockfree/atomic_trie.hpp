@@ -7,6 +7,10 @@
 #include <array>
 #include <functional>
 #include <algorithm>
+#include <string_view>
+#include <thread>
+#include <exception>
+#include "cpu_dispatch.hpp"
 
 namespace lockfree {
 
@@ -30,6 +34,8 @@ namespace lockfree {
  * - Unicode support: Configurable character type support
  * - Iterator support: Lexicographic iteration through all stored strings
  * - Auto-completion: Built-in support for prefix-based suggestions
+ * - Parallel bulk loading: bulk_insert() builds disjoint subtrees on several
+ *   threads without CAS and attaches them to the root
  * 
  * Performance Characteristics:
  * - Insert: O(m) where m is the length of the string
@@ -100,19 +106,68 @@ private:
         std::array<std::atomic<TrieNode*>, ALPHABET_SIZE> children; ///< Atomic pointers to child nodes
         std::atomic<bool> is_end_of_word;   ///< Flag indicating this node ends a word
         std::atomic<bool> deleted;          ///< Flag indicating this node is logically deleted
+        bool in_slab = false;               ///< Allocated from a NodeSlab by bulk_insert(), not by new
         
         /**
          * @brief Default constructor. Creates a node with no children and not marked as end-of-word.
+         * 
+         * The stores are relaxed: a node becomes reachable only through a release
+         * CAS or store of its parent's child pointer.
          */
         TrieNode() : is_end_of_word(false), deleted(false) {
             for (auto& child : children) {
-                child.store(nullptr);
+                child.store(nullptr, std::memory_order_relaxed);
             }
         }
     };
     
+    /**
+     * @brief A block of nodes for one bulk_insert() worker.
+     * 
+     * Slabs are pushed onto slabs_ as soon as they are allocated and freed
+     * only by the destructor, so slab nodes are never deleted individually.
+     */
+    struct NodeSlab {
+        static constexpr size_t NODES = 256;    ///< Nodes per slab, about 512 KB
+        
+        NodeSlab* next = nullptr;               ///< Next slab owned by the trie
+        std::array<TrieNode, NODES> nodes;      ///< Node storage
+        
+        NodeSlab() {
+            for (auto& node : nodes) {
+                node.in_slab = true;
+            }
+        }
+    };
+    
+    /**
+     * @brief Hands out nodes from the current slab of one bulk_insert() worker.
+     */
+    class SlabAllocator {
+    private:
+        std::atomic<NodeSlab*>& owner_;         ///< The trie's slab list
+        NodeSlab* slab_ = nullptr;              ///< Slab being carved
+        size_t used_ = NodeSlab::NODES;         ///< Nodes taken from slab_
+        
+    public:
+        explicit SlabAllocator(std::atomic<NodeSlab*>& owner) : owner_(owner) {}
+        
+        TrieNode* allocate() {
+            if (used_ == NodeSlab::NODES) {
+                slab_ = new NodeSlab;
+                slab_->next = owner_.load(std::memory_order_relaxed);
+                while (!owner_.compare_exchange_weak(slab_->next, slab_, std::memory_order_release,
+                                                     std::memory_order_relaxed)) {
+                }
+                used_ = 0;
+            }
+            return &slab_->nodes[used_++];
+        }
+    };
+    
     TrieNode* root_;                        ///< Pointer to the root node of the trie
     std::atomic<size_t> size_;              ///< Atomic counter for number of strings in the trie
+    std::atomic<NodeSlab*> slabs_;          ///< Slabs allocated by bulk_insert(), freed on destruction
     
     /**
      * @brief Convert character to array index.
@@ -170,6 +225,34 @@ private:
                                    std::basic_string<CharType>& current_word, 
                                    std::vector<std::basic_string<CharType>>& result) const;
     
+    /**
+     * @brief Find the next non-null child slot of a node that other threads may be updating.
+     * @param node The node to scan
+     * @param from First slot index to examine
+     * @return Index of the first non-null child at or after from, or ALPHABET_SIZE if none
+     * @note Each slot is an atomic load, since inserts CAS the slots concurrently.
+     */
+    size_t next_child(TrieNode* node, size_t from) const {
+        for (; from < ALPHABET_SIZE; ++from) {
+            if (node->children[from].load(std::memory_order_acquire)) {
+                return from;
+            }
+        }
+        return ALPHABET_SIZE;
+    }
+    
+    /**
+     * @brief Find the next non-null child slot of a node no other thread can reach.
+     * @param node The node to scan
+     * @param from First slot index to examine
+     * @return Index of the first non-null child at or after from, or ALPHABET_SIZE if none
+     * @note Scans several slots per step where the CPU allows, with plain vector loads.
+     *       Only for teardown and for subtrees that are still private to a graft.
+     */
+    size_t next_quiescent_child(TrieNode* node, size_t from) const {
+        return kernels().find_nonzero(node->children.data(), from, ALPHABET_SIZE);
+    }
+    
     /**
      * @brief Check if a node has any non-deleted children.
      * @param node The node to check
@@ -191,6 +274,30 @@ private:
      */
     void delete_recursive(TrieNode* node);
     
+    /**
+     * @brief Build a private subtree for words sharing their first character, without CAS.
+     * @param words Words whose first character is the same; empty words are skipped
+     * @param slab Allocator for the subtree's nodes
+     * @param added Incremented once per distinct word
+     * @return Root of the subtree, i.e. the node for the first character
+     */
+    TrieNode* build_subtree(const std::vector<std::basic_string_view<CharType>>& words,
+                            SlabAllocator& slab, size_t& added) const;
+    
+    /**
+     * @brief Attach a private subtree at parent->children[index].
+     * 
+     * An empty or deleted slot takes the whole subtree with one CAS. Otherwise
+     * the subtree is merged into the live node: its end-of-word flag is set
+     * and each child is grafted the same way, one level down.
+     * 
+     * @param parent Live node to attach under
+     * @param index Child slot in parent
+     * @param node Root of the private subtree
+     * @param duplicates Incremented once per word the trie already held
+     */
+    void graft(TrieNode* parent, size_t index, TrieNode* node, size_t& duplicates);
+    
 public:
     /**
      * @brief Default constructor. Creates an empty trie.
@@ -244,6 +351,33 @@ public:
      */
     bool insert(std::basic_string<CharType>&& word);
     
+    /**
+     * @brief Insert many strings using several threads.
+     * 
+     * Words are partitioned by their first character. Each worker takes whole
+     * partitions, largest first, and builds each one as a private subtree with
+     * plain stores, taking nodes from its own slabs of NodeSlab::NODES nodes
+     * instead of one new per node. A finished subtree is attached under the
+     * root with a single CAS, or merged into the existing subtree for that
+     * character if the trie already has one.
+     * 
+     * @tparam Range Range whose elements convert to std::basic_string_view<CharType>,
+     *         e.g. std::vector<std::string>; elements must outlive the call
+     * @param words The strings to insert; empty strings are skipped
+     * @param threads Number of worker threads; 0 uses std::thread::hardware_concurrency()
+     * @return Number of strings inserted, excluding duplicates and strings already present
+     * @complexity O(total characters / threads + partitions) expected
+     * @thread_safety Safe - may run concurrently with all other operations; each
+     *                 word becomes visible when its subtree is attached
+     * @exception_safety Basic guarantee - if allocation fails, subtrees attached so far remain
+     *                  and the exception is rethrown after all workers stop
+     * 
+     * @note Slab nodes are released only when the trie is destroyed, including
+     *       nodes of a subtree that was merged into an existing one.
+     */
+    template<typename Range>
+    size_t bulk_insert(const Range& words, size_t threads = 0);
+    
     /**
      * @brief Construct a string in-place and insert it into the trie.
      * 
@@ -460,7 +594,7 @@ using AtomicWStringTrie = AtomicTrie<wchar_t>;
 // Implementation starts here
 
 template<typename CharType>
-AtomicTrie<CharType>::AtomicTrie() : size_(0) {
+AtomicTrie<CharType>::AtomicTrie() : size_(0), slabs_(nullptr) {
     root_ = new TrieNode;
 }
 
@@ -468,6 +602,13 @@ template<typename CharType>
 AtomicTrie<CharType>::~AtomicTrie() {
     // Clean up the trie structure - destructor is only called when no other threads access
     delete_recursive(root_);
+    
+    NodeSlab* slab = slabs_.load(std::memory_order_acquire);
+    while (slab) {
+        NodeSlab* next = slab->next;
+        delete slab;
+        slab = next;
+    }
 }
 
 template<typename CharType>
@@ -488,6 +629,123 @@ bool AtomicTrie<CharType>::insert(std::basic_string<CharType>&& word) {
     return insert(word); // For trie, we need to traverse the string anyway
 }
 
+template<typename CharType>
+template<typename Range>
+size_t AtomicTrie<CharType>::bulk_insert(const Range& words, size_t threads) {
+    using View = std::basic_string_view<CharType>;
+    
+    std::vector<std::vector<View>> partitions(ALPHABET_SIZE);
+    for (const auto& word : words) {
+        View view(word);
+        if (!view.empty()) {
+            partitions[char_to_index(view[0])].push_back(view);
+        }
+    }
+    
+    // Largest partitions first, so the last ones to finish are small
+    std::vector<size_t> order;
+    for (size_t c = 0; c < ALPHABET_SIZE; ++c) {
+        if (!partitions[c].empty()) {
+            order.push_back(c);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return partitions[a].size() > partitions[b].size();
+    });
+    
+    std::atomic<size_t> next_partition{0};
+    std::atomic<size_t> inserted{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    
+    auto worker = [&]() {
+        SlabAllocator slab(slabs_);
+        try {
+            for (size_t i = next_partition.fetch_add(1, std::memory_order_relaxed);
+                 i < order.size() && !failed.load(std::memory_order_relaxed);
+                 i = next_partition.fetch_add(1, std::memory_order_relaxed)) {
+                const size_t c = order[i];
+                size_t added = 0;
+                size_t duplicates = 0;
+                TrieNode* subtree = build_subtree(partitions[c], slab, added);
+                graft(root_, c, subtree, duplicates);
+                size_.fetch_add(added - duplicates, std::memory_order_relaxed);
+                inserted.fetch_add(added - duplicates, std::memory_order_relaxed);
+            }
+        } catch (...) {
+            if (!failed.exchange(true)) {
+                error = std::current_exception();
+            }
+        }
+    };
+    
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, order.size());
+    
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();   // The calling thread takes partitions too
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return inserted.load(std::memory_order_relaxed);
+}
+
+template<typename CharType>
+typename AtomicTrie<CharType>::TrieNode*
+AtomicTrie<CharType>::build_subtree(const std::vector<std::basic_string_view<CharType>>& words,
+                                    SlabAllocator& slab, size_t& added) const {
+    // Private until grafted, so plain relaxed accesses suffice
+    TrieNode* subtree = slab.allocate();
+    for (const auto& word : words) {
+        TrieNode* node = subtree;
+        for (size_t i = 1; i < word.size(); ++i) {
+            auto& slot = node->children[char_to_index(word[i])];
+            TrieNode* child = slot.load(std::memory_order_relaxed);
+            if (!child) {
+                child = slab.allocate();
+                slot.store(child, std::memory_order_relaxed);
+            }
+            node = child;
+        }
+        if (!node->is_end_of_word.load(std::memory_order_relaxed)) {
+            node->is_end_of_word.store(true, std::memory_order_relaxed);
+            ++added;
+        }
+    }
+    return subtree;
+}
+
+template<typename CharType>
+void AtomicTrie<CharType>::graft(TrieNode* parent, size_t index, TrieNode* node, size_t& duplicates) {
+    TrieNode* live = parent->children[index].load(std::memory_order_acquire);
+    while (!live || live->deleted.load(std::memory_order_acquire)) {
+        // Like insert(), a deleted node is replaced rather than reused
+        if (parent->children[index].compare_exchange_weak(live, node, std::memory_order_release,
+                                                          std::memory_order_acquire)) {
+            return;
+        }
+    }
+    
+    if (node->is_end_of_word.load(std::memory_order_relaxed)) {
+        bool expected = false;
+        if (!live->is_end_of_word.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            ++duplicates;
+        }
+    }
+    for (size_t i = next_quiescent_child(node, 0); i < ALPHABET_SIZE; i = next_quiescent_child(node, i + 1)) {
+        graft(live, i, node->children[i].load(std::memory_order_relaxed), duplicates);
+    }
+}
+
 template<typename CharType>
 template<typename... Args>
 bool AtomicTrie<CharType>::emplace(Args&&... args) {
@@ -634,8 +892,8 @@ template<typename CharType>
 bool AtomicTrie<CharType>::has_children(TrieNode* node) const {
     if (!node) return false;
     
-    for (const auto& child : node->children) {
-        TrieNode* child_ptr = child.load(std::memory_order_acquire);
+    for (size_t i = next_child(node, 0); i < ALPHABET_SIZE; i = next_child(node, i + 1)) {
+        TrieNode* child_ptr = node->children[i].load(std::memory_order_acquire);
         if (child_ptr && !child_ptr->deleted.load(std::memory_order_acquire)) {
             return true;
         }
@@ -704,7 +962,7 @@ void AtomicTrie<CharType>::collect_words_with_prefix(TrieNode* node, const std::
         result.push_back(current_word);
     }
     
-    for (size_t i = 0; i < ALPHABET_SIZE; ++i) {
+    for (size_t i = next_child(node, 0); i < ALPHABET_SIZE; i = next_child(node, i + 1)) {
         TrieNode* child = node->children[i].load(std::memory_order_acquire);
         if (child && !child->deleted.load(std::memory_order_acquire)) {
             current_word.push_back(index_to_char(i));
@@ -835,14 +1093,16 @@ void AtomicTrie<CharType>::delete_recursive(TrieNode* node) {
         return;
     }
     
-    for (size_t i = 0; i < ALPHABET_SIZE; ++i) {
+    for (size_t i = next_quiescent_child(node, 0); i < ALPHABET_SIZE; i = next_quiescent_child(node, i + 1)) {
         TrieNode* child = node->children[i].load(std::memory_order_acquire);
         if (child && !child->deleted.load(std::memory_order_acquire)) {
             delete_recursive(child);
         }
     }
     
-    delete node;
+    if (!node->in_slab) {
+        delete node;   // Slab nodes go with their slab
+    }
 }
 
 } // namespace lockfree 
\ No newline at end of file
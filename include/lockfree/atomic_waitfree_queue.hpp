@@ -0,0 +1,459 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A wait-free MPMC queue (Kogan & Petrank, PPoPP 2011).
+ *
+ * AtomicQueue and AtomicMPMCQueue are lock-free: some thread always makes
+ * progress, but a given thread can lose every CAS race and, after its retry
+ * budget, give up. This queue bounds the number of steps of every operation.
+ *
+ * Each operation takes a phase number from a shared counter and publishes a
+ * descriptor in its thread's slot. Before doing its own work, every operation
+ * helps complete all pending operations with a phase no later than its own.
+ * An operation can therefore be overtaken by at most one operation per thread
+ * before every thread is helping it, so it finishes within O(threads) steps
+ * however the scheduler behaves. The linked list underneath is the Michael &
+ * Scott queue, and the same CASes move head and tail.
+ *
+ * @tparam T The type of elements stored in the queue. Must be constructible,
+ *           destructible, and either copyable or movable.
+ * @tparam MaxThreads Maximum number of threads that may use queues of this type
+ *                    at the same time. Every operation scans up to this many
+ *                    slots, so keep it close to the real thread count.
+ *
+ * Key Features:
+ * - Wait-free enqueue and dequeue: no retry budget, no silent drops
+ * - Unbounded capacity, FIFO ordering
+ * - Nodes and descriptors are reclaimed through EpochDomain
+ *
+ * Performance Characteristics:
+ * - Enqueue: O(MaxThreads) worst case, one descriptor and one node allocation
+ * - Dequeue: O(MaxThreads) worst case, one or two descriptor allocations
+ * - Memory: O(n + MaxThreads)
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicWaitFreeQueue<Order, 16> orders;
+ *
+ * // Any of up to 16 threads
+ * orders.enqueue(Order{42});
+ *
+ * Order order;
+ * if (orders.dequeue(order)) {
+ *     process(order);
+ * }
+ * @endcode
+ *
+ * @note Wait-freedom covers the queue's own steps. Allocation goes through the
+ *       global operator new, which is only as wait-free as the allocator.
+ * @note All shared accesses are sequentially consistent: the helping protocol
+ *       relies on a single order of descriptor, head and tail updates.
+ */
+template<typename T, size_t MaxThreads = 64>
+class AtomicWaitFreeQueue {
+public:
+    using value_type = T;
+
+private:
+    static_assert(MaxThreads > 0, "MaxThreads must be greater than 0");
+
+    static constexpr size_t NO_THREAD = SIZE_MAX;   ///< Unclaimed node / no slot
+
+    /**
+     * @brief Queue node. The head node is a dummy whose element has been dequeued.
+     */
+    struct Node {
+        std::atomic<Node*> next{nullptr};               ///< Successor
+        const size_t enq_tid;                           ///< Slot of the enqueuer
+        std::atomic<size_t> deq_tid{NO_THREAD};         ///< Slot of the dequeuer that claimed it as head
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element, constructed while queued
+
+        explicit Node(size_t enqueuer) : enq_tid(enqueuer) {}
+
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    /**
+     * @brief Immutable description of a thread's current operation.
+     */
+    struct OpDesc {
+        const uint64_t phase;       ///< Phase the operation started in
+        const bool pending;         ///< Not yet linearized
+        const bool enqueue;         ///< Enqueue or dequeue
+        Node* const node;           ///< Enqueue: node to link. Dequeue: claimed head, or nullptr if empty
+    };
+
+    /**
+     * @brief Process-wide slot numbers for the threads using this queue type.
+     *
+     * A thread claims the lowest free slot on its first operation and gives it
+     * back when it exits.
+     */
+    struct ThreadSlots {
+        std::atomic<bool> used[MaxThreads] = {};    ///< Claimed by a live thread
+        std::atomic<size_t> high_water{0};          ///< Slots ever claimed
+
+        struct Handle {
+            ThreadSlots* slots = nullptr;
+            size_t id = NO_THREAD;
+
+            ~Handle() {
+                if (id != NO_THREAD) {
+                    slots->used[id].store(false);
+                }
+            }
+        };
+
+        size_t claim() {
+            for (size_t i = 0; i < MaxThreads; ++i) {
+                bool expected = false;
+                if (!used[i].load(std::memory_order_relaxed) && used[i].compare_exchange_strong(expected, true)) {
+                    size_t seen = high_water.load();
+                    while (seen <= i && !high_water.compare_exchange_weak(seen, i + 1)) {
+                    }
+                    return i;
+                }
+            }
+            return NO_THREAD;
+        }
+    };
+
+    alignas(64) std::atomic<Node*> head_;           ///< Dummy node
+    alignas(64) std::atomic<Node*> tail_;           ///< Last node (may lag by one)
+    alignas(64) std::atomic<uint64_t> phase_{0};    ///< Phase counter
+    std::atomic<OpDesc*> state_[MaxThreads];        ///< Current descriptor per slot
+    EpochDomain& epochs_;                           ///< Reclamation for nodes and descriptors
+
+    static ThreadSlots& slots() {
+        static ThreadSlots instance;
+        return instance;
+    }
+
+    /**
+     * @brief The calling thread's slot, or NO_THREAD if all MaxThreads are taken.
+     */
+    static size_t thread_id() {
+        static thread_local typename ThreadSlots::Handle handle;
+        if (handle.id == NO_THREAD) {
+            handle.slots = &slots();
+            handle.id = handle.slots->claim();
+        }
+        return handle.id;
+    }
+
+    static size_t active_slots() {
+        return slots().high_water.load();
+    }
+
+    bool is_still_pending(size_t tid, uint64_t phase) const {
+        OpDesc* desc = state_[tid].load();
+        return desc->pending && desc->phase <= phase;
+    }
+
+    /**
+     * @brief Replace a descriptor if it is still current, retiring the old one.
+     */
+    bool swap_state(size_t tid, OpDesc* current, OpDesc* replacement) {
+        if (state_[tid].compare_exchange_strong(current, replacement)) {
+            epochs_.retire(current);
+            return true;
+        }
+        delete replacement;
+        return false;
+    }
+
+    void help(uint64_t phase) {
+        size_t slots = active_slots();
+        for (size_t i = 0; i < slots; ++i) {
+            OpDesc* desc = state_[i].load();
+            if (desc->pending && desc->phase <= phase) {
+                if (desc->enqueue) {
+                    help_enqueue(i, phase);
+                } else {
+                    help_dequeue(i, phase);
+                }
+            }
+        }
+    }
+
+    void help_enqueue(size_t tid, uint64_t phase) {
+        while (is_still_pending(tid, phase)) {
+            Node* last = tail_.load();
+            Node* next = last->next.load();
+            if (last != tail_.load()) {
+                continue;
+            }
+            if (next == nullptr) {
+                if (is_still_pending(tid, phase)) {
+                    Node* expected = nullptr;
+                    if (last->next.compare_exchange_strong(expected, state_[tid].load()->node)) {
+                        help_finish_enqueue();
+                        return;
+                    }
+                }
+            } else {
+                help_finish_enqueue();
+            }
+        }
+    }
+
+    void help_finish_enqueue() {
+        Node* last = tail_.load();
+        Node* next = last->next.load();
+        if (next != nullptr) {
+            size_t tid = next->enq_tid;
+            OpDesc* current = state_[tid].load();
+            if (last == tail_.load() && current->node == next) {
+                swap_state(tid, current, new OpDesc{current->phase, false, true, next});
+            }
+            tail_.compare_exchange_strong(last, next);
+        }
+    }
+
+    void help_dequeue(size_t tid, uint64_t phase) {
+        while (is_still_pending(tid, phase)) {
+            Node* first = head_.load();
+            Node* last = tail_.load();
+            Node* next = first->next.load();
+            if (first != head_.load()) {
+                continue;
+            }
+            if (first == last) {
+                if (next == nullptr) {
+                    // Empty: linearize the dequeue as failed
+                    OpDesc* current = state_[tid].load();
+                    if (last == tail_.load() && is_still_pending(tid, phase)) {
+                        swap_state(tid, current, new OpDesc{current->phase, false, false, nullptr});
+                    }
+                } else {
+                    help_finish_enqueue();
+                }
+            } else {
+                OpDesc* current = state_[tid].load();
+                if (!is_still_pending(tid, phase)) {
+                    break;
+                }
+                if (first == head_.load() && current->node != first) {
+                    // Record the head this dequeue is trying to take
+                    if (!swap_state(tid, current, new OpDesc{current->phase, true, false, first})) {
+                        continue;
+                    }
+                }
+                size_t unclaimed = NO_THREAD;
+                first->deq_tid.compare_exchange_strong(unclaimed, tid);
+                help_finish_dequeue();
+            }
+        }
+    }
+
+    void help_finish_dequeue() {
+        Node* first = head_.load();
+        Node* next = first->next.load();
+        size_t tid = first->deq_tid.load();
+        if (tid != NO_THREAD) {
+            OpDesc* current = state_[tid].load();
+            if (first == head_.load() && next != nullptr) {
+                swap_state(tid, current, new OpDesc{current->phase, false, false, current->node});
+                head_.compare_exchange_strong(first, next);
+            }
+        }
+    }
+
+    /**
+     * @brief Publish a new descriptor for the calling thread and run the operation.
+     */
+    void run(size_t tid, bool enqueue, Node* node) {
+        uint64_t phase = phase_.fetch_add(1) + 1;
+        OpDesc* previous = state_[tid].exchange(new OpDesc{phase, true, enqueue, node});
+        epochs_.retire(previous);
+        help(phase);
+        if (enqueue) {
+            help_finish_enqueue();
+        } else {
+            help_finish_dequeue();
+        }
+    }
+
+    template<typename... Args>
+    bool emplace_impl(Args&&... args) {
+        size_t tid = thread_id();
+        if (tid == NO_THREAD) {
+            return false;
+        }
+        Node* node = new Node(tid);
+        try {
+            ::new (node->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        auto guard = epochs_.pin();
+        run(tid, true, node);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Create an empty queue.
+     *
+     * @complexity O(MaxThreads)
+     * @thread_safety Safe
+     */
+    AtomicWaitFreeQueue() : epochs_(EpochDomain::global()) {
+        Node* dummy = new Node(NO_THREAD);
+        head_.store(dummy, std::memory_order_relaxed);
+        tail_.store(dummy, std::memory_order_relaxed);
+        for (auto& slot : state_) {
+            slot.store(new OpDesc{0, false, true, nullptr}, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor. Destroys the remaining elements.
+     *
+     * @complexity O(n + MaxThreads)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~AtomicWaitFreeQueue() {
+        Node* node = head_.load(std::memory_order_relaxed);
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        while (next) {
+            node = next;
+            next = node->next.load(std::memory_order_relaxed);
+            node->item()->~T();
+            delete node;
+        }
+        for (auto& slot : state_) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+
+    AtomicWaitFreeQueue(const AtomicWaitFreeQueue&) = delete;
+    AtomicWaitFreeQueue& operator=(const AtomicWaitFreeQueue&) = delete;
+
+    /**
+     * @brief Enqueue a copy of the item.
+     *
+     * @param item The item to copy and enqueue
+     * @return true once enqueued; false only if MaxThreads other threads hold a slot
+     * @complexity O(MaxThreads) worst case
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's copy constructor throws, the queue is unchanged
+     */
+    bool enqueue(const T& item) {
+        return emplace_impl(item);
+    }
+
+    /**
+     * @brief Enqueue an item by moving it.
+     *
+     * @param item The item to move and enqueue
+     * @return true once enqueued; false only if MaxThreads other threads hold a slot
+     * @complexity O(MaxThreads) worst case
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's move constructor throws, the queue is unchanged
+     */
+    bool enqueue(T&& item) {
+        return emplace_impl(std::move(item));
+    }
+
+    /**
+     * @brief Construct an element in place at the back of the queue.
+     *
+     * @param args Arguments to forward to T's constructor
+     * @return true once enqueued; false only if MaxThreads other threads hold a slot
+     * @complexity O(MaxThreads) worst case
+     * @thread_safety Safe
+     * @exception_safety Strong guarantee - if T's constructor throws, the queue is unchanged
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        return emplace_impl(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Dequeue the front element.
+     *
+     * @param result Receives the dequeued element
+     * @return true if an element was dequeued; false if the queue was empty or
+     *         MaxThreads other threads hold a slot
+     * @complexity O(MaxThreads) worst case
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - if T's move assignment throws, the element is lost
+     */
+    bool dequeue(T& result) {
+        size_t tid = thread_id();
+        if (tid == NO_THREAD) {
+            return false;
+        }
+        auto guard = epochs_.pin();
+        run(tid, false, nullptr);
+
+        Node* first = state_[tid].load()->node;
+        if (first == nullptr) {
+            return false;
+        }
+        // first is the old dummy; its successor, now the dummy, holds our element
+        T* item = first->next.load()->item();
+        result = std::move(*item);
+        item->~T();
+        epochs_.retire(first);
+        return true;
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     *
+     * @note Result may be immediately outdated in concurrent environment.
+     */
+    bool empty() const {
+        auto guard = epochs_.pin();
+        return head_.load()->next.load() == nullptr;
+    }
+
+    /**
+     * @brief Count the elements by walking the queue.
+     *
+     * @return Number of elements; approximate under concurrent modification
+     * @complexity O(n)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        auto guard = epochs_.pin();
+        size_t count = 0;
+        for (Node* node = head_.load()->next.load(); node; node = node->next.load()) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get the maximum number of threads that can use queues of this type at once.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    static constexpr size_t max_threads() {
+        return MaxThreads;
+    }
+};
+
+} // namespace lockfree
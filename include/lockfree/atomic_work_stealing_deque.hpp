@@ -3,6 +3,9 @@
 #include <atomic>
 #include <memory>
 #include <array>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace lockfree {
 
@@ -13,9 +16,9 @@ namespace lockfree {
  * owner thread produces tasks and multiple worker (thief) threads steal tasks for
  * load balancing. It provides asymmetric access patterns optimized for this use case.
  * 
- * @tparam T The type of elements stored in the deque. Elements are stored as pointers
- *           and must be constructible, destructible, and either copyable or movable.
- *           The deque manages memory allocation internally.
+ * @tparam T The type of elements stored in the deque. Must be constructible,
+ *           destructible, and either copyable or movable. The deque manages
+ *           memory allocation internally.
  * 
  * Key Features:
  * - Lock-free: No blocking operations for the core work-stealing operations
@@ -41,7 +44,11 @@ namespace lockfree {
  * - Fixed-size circular buffer to avoid ABA problems with resizing
  * 
  * Memory Management:
- * - Elements are allocated dynamically and stored as pointers
+ * - Elements that are nothrow move constructible and at most 120 bytes live
+ *   in the slots themselves (one or two cache lines per slot); others are
+ *   allocated dynamically and stored as pointers
+ * - pop_bottom(T&) and steal(T&) move an element out without allocating;
+ *   pop_bottom() and steal() hand out a heap copy that the caller deletes
  * - Automatic cleanup on destruction of remaining elements
  * - No memory reclamation during operation to maintain lock-free properties
  * - Cache-aligned slots to reduce false sharing between threads
@@ -91,7 +98,8 @@ namespace lockfree {
  *       data structure.
  * 
  * @warning The caller is responsible for managing the lifetime of elements.
- *          The deque returns raw pointers that must be deleted by the caller.
+ *          The pointer-returning pop_bottom() and steal() return raw pointers
+ *          that must be deleted by the caller.
  *          Only call destructor when no other threads are accessing the deque.
  */
 template<typename T>
@@ -100,6 +108,8 @@ private:
     static constexpr size_t CAPACITY = 4096;                    ///< Fixed capacity (power of 2)
     static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of 2");
     
+    static constexpr bool INLINE_SLOTS = std::is_nothrow_move_constructible_v<T> && sizeof(T) <= 120;  ///< Store elements in the slots
+    
     /**
      * @brief Cache-aligned slot structure to store element pointers.
      * 
@@ -122,13 +132,117 @@ private:
         Slot& operator=(Slot&&) = delete;
     };
     
+    /**
+     * @brief Cache-aligned slot holding an element in place.
+     * 
+     * The flag is set by the owner after constructing the element and cleared by
+     * whoever moves it out. The owner will not reuse a slot whose flag is still
+     * set, which covers a thief that won its steal but is still moving the
+     * element out when the owner wraps around to the same slot.
+     */
+    struct alignas(64) InlineSlot {
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element, constructed while the slot is occupied
+        std::atomic<bool> full{false};                  ///< Element constructed and not yet moved out
+        
+        T* item() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+    
+    using SlotType = std::conditional_t<INLINE_SLOTS, InlineSlot, Slot>;
+    
     alignas(64) std::atomic<size_t> top_{0};     ///< Top index for thief access (cache-aligned)
     alignas(64) std::atomic<size_t> bottom_{0};  ///< Bottom index for owner access (cache-aligned)
     
-    std::array<Slot, CAPACITY> buffer_;          ///< Fixed-size circular buffer of slots
+    std::array<SlotType, CAPACITY> buffer_;      ///< Fixed-size circular buffer of slots
     
     static constexpr size_t INDEX_MASK = CAPACITY - 1;  ///< Mask for circular indexing
     
+    /**
+     * @brief Move the element out of a slot the caller has claimed, then free the slot.
+     * 
+     * @param sink Called with the element as T&&
+     */
+    template<typename Sink>
+    static void consume(InlineSlot& slot, Sink&& sink) {
+        T* item = slot.item();
+        try {
+            sink(std::move(*item));
+        } catch (...) {
+            item->~T();
+            slot.full.store(false, std::memory_order_release);
+            throw;
+        }
+        item->~T();
+        slot.full.store(false, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Owner-side claim of the bottom element (inline slots).
+     * 
+     * @return The claimed slot, or nullptr if empty or a thief took the last element
+     */
+    InlineSlot* claim_bottom() {
+        size_t bottom = bottom_.load(std::memory_order_relaxed);
+        
+        if (bottom == 0) {
+            return nullptr; // Empty
+        }
+        
+        // Decrement bottom first
+        bottom = bottom - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        
+        // Memory fence to ensure bottom update is seen by thieves
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        
+        size_t top = top_.load(std::memory_order_relaxed);
+        
+        if (top < bottom) {
+            // More than one element - no thief can reach this one
+            return &buffer_[bottom & INDEX_MASK];
+        }
+        
+        if (top == bottom) {
+            // Last element - compete with thieves; the slot is only touched by the winner
+            size_t expected_top = top;
+            bool won = top_.compare_exchange_strong(expected_top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won ? &buffer_[bottom & INDEX_MASK] : nullptr;
+        }
+        
+        // Empty - restore bottom
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    
+    /**
+     * @brief Thief-side claim of the top element (inline slots).
+     * 
+     * @return The claimed slot, or nullptr if empty or the race was lost
+     */
+    InlineSlot* claim_top() {
+        size_t top = top_.load(std::memory_order_acquire);
+        
+        // Memory fence to ensure we see the latest bottom
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        
+        size_t bottom = bottom_.load(std::memory_order_acquire);
+        
+        if (top < bottom) {
+            size_t expected_top = top;
+            if (top_.compare_exchange_strong(expected_top, top + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed)) {
+                return &buffer_[top & INDEX_MASK];
+            }
+        }
+        
+        return nullptr; // Failed to steal or empty
+    }
+    
 public:
     /**
      * @brief Default constructor. Creates an empty work-stealing deque.
@@ -152,9 +266,17 @@ public:
      */
     ~AtomicWorkStealingDeque() {
         // Clean up remaining elements
-        while (!empty()) {
-            T* element = pop_bottom();
-            delete element;
+        if constexpr (INLINE_SLOTS) {
+            for (auto& slot : buffer_) {
+                if (slot.full.load(std::memory_order_relaxed)) {
+                    slot.item()->~T();
+                }
+            }
+        } else {
+            while (!empty()) {
+                T* element = pop_bottom();
+                delete element;
+            }
         }
     }
     
@@ -169,7 +291,9 @@ public:
      * 
      * Adds an element to the bottom end of the deque. This operation should
      * only be called by the owner thread. If the deque is at capacity, the
-     * element is discarded.
+     * element is discarded. For types stored inline the element is also discarded
+     * when the target slot still holds an element a thief has claimed but not yet
+     * moved out.
      * 
      * @param item The item to move and store in the deque
      * @complexity O(1) - constant time insertion
@@ -177,28 +301,49 @@ public:
      * @exception_safety Basic guarantee - if T's move constructor or operator new throws,
      *                  the deque remains unchanged
      * 
-     * @note The element is moved into dynamically allocated storage.
+     * @note The element is moved into its slot, or into dynamically allocated
+     *       storage for types that are not stored inline.
      *       If capacity is reached, the element is discarded silently.
      *       Owner should check size() before pushing if capacity is a concern.
+     *       For types stored inline, size() does not count steals in flight: a
+     *       thief that has advanced top but not finished moving the element out
+     *       still occupies its slot, so usable capacity shrinks by the number of
+     *       such steals and a push can be discarded while size() reports room.
      */
     void push_bottom(T item) {
-        T* element = new T(std::move(item));
+        if constexpr (INLINE_SLOTS) {
+            size_t bottom = bottom_.load(std::memory_order_relaxed);
+            size_t top = top_.load(std::memory_order_acquire);
+            
+            InlineSlot& slot = buffer_[bottom & INDEX_MASK];
+            // Full, or a thief is still moving the previous occupant out
+            if (bottom - top >= CAPACITY - 1 || slot.full.load(std::memory_order_acquire)) {
+                return;
+            }
+            
+            ::new (slot.storage) T(std::move(item));
+            slot.full.store(true, std::memory_order_relaxed);
+            
+            // Publish the element to thieves that acquire bottom
+            bottom_.store(bottom + 1, std::memory_order_release);
+        } else {
+            T* element = new T(std::move(item));
         
-        size_t bottom = bottom_.load(std::memory_order_relaxed);
-        size_t top = top_.load(std::memory_order_acquire);
+            size_t bottom = bottom_.load(std::memory_order_relaxed);
+            size_t top = top_.load(std::memory_order_acquire);
         
-        // Check if full
-        if (bottom - top >= CAPACITY - 1) {
-            delete element;
-            return; // Full, cannot push
-        }
+            // Check if full
+            if (bottom - top >= CAPACITY - 1) {
+                delete element;
+                return; // Full, cannot push
+            }
         
-        // Store the element
-        buffer_[bottom & INDEX_MASK].data.store(element, std::memory_order_relaxed);
+            // Store the element
+            buffer_[bottom & INDEX_MASK].data.store(element, std::memory_order_relaxed);
         
-        // Ensure the store is visible before updating bottom
-        std::atomic_thread_fence(std::memory_order_release);
-        bottom_.store(bottom + 1, std::memory_order_relaxed);
+            // Publish the element to thieves that acquire bottom
+            bottom_.store(bottom + 1, std::memory_order_release);
+        }
     }
     
     /**
@@ -212,49 +357,61 @@ public:
      *         Caller is responsible for deleting the returned pointer.
      * @complexity O(1) - constant time removal
      * @thread_safety Safe - but only one thread should call this method
-     * @exception_safety No-throw guarantee
+     * @exception_safety Basic guarantee - for types stored inline, if allocating
+     *                   the heap copy or T's move constructor throws, the element is lost
      * 
      * @note Returns nullptr if deque is empty or if lost race with thief for last element.
      *       The returned pointer must be deleted by the caller to prevent memory leaks.
+     *       For types stored inline the returned element is a heap copy; prefer
+     *       pop_bottom(T&), which does not allocate.
      */
     T* pop_bottom() {
-        size_t bottom = bottom_.load(std::memory_order_relaxed);
+        if constexpr (INLINE_SLOTS) {
+            InlineSlot* slot = claim_bottom();
+            T* element = nullptr;
+            if (slot) {
+                consume(*slot, [&](T&& item) { element = new T(std::move(item)); });
+            }
+            return element;
+        } else {
+            size_t bottom = bottom_.load(std::memory_order_relaxed);
         
-        if (bottom == 0) {
-            return nullptr; // Empty
-        }
+            if (bottom == 0) {
+                return nullptr; // Empty
+            }
         
-        // Decrement bottom first
-        bottom = bottom - 1;
-        bottom_.store(bottom, std::memory_order_relaxed);
+            // Decrement bottom first
+            bottom = bottom - 1;
+            bottom_.store(bottom, std::memory_order_relaxed);
         
-        // Memory fence to ensure bottom update is seen by thieves
-        std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Memory fence to ensure bottom update is seen by thieves
+            std::atomic_thread_fence(std::memory_order_seq_cst);
         
-        size_t top = top_.load(std::memory_order_relaxed);
+            size_t top = top_.load(std::memory_order_relaxed);
         
-        if (top <= bottom) {
-            // Non-empty - we have at least one element
-            T* element = buffer_[bottom & INDEX_MASK].data.exchange(nullptr, std::memory_order_relaxed);
+            if (top <= bottom) {
+                // Non-empty - we have at least one element
+                T* element = buffer_[bottom & INDEX_MASK].data.exchange(nullptr, std::memory_order_relaxed);
             
-            if (top == bottom) {
-                // Last element - need to compete with thieves
-                size_t expected_top = top;
-                if (!top_.compare_exchange_strong(expected_top, top + 1,
-                                                 std::memory_order_seq_cst,
-                                                 std::memory_order_relaxed)) {
-                    // Lost race to thief - restore bottom and return null
+                if (top == bottom) {
+                    // Last element - need to compete with thieves
+                    size_t expected_top = top;
+                    if (!top_.compare_exchange_strong(expected_top, top + 1,
+                                                     std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed)) {
+                        // Lost race to thief - restore bottom and return null
+                        bottom_.store(bottom + 1, std::memory_order_relaxed);
+                        return nullptr;
+                    }
                     bottom_.store(bottom + 1, std::memory_order_relaxed);
-                    return nullptr;
                 }
+            
+                return element;
+            } else {
+                // Empty - restore bottom
                 bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
             }
-            
-            return element;
-        } else {
-            // Empty - restore bottom
-            bottom_.store(bottom + 1, std::memory_order_relaxed);
-            return nullptr;
         }
     }
     
@@ -269,38 +426,110 @@ public:
      *         steal attempt failed. Caller is responsible for deleting the returned pointer.
      * @complexity O(1) - constant time removal attempt
      * @thread_safety Safe - multiple threads can call this concurrently
-     * @exception_safety No-throw guarantee
+     * @exception_safety Basic guarantee - for types stored inline, if allocating
+     *                   the heap copy or T's move constructor throws, the element is lost
      * 
      * @note May return nullptr even if deque appears non-empty due to races with
      *       other thieves or the owner. This is normal behavior in work-stealing.
      *       The returned pointer must be deleted by the caller to prevent memory leaks.
+     *       For types stored inline the returned element is a heap copy; prefer
+     *       steal(T&), which does not allocate.
      */
     T* steal() {
-        size_t top = top_.load(std::memory_order_acquire);
+        if constexpr (INLINE_SLOTS) {
+            InlineSlot* slot = claim_top();
+            T* element = nullptr;
+            if (slot) {
+                consume(*slot, [&](T&& item) { element = new T(std::move(item)); });
+            }
+            return element;
+        } else {
+            size_t top = top_.load(std::memory_order_acquire);
         
-        // Memory fence to ensure we see the latest bottom
-        std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Memory fence to ensure we see the latest bottom
+            std::atomic_thread_fence(std::memory_order_seq_cst);
         
-        size_t bottom = bottom_.load(std::memory_order_acquire);
+            size_t bottom = bottom_.load(std::memory_order_acquire);
         
-        if (top < bottom) {
-            // Non-empty, try to steal the element
-            T* element = buffer_[top & INDEX_MASK].data.load(std::memory_order_relaxed);
+            if (top < bottom) {
+                // Non-empty, try to steal the element
+                T* element = buffer_[top & INDEX_MASK].data.load(std::memory_order_relaxed);
             
-            if (element != nullptr) {
-                // Try to claim this position by advancing top
-                size_t expected_top = top;
-                if (top_.compare_exchange_strong(expected_top, top + 1,
-                                                std::memory_order_seq_cst,
-                                                std::memory_order_relaxed)) {
-                    // Successfully advanced top, now try to get the element
-                    T* stolen = buffer_[top & INDEX_MASK].data.exchange(nullptr, std::memory_order_relaxed);
-                    return stolen; // May be null if owner took it
+                if (element != nullptr) {
+                    // Try to claim this position by advancing top
+                    size_t expected_top = top;
+                    if (top_.compare_exchange_strong(expected_top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed)) {
+                        // Successfully advanced top, now try to get the element
+                        T* stolen = buffer_[top & INDEX_MASK].data.exchange(nullptr, std::memory_order_relaxed);
+                        return stolen; // May be null if owner took it
+                    }
                 }
             }
-        }
         
-        return nullptr; // Failed to steal or empty
+            return nullptr; // Failed to steal or empty
+        }
+    }
+    
+    /**
+     * @brief Pop an element from the bottom of the deque into result (owner thread only).
+     * 
+     * @param result Receives the popped element by move assignment
+     * @return true if an element was popped, false if the deque was empty or a
+     *         thief took the last element
+     * @complexity O(1) - constant time removal
+     * @thread_safety Safe - but only one thread should call this method
+     * @exception_safety Basic guarantee - if T's move assignment throws, the element is lost
+     * 
+     * @note Does not allocate for types stored inline.
+     */
+    bool pop_bottom(T& result) {
+        if constexpr (INLINE_SLOTS) {
+            InlineSlot* slot = claim_bottom();
+            if (!slot) {
+                return false;
+            }
+            consume(*slot, [&](T&& item) { result = std::move(item); });
+            return true;
+        } else {
+            std::unique_ptr<T> element(pop_bottom());
+            if (!element) {
+                return false;
+            }
+            result = std::move(*element);
+            return true;
+        }
+    }
+    
+    /**
+     * @brief Steal an element from the top of the deque into result (thief threads).
+     * 
+     * @param result Receives the stolen element by move assignment
+     * @return true if an element was stolen, false if the deque was empty or
+     *         the steal attempt lost a race
+     * @complexity O(1) - constant time removal attempt
+     * @thread_safety Safe - multiple threads can call this concurrently
+     * @exception_safety Basic guarantee - if T's move assignment throws, the element is lost
+     * 
+     * @note Does not allocate for types stored inline.
+     */
+    bool steal(T& result) {
+        if constexpr (INLINE_SLOTS) {
+            InlineSlot* slot = claim_top();
+            if (!slot) {
+                return false;
+            }
+            consume(*slot, [&](T&& item) { result = std::move(item); });
+            return true;
+        } else {
+            std::unique_ptr<T> element(steal());
+            if (!element) {
+                return false;
+            }
+            result = std::move(*element);
+            return true;
+        }
     }
     
     /**
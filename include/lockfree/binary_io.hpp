@@ -0,0 +1,284 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define LOCKFREE_HAS_MMAP 1
+#else
+    #define LOCKFREE_HAS_MMAP 0
+#endif
+
+namespace lockfree {
+namespace io {
+
+/**
+ * @brief Binary encoding rules for values written to on-disk snapshots and runs.
+ *
+ * The primary template marks a type as unsupported. Trivially copyable types are
+ * stored as their raw object representation (fixed size), and std::basic_string
+ * is stored as a 32-bit length followed by the characters (variable size).
+ * Users may specialize Codec for their own types following the same interface.
+ *
+ * @tparam T The type to encode
+ */
+template<typename T, typename = void>
+struct Codec {
+    static constexpr bool supported = false;    ///< No encoding available for T
+    static constexpr bool fixed_size = false;   ///< Not meaningful for unsupported types
+    static constexpr size_t encoded_size = 0;   ///< Not meaningful for unsupported types
+};
+
+/**
+ * @brief Codec for trivially copyable types: raw bytes, fixed size.
+ */
+template<typename T>
+struct Codec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+    static constexpr bool supported = true;         ///< Encoding available
+    static constexpr bool fixed_size = true;        ///< Every record has the same size
+    static constexpr size_t encoded_size = sizeof(T); ///< Bytes per encoded value
+
+    /**
+     * @brief Append the encoded value to a byte buffer.
+     * @param value The value to encode
+     * @param out Buffer to append to
+     */
+    static void encode(const T& value, std::string& out) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief Decode a value from a byte range.
+     * @param pos Start of the encoded value (no alignment requirement)
+     * @param end End of the readable range
+     * @param out Receives the decoded value
+     * @return Pointer past the decoded value, or nullptr if the range is truncated
+     */
+    static const char* decode(const char* pos, const char* end, T& out) {
+        if (static_cast<size_t>(end - pos) < sizeof(T)) {
+            return nullptr;
+        }
+        std::memcpy(&out, pos, sizeof(T));
+        return pos + sizeof(T);
+    }
+};
+
+/**
+ * @brief Codec for strings: 32-bit character count followed by the characters.
+ */
+template<typename CharT, typename Traits, typename Alloc>
+struct Codec<std::basic_string<CharT, Traits, Alloc>, void> {
+    using String = std::basic_string<CharT, Traits, Alloc>;
+
+    static constexpr bool supported = true;     ///< Encoding available
+    static constexpr bool fixed_size = false;   ///< Records carry their own length
+    static constexpr size_t encoded_size = 0;   ///< Not meaningful for variable-size values
+
+    /**
+     * @brief Append the length-prefixed string to a byte buffer.
+     * @param value The string to encode (at most 2^32-1 characters)
+     * @param out Buffer to append to
+     */
+    static void encode(const String& value, std::string& out) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.append(reinterpret_cast<const char*>(value.data()), length * sizeof(CharT));
+    }
+
+    /**
+     * @brief Decode a length-prefixed string from a byte range.
+     * @param pos Start of the encoded string
+     * @param end End of the readable range
+     * @param out Receives the decoded string
+     * @return Pointer past the decoded string, or nullptr if the range is truncated
+     */
+    static const char* decode(const char* pos, const char* end, String& out) {
+        uint32_t length;
+        if (static_cast<size_t>(end - pos) < sizeof(length)) {
+            return nullptr;
+        }
+        std::memcpy(&length, pos, sizeof(length));
+        pos += sizeof(length);
+        size_t bytes = static_cast<size_t>(length) * sizeof(CharT);
+        if (static_cast<size_t>(end - pos) < bytes) {
+            return nullptr;
+        }
+        out.resize(length);
+        std::memcpy(out.data(), pos, bytes);
+        return pos + bytes;
+    }
+};
+
+/**
+ * @brief Append a trivially copyable value to a byte buffer.
+ * @param out Buffer to append to
+ * @param value Value whose object representation is appended
+ */
+template<typename T>
+inline void append_pod(std::string& out, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "append_pod requires a trivially copyable type");
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Read a trivially copyable value from an unaligned position.
+ * @param pos Position of the stored object representation
+ * @return The decoded value
+ */
+template<typename T>
+inline T read_pod(const char* pos) {
+    static_assert(std::is_trivially_copyable_v<T>, "read_pod requires a trivially copyable type");
+    T value;
+    std::memcpy(&value, pos, sizeof(T));
+    return value;
+}
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Uses mmap on POSIX systems so that pages are faulted in on demand and shared
+ * with the page cache. On other platforms the file is read into a heap buffer,
+ * which keeps the same interface at the cost of an upfront copy.
+ *
+ * @note The mapping stays valid until close() or destruction; pointers into it
+ *       must not outlive the MappedFile.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Access pattern hint passed to the kernel.
+     */
+    enum class Access { SEQUENTIAL, RANDOM };
+
+    MappedFile() = default;
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          buffer_(std::move(other.buffer_)) {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Map a file read-only.
+     *
+     * @param path Path of the file to map
+     * @param access Expected access pattern (used as an madvise hint)
+     * @return true if the file was mapped, false if it is missing, empty or unreadable
+     */
+    bool open(const std::string& path, Access access = Access::SEQUENTIAL) {
+        close();
+#if LOCKFREE_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // The mapping keeps its own reference to the file
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        ::madvise(addr, static_cast<size_t>(st.st_size),
+                  access == Access::SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM);
+        data_ = static_cast<const char*>(addr);
+        size_ = static_cast<size_t>(st.st_size);
+        return true;
+#else
+        (void)access;
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            return false;
+        }
+        std::streamsize length = in.tellg();
+        if (length <= 0) {
+            return false;
+        }
+        buffer_.resize(static_cast<size_t>(length));
+        in.seekg(0);
+        if (!in.read(buffer_.data(), length)) {
+            buffer_.clear();
+            return false;
+        }
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Unmap the file. Safe to call on a closed mapping.
+     */
+    void close() {
+#if LOCKFREE_HAS_MMAP
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Check whether a file is currently mapped.
+     * @return true if open() succeeded and close() has not been called
+     */
+    bool is_open() const {
+        return data_ != nullptr;
+    }
+
+    /**
+     * @brief Start of the mapped bytes.
+     * @return Pointer to the first byte, or nullptr if nothing is mapped
+     */
+    const char* data() const {
+        return data_;
+    }
+
+    /**
+     * @brief Size of the mapping in bytes.
+     * @return Number of mapped bytes
+     */
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    const char* data_ = nullptr;    ///< Start of the mapped (or buffered) file contents
+    size_t size_ = 0;               ///< Number of bytes available at data_
+    std::vector<char> buffer_;      ///< Backing storage when mmap is unavailable
+};
+
+} // namespace io
+} // namespace lockfree
@@ -0,0 +1,554 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <bit>
+#include <algorithm>
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free histogram of non-negative integer values (HdrHistogram-style).
+ *
+ * Values are counted in log-linear buckets: every power-of-two range is split
+ * into 2^SignificantBits equal sub-buckets, so a bucket is never wider than
+ * 1/2^SignificantBits of the values it holds (0.78% for the default of 7) and
+ * values below 2^(SignificantBits + 1) are counted exactly.
+ *
+ * Counters are per-thread: the first thread to record into a stripe (picked
+ * by a per-thread slot number) owns it, and as the only writer updates its
+ * counters with plain relaxed loads and stores - no read-modify-write, no
+ * shared cache lines. A thread whose stripe is owned by another thread
+ * records into a shared stripe with fetch_add instead, so correctness never
+ * depends on the stripe count, only speed does. snapshot() sums the stripes
+ * into a plain Snapshot that answers percentile queries, while recording
+ * continues.
+ *
+ * @tparam SignificantBits Sub-bucket bits per power of two (1-12). Sets the
+ *                         relative precision: 2^-SignificantBits.
+ * @tparam MaxValueBits Values up to 2^MaxValueBits - 1 are bucketed
+ *                      (48 bits of nanoseconds is about 78 hours). Larger
+ *                      values are counted in the top bucket; max() stays exact.
+ *
+ * Key Features:
+ * - Lock-free record(); a thread's first record may allocate its stripe
+ * - Lock-free snapshot() with percentile, mean, min and max queries
+ * - merge() of histograms and snapshots, e.g. per-service histograms into a total
+ * - Fixed memory per stripe: bucket_count() 8-byte counters
+ *
+ * Performance Characteristics:
+ * - record(): O(1), a few relaxed loads and stores on a thread-owned stripe;
+ *   fetch_add and CAS on the shared stripe when threads outnumber stripes
+ * - snapshot(): O(stripes * bucket_count())
+ * - value_at_percentile(): O(bucket_count())
+ * - Memory: about 43 KB per used stripe with the default parameters
+ *
+ * @note A thread hands its slot number back when it exits, and the next thread
+ *       to record takes the lowest free slot, so threads that come and go keep
+ *       finding private stripes. The new owner inherits the stripe and its counts.
+ *
+ * Usage Example:
+ * @code
+ * lockfree::ConcurrentHistogram<> latency;
+ *
+ * // Any number of threads
+ * auto start = std::chrono::steady_clock::now();
+ * handle_request();
+ * latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+ *     std::chrono::steady_clock::now() - start).count());
+ *
+ * // Reporting thread
+ * auto snap = latency.snapshot();
+ * std::cout << "p99: " << snap.value_at_percentile(99.0) << " ns\n";
+ * @endcode
+ *
+ * @note A snapshot taken while other threads record includes some of the
+ *       concurrent records and not others; each record is counted exactly once
+ *       in every snapshot taken after it completes.
+ */
+template<size_t SignificantBits = 7, size_t MaxValueBits = 48>
+class ConcurrentHistogram {
+    static_assert(SignificantBits >= 1 && SignificantBits <= 12, "SignificantBits must be between 1 and 12");
+    static_assert(MaxValueBits > SignificantBits && MaxValueBits <= 64, "MaxValueBits must be in (SignificantBits, 64]");
+
+public:
+    static constexpr size_t SUB_BUCKETS = size_t{1} << SignificantBits;               ///< Sub-buckets per power of two
+    static constexpr size_t BUCKET_COUNT = (MaxValueBits - SignificantBits + 1) * SUB_BUCKETS;
+    static constexpr uint64_t MAX_TRACKABLE = MaxValueBits == 64 ? UINT64_MAX : (uint64_t{1} << MaxValueBits) - 1;
+    static constexpr size_t DEFAULT_STRIPES = 16;                                      ///< Default stripe count
+    static constexpr size_t MAX_STRIPES = 256;                                         ///< Upper bound for stripe count
+
+    /**
+     * @brief Point-in-time copy of a histogram's counts, with percentile queries.
+     *
+     * Snapshots are plain values: copyable, not thread-safe to mutate concurrently,
+     * and independent of the histogram they came from.
+     */
+    class Snapshot {
+    private:
+        std::vector<uint64_t> counts_;
+        uint64_t total_ = 0;
+        uint64_t sum_ = 0;
+        uint64_t min_ = UINT64_MAX;
+        uint64_t max_ = 0;
+
+        friend class ConcurrentHistogram;
+
+    public:
+        Snapshot() : counts_(BUCKET_COUNT, 0) {}
+
+        /**
+         * @brief Number of recorded values.
+         */
+        uint64_t total_count() const {
+            return total_;
+        }
+
+        /**
+         * @brief Smallest recorded value, or 0 if empty.
+         */
+        uint64_t min() const {
+            return total_ ? min_ : 0;
+        }
+
+        /**
+         * @brief Largest recorded value (exact, even above MAX_TRACKABLE), or 0 if empty.
+         */
+        uint64_t max() const {
+            return max_;
+        }
+
+        /**
+         * @brief Exact mean of the recorded values, or 0 if empty.
+         */
+        double mean() const {
+            return total_ ? static_cast<double>(sum_) / static_cast<double>(total_) : 0.0;
+        }
+
+        /**
+         * @brief Value at or below which the given percentage of values fall.
+         *
+         * @param percentile Percentage in [0, 100]; values outside are clamped
+         * @return Highest value equivalent to the bucket holding the percentile,
+         *         capped at max(); 0 if the snapshot is empty
+         * @complexity O(bucket_count())
+         */
+        uint64_t value_at_percentile(double percentile) const {
+            if (total_ == 0) {
+                return 0;
+            }
+            if (percentile <= 0.0) {
+                return min_;
+            }
+            percentile = std::min(percentile, 100.0);
+            const double exact = std::ceil(percentile / 100.0 * static_cast<double>(total_));
+            const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(exact));
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                seen += counts_[i];
+                if (seen >= target) {
+                    // The top bucket also holds every value above MAX_TRACKABLE
+                    return i + 1 == BUCKET_COUNT ? max_ : std::min(highest_equivalent_value(bucket_value(i)), max_);
+                }
+            }
+            return max_;
+        }
+
+        /**
+         * @brief Number of recorded values in buckets at or below value's bucket.
+         */
+        uint64_t count_at_or_below(uint64_t value) const {
+            const size_t last = bucket_index(value);
+            uint64_t seen = 0;
+            for (size_t i = 0; i <= last; ++i) {
+                seen += counts_[i];
+            }
+            return seen;
+        }
+
+        /**
+         * @brief Add another snapshot's counts into this one.
+         *
+         * @complexity O(bucket_count())
+         */
+        void merge(const Snapshot& other) {
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                counts_[i] += other.counts_[i];
+            }
+            total_ += other.total_;
+            sum_ += other.sum_;
+            min_ = std::min(min_, other.min_);
+            max_ = std::max(max_, other.max_);
+        }
+    };
+
+private:
+    /**
+     * @brief One stripe of counters, written only by its owner (or by anyone with RMWs if shared).
+     */
+    struct alignas(64) Stripe {
+        const size_t owner;                                             ///< Owning thread slot, 0 for the shared stripe
+        std::atomic<uint64_t> sum{0};                                   ///< Sum of recorded values
+        std::atomic<uint64_t> min{UINT64_MAX};                          ///< Smallest recorded value
+        std::atomic<uint64_t> max{0};                                   ///< Largest recorded value
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts{};       ///< Per-bucket counts
+
+        explicit Stripe(size_t owner_slot) : owner(owner_slot) {}
+    };
+
+    std::unique_ptr<std::atomic<Stripe*>[]> stripes_;  ///< Lazily allocated, thread-owned stripes
+    std::atomic<Stripe*> shared_{nullptr};              ///< Lazily allocated stripe for threads without one
+    size_t stripe_mask_;                                ///< stripe count - 1 (a power of two)
+
+    static constexpr size_t RECYCLED_SLOTS = 4 * MAX_STRIPES;   ///< Slot numbers reused after their thread exits
+
+    /**
+     * @brief Slot numbers in use: a bitmap of the recycled range plus a counter beyond it.
+     */
+    struct SlotPool {
+        std::array<std::atomic<uint64_t>, RECYCLED_SLOTS / 64> used{};     ///< Bit i set: slot i + 1 taken
+        std::atomic<size_t> overflow{RECYCLED_SLOTS + 1};                 ///< Next never-recycled slot
+    };
+
+    static SlotPool& slot_pool() {
+        static SlotPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Take the lowest free slot number, or a fresh one if all recycled slots are taken.
+     *
+     * The acquire pairs with release_slot(), so a thread that inherits stripes sees
+     * every plain store the previous owner made to them.
+     */
+    static size_t acquire_slot() {
+        SlotPool& pool = slot_pool();
+        for (size_t word = 0; word < pool.used.size(); ++word) {
+            uint64_t bits = pool.used[word].load(std::memory_order_relaxed);
+            while (bits != UINT64_MAX) {
+                const uint64_t bit = uint64_t{1} << std::countr_one(bits);
+                if (pool.used[word].compare_exchange_weak(bits, bits | bit, std::memory_order_acquire,
+                                                          std::memory_order_relaxed)) {
+                    return word * 64 + static_cast<size_t>(std::countr_zero(bit)) + 1;
+                }
+            }
+        }
+        return pool.overflow.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void release_slot(size_t slot) {
+        if (slot <= RECYCLED_SLOTS) {
+            const size_t bit = slot - 1;
+            slot_pool().used[bit / 64].fetch_and(~(uint64_t{1} << (bit % 64)), std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Holds a thread's slot number and hands it back when the thread exits.
+     */
+    struct SlotLease {
+        const size_t slot = acquire_slot();
+
+        ~SlotLease() {
+            release_slot(slot);
+        }
+    };
+
+    /**
+     * @brief Non-zero per-thread number, assigned on a thread's first record into any histogram.
+     */
+    static size_t thread_slot() {
+        thread_local const SlotLease lease;
+        return lease.slot;
+    }
+
+    static Stripe& install(std::atomic<Stripe*>& entry, size_t owner) {
+        Stripe* stripe = entry.load(std::memory_order_acquire);
+        if (stripe) {
+            return *stripe;
+        }
+        Stripe* fresh = new Stripe(owner);
+        if (entry.compare_exchange_strong(stripe, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return *fresh;
+        }
+        delete fresh;   // Another thread installed it first
+        return *stripe;
+    }
+
+    /**
+     * @brief The calling thread's own stripe, or the shared stripe if another thread owns its slot.
+     */
+    Stripe& stripe_for_thread(size_t slot) {
+        Stripe& stripe = install(stripes_[slot & stripe_mask_], slot);
+        return stripe.owner == slot ? stripe : install(shared_, 0);
+    }
+
+    // An owned stripe has a single writer, so plain load + store cannot lose updates
+    // and readers still see each store whole; the shared stripe needs RMWs.
+    static void add(std::atomic<uint64_t>& target, uint64_t delta, bool owned) {
+        if (owned) {
+            target.store(target.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        } else {
+            target.fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    static void lower_to(std::atomic<uint64_t>& target, uint64_t value, bool owned) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        if (owned) {
+            if (value < current) {
+                target.store(value, std::memory_order_relaxed);
+            }
+            return;
+        }
+        while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void raise_to(std::atomic<uint64_t>& target, uint64_t value, bool owned) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        if (owned) {
+            if (value > current) {
+                target.store(value, std::memory_order_relaxed);
+            }
+            return;
+        }
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Stripe s of the owned stripes, or the shared stripe for s == stripe_count().
+     */
+    Stripe* stripe_at(size_t s) const {
+        return (s <= stripe_mask_ ? stripes_[s] : shared_).load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Smallest value counted in bucket index.
+     */
+    static uint64_t bucket_value(size_t index) {
+        if (index < 2 * SUB_BUCKETS) {
+            return index;
+        }
+        const size_t shift = index / SUB_BUCKETS - 1;
+        return static_cast<uint64_t>(index - shift * SUB_BUCKETS) << shift;
+    }
+
+public:
+    /**
+     * @brief Create an empty histogram.
+     *
+     * @param stripes Number of counter stripes; rounded up to a power of two and
+     *                clamped to [1, MAX_STRIPES]. Use at least the number of
+     *                threads that record, so each gets a stripe of its own.
+     * @complexity O(stripes); stripe counters are allocated on first use
+     * @thread_safety Not applicable (constructor)
+     * @exception_safety Strong guarantee
+     */
+    explicit ConcurrentHistogram(size_t stripes = DEFAULT_STRIPES)
+        : stripes_(), stripe_mask_(std::bit_ceil(std::clamp<size_t>(stripes, 1, MAX_STRIPES)) - 1) {
+        stripes_ = std::make_unique<std::atomic<Stripe*>[]>(stripe_mask_ + 1);
+        for (size_t i = 0; i <= stripe_mask_; ++i) {
+            stripes_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor. Frees all stripes.
+     *
+     * @thread_safety Not safe - no other thread may use the histogram
+     */
+    ~ConcurrentHistogram() {
+        for (size_t s = 0; s <= stripe_mask_ + 1; ++s) {
+            delete stripe_at(s);
+        }
+    }
+
+    ConcurrentHistogram(const ConcurrentHistogram&) = delete;
+    ConcurrentHistogram& operator=(const ConcurrentHistogram&) = delete;
+
+    /**
+     * @brief Bucket index of a value.
+     *
+     * @complexity O(1) - one bit-width instruction and a shift
+     */
+    static size_t bucket_index(uint64_t value) {
+        value = std::min(value, MAX_TRACKABLE);
+        if (value < 2 * SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        const size_t shift = static_cast<size_t>(std::bit_width(value)) - 1 - SignificantBits;
+        return shift * SUB_BUCKETS + static_cast<size_t>(value >> shift);
+    }
+
+    /**
+     * @brief Smallest value that shares value's bucket.
+     */
+    static uint64_t lowest_equivalent_value(uint64_t value) {
+        return bucket_value(bucket_index(value));
+    }
+
+    /**
+     * @brief Largest value that shares value's bucket.
+     */
+    static uint64_t highest_equivalent_value(uint64_t value) {
+        const size_t index = bucket_index(value);
+        if (index + 1 >= BUCKET_COUNT) {
+            return MAX_TRACKABLE;
+        }
+        return bucket_value(index + 1) - 1;
+    }
+
+    /**
+     * @brief Get the number of buckets per stripe.
+     */
+    static constexpr size_t bucket_count() {
+        return BUCKET_COUNT;
+    }
+
+    /**
+     * @brief Get the number of thread-owned counter stripes (the shared stripe is extra).
+     */
+    size_t stripe_count() const {
+        return stripe_mask_ + 1;
+    }
+
+    /**
+     * @brief Get the number of values counted in the shared stripe.
+     *
+     * Non-zero when more threads record at once than there are stripes (or their
+     * slots collide). merge() into a histogram whose calling thread has no stripe
+     * also counts here.
+     *
+     * @complexity O(bucket_count())
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    uint64_t shared_count() const {
+        const Stripe* shared = shared_.load(std::memory_order_acquire);
+        uint64_t total = 0;
+        if (shared) {
+            for (const auto& count : shared->counts) {
+                total += count.load(std::memory_order_relaxed);
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Record a value.
+     *
+     * @param value The value, e.g. a latency in nanoseconds
+     * @param count Number of occurrences to record
+     * @complexity O(1)
+     * @thread_safety Safe - lock-free
+     * @exception_safety Strong guarantee - may throw std::bad_alloc on a thread's
+     *                   first record into a new stripe, in which case nothing is recorded
+     */
+    void record(uint64_t value, uint64_t count = 1) {
+        const size_t slot = thread_slot();
+        Stripe& stripe = stripe_for_thread(slot);
+        const bool owned = stripe.owner == slot;
+        add(stripe.counts[bucket_index(value)], count, owned);
+        add(stripe.sum, value * count, owned);
+        lower_to(stripe.min, value, owned);
+        raise_to(stripe.max, value, owned);
+    }
+
+    /**
+     * @brief Copy the current counts into a Snapshot.
+     *
+     * @return Snapshot of all stripes
+     * @complexity O(stripes * bucket_count())
+     * @thread_safety Safe - lock-free; concurrent records may or may not be included
+     * @exception_safety Strong guarantee
+     */
+    Snapshot snapshot() const {
+        Snapshot result;
+        for (size_t s = 0; s <= stripe_mask_ + 1; ++s) {
+            const Stripe* stripe = stripe_at(s);
+            if (!stripe) {
+                continue;
+            }
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                const uint64_t count = stripe->counts[i].load(std::memory_order_relaxed);
+                result.counts_[i] += count;
+                result.total_ += count;
+            }
+            result.sum_ += stripe->sum.load(std::memory_order_relaxed);
+            result.min_ = std::min(result.min_, stripe->min.load(std::memory_order_relaxed));
+            result.max_ = std::max(result.max_, stripe->max.load(std::memory_order_relaxed));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Add a snapshot's counts into this histogram.
+     *
+     * @complexity O(bucket_count())
+     * @thread_safety Safe with concurrent record() and snapshot()
+     * @exception_safety Strong guarantee
+     */
+    void merge(const Snapshot& other) {
+        if (other.total_ == 0) {
+            return;
+        }
+        const size_t slot = thread_slot();
+        Stripe& stripe = stripe_for_thread(slot);
+        const bool owned = stripe.owner == slot;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            if (other.counts_[i]) {
+                add(stripe.counts[i], other.counts_[i], owned);
+            }
+        }
+        add(stripe.sum, other.sum_, owned);
+        lower_to(stripe.min, other.min_, owned);
+        raise_to(stripe.max, other.max_, owned);
+    }
+
+    /**
+     * @brief Add another histogram's current counts into this one.
+     *
+     * @complexity O(stripes * bucket_count())
+     * @thread_safety Safe with concurrent use of either histogram
+     * @exception_safety Strong guarantee
+     */
+    void merge(const ConcurrentHistogram& other) {
+        if (&other != this) {
+            merge(other.snapshot());
+        }
+    }
+
+    /**
+     * @brief Clear all counts.
+     *
+     * @complexity O(stripes * bucket_count())
+     * @thread_safety Not safe with concurrent record() or merge() - an owner's
+     *                in-flight store could bring back its pre-reset count;
+     *                concurrent snapshot() is fine
+     * @exception_safety No-throw guarantee
+     */
+    void reset() {
+        for (size_t s = 0; s <= stripe_mask_ + 1; ++s) {
+            Stripe* stripe = stripe_at(s);
+            if (!stripe) {
+                continue;
+            }
+            for (auto& count : stripe->counts) {
+                count.store(0, std::memory_order_relaxed);
+            }
+            stripe->sum.store(0, std::memory_order_relaxed);
+            stripe->min.store(UINT64_MAX, std::memory_order_relaxed);
+            stripe->max.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define LOCKFREE_X86_DISPATCH 1
+#endif
+
+namespace lockfree {
+
+/**
+ * @brief Instruction set levels that kernels are compiled for.
+ *
+ * Levels are ordered: a host that supports a level supports every lower one.
+ */
+enum class CpuLevel {
+    GENERIC = 0,    ///< Baseline ISA of the build target
+    POPCNT = 1,     ///< x86 POPCNT
+    AVX2 = 2        ///< x86 AVX2 (with POPCNT)
+};
+
+/**
+ * @brief Kernels for the SIMD-capable inner loops, compiled once per CpuLevel.
+ *
+ * The library is built for the baseline ISA; each x86 kernel carries its own
+ * target attribute, and kernels() picks the best table for the running host
+ * the first time it is called. A portable binary therefore runs the AVX2 paths
+ * on hosts that have AVX2 and the generic ones elsewhere, instead of requiring
+ * -march=native and faulting on older CPUs.
+ *
+ * Setting the environment variable LOCKFREE_KERNELS to "generic", "popcnt" or
+ * "avx2" caps the selection (it never selects a level the host lacks).
+ *
+ * @note popcount() reads each word with a relaxed atomic load at every level, so
+ *       it may run while other threads write the words. The kernels that read
+ *       with plain vector loads (popcount_quiescent(), and find_nonzero() at the
+ *       AVX2 level) require that no thread writes the words during the call.
+ */
+struct KernelTable {
+    CpuLevel level;         ///< Level the kernels were compiled for
+    const char* name;       ///< Human-readable level name
+
+    /**
+     * @brief Count the set bits in count words; safe with concurrent writers.
+     */
+    size_t (*popcount)(const std::atomic<uint64_t>* words, size_t count);
+
+    /**
+     * @brief Count the set bits in count words that no thread is writing.
+     *
+     * The AVX2 kernel reads the words with plain vector loads, so the words must not
+     * be written concurrently.
+     */
+    size_t (*popcount_quiescent)(const std::atomic<uint64_t>* words, size_t count);
+
+    /**
+     * @brief Index of the first non-zero pointer-sized word in [from, count), or count.
+     *
+     * The AVX2 kernel reads the words with plain vector loads, so the words must not
+     * be written concurrently.
+     */
+    size_t (*find_nonzero)(const void* words, size_t from, size_t count);
+
+    /**
+     * @brief Hash count 64-bit keys with hash_u64(), writing the results to out.
+     */
+    void (*hash_batch)(const uint64_t* keys, uint64_t* out, size_t count);
+};
+
+/**
+ * @brief 64-bit finalizer hash (MurmurHash3 fmix64): a bijective, well-mixed hash.
+ *
+ * @complexity O(1)
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+constexpr uint64_t hash_u64(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+namespace kernels_detail {
+
+// Generic kernels: plain C++ for the build's baseline ISA
+
+inline size_t popcount_generic(const std::atomic<uint64_t>* words, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += std::popcount(words[i].load(std::memory_order_relaxed));
+    }
+    return total;
+}
+
+inline size_t find_nonzero_generic(const void* words, size_t from, size_t count) {
+    const auto* slots = static_cast<const std::atomic<uintptr_t>*>(words);
+    for (size_t i = from; i < count; ++i) {
+        if (slots[i].load(std::memory_order_relaxed) != 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+inline void hash_batch_generic(const uint64_t* keys, uint64_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = hash_u64(keys[i]);
+    }
+}
+
+#ifdef LOCKFREE_X86_DISPATCH
+
+// POPCNT kernels: same loops, with the popcount compiled to one instruction
+
+__attribute__((target("popcnt")))
+inline size_t popcount_popcnt(const std::atomic<uint64_t>* words, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += static_cast<size_t>(__builtin_popcountll(words[i].load(std::memory_order_relaxed)));
+    }
+    return total;
+}
+
+// AVX2 kernels
+
+/**
+ * @brief Nibble-table popcount over four words per step (Mula et al.).
+ *
+ * Reads the words with plain vector loads; only for words no thread is writing.
+ */
+__attribute__((target("avx2,popcnt")))
+inline size_t popcount_avx2(const std::atomic<uint64_t>* words, size_t count) {
+    const auto* data = reinterpret_cast<const uint64_t*>(words);
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i sums = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i lo = _mm256_and_si256(v, low_mask);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+        const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, lo), _mm256_shuffle_epi8(table, hi));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+    }
+
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sums);
+    size_t total = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    for (; i < count; ++i) {
+        total += static_cast<size_t>(__builtin_popcountll(words[i].load(std::memory_order_relaxed)));
+    }
+    return total;
+}
+
+__attribute__((target("avx2")))
+inline size_t find_nonzero_avx2(const void* words, size_t from, size_t count) {
+    const auto* data = static_cast<const uint64_t*>(words);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t i = from;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const int zero_lanes = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, zero)));
+        if (zero_lanes != 0xf) {
+            return i + static_cast<size_t>(__builtin_ctz(~zero_lanes & 0xf));
+        }
+    }
+    return find_nonzero_generic(words, i, count);
+}
+
+/**
+ * @brief Low 64 bits of a 64x64-bit product per lane, from three 32x32-bit multiplies.
+ */
+__attribute__((target("avx2")))
+inline __m256i mullo_epi64_avx2(__m256i a, __m256i b) {
+    const __m256i lo_lo = _mm256_mul_epu32(a, b);
+    const __m256i lo_hi = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+    const __m256i hi_lo = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+    return _mm256_add_epi64(lo_lo, _mm256_slli_epi64(_mm256_add_epi64(lo_hi, hi_lo), 32));
+}
+
+__attribute__((target("avx2")))
+inline void hash_batch_avx2(const uint64_t* keys, uint64_t* out, size_t count) {
+    const __m256i c1 = _mm256_set1_epi64x(static_cast<long long>(0xff51afd7ed558ccdULL));
+    const __m256i c2 = _mm256_set1_epi64x(static_cast<long long>(0xc4ceb9fe1a85ec53ULL));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+        h = mullo_epi64_avx2(h, c1);
+        h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+        h = mullo_epi64_avx2(h, c2);
+        h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+    }
+    hash_batch_generic(keys + i, out + i, count - i);
+}
+
+#endif // LOCKFREE_X86_DISPATCH
+
+inline constexpr KernelTable GENERIC_KERNELS{
+    CpuLevel::GENERIC, "generic",
+    popcount_generic, popcount_generic, find_nonzero_generic, hash_batch_generic
+};
+
+#ifdef LOCKFREE_X86_DISPATCH
+inline constexpr KernelTable POPCNT_KERNELS{
+    CpuLevel::POPCNT, "popcnt",
+    popcount_popcnt, popcount_popcnt, find_nonzero_generic, hash_batch_generic
+};
+
+inline constexpr KernelTable AVX2_KERNELS{
+    CpuLevel::AVX2, "avx2",
+    popcount_popcnt, popcount_avx2, find_nonzero_avx2, hash_batch_avx2
+};
+#endif
+
+/**
+ * @brief Highest level the running CPU supports.
+ */
+inline CpuLevel detect_host_level() {
+#ifdef LOCKFREE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return CpuLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        return CpuLevel::POPCNT;
+    }
+#endif
+    return CpuLevel::GENERIC;
+}
+
+/**
+ * @brief Level requested through LOCKFREE_KERNELS, or AVX2 (no cap) if unset or unknown.
+ */
+inline CpuLevel requested_level() {
+    const char* value = std::getenv("LOCKFREE_KERNELS");
+    if (value == nullptr) {
+        return CpuLevel::AVX2;
+    }
+    if (std::strcmp(value, "generic") == 0) {
+        return CpuLevel::GENERIC;
+    }
+    if (std::strcmp(value, "popcnt") == 0) {
+        return CpuLevel::POPCNT;
+    }
+    return CpuLevel::AVX2;
+}
+
+} // namespace kernels_detail
+
+/**
+ * @brief Highest CpuLevel the running host supports (detected once).
+ *
+ * @complexity O(1) after the first call
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+inline CpuLevel host_cpu_level() {
+    static const CpuLevel level = kernels_detail::detect_host_level();
+    return level;
+}
+
+/**
+ * @brief Kernel table for a level, lowered to what the host supports.
+ *
+ * @param level Desired level
+ * @return The kernels for min(level, host_cpu_level())
+ * @complexity O(1)
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+inline const KernelTable& kernels_for(CpuLevel level) {
+    if (static_cast<int>(level) > static_cast<int>(host_cpu_level())) {
+        level = host_cpu_level();
+    }
+#ifdef LOCKFREE_X86_DISPATCH
+    switch (level) {
+        case CpuLevel::AVX2:
+            return kernels_detail::AVX2_KERNELS;
+        case CpuLevel::POPCNT:
+            return kernels_detail::POPCNT_KERNELS;
+        default:
+            break;
+    }
+#endif
+    return kernels_detail::GENERIC_KERNELS;
+}
+
+/**
+ * @brief Kernels selected for this process: the best the host supports, capped by LOCKFREE_KERNELS.
+ *
+ * @complexity O(1) after the first call
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+inline const KernelTable& kernels() {
+    static const KernelTable& selected = kernels_for(kernels_detail::requested_level());
+    return selected;
+}
+
+} // namespace lockfree
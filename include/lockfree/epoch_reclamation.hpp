@@ -0,0 +1,730 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <utility>
+#include <algorithm>
+
+namespace lockfree {
+
+/**
+ * @brief Process-wide epoch-based memory reclamation (EBR).
+ *
+ * Lock-free structures that physically unlink memory cannot free it right away,
+ * because a concurrent reader may still hold a pointer to it. EpochDomain defers
+ * the free until every thread that could have seen the object has left its
+ * critical section.
+ *
+ * Readers pin the domain for the duration of an operation (pin() returns an RAII
+ * guard). Writers unlink an object and hand it to retire(). A retired object is
+ * freed once the global epoch has advanced twice past the epoch it was retired in,
+ * which can only happen after every thread pinned at that time has unpinned.
+ *
+ * Key Features:
+ * - Lock-free: pin/unpin are a store and a fence; retire is a thread-local push
+ * - Bounded garbage: each thread attempts reclamation every RECLAIM_THRESHOLD retires
+ * - Thread exit safe: pending garbage of exiting threads is handed to survivors
+ * - Nestable: guards may be nested within a thread
+ *
+ * Usage Example:
+ * @code
+ * auto& epochs = lockfree::EpochDomain::global();
+ *
+ * // Reader
+ * {
+ *     auto guard = epochs.pin();
+ *     Node* node = head.load(std::memory_order_acquire);
+ *     use(node);  // node cannot be freed while the guard is alive
+ * }
+ *
+ * // Writer, after unlinking old_node
+ * epochs.retire(old_node);
+ * @endcode
+ *
+ * @note Never call synchronize() while the calling thread is pinned.
+ */
+class EpochDomain {
+public:
+    using Deleter = void (*)(void*);    ///< Type-erased deleter for retired objects
+
+    /**
+     * @brief RAII guard that keeps the current thread pinned.
+     */
+    class Guard {
+    public:
+        /**
+         * @brief Pin the calling thread in the given domain.
+         * @param domain The domain to pin
+         */
+        explicit Guard(EpochDomain& domain) : domain_(&domain) {
+            domain_->enter();
+        }
+
+        /**
+         * @brief Unpin the calling thread (if this guard still owns the pin).
+         */
+        ~Guard() {
+            if (domain_) {
+                domain_->exit();
+            }
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard(Guard&& other) noexcept : domain_(std::exchange(other.domain_, nullptr)) {}
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        EpochDomain* domain_;   ///< Domain to unpin, nullptr after a move
+    };
+
+    /**
+     * @brief Get the process-wide domain shared by all structures.
+     * @return Reference to the global domain
+     */
+    static EpochDomain& global() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    /**
+     * @brief Pin the calling thread.
+     *
+     * @return Guard that unpins on destruction
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    Guard pin() {
+        return Guard(*this);
+    }
+
+    /**
+     * @brief Schedule an object for deletion once no pinned thread can reference it.
+     *
+     * @param ptr Object that is no longer reachable from the shared structure
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     */
+    template<typename T>
+    void retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief Schedule an object for deletion with a custom deleter.
+     *
+     * @param ptr Object that is no longer reachable from the shared structure
+     * @param deleter Function that frees ptr
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     */
+    void retire(void* ptr, Deleter deleter) {
+        ThreadRecord* record = local_record();
+        record->retired.push_back({ptr, deleter, global_epoch_.load(std::memory_order_seq_cst)});
+        if (record->retired.size() >= record->collect_at) {
+            collect(record);
+            // If a pinned thread holds the epoch back, wait for another batch before rescanning
+            record->collect_at = record->retired.size() + RECLAIM_THRESHOLD;
+        }
+    }
+
+    /**
+     * @brief Wait for a grace period and free everything that became reclaimable.
+     *
+     * When this returns, every critical section that was active at the time of the
+     * call has finished, so objects unlinked before the call are no longer referenced.
+     *
+     * @complexity O(threads) per epoch advance; blocks while other threads stay pinned
+     * @thread_safety Safe, but the calling thread must not be pinned
+     */
+    void synchronize() {
+        uint64_t target = global_epoch_.load(std::memory_order_seq_cst) + 2;
+        while (global_epoch_.load(std::memory_order_seq_cst) < target) {
+            if (!try_advance()) {
+                std::this_thread::yield();
+            }
+        }
+        collect(local_record());
+    }
+
+    /**
+     * @brief Get the current global epoch.
+     *
+     * The load is sequentially consistent, like the one retire() labels garbage
+     * with, so structures that keep their own epoch-stamped free lists can use it
+     * both to label retired nodes and to decide when a label has aged out.
+     *
+     * @return The global epoch counter
+     */
+    uint64_t epoch() const {
+        return global_epoch_.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Advance the global epoch if every pinned thread has observed it.
+     *
+     * retire() does this implicitly. Structures that keep their own epoch-stamped
+     * free lists call it when they need older garbage to become reusable.
+     *
+     * @return true if the epoch moved (by this or another thread)
+     * @complexity O(threads)
+     * @thread_safety Safe
+     */
+    bool try_advance() {
+        uint64_t current = global_epoch_.load(std::memory_order_seq_cst);
+        for (ThreadRecord* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            uint64_t state = record->state.load(std::memory_order_seq_cst);
+            if ((state & 1) && (state >> 1) != current) {
+                return false;   // A thread is still pinned in an older epoch
+            }
+        }
+        global_epoch_.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    /**
+     * @brief Destructor. Frees all remaining garbage; runs at process exit.
+     */
+    ~EpochDomain() {
+        ThreadRecord* record = records_.load(std::memory_order_acquire);
+        while (record) {
+            for (auto& item : record->retired) {
+                item.deleter(item.ptr);
+            }
+            ThreadRecord* next = record->next;
+            delete record;
+            record = next;
+        }
+        OrphanBatch* batch = orphans_.load(std::memory_order_acquire);
+        while (batch) {
+            for (auto& item : batch->items) {
+                item.deleter(item.ptr);
+            }
+            OrphanBatch* next = batch->next;
+            delete batch;
+            batch = next;
+        }
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+private:
+    static constexpr size_t RECLAIM_THRESHOLD = 64;     ///< Retires between reclamation attempts
+
+    /**
+     * @brief An object waiting for its grace period.
+     */
+    struct Retired {
+        void* ptr;          ///< Object to free
+        Deleter deleter;    ///< How to free it
+        uint64_t epoch;     ///< Global epoch observed when it was retired
+    };
+
+    /**
+     * @brief Per-thread state, cache-line aligned to avoid false sharing.
+     */
+    struct alignas(64) ThreadRecord {
+        std::atomic<uint64_t> state{0};     ///< (epoch << 1) | 1 while pinned, 0 otherwise
+        std::atomic<bool> in_use{false};    ///< Claimed by a live thread
+        ThreadRecord* next = nullptr;       ///< Next record; immutable once published
+        unsigned nesting = 0;               ///< Guard nesting depth (owner only)
+        std::vector<Retired> retired;       ///< Pending garbage (owner only)
+        size_t collect_at = RECLAIM_THRESHOLD;  ///< Pending count that triggers the next collect (owner only)
+        uint64_t collected_epoch = 0;       ///< Global epoch at the last collect (owner only)
+    };
+
+    /**
+     * @brief Garbage left behind by a thread that exited.
+     */
+    struct OrphanBatch {
+        std::vector<Retired> items;         ///< Pending garbage
+        OrphanBatch* next;                  ///< Next batch in the orphan stack
+    };
+
+    /**
+     * @brief Releases the thread's record when the thread exits.
+     */
+    struct ThreadHandle {
+        EpochDomain* domain = nullptr;      ///< Domain owning the record
+        ThreadRecord* record = nullptr;     ///< Record claimed by this thread
+
+        ~ThreadHandle() {
+            if (record) {
+                domain->release(record);
+            }
+        }
+    };
+
+    alignas(64) std::atomic<uint64_t> global_epoch_{1};        ///< Global epoch counter
+    alignas(64) std::atomic<ThreadRecord*> records_{nullptr};  ///< All records ever created
+    std::atomic<OrphanBatch*> orphans_{nullptr};               ///< Garbage from exited threads
+
+    EpochDomain() = default;
+
+    /**
+     * @brief Get (claiming on first use) the calling thread's record.
+     * @return The thread's record
+     */
+    ThreadRecord* local_record() {
+        static thread_local ThreadHandle handle;
+        if (!handle.record) {
+            handle.domain = this;
+            handle.record = acquire_record();
+        }
+        return handle.record;
+    }
+
+    /**
+     * @brief Claim a free record or publish a new one.
+     * @return A record owned by the calling thread
+     */
+    ThreadRecord* acquire_record() {
+        for (ThreadRecord* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed) &&
+                record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        ThreadRecord* record = new ThreadRecord();
+        record->in_use.store(true, std::memory_order_relaxed);
+        ThreadRecord* head = records_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records_.compare_exchange_weak(head, record,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed));
+        return record;
+    }
+
+    /**
+     * @brief Hand a record back when its thread exits.
+     * @param record The exiting thread's record
+     */
+    void release(ThreadRecord* record) {
+        collect(record);
+        if (!record->retired.empty()) {
+            push_orphans(new OrphanBatch{std::move(record->retired), nullptr});
+            record->retired.clear();
+        }
+        record->state.store(0, std::memory_order_release);
+        record->nesting = 0;
+        record->collect_at = RECLAIM_THRESHOLD;
+        record->in_use.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pin the calling thread.
+     */
+    void enter() {
+        ThreadRecord* record = local_record();
+        if (record->nesting++ == 0) {
+            uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+            // A read-modify-write, so that the announcement continues the release
+            // sequence of the previous exit(): a thread that reads it in try_advance()
+            // also sees every access this thread made before unpinning
+            record->state.exchange((epoch << 1) | 1, std::memory_order_seq_cst);
+            // Order the announcement before any load of shared pointers
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    /**
+     * @brief Unpin the calling thread.
+     */
+    void exit() {
+        ThreadRecord* record = local_record();
+        if (--record->nesting == 0) {
+            record->state.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Free a thread's and the orphaned garbage whose grace period has passed.
+     * @param record The calling thread's record
+     */
+    void collect(ThreadRecord* record) {
+        try_advance();
+        uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        // Nothing becomes reclaimable until the epoch moves, so skip the scan
+        if (epoch == record->collected_epoch) {
+            return;
+        }
+        record->collected_epoch = epoch;
+
+        std::vector<Retired> ready;
+        auto split = [&](std::vector<Retired>& items) {
+            auto pending = std::stable_partition(items.begin(), items.end(), [&](const Retired& item) {
+                return item.epoch + 2 > epoch;
+            });
+            ready.insert(ready.end(), pending, items.end());
+            items.erase(pending, items.end());
+        };
+
+        split(record->retired);
+
+        OrphanBatch* batch = orphans_.exchange(nullptr, std::memory_order_acquire);
+        while (batch) {
+            OrphanBatch* next = batch->next;
+            split(batch->items);
+            if (batch->items.empty()) {
+                delete batch;
+            } else {
+                batch->next = nullptr;
+                push_orphans(batch);
+            }
+            batch = next;
+        }
+
+        // Deleters run last: they may retire further objects into record->retired
+        for (auto& item : ready) {
+            item.deleter(item.ptr);
+        }
+    }
+
+    /**
+     * @brief Push a batch onto the orphan stack.
+     * @param batch Batch to push
+     */
+    void push_orphans(OrphanBatch* batch) {
+        OrphanBatch* head = orphans_.load(std::memory_order_relaxed);
+        do {
+            batch->next = head;
+        } while (!orphans_.compare_exchange_weak(head, batch,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    }
+};
+
+/**
+ * @brief Process-wide quiescent-state-based reclamation (QSBR) for read-mostly structures.
+ *
+ * Unlike EpochDomain, reads do not pin: a reader thread only announces, at the start
+ * of each outermost read section, the grace period it is in. The announcement is a
+ * plain store to the thread's own cache line, and it is skipped entirely while no
+ * writer has retired anything since the thread's last read. Steady-state reads
+ * therefore perform no atomic read-modify-writes and no stores to shared memory.
+ *
+ * A writer retires a batch of unlinked objects; this closes the current grace period.
+ * The batch is freed once every online reader has announced a later period, which it
+ * does at the start of its next read section. Threads that stop reading should call
+ * offline() so that they do not hold back reclamation.
+ *
+ * Key Features:
+ * - Zero-cost reads: two loads and a compare in the steady state
+ * - Deferred, non-blocking reclamation for writers
+ * - Nestable read sections
+ * - Thread exit safe: exiting threads go offline automatically
+ *
+ * @note A thread that read once and then went idle without calling offline() delays
+ *       the freeing of memory retired after its last read until it reads again or exits.
+ */
+class QsbrDomain {
+private:
+    struct Slot;
+
+public:
+    using Deleter = void (*)(void*);    ///< Type-erased deleter for retired objects
+
+    /**
+     * @brief An object waiting for its grace period.
+     */
+    struct Retired {
+        void* ptr;          ///< Object to free
+        Deleter deleter;    ///< How to free it
+    };
+
+    /**
+     * @brief RAII read section: the thread may use shared pointers until it ends.
+     */
+    class ReadSection {
+    public:
+        /**
+         * @brief Begin a read section; announces quiescence if outermost.
+         * @param domain The domain to read in
+         */
+        explicit ReadSection(QsbrDomain& domain) : slot_(domain.local_slot()) {
+            if (slot_->nesting++ == 0) {
+                domain.announce(slot_);
+            }
+        }
+
+        /**
+         * @brief End the read section.
+         */
+        ~ReadSection() {
+            --slot_->nesting;
+        }
+
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) = delete;
+
+    private:
+        Slot* slot_;            ///< Calling thread's slot
+    };
+
+    /**
+     * @brief Get the process-wide domain shared by all read-mostly structures.
+     * @return Reference to the global domain
+     */
+    static QsbrDomain& global() {
+        static QsbrDomain domain;
+        return domain;
+    }
+
+    /**
+     * @brief Begin a read section on the calling thread.
+     *
+     * @return Guard that ends the section on destruction
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    ReadSection read() {
+        return ReadSection(*this);
+    }
+
+    /**
+     * @brief Declare that the calling thread holds no references until its next read.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe, but must not be called inside a read section
+     */
+    void offline() {
+        Slot* slot = local_slot();
+        if (slot->nesting == 0) {
+            slot->period.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Retire a batch of objects unlinked by one update and try to reclaim.
+     *
+     * @param batch Objects no longer reachable from the shared structure
+     * @complexity O(threads + pending batches)
+     * @thread_safety Safe
+     */
+    void retire(std::vector<Retired> batch) {
+        if (batch.empty()) {
+            return;
+        }
+        uint64_t period = period_.fetch_add(1, std::memory_order_seq_cst);
+        push_pending(new PendingBatch{period, std::move(batch), nullptr});
+        collect();
+    }
+
+    /**
+     * @brief Free every pending batch whose grace period has ended.
+     *
+     * The calling thread is treated as quiescent if it is outside a read section.
+     *
+     * @complexity O(threads + pending batches)
+     * @thread_safety Safe
+     */
+    void collect() {
+        Slot* self = local_slot();
+        if (self->nesting == 0 && self->period.load(std::memory_order_relaxed) != 0) {
+            announce(self);
+        }
+
+        uint64_t oldest = oldest_reader_period();
+        std::vector<Retired> ready;
+        PendingBatch* batch = pending_.exchange(nullptr, std::memory_order_acquire);
+        while (batch) {
+            PendingBatch* next = batch->next;
+            if (batch->period < oldest) {
+                ready.insert(ready.end(), batch->items.begin(), batch->items.end());
+                delete batch;
+            } else {
+                batch->next = nullptr;
+                push_pending(batch);
+            }
+            batch = next;
+        }
+        for (auto& item : ready) {
+            item.deleter(item.ptr);
+        }
+    }
+
+    /**
+     * @brief Wait until every batch retired before the call has been freed.
+     *
+     * @complexity Blocks until every online reader starts a new read section or goes offline
+     * @thread_safety Safe, but must not be called inside a read section
+     */
+    void synchronize() {
+        uint64_t target = period_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        Slot* self = local_slot();
+        while (true) {
+            if (self->period.load(std::memory_order_relaxed) != 0) {
+                announce(self);
+            }
+            if (oldest_reader_period() >= target) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+        collect();
+    }
+
+    /**
+     * @brief Destructor. Frees all remaining garbage; runs at process exit.
+     */
+    ~QsbrDomain() {
+        PendingBatch* batch = pending_.load(std::memory_order_acquire);
+        while (batch) {
+            for (auto& item : batch->items) {
+                item.deleter(item.ptr);
+            }
+            PendingBatch* next = batch->next;
+            delete batch;
+            batch = next;
+        }
+        Slot* slot = slots_.load(std::memory_order_acquire);
+        while (slot) {
+            Slot* next = slot->next;
+            delete slot;
+            slot = next;
+        }
+    }
+
+    QsbrDomain(const QsbrDomain&) = delete;
+    QsbrDomain& operator=(const QsbrDomain&) = delete;
+
+private:
+    /**
+     * @brief Per-thread announcement, cache-line aligned to avoid false sharing.
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> period{0};    ///< Period of the current read section, 0 when offline
+        std::atomic<bool> in_use{false};    ///< Claimed by a live thread
+        Slot* next = nullptr;               ///< Next slot; immutable once published
+        unsigned nesting = 0;               ///< Read section nesting depth (owner only)
+    };
+
+    /**
+     * @brief Objects retired together, freed after the period they closed.
+     */
+    struct PendingBatch {
+        uint64_t period;                    ///< Period closed by the retiring update
+        std::vector<Retired> items;         ///< Objects to free
+        PendingBatch* next;                 ///< Next batch in the pending stack
+    };
+
+    /**
+     * @brief Takes the thread offline and frees its slot when the thread exits.
+     */
+    struct ThreadHandle {
+        Slot* slot = nullptr;               ///< Slot claimed by this thread
+
+        ~ThreadHandle() {
+            if (slot) {
+                slot->period.store(0, std::memory_order_release);
+                slot->nesting = 0;
+                slot->in_use.store(false, std::memory_order_release);
+                cached_slot_ = nullptr;
+            }
+        }
+    };
+
+    alignas(64) std::atomic<uint64_t> period_{1};           ///< Current grace period
+    alignas(64) std::atomic<Slot*> slots_{nullptr};         ///< All slots ever created
+    std::atomic<PendingBatch*> pending_{nullptr};           ///< Batches awaiting their grace period
+
+    // Trivially destructible, so reading it on the hot path needs no thread_local init guard
+    static inline thread_local Slot* cached_slot_ = nullptr;    ///< Calling thread's slot
+
+    QsbrDomain() = default;
+
+    /**
+     * @brief Get (claiming on first use) the calling thread's slot.
+     * @return The thread's slot
+     */
+    Slot* local_slot() {
+        if (!cached_slot_) {
+            static thread_local ThreadHandle handle;
+            handle.slot = acquire_slot();
+            cached_slot_ = handle.slot;
+        }
+        return cached_slot_;
+    }
+
+    /**
+     * @brief Claim a free slot or publish a new one.
+     * @return A slot owned by the calling thread
+     */
+    Slot* acquire_slot() {
+        for (Slot* slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool expected = false;
+            if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return slot;
+            }
+        }
+
+        Slot* slot = new Slot();
+        slot->in_use.store(true, std::memory_order_relaxed);
+        Slot* head = slots_.load(std::memory_order_relaxed);
+        do {
+            slot->next = head;
+        } while (!slots_.compare_exchange_weak(head, slot,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+        return slot;
+    }
+
+    /**
+     * @brief Record that the thread has finished every earlier read section.
+     *
+     * Reading the period with acquire orders the announcement after the writer's
+     * publication, so a reader that announces period p sees every update retired
+     * before p. The release store orders the thread's earlier reads before it.
+     * Coming back online needs a full fence: until the store is visible, a
+     * collector would not see the thread at all.
+     */
+    void announce(Slot* slot) {
+        uint64_t period = period_.load(std::memory_order_acquire);
+        uint64_t announced = slot->period.load(std::memory_order_relaxed);
+        if (announced != period) {
+            slot->period.store(period, std::memory_order_release);
+            if (announced == 0) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+    }
+
+    /**
+     * @brief Smallest period announced by an online thread (or the current period).
+     */
+    uint64_t oldest_reader_period() const {
+        // Pairs with the fence in announce(): either the slot is seen, or the
+        // reader sees the update that preceded this scan
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t oldest = period_.load(std::memory_order_seq_cst);
+        for (Slot* slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            uint64_t period = slot->period.load(std::memory_order_acquire);
+            if (period != 0 && period < oldest) {
+                oldest = period;
+            }
+        }
+        return oldest;
+    }
+
+    /**
+     * @brief Push a batch onto the pending stack.
+     * @param batch Batch to push
+     */
+    void push_pending(PendingBatch* batch) {
+        PendingBatch* head = pending_.load(std::memory_order_relaxed);
+        do {
+            batch->next = head;
+        } while (!pending_.compare_exchange_weak(head, batch,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "cpu_dispatch.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief Fast non-cryptographic hashing for the hash-based containers.
+ *
+ * std::hash is the identity for integers on the common standard libraries, so
+ * keys that share low bits (strided ids, aligned addresses) pile into the same
+ * buckets, and it offers nothing for pairs or tuples. Hasher<T> is the default
+ * hash of AtomicHashMap, AtomicRCUHashMap, AtomicCuckooHashMap, AtomicSet, the
+ * string map and set, and AtomicBloomFilter:
+ *
+ * - Integers, enums and pointers: hash_u64(), a bijective 64-bit finalizer
+ * - Strings and string views: hash_bytes(), wyhash over the characters
+ * - Floating point: the bit pattern, with -0.0 hashed like 0.0
+ * - std::pair and std::tuple: element hashes folded with hash_combine(), which
+ *   is order-sensitive, so (a, b) and (b, a) hash differently
+ * - Anything else: std::hash<T> passed through hash_u64()
+ *
+ * hash_batch() hashes a span of keys; for integer keys it runs the AVX2 kernel
+ * from cpu_dispatch.hpp when the host supports it.
+ *
+ * On little-endian hosts with a 64-bit size_t, the hashes of integers, enums,
+ * floating point values, strings, and pairs and tuples of those do not depend on
+ * the platform or standard library, so they may be persisted, e.g. in serialized
+ * Bloom filters. Pointer hashes depend on addresses, and the fallback for other
+ * types depends on the standard library's std::hash, so neither should be stored.
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicSet<std::pair<int, int>> edges;           // Hasher<std::pair<int, int>>
+ * size_t h = lockfree::Hasher<std::string_view>{}("key");
+ *
+ * std::vector<uint64_t> ids = load_ids();
+ * std::vector<size_t> hashes(ids.size());
+ * lockfree::hash_batch(std::span<const uint64_t>(ids), std::span<size_t>(hashes));
+ * @endcode
+ */
+
+namespace hash_detail {
+
+inline constexpr uint64_t SECRET[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+/**
+ * @brief Full 64x64 -> 128-bit multiply; a becomes the low half and b the high half.
+ */
+inline void multiply(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = static_cast<__uint128_t>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+#else
+    const uint64_t a_hi = a >> 32, a_lo = static_cast<uint32_t>(a);
+    const uint64_t b_hi = b >> 32, b_lo = static_cast<uint32_t>(b);
+    const uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + static_cast<uint32_t>(hi_lo) + lo_hi;
+    a = (cross << 32) | static_cast<uint32_t>(lo_lo);
+    b = hi_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64_t read8(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t read4(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t read_small(const uint8_t* p, size_t len) {
+    return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+}
+
+} // namespace hash_detail
+
+/**
+ * @brief Hash a byte range with wyhash (final version 4).
+ *
+ * @param data Bytes to hash (no alignment requirement)
+ * @param len Number of bytes
+ * @param seed Seed; different seeds give independent hash functions
+ * @return 64-bit hash
+ * @complexity O(len), about 16 bytes per multiply
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+inline uint64_t hash_bytes(const void* data, size_t len, uint64_t seed = 0) {
+    using namespace hash_detail;
+    const auto* p = static_cast<const uint8_t*>(data);
+    seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+    uint64_t a, b;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+            b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) {
+            a = read_small(p, len);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i >= 48) {
+            uint64_t seed1 = seed, seed2 = seed;
+            do {
+                seed = mix(read8(p) ^ SECRET[1], read8(p + 8) ^ seed);
+                seed1 = mix(read8(p + 16) ^ SECRET[2], read8(p + 24) ^ seed1);
+                seed2 = mix(read8(p + 32) ^ SECRET[3], read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = mix(read8(p) ^ SECRET[1], read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+
+    a ^= SECRET[1];
+    b ^= seed;
+    multiply(a, b);
+    return mix(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+
+/**
+ * @brief Fold an element hash into a running hash (for composite keys).
+ *
+ * @param seed Hash of the elements so far
+ * @param value Hash of the next element
+ * @return Combined hash; depends on the order of the elements
+ * @complexity O(1)
+ * @thread_safety Safe
+ * @exception_safety No-throw guarantee
+ */
+constexpr uint64_t hash_combine(uint64_t seed, uint64_t value) {
+    return hash_u64(seed * 0x9e3779b97f4a7c15ULL + value);
+}
+
+/**
+ * @brief Default hash function object of the library (see hash.hpp overview).
+ *
+ * The primary template post-mixes std::hash<T>, so any type with a std::hash
+ * specialization works; the specializations below replace it where std::hash is weak.
+ */
+template<typename T, typename Enable = void>
+struct Hasher {
+    size_t operator()(const T& value) const noexcept(noexcept(std::hash<T>{}(value))) {
+        return static_cast<size_t>(hash_u64(static_cast<uint64_t>(std::hash<T>{}(value))));
+    }
+};
+
+template<typename T>
+struct Hasher<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+    size_t operator()(T value) const noexcept {
+        if constexpr (std::is_enum_v<T>) {
+            return static_cast<size_t>(hash_u64(static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(value))));
+        } else {
+            return static_cast<size_t>(hash_u64(static_cast<uint64_t>(value)));
+        }
+    }
+};
+
+template<typename T>
+struct Hasher<T*> {
+    size_t operator()(T* value) const noexcept {
+        return static_cast<size_t>(hash_u64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value))));
+    }
+};
+
+template<typename T>
+struct Hasher<T, std::enable_if_t<std::is_floating_point_v<T> && sizeof(T) <= sizeof(uint64_t)>> {
+    size_t operator()(T value) const noexcept {
+        if (value == T(0)) {
+            value = T(0);   // -0.0 == 0.0, so they must hash alike
+        }
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        return static_cast<size_t>(hash_u64(bits));
+    }
+};
+
+/**
+ * @brief Strings and string views of the same characters hash alike, so lookups are transparent.
+ */
+template<typename CharT, typename Traits>
+struct Hasher<std::basic_string_view<CharT, Traits>> {
+    using is_transparent = void;
+
+    size_t operator()(std::basic_string_view<CharT, Traits> value) const noexcept {
+        return static_cast<size_t>(hash_bytes(value.data(), value.size() * sizeof(CharT)));
+    }
+};
+
+template<typename CharT, typename Traits, typename Alloc>
+struct Hasher<std::basic_string<CharT, Traits, Alloc>> : Hasher<std::basic_string_view<CharT, Traits>> {};
+
+template<typename T1, typename T2>
+struct Hasher<std::pair<T1, T2>> {
+    size_t operator()(const std::pair<T1, T2>& value) const {
+        return static_cast<size_t>(hash_combine(Hasher<T1>{}(value.first), Hasher<T2>{}(value.second)));
+    }
+};
+
+template<typename... Ts>
+struct Hasher<std::tuple<Ts...>> {
+    size_t operator()(const std::tuple<Ts...>& value) const {
+        return std::apply([](const Ts&... elements) {
+            uint64_t seed = sizeof...(Ts);
+            ((seed = hash_combine(seed, Hasher<Ts>{}(elements))), ...);
+            return static_cast<size_t>(seed);
+        }, value);
+    }
+};
+
+/**
+ * @brief Hash a batch of keys.
+ *
+ * With the default Hasher and integer keys this runs the best hash_batch kernel
+ * for the host (four keys per AVX2 step); other keys and hash functions are
+ * hashed one by one. Either way out[i] == hasher(keys[i]).
+ *
+ * @param keys Keys to hash
+ * @param out Receives one hash per key; must be at least keys.size() long
+ * @param hasher Hash function
+ * @complexity O(keys.size())
+ * @thread_safety Safe
+ * @exception_safety Propagates exceptions from hasher
+ */
+template<typename Key, typename Hash = Hasher<Key>>
+void hash_batch(std::span<const Key> keys, std::span<size_t> out, const Hash& hasher = Hash{}) {
+    if constexpr (std::is_same_v<Hash, Hasher<Key>> && std::is_integral_v<Key> &&
+                  std::is_same_v<size_t, uint64_t>) {
+        if constexpr (sizeof(Key) == sizeof(uint64_t)) {
+            kernels().hash_batch(reinterpret_cast<const uint64_t*>(keys.data()), out.data(), keys.size());
+        } else {
+            // Widen in cache-sized chunks; sign extension matches Hasher<Key>
+            constexpr size_t CHUNK = 256;
+            uint64_t wide[CHUNK];
+            for (size_t base = 0; base < keys.size(); base += CHUNK) {
+                const size_t n = std::min(CHUNK, keys.size() - base);
+                for (size_t i = 0; i < n; ++i) {
+                    wide[i] = static_cast<uint64_t>(keys[base + i]);
+                }
+                kernels().hash_batch(wide, out.data() + base, n);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            out[i] = hasher(keys[i]);
+        }
+    }
+}
+
+} // namespace lockfree
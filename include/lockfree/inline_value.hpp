@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lockfree {
+
+/**
+ * @brief Element types that containers store by value in atomic words.
+ *
+ * A trivially copyable type of at most 16 bytes needs no constructor, no
+ * destructor and no heap box: its bytes can be copied in and out of a slot
+ * with plain stores. AtomicRingBuffer, AtomicQueue and AtomicMPMCQueue select
+ * a fast path for such types at compile time.
+ */
+template<typename T>
+concept InlineValue = std::is_trivially_copyable_v<T> && sizeof(T) <= 16;
+
+/**
+ * @brief Element types that ordered maps replace in place with one atomic word.
+ *
+ * AtomicSkipList and AtomicRBTree keep such values in their nodes and access
+ * them through std::atomic_ref, so insert_or_assign() and compute() update an
+ * existing key with a single compare-and-swap instead of a new node or a heap
+ * box. The type must not have padding bits (floating point aside), since a
+ * compare-and-swap compares object representations.
+ */
+template<typename T>
+concept AtomicWordValue = InlineValue<T> && sizeof(T) <= sizeof(uint64_t) &&
+    (std::has_unique_object_representations_v<T> || std::is_floating_point_v<T>) &&
+    std::atomic_ref<T>::is_always_lock_free;
+
+/**
+ * @brief Alignment a container must give a stored T so std::atomic_ref can bind to it.
+ */
+template<typename T>
+constexpr size_t atomic_word_alignment() {
+    if constexpr (AtomicWordValue<T>) {
+        return std::atomic_ref<T>::required_alignment;
+    } else {
+        return alignof(T);
+    }
+}
+
+/**
+ * @brief Storage for an InlineValue as one or two relaxed atomic words.
+ *
+ * Loads and stores are word-wise, so a reader racing with a writer may see a
+ * mix of old and new words for types wider than 8 bytes. Containers publish
+ * and retire the value with their own acquire/release flag or sequence
+ * number; this class only makes the racy peek paths (front(), back()) free
+ * of undefined behaviour.
+ *
+ * @tparam T An InlineValue type. The check is a static_assert rather than a
+ *           constraint so that containers can name AtomicInlineValue<T> in a
+ *           std::conditional_t branch that is not taken.
+ */
+template<typename T>
+class AtomicInlineValue {
+private:
+    static_assert(InlineValue<T>, "AtomicInlineValue requires a trivially copyable type of at most 16 bytes");
+
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> words_[WORDS] = {};   ///< Value bytes, zero-padded
+
+public:
+    /**
+     * @brief Store a value.
+     *
+     * @param value The value to store
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    void store(const T& value) {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Load the stored value.
+     *
+     * @return The stored value (zero bytes if nothing was ever stored)
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    T load() const {
+        uint64_t buffer[WORDS];
+        for (size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::array<unsigned char, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), buffer, sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+};
+
+} // namespace lockfree
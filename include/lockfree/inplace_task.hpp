@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lockfree {
+
+/**
+ * @brief A move-only void() callable with an inline buffer for its captures.
+ *
+ * A replacement for std::function<void()> in task queues. std::function keeps
+ * only about 16 bytes of captures inline and heap-allocates anything larger;
+ * InplaceTask keeps up to Capacity bytes inline, so constructing, moving and
+ * destroying a task whose callable fits never allocates. The layout is one
+ * operations pointer followed by the buffer, so sizeof(InplaceTask<48>) is 56
+ * bytes and a task plus the occupancy flag of an AtomicWorkStealingDeque slot
+ * fits in one 64-byte cache line (two lines for InplaceTask<112>).
+ *
+ * @tparam Capacity Inline buffer size in bytes: a multiple of 8 in [48, 112].
+ *
+ * Key Features:
+ * - No allocation for callables that fit (see fits_inline())
+ * - Move-only, so captures such as std::unique_ptr are allowed
+ * - Callables that do not fit still work: they are heap-allocated once, like std::function
+ *
+ * Performance Characteristics:
+ * - Construct/move/destroy: O(sizeof(F)), no allocation when F fits
+ * - Invoke: one indirect call
+ * - Memory: Capacity + 8 bytes
+ *
+ * Usage Example:
+ * @code
+ * lockfree::AtomicWorkStealingDeque<lockfree::InplaceTask<48>> tasks;
+ *
+ * std::array<int, 8> block = load_block();
+ * tasks.push_bottom([block] { process(block); });   // 32-byte capture, no allocation
+ *
+ * lockfree::InplaceTask<48> task;
+ * if (tasks.pop_bottom(task)) {
+ *     task();
+ * }
+ * @endcode
+ *
+ * @note A callable fits when it is at most Capacity bytes, needs no more than
+ *       8-byte alignment, and is nothrow move constructible.
+ */
+template<size_t Capacity = 48>
+class InplaceTask {
+private:
+    static_assert(Capacity >= 48 && Capacity <= 112, "InplaceTask capacity must be between 48 and 112 bytes");
+    static_assert(Capacity % alignof(void*) == 0, "InplaceTask capacity must be a multiple of 8");
+
+    /**
+     * @brief Per-callable-type operations, shared by every task holding that type.
+     */
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*move)(void* to, void* from) noexcept;    ///< Move-construct into to, then destroy from
+        void (*destroy)(void* storage) noexcept;
+        bool heap;                                      ///< Storage holds a pointer to the callable
+    };
+
+    template<typename F>
+    struct InlineOps {
+        static void invoke(void* storage) {
+            (*static_cast<F*>(storage))();
+        }
+
+        static void move(void* to, void* from) noexcept {
+            ::new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        }
+
+        static void destroy(void* storage) noexcept {
+            static_cast<F*>(storage)->~F();
+        }
+
+        static constexpr Ops table{invoke, move, destroy, false};
+    };
+
+    template<typename F>
+    struct HeapOps {
+        static void invoke(void* storage) {
+            (**static_cast<F**>(storage))();
+        }
+
+        static void move(void* to, void* from) noexcept {
+            *static_cast<F**>(to) = *static_cast<F**>(from);
+        }
+
+        static void destroy(void* storage) noexcept {
+            delete *static_cast<F**>(storage);
+        }
+
+        static constexpr Ops table{invoke, move, destroy, true};
+    };
+
+    const Ops* ops_ = nullptr;                                  ///< Operations for the stored callable, or null
+    alignas(void*) unsigned char storage_[Capacity];            ///< The callable, or a pointer to it
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    void take(InplaceTask& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+public:
+    /**
+     * @brief Check whether a callable of type F is stored without allocating.
+     *
+     * @complexity O(1) - compile-time constant
+     */
+    template<typename F>
+    static constexpr bool fits_inline() {
+        using Fn = std::decay_t<F>;
+        return sizeof(Fn) <= Capacity && alignof(Fn) <= alignof(void*) &&
+               std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+    /**
+     * @brief Create an empty task.
+     *
+     * @complexity O(1)
+     * @exception_safety No-throw guarantee
+     */
+    InplaceTask() noexcept = default;
+
+    /**
+     * @brief Create a task holding a callable.
+     *
+     * @param f Callable invocable as void(); moved or copied into the task
+     * @complexity O(sizeof(F))
+     * @exception_safety Strong guarantee - if F's constructor or (for callables
+     *                   that do not fit) operator new throws, nothing is stored
+     */
+    template<typename F>
+        requires (!std::is_same_v<std::decay_t<F>, InplaceTask> && std::is_invocable_v<std::decay_t<F>&>)
+    InplaceTask(F&& f) {
+        using Fn = std::decay_t<F>;
+        if constexpr (fits_inline<Fn>()) {
+            ::new (storage_) Fn(std::forward<F>(f));
+            ops_ = &InlineOps<Fn>::table;
+        } else {
+            *reinterpret_cast<Fn**>(storage_) = new Fn(std::forward<F>(f));
+            ops_ = &HeapOps<Fn>::table;
+        }
+    }
+
+    /**
+     * @brief Move constructor. Leaves other empty.
+     *
+     * @complexity O(sizeof(F))
+     * @exception_safety No-throw guarantee
+     */
+    InplaceTask(InplaceTask&& other) noexcept {
+        take(other);
+    }
+
+    /**
+     * @brief Move assignment. Destroys the current callable and leaves other empty.
+     *
+     * @complexity O(sizeof(F))
+     * @exception_safety No-throw guarantee
+     */
+    InplaceTask& operator=(InplaceTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    InplaceTask(const InplaceTask&) = delete;
+    InplaceTask& operator=(const InplaceTask&) = delete;
+
+    /**
+     * @brief Destructor. Destroys the stored callable.
+     */
+    ~InplaceTask() {
+        reset();
+    }
+
+    /**
+     * @brief Run the stored callable.
+     *
+     * @complexity O(1) plus the callable
+     * @exception_safety Propagates exceptions from the callable; throws
+     *                   std::bad_function_call if the task is empty
+     */
+    void operator()() {
+        if (!ops_) {
+            throw std::bad_function_call();
+        }
+        ops_->invoke(storage_);
+    }
+
+    /**
+     * @brief Check whether the task holds a callable.
+     */
+    explicit operator bool() const noexcept {
+        return ops_ != nullptr;
+    }
+
+    /**
+     * @brief Check whether the stored callable lives in the inline buffer.
+     *
+     * @return true if the task holds a callable that did not need an allocation
+     */
+    bool is_inline() const noexcept {
+        return ops_ != nullptr && !ops_->heap;
+    }
+
+    /**
+     * @brief Get the inline buffer size.
+     */
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+};
+
+} // namespace lockfree
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <algorithm>
+#include <thread>
+#include "epoch_reclamation.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A fixed-capacity pool of nodes addressed by 32-bit indices.
+ *
+ * Backs the compact containers (AtomicCompactStack, AtomicCompactQueue,
+ * AtomicCompactLinkedList, AtomicCompactSkipList). Their links are 32-bit slot
+ * indices into one preallocated array instead of 64-bit pointers, which halves
+ * the footprint of every link and leaves the other half of a 64-bit word free
+ * for an ABA tag, so a single-word CAS does the job of a double-width one.
+ *
+ * Nodes are never returned to the heap while the arena lives. A node given back
+ * with release() is reused immediately, which is safe when the container guards
+ * every link it CASes with a tag. A node given back with retire() is reused
+ * only after an EpochDomain grace period, for containers whose readers follow
+ * links without tags. Once the working set has been reached, the containers run
+ * without touching the heap allocator.
+ *
+ * @tparam Node The node type. Must be default constructible; a node object is
+ *              constructed the first time its slot is handed out and reused from
+ *              then on. If Node has a reclaim() member it is called when a
+ *              retired node's grace period ends.
+ *
+ * Key Features:
+ * - Lock-free allocate/release through a tagged free list
+ * - Epoch-deferred reuse for retire(), with no per-node bookkeeping
+ * - Slots are constructed on first use, so untouched capacity costs no memory
+ *   beyond reserved address space
+ *
+ * @note Indices are only meaningful for the arena that produced them.
+ */
+template<typename Node>
+class NodeArena {
+public:
+    using Index = uint32_t;
+
+    static constexpr Index NULL_INDEX = UINT32_MAX;             ///< "No node"
+    static constexpr size_t MAX_CAPACITY = NULL_INDEX;          ///< Largest usable capacity
+
+    /**
+     * @brief Pack an index and a tag into one CAS-able word.
+     */
+    static constexpr uint64_t pack(Index index, uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    /**
+     * @brief Index half of a packed word.
+     */
+    static constexpr Index index_of(uint64_t word) {
+        return static_cast<Index>(word);
+    }
+
+    /**
+     * @brief Tag half of a packed word.
+     */
+    static constexpr uint32_t tag_of(uint64_t word) {
+        return static_cast<uint32_t>(word >> 32);
+    }
+
+    /**
+     * @brief Reserve storage for a fixed number of nodes.
+     *
+     * @param capacity Number of slots, clamped to [1, MAX_CAPACITY]
+     * @param epochs Domain that defers reuse of retired nodes
+     * @complexity O(1) - slots are constructed lazily
+     * @thread_safety Safe
+     */
+    explicit NodeArena(size_t capacity, EpochDomain& epochs = EpochDomain::global())
+        : capacity_(std::clamp<size_t>(capacity, 1, MAX_CAPACITY)),
+          nodes_(static_cast<Node*>(::operator new(capacity_ * sizeof(Node), std::align_val_t{alignof(Node)}))),
+          free_next_(static_cast<std::atomic<Index>*>(::operator new(capacity_ * sizeof(std::atomic<Index>)))),
+          epochs_(epochs) {
+        for (auto& head : limbo_) {
+            head.store(pack(NULL_INDEX, 0), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor. Reclaims retired nodes and destroys every constructed slot.
+     *
+     * @complexity O(slots handed out)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~NodeArena() {
+        for (auto& head : limbo_) {
+            for (Index i = index_of(head.load(std::memory_order_relaxed)); i != NULL_INDEX;
+                 i = free_next_[i].load(std::memory_order_relaxed)) {
+                reclaim(nodes_[i]);
+            }
+        }
+        size_t constructed = high_water();
+        for (size_t i = 0; i < constructed; ++i) {
+            nodes_[i].~Node();
+        }
+        ::operator delete(nodes_, std::align_val_t{alignof(Node)});
+        ::operator delete(free_next_);
+    }
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /**
+     * @brief Access a node by index.
+     *
+     * @param index An index returned by allocate()
+     * @complexity O(1)
+     * @thread_safety Safe
+     */
+    Node& node(Index index) const {
+        return nodes_[index];
+    }
+
+    /**
+     * @brief Take a node from the arena.
+     *
+     * Reuses released nodes first, then retired nodes whose grace period has
+     * ended, then never-used slots.
+     *
+     * @return Index of a node owned by the caller, or NULL_INDEX if the arena is full
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee unless Node's default constructor throws
+     */
+    Index allocate() {
+        Index index = pop_free();
+        if (index != NULL_INDEX) {
+            return index;
+        }
+
+        index = reuse_retired(LIMBO_SLOTS);
+        if (index != NULL_INDEX) {
+            return index;
+        }
+
+        index = take_fresh();
+        if (index != NULL_INDEX) {
+            return index;
+        }
+
+        // Full: the only way out is for readers of retired nodes to move on
+        for (int attempt = 0; attempt < MAX_RECLAIM_ATTEMPTS && has_retired(); ++attempt) {
+            std::this_thread::yield();
+            index = reuse_retired(LIMBO_SLOTS);
+            if (index != NULL_INDEX) {
+                return index;
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    /**
+     * @brief Return a node for immediate reuse.
+     *
+     * @param index Node owned by the caller; no other thread may dereference it
+     *              unless every link it reads is validated by a tag
+     * @complexity O(1) amortized
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    void release(Index index) {
+        push_free(index, index);
+    }
+
+    /**
+     * @brief Return an unlinked node for reuse after a grace period.
+     *
+     * Concurrent readers that reached the node before it was unlinked may keep
+     * using it; it is reused only once all of them have unpinned.
+     *
+     * @param index Node no longer reachable from the container
+     * @complexity O(1) amortized
+     * @thread_safety Safe, but the caller must be pinned in the arena's EpochDomain
+     * @exception_safety No-throw guarantee
+     */
+    void retire(Index index) {
+        // Sequentially consistent, as in EpochDomain::retire(): a stale label would
+        // let drain_retired() reuse the node one grace period early
+        uint64_t epoch = epochs_.epoch();
+        uint32_t label = static_cast<uint32_t>(epoch);
+        std::atomic<uint64_t>& slot = limbo_[epoch % LIMBO_SLOTS];
+
+        uint64_t head = slot.load(std::memory_order_acquire);
+        while (true) {
+            if (index_of(head) != NULL_INDEX && tag_of(head) != label) {
+                // The slot still holds a list from three epochs ago, which is past its grace period
+                if (slot.compare_exchange_weak(head, pack(NULL_INDEX, label),
+                                               std::memory_order_acquire, std::memory_order_acquire)) {
+                    recycle_chain(index_of(head));
+                    head = pack(NULL_INDEX, label);
+                }
+                continue;
+            }
+            free_next_[index].store(index_of(head), std::memory_order_relaxed);
+            if (slot.compare_exchange_weak(head, pack(index, label),
+                                           std::memory_order_release, std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of slots.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    /**
+     * @brief Get the number of slots that have ever been handed out.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t high_water() const {
+        return std::min(fresh_.load(std::memory_order_relaxed), capacity_);
+    }
+
+    /**
+     * @brief Approximate bytes in use: the slots handed out so far plus the arena itself.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        return sizeof(*this) + high_water() * (sizeof(Node) + sizeof(std::atomic<Index>));
+    }
+
+private:
+    static constexpr size_t LIMBO_SLOTS = 3;    ///< Epochs that can hold garbage at once
+    static constexpr int MAX_RECLAIM_ATTEMPTS = 100;    ///< Yields to wait out readers when full
+
+    const size_t capacity_;                     ///< Number of slots
+    Node* const nodes_;                         ///< Slot storage, constructed lazily
+    std::atomic<Index>* const free_next_;       ///< Free-list and limbo links, one per slot
+    EpochDomain& epochs_;                       ///< Grace periods for retire()
+
+    alignas(64) std::atomic<uint64_t> free_head_{pack(NULL_INDEX, 0)};  ///< Tagged free-list head
+    alignas(64) std::atomic<size_t> fresh_{0};                         ///< Slots handed out at least once
+    std::atomic<uint64_t> limbo_[LIMBO_SLOTS];  ///< Retired nodes per epoch mod 3, tagged with the epoch
+
+    static void reclaim(Node& node) {
+        if constexpr (requires { node.reclaim(); }) {
+            node.reclaim();
+        }
+    }
+
+    Index pop_free() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (index_of(head) != NULL_INDEX) {
+            // A stale next is harmless: the tag makes the CAS fail if the head moved
+            Index next = free_next_[index_of(head)].load(std::memory_order_relaxed);
+            if (free_head_.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+                                                 std::memory_order_acquire, std::memory_order_acquire)) {
+                return index_of(head);
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    void push_free(Index first, Index last) {
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        do {
+            free_next_[last].store(index_of(head), std::memory_order_relaxed);
+        } while (!free_head_.compare_exchange_weak(head, pack(first, tag_of(head) + 1),
+                                                   std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    Index take_fresh() {
+        size_t slot = fresh_.load(std::memory_order_relaxed);
+        do {
+            if (slot >= capacity_) {
+                return NULL_INDEX;
+            }
+        } while (!fresh_.compare_exchange_weak(slot, slot + 1, std::memory_order_relaxed));
+
+        ::new (&free_next_[slot]) std::atomic<Index>(NULL_INDEX);
+        ::new (&nodes_[slot]) Node();
+        return static_cast<Index>(slot);
+    }
+
+    /**
+     * @brief Recycle retired nodes whose grace period has ended, advancing the epoch as needed.
+     *
+     * A retired node needs two epoch advances, so this takes up to max_advances
+     * attempts before giving up.
+     */
+    Index reuse_retired(size_t max_advances) {
+        for (size_t attempt = 0; attempt < max_advances && has_retired(); ++attempt) {
+            if (drain_retired()) {
+                Index index = pop_free();
+                if (index != NULL_INDEX) {
+                    return index;
+                }
+            }
+            if (!epochs_.try_advance()) {
+                break;
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    bool has_retired() const {
+        for (const auto& head : limbo_) {
+            if (index_of(head.load(std::memory_order_relaxed)) != NULL_INDEX) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Move every retired list whose grace period has ended to the free list.
+     * @return true if anything was moved
+     */
+    bool drain_retired() {
+        // Sequentially consistent, so reuse is ordered after the advance that ended the grace period
+        uint32_t now = static_cast<uint32_t>(epochs_.epoch());
+        bool drained = false;
+        for (auto& slot : limbo_) {
+            uint64_t head = slot.load(std::memory_order_acquire);
+            // Two advances past the retiring epoch means no pinned thread can still see the nodes
+            if (index_of(head) == NULL_INDEX || static_cast<int32_t>(now - tag_of(head)) < 2) {
+                continue;
+            }
+            if (slot.compare_exchange_strong(head, pack(NULL_INDEX, tag_of(head)),
+                                             std::memory_order_acquire, std::memory_order_relaxed)) {
+                recycle_chain(index_of(head));
+                drained = true;
+            }
+        }
+        return drained;
+    }
+
+    void recycle_chain(Index first) {
+        Index last = first;
+        for (Index i = first; i != NULL_INDEX; i = free_next_[i].load(std::memory_order_relaxed)) {
+            reclaim(nodes_[i]);
+            last = i;
+        }
+        push_free(first, last);
+    }
+};
+
+} // namespace lockfree
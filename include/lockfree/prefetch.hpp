@@ -0,0 +1,42 @@
+#pragma once
+
+namespace lockfree {
+
+/**
+ * @brief Ask the CPU to start loading the cache line at an address for reading.
+ *
+ * Purely a hint: it never faults and has no visible effect on program state, so
+ * it may be issued for memory that turns out not to be needed. Batched lookups
+ * use it to overlap the cache misses of independent keys.
+ *
+ * @param address Any address; need not be dereferenceable
+ * @complexity O(1)
+ * @thread_safety Safe
+ */
+inline void prefetch_read(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+/**
+ * @brief Ask the CPU to start loading the cache line at an address for writing.
+ *
+ * Like prefetch_read(), but requests the line in a writable state, so a later
+ * atomic read-modify-write on it does not pay a second coherence round trip.
+ *
+ * @param address Any address; need not be dereferenceable
+ * @complexity O(1)
+ * @thread_safety Safe
+ */
+inline void prefetch_write(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 1, 3);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace lockfree
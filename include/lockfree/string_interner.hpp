@@ -0,0 +1,420 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <new>
+#include <algorithm>
+#include "atomic_hashmap.hpp"
+
+namespace lockfree {
+
+/**
+ * @brief A lock-free pool that maps strings to small, stable integer IDs.
+ *
+ * Each distinct string is copied once into append-only arena chunks and assigned
+ * a 32-bit ID. Containers can then be keyed by the ID instead of by std::string,
+ * which replaces millions of duplicate heap strings with 4-byte keys that hash as
+ * plain integers. resolve() turns an ID back into a std::string_view in O(1).
+ *
+ * The string-to-ID index is an AtomicHashMap whose keys are views into the arena.
+ * A new string takes the next ID and gets its directory entry before it is
+ * inserted into the index, so any thread that finds the string can resolve its ID
+ * without waiting for the inserting thread. The ID-to-string directory is a list of
+ * segments that double in size, so it never moves entries once written and needs
+ * no resizing locks.
+ *
+ * Key Features:
+ * - Lock-free intern(), find() and resolve()
+ * - Stable handles: IDs and the views returned by resolve() stay valid for the
+ *   lifetime of the interner
+ * - One copy per distinct string, packed into CHUNK_SIZE arena chunks
+ * - O(1) resolve(): one directory lookup, no hashing
+ *
+ * Performance Characteristics:
+ * - intern(): O(1) average for strings already present (one hash map lookup),
+ *   plus an arena copy and a hash map insert for new strings
+ * - find(): O(1) average
+ * - resolve(): O(1)
+ * - Memory: string bytes + 16 bytes per directory entry + one hash map node per string
+ *
+ * Usage Example:
+ * @code
+ * lockfree::StringInterner names(1 << 16);
+ *
+ * lockfree::StringInterner::Id cpu = names.intern("host.cpu.utilization");
+ * lockfree::AtomicHashMap<lockfree::StringInterner::Id, double> latest;
+ * latest.insert(cpu, 0.42);
+ *
+ * std::string_view name = names.resolve(cpu);  // "host.cpu.utilization"
+ * @endcode
+ *
+ * @note The string index does not grow, so pass the expected number of distinct
+ *       strings to the constructor (DEFAULT_EXPECTED_STRINGS otherwise). Past that
+ *       count lookups slow down in proportion as the index chains lengthen.
+ * @note When several threads intern the same new string at once, exactly one ID is
+ *       returned to all of them. The losers give their arena bytes back unless
+ *       another string was carved from the chunk in the meantime, and the IDs they
+ *       took stay unused, so IDs are increasing but can have gaps under contention.
+ */
+class StringInterner {
+public:
+    using Id = uint32_t;                                    ///< Handle for an interned string
+
+    static constexpr Id INVALID_ID = UINT32_MAX;            ///< Returned when the ID space is exhausted
+    static constexpr size_t DEFAULT_EXPECTED_STRINGS = 1 << 16;  ///< Index size when none is given
+
+private:
+    /**
+     * @brief Arena chunk; string bytes follow the header.
+     */
+    struct Chunk {
+        std::atomic<size_t> used;       ///< Bytes handed out (may overshoot capacity)
+        size_t capacity;                ///< Bytes available after the header
+        Chunk* next;                    ///< Next chunk in the ownership list
+
+        char* data() {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        static Chunk* create(size_t capacity, size_t used) {
+            void* memory = ::operator new(sizeof(Chunk) + capacity);
+            Chunk* chunk = static_cast<Chunk*>(memory);
+            new (&chunk->used) std::atomic<size_t>(used);
+            chunk->capacity = capacity;
+            chunk->next = nullptr;
+            return chunk;
+        }
+
+        static void destroy(Chunk* chunk) {
+            ::operator delete(chunk);
+        }
+    };
+
+    /**
+     * @brief Directory entry of one ID.
+     */
+    struct Entry {
+        const char* data;               ///< First byte of the string in the arena
+        uint32_t length;                ///< Length in bytes
+    };
+
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;            ///< Bytes per regular arena chunk
+    static constexpr size_t LARGE_STRING = CHUNK_SIZE / 4;      ///< Longer strings get a private chunk
+    static constexpr unsigned FIRST_SEGMENT_BITS = 10;          ///< Segment 0 holds 1024 entries
+    static constexpr size_t SEGMENT_COUNT = 33 - FIRST_SEGMENT_BITS;  ///< Segments covering every Id
+    static constexpr int MAX_INTERN_ATTEMPTS = 1000;            ///< Index retries before giving up
+
+    AtomicHashMap<std::string_view, Id> index_;             ///< String to ID
+    std::atomic<Entry*> segments_[SEGMENT_COUNT];               ///< ID to string, segment k holds 1024 << k
+    std::atomic<Id> next_id_{0};                                ///< Next ID to hand out
+    std::atomic<Chunk*> current_;                               ///< Chunk new strings are carved from
+    std::atomic<Chunk*> chunks_;                                ///< All chunks, for destruction
+    std::atomic<size_t> arena_bytes_{0};                        ///< Bytes reserved by all chunks
+
+    /**
+     * @brief Split an ID into its directory segment and the offset within it.
+     */
+    static void locate(Id id, size_t& segment, size_t& offset) {
+        const uint64_t position = static_cast<uint64_t>(id) + (uint64_t{1} << FIRST_SEGMENT_BITS);
+        segment = static_cast<size_t>(std::bit_width(position)) - 1 - FIRST_SEGMENT_BITS;
+        offset = static_cast<size_t>(position - (uint64_t{1} << (segment + FIRST_SEGMENT_BITS)));
+    }
+
+    /**
+     * @brief Get the directory segment for an ID, allocating it on first use.
+     */
+    Entry* segment_for(size_t segment) {
+        Entry* entries = segments_[segment].load(std::memory_order_acquire);
+        if (entries) {
+            return entries;
+        }
+        Entry* fresh = new Entry[size_t{1} << (segment + FIRST_SEGMENT_BITS)]();
+        if (segments_[segment].compare_exchange_strong(entries, fresh,
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+            return fresh;
+        }
+        delete[] fresh;     // Another thread installed the segment first
+        return entries;
+    }
+
+    /**
+     * @brief Push a chunk onto the ownership list.
+     */
+    void adopt_chunk(Chunk* chunk) {
+        arena_bytes_.fetch_add(sizeof(Chunk) + chunk->capacity, std::memory_order_relaxed);
+        Chunk* head = chunks_.load(std::memory_order_relaxed);
+        do {
+            chunk->next = head;
+        } while (!chunks_.compare_exchange_weak(head, chunk,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Reserve arena bytes for a string by bumping the current chunk.
+     *
+     * @param length Bytes to reserve
+     * @param owned Receives the private chunk of a large string, which the caller
+     *        adopts once the string is published, or nullptr
+     */
+    char* allocate(size_t length, Chunk*& owned) {
+        owned = nullptr;
+        if (length > LARGE_STRING) {
+            // Large strings get a private chunk so they do not waste a shared one
+            owned = Chunk::create(length, length);
+            return owned->data();
+        }
+
+        while (true) {
+            Chunk* chunk = current_.load(std::memory_order_acquire);
+            const size_t offset = chunk->used.fetch_add(length, std::memory_order_relaxed);
+            if (offset + length <= chunk->capacity) {
+                return chunk->data() + offset;
+            }
+
+            // Chunk exhausted: start a new one with our string already in it
+            Chunk* fresh = Chunk::create(CHUNK_SIZE, length);
+            adopt_chunk(fresh);
+            current_.compare_exchange_strong(chunk, fresh,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed);
+            return fresh->data();
+        }
+    }
+
+    /**
+     * @brief Give back the bytes of a string that lost the race to be interned.
+     *
+     * A private chunk is freed. Shared-chunk bytes are returned by rolling the
+     * bump pointer back, which only works while they are still the last bytes
+     * carved from the current chunk; otherwise they stay unused.
+     */
+    void release(char* bytes, size_t length, Chunk* owned) {
+        if (owned) {
+            Chunk::destroy(owned);
+            return;
+        }
+        Chunk* chunk = current_.load(std::memory_order_acquire);
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(chunk->data());
+        const uintptr_t at = reinterpret_cast<uintptr_t>(bytes);
+        if (at < begin || at - begin + length > chunk->capacity) {
+            return;     // Carved from a chunk that is no longer current
+        }
+        size_t end = at - begin + length;
+        chunk->used.compare_exchange_strong(end, at - begin, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Take the next ID for a string and write its directory entry.
+     *
+     * Runs before the index insert, which publishes the entry with release ordering,
+     * so any thread that finds the ID in the index can resolve it.
+     *
+     * @return The new ID, or INVALID_ID if the ID space is exhausted
+     */
+    Id reserve_id(std::string_view stored) {
+        const Id id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= INVALID_ID) {
+            next_id_.store(INVALID_ID, std::memory_order_relaxed);     // Keep the counter from wrapping
+            return INVALID_ID;
+        }
+        size_t segment, offset;
+        locate(id, segment, offset);
+        segment_for(segment)[offset] = Entry{stored.data(), static_cast<uint32_t>(stored.size())};
+        return id;
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param expected_strings Expected number of distinct strings, used to size the index.
+     *        The index never grows, so lookups slow down once this count is exceeded.
+     * @complexity O(expected_strings)
+     * @thread_safety Not applicable (constructor)
+     * @exception_safety Strong guarantee
+     */
+    explicit StringInterner(size_t expected_strings = DEFAULT_EXPECTED_STRINGS)
+        : index_(std::max<size_t>(expected_strings, 16)) {
+        for (auto& segment : segments_) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+        Chunk* first = Chunk::create(CHUNK_SIZE, 0);
+        chunks_.store(nullptr, std::memory_order_relaxed);
+        adopt_chunk(first);
+        current_.store(first, std::memory_order_release);
+    }
+
+    /**
+     * @brief Destructor. Frees all arena chunks and directory segments.
+     *
+     * @complexity O(chunks + segments)
+     * @thread_safety Not safe - should only be called when no other threads are accessing
+     */
+    ~StringInterner() {
+        Chunk* chunk = chunks_.load(std::memory_order_acquire);
+        while (chunk) {
+            Chunk* next = chunk->next;
+            Chunk::destroy(chunk);
+            chunk = next;
+        }
+        for (auto& segment : segments_) {
+            delete[] segment.load(std::memory_order_acquire);
+        }
+    }
+
+    // Non-copyable and non-movable: handed-out views point into the arena
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+    StringInterner(StringInterner&&) = delete;
+    StringInterner& operator=(StringInterner&&) = delete;
+
+    /**
+     * @brief Get the ID of a string, interning it if it is new.
+     *
+     * @param text The string to intern
+     * @return The string's ID, or INVALID_ID if the ID space is exhausted or the index
+     *         stayed contended for MAX_INTERN_ATTEMPTS
+     * @complexity O(1) average plus O(length) to hash (and for new strings, copy) the text
+     * @thread_safety Safe
+     * @exception_safety Basic guarantee - may throw std::bad_alloc; arena space taken
+     *                   before the throw is given back as for a lost race
+     */
+    Id intern(std::string_view text) {
+        Id id;
+        if (index_.find(text, id)) {
+            return id;
+        }
+
+        // The index key must point into the arena, so the string is copied and given
+        // an ID before the insert; a thread that loses the insert gives the bytes back
+        Chunk* owned;
+        char* bytes = allocate(text.size(), owned);
+        std::memcpy(bytes, text.data(), text.size());
+        const std::string_view stored(bytes, text.size());
+
+        bool won = false;
+        try {
+            const Id reserved = reserve_id(stored);
+            if (reserved == INVALID_ID) {
+                release(bytes, text.size(), owned);
+                return INVALID_ID;
+            }
+            for (int attempt = 0; attempt < MAX_INTERN_ATTEMPTS && !won; ++attempt) {
+                won = index_.insert(stored, reserved);
+                if (!won && index_.find(stored, id)) {
+                    release(bytes, text.size(), owned);
+                    return id;      // Another thread interned the same string first
+                }
+            }
+            id = reserved;
+        } catch (...) {
+            release(bytes, text.size(), owned);
+            throw;
+        }
+        if (!won) {
+            release(bytes, text.size(), owned);
+            return INVALID_ID;
+        }
+        if (owned) {
+            adopt_chunk(owned);
+        }
+        return id;
+    }
+
+    /**
+     * @brief Look up the ID of a string without interning it.
+     *
+     * @param text The string to look up
+     * @param id Receives the ID if the string is interned
+     * @return true if the string is interned
+     * @complexity O(1) average plus O(length) to hash the text
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool find(std::string_view text, Id& id) const {
+        return index_.find(text, id);
+    }
+
+    /**
+     * @brief Get the string of an ID.
+     *
+     * @param id An ID returned by intern() or find() on this interner
+     * @return View of the interned bytes, valid for the lifetime of the interner
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     *
+     * @note Passing an ID that this interner never returned is undefined behavior.
+     */
+    std::string_view resolve(Id id) const {
+        size_t segment, offset;
+        locate(id, segment, offset);
+        const Entry& entry = segments_[segment].load(std::memory_order_acquire)[offset];
+        return {entry.data, entry.length};
+    }
+
+    /**
+     * @brief Get the number of distinct strings interned.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t size() const {
+        return index_.size();
+    }
+
+    /**
+     * @brief Check if no string has been interned.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of bytes reserved by arena chunks, headers included.
+     *
+     * @complexity O(1)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t arena_bytes() const {
+        return arena_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Estimate the total memory held by the interner.
+     *
+     * Counts arena chunks, allocated directory segments, index buckets and one index
+     * node per string. Allocator overhead is not included.
+     *
+     * @complexity O(SEGMENT_COUNT)
+     * @thread_safety Safe
+     * @exception_safety No-throw guarantee
+     */
+    size_t memory_usage() const {
+        size_t bytes = arena_bytes() + sizeof(*this);
+        for (size_t segment = 0; segment < SEGMENT_COUNT; ++segment) {
+            if (segments_[segment].load(std::memory_order_relaxed)) {
+                bytes += sizeof(Entry) << (segment + FIRST_SEGMENT_BITS);
+            }
+        }
+        // Index: one bucket head per bucket, one node (hash, links, view, ID) per string
+        bytes += index_.bucket_count() * sizeof(void*);
+        bytes += size() * (4 * sizeof(void*) + sizeof(std::string_view));
+        return bytes;
+    }
+};
+
+} // namespace lockfree
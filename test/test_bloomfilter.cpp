@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 #include <thread>
+#include <atomic>
 #include <random>
 #include <chrono>
 #include <set>
@@ -168,6 +169,43 @@ void test_concurrent_operations() {
     std::cout << "PASSED\n";
 }
 
+void test_bits_set_during_inserts() {
+    std::cout << "Testing bits_set() during concurrent inserts... ";
+    
+    AtomicBloomFilter<int, 65536, 4> filter;
+    std::atomic<bool> done{false};
+    
+    // Bits are only ever set, so successive counts from one reader never shrink
+    std::thread reader([&]() {
+        size_t last = 0;
+        while (!done.load()) {
+            size_t bits = filter.bits_set();
+            assert(bits >= last);
+            assert(filter.load_factor() <= 1.0);
+            last = bits;
+        }
+    });
+    
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.emplace_back([&, t]() {
+            for (int i = 0; i < 5000; ++i) {
+                filter.insert(t * 5000 + i);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    reader.join();
+    
+    assert(!filter.empty());
+    assert(filter.bits_set() <= 4 * 10000);
+    
+    std::cout << "PASSED\n";
+}
+
 void test_multiple_filter_coordination() {
     std::cout << "Testing multiple filter coordination... ";
     
@@ -409,6 +447,7 @@ int main() {
     test_string_operations();
     test_false_positive_characteristics();
     test_concurrent_operations();
+    test_bits_set_during_inserts();
     test_multiple_filter_coordination();
     test_statistics();
     test_edge_cases();
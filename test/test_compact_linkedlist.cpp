@@ -0,0 +1,186 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include "lockfree/atomic_compact_linkedlist.hpp"
+
+using namespace lockfree;
+
+void test_basic_operations() {
+    std::cout << "Testing basic compact list operations...\n";
+    
+    AtomicCompactLinkedList<int> list(16);
+    
+    assert(list.empty());
+    assert(list.capacity() == 16);
+    
+    assert(list.insert(1));
+    assert(list.insert(2));
+    assert(list.insert(3));
+    assert(!list.insert(2));
+    assert(list.size() == 3);
+    
+    assert(list.contains(2));
+    assert(list.find(3));
+    assert(!list.contains(4));
+    
+    std::vector<int> order;
+    list.for_each([&](const int& item) { order.push_back(item); });
+    assert((order == std::vector<int>{1, 2, 3}));
+    
+    assert(list.remove(2));
+    assert(!list.remove(2));
+    assert(!list.contains(2));
+    assert(list.size() == 2);
+    
+    assert(list.remove(1));
+    assert(list.remove(3));
+    assert(list.empty());
+    
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_capacity_and_reuse() {
+    std::cout << "Testing capacity limit and node reuse...\n";
+    
+    AtomicCompactLinkedList<int> list(8);
+    for (int i = 0; i < 8; ++i) {
+        assert(list.insert(i));
+    }
+    assert(!list.insert(99));
+    
+    // Removed nodes come back after a grace period, so churn never exhausts the arena
+    for (int round = 0; round < 1000; ++round) {
+        assert(list.remove(round));
+        assert(list.insert(round + 8));
+    }
+    assert(list.size() == 8);
+    for (int i = 1000; i < 1008; ++i) {
+        assert(list.contains(i));
+    }
+    
+    std::cout << "Capacity and reuse test passed!\n";
+}
+
+void test_concurrent_operations() {
+    std::cout << "Testing concurrent insert and remove...\n";
+    
+    constexpr int num_threads = 8;
+    constexpr int keys_per_thread = 64;
+    constexpr int rounds = 200;
+    AtomicCompactLinkedList<int> list(num_threads * keys_per_thread * 4);
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int round = 0; round < rounds; ++round) {
+                for (int k = 0; k < keys_per_thread; ++k) {
+                    // Keys are owned by this thread, so a failed insert means removed
+                    // nodes are still waiting out their grace period
+                    while (!list.insert(t * keys_per_thread + k)) {
+                        std::this_thread::yield();
+                    }
+                }
+                for (int k = 0; k < keys_per_thread; ++k) {
+                    assert(list.contains(t * keys_per_thread + k));
+                }
+                // Keep the last round's keys
+                if (round + 1 < rounds) {
+                    for (int k = 0; k < keys_per_thread; ++k) {
+                        assert(list.remove(t * keys_per_thread + k));
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    assert(list.size() == num_threads * keys_per_thread);
+    size_t visited = 0;
+    list.for_each([&](const int&) { ++visited; });
+    assert(visited == list.size());
+    
+    std::cout << "Concurrent operations test passed!\n";
+}
+
+void test_reuse_under_readers() {
+    std::cout << "Testing node reuse while readers traverse...\n";
+    
+    // A tight arena forces every removed node back into use within a few epochs,
+    // while readers keep pinning and unpinning on the same nodes
+    constexpr int num_writers = 2;
+    constexpr int num_readers = 2;
+    constexpr int keys_per_writer = 16;
+    AtomicCompactLinkedList<std::string> list(num_writers * keys_per_writer + 8);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    
+    auto key = [](int k) { return "reuse-key-" + std::to_string(k) + std::string(24, '.'); };
+    
+    for (int w = 0; w < num_writers; ++w) {
+        threads.emplace_back([&, w]() {
+            for (int round = 0; round < 300; ++round) {
+                for (int k = 0; k < keys_per_writer; ++k) {
+                    while (!list.insert(key(w * keys_per_writer + k))) {
+                        std::this_thread::yield();
+                    }
+                }
+                for (int k = 0; k < keys_per_writer; ++k) {
+                    assert(list.remove(key(w * keys_per_writer + k)));
+                }
+            }
+        });
+    }
+    for (int r = 0; r < num_readers; ++r) {
+        threads.emplace_back([&]() {
+            while (!done.load(std::memory_order_acquire)) {
+                for (int k = 0; k < num_writers * keys_per_writer; ++k) {
+                    list.contains(key(k));
+                }
+            }
+        });
+    }
+    for (int w = 0; w < num_writers; ++w) {
+        threads[w].join();
+    }
+    done.store(true, std::memory_order_release);
+    for (int r = 0; r < num_readers; ++r) {
+        threads[num_writers + r].join();
+    }
+    
+    assert(list.empty());
+    
+    std::cout << "Reuse under readers test passed!\n";
+}
+
+void test_emplace() {
+    std::cout << "Testing emplace functionality...\n";
+    
+    AtomicCompactLinkedList<std::string> list(8);
+    
+    assert(list.emplace(32, 'a'));
+    assert(list.insert(std::string("hello")));
+    assert(!list.emplace("hello"));
+    assert(list.contains(std::string(32, 'a')));
+    assert(list.remove("hello"));
+    
+    std::cout << "Emplace test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCompactLinkedList Tests\n";
+    std::cout << "=============================\n\n";
+    
+    test_basic_operations();
+    test_capacity_and_reuse();
+    test_concurrent_operations();
+    test_reuse_under_readers();
+    test_emplace();
+    
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include "lockfree/atomic_compact_queue.hpp"
+
+using namespace lockfree;
+
+void test_basic_operations() {
+    std::cout << "Testing basic compact queue operations...\n";
+    
+    AtomicCompactQueue<int> queue(16);
+    
+    assert(queue.empty());
+    assert(queue.size() == 0);
+    assert(queue.capacity() == 16);
+    
+    assert(queue.enqueue(1));
+    assert(queue.enqueue(2));
+    assert(queue.enqueue(3));
+    assert(queue.size() == 3);
+    
+    int val;
+    assert(queue.dequeue(val));
+    assert(val == 1);
+    assert(queue.dequeue(val));
+    assert(val == 2);
+    assert(queue.dequeue(val));
+    assert(val == 3);
+    
+    assert(queue.empty());
+    assert(!queue.dequeue(val));
+    
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_capacity_and_reuse() {
+    std::cout << "Testing capacity limit and node reuse...\n";
+    
+    AtomicCompactQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.enqueue(i));
+    }
+    assert(!queue.enqueue(99));
+    
+    size_t memory = queue.memory_usage();
+    int val;
+    for (int round = 0; round < 1000; ++round) {
+        assert(queue.dequeue(val));
+        assert(val == round);
+        assert(queue.enqueue(round + 4));
+    }
+    assert(queue.memory_usage() == memory);
+    assert(queue.size() == 4);
+    
+    std::cout << "Capacity and reuse test passed!\n";
+}
+
+void test_concurrent_fifo() {
+    std::cout << "Testing concurrent producers and consumers...\n";
+    
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 20000;
+    AtomicCompactQueue<int> queue(256);
+    
+    std::atomic<int> consumed{0};
+    std::atomic<long long> consumed_sum{0};
+    std::vector<std::vector<int>> last_seen(num_consumers, std::vector<int>(num_producers, -1));
+    std::vector<std::thread> threads;
+    
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                while (!queue.enqueue(p * items_per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            int val;
+            while (consumed.load() < num_producers * items_per_producer) {
+                if (queue.dequeue(val)) {
+                    int producer = val / items_per_producer;
+                    // Items from one producer arrive in order
+                    assert(val % items_per_producer > last_seen[c][producer]);
+                    last_seen[c][producer] = val % items_per_producer;
+                    consumed_sum.fetch_add(val);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    long long total = static_cast<long long>(num_producers) * items_per_producer;
+    assert(consumed_sum.load() == total * (total - 1) / 2);
+    assert(queue.empty());
+    
+    std::cout << "Concurrent FIFO test passed!\n";
+}
+
+void test_emplace() {
+    std::cout << "Testing emplace functionality...\n";
+    
+    AtomicCompactQueue<std::pair<int, std::string>> queue(8);
+    
+    assert(queue.emplace(1, "first"));
+    assert(queue.emplace(2, "second"));
+    
+    std::pair<int, std::string> val;
+    assert(queue.dequeue(val));
+    assert(val.first == 1 && val.second == "first");
+    
+    // Elements left in the queue are destroyed with it
+    assert(queue.emplace(3, std::string(64, 'x')));
+    
+    std::cout << "Emplace test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCompactQueue Tests\n";
+    std::cout << "========================\n\n";
+    
+    test_basic_operations();
+    test_capacity_and_reuse();
+    test_concurrent_fifo();
+    test_emplace();
+    
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include "lockfree/atomic_compact_skiplist.hpp"
+
+using namespace lockfree;
+
+void test_basic_operations() {
+    std::cout << "Testing basic compact skip list operations...\n";
+    
+    AtomicCompactSkipList<int, std::string> skiplist(64);
+    
+    assert(skiplist.empty());
+    assert(skiplist.capacity() == 64);
+    
+    assert(skiplist.insert(5, "five"));
+    assert(skiplist.insert(1, "one"));
+    assert(skiplist.insert(3, "three"));
+    assert(!skiplist.insert(3, "again"));
+    assert(skiplist.size() == 3);
+    
+    std::string value;
+    assert(skiplist.find(3, value));
+    assert(value == "three");
+    assert(!skiplist.find(4, value));
+    assert(skiplist.contains(1));
+    assert(skiplist.find_if(5, [](const std::string& v) { return v == "five"; }));
+    
+    std::vector<int> keys;
+    skiplist.range(0, 4, [&](const int& key, const std::string&) {
+        keys.push_back(key);
+        return true;
+    });
+    assert((keys == std::vector<int>{1, 3}));
+    
+    assert(skiplist.erase(3));
+    assert(!skiplist.erase(3));
+    assert(!skiplist.contains(3));
+    assert(skiplist.size() == 2);
+    
+    assert(skiplist.emplace(7, 3, 'x'));
+    assert(skiplist.find(7, value) && value == "xxx");
+    
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_capacity_and_reuse() {
+    std::cout << "Testing capacity limit and node reuse...\n";
+    
+    AtomicCompactSkipList<int, int> skiplist(32);
+    for (int i = 0; i < 32; ++i) {
+        assert(skiplist.insert(i, i));
+    }
+    assert(!skiplist.insert(100, 100));
+    
+    // Erased nodes come back after a grace period, so churn never exhausts the arena
+    for (int round = 0; round < 2000; ++round) {
+        assert(skiplist.erase(round));
+        assert(skiplist.insert(round + 32, round));
+    }
+    assert(skiplist.size() == 32);
+    int value;
+    assert(skiplist.find(2031, value) && value == 1999);
+    
+    std::cout << "Capacity and reuse test passed!\n";
+}
+
+void test_concurrent_operations() {
+    std::cout << "Testing concurrent insert, erase and find...\n";
+    
+    constexpr int num_threads = 8;
+    constexpr int key_range = 512;
+    constexpr int operations_per_thread = 20000;
+    AtomicCompactSkipList<int, int> skiplist(key_range * 4);
+    std::vector<std::atomic<int>> net(key_range);
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            unsigned state = 12345u + t;
+            for (int i = 0; i < operations_per_thread; ++i) {
+                state = state * 1103515245u + 12345u;
+                int key = static_cast<int>((state >> 8) % key_range);
+                int value;
+                switch ((state >> 20) % 3) {
+                case 0:
+                    if (skiplist.insert(key, key * 2)) {
+                        net[key].fetch_add(1);
+                    }
+                    break;
+                case 1:
+                    if (skiplist.erase(key)) {
+                        net[key].fetch_sub(1);
+                    }
+                    break;
+                default:
+                    if (skiplist.find(key, value)) {
+                        assert(value == key * 2);
+                    }
+                    break;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    size_t expected = 0;
+    for (int key = 0; key < key_range; ++key) {
+        assert(net[key].load() == 0 || net[key].load() == 1);
+        assert(skiplist.contains(key) == (net[key].load() == 1));
+        expected += net[key].load();
+    }
+    assert(skiplist.size() == expected);
+    
+    int previous = -1;
+    skiplist.range(0, key_range, [&](const int& key, const int&) {
+        assert(key > previous);
+        previous = key;
+        return true;
+    });
+    
+    std::cout << "Concurrent operations test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCompactSkipList Tests\n";
+    std::cout << "===========================\n\n";
+    
+    test_basic_operations();
+    test_capacity_and_reuse();
+    test_concurrent_operations();
+    
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <set>
+#include "lockfree/atomic_compact_stack.hpp"
+
+using namespace lockfree;
+
+void test_basic_operations() {
+    std::cout << "Testing basic compact stack operations...\n";
+    
+    AtomicCompactStack<int> stack(16);
+    
+    assert(stack.empty());
+    assert(stack.size() == 0);
+    assert(stack.capacity() == 16);
+    
+    assert(stack.push(1));
+    assert(stack.push(2));
+    assert(stack.push(3));
+    
+    assert(!stack.empty());
+    assert(stack.size() == 3);
+    
+    int val;
+    assert(stack.pop(val));
+    assert(val == 3);
+    assert(stack.pop(val));
+    assert(val == 2);
+    assert(stack.pop(val));
+    assert(val == 1);
+    
+    assert(stack.empty());
+    assert(!stack.pop(val));
+    
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_capacity_and_reuse() {
+    std::cout << "Testing capacity limit and node reuse...\n";
+    
+    AtomicCompactStack<int> stack(4);
+    for (int i = 0; i < 4; ++i) {
+        assert(stack.push(i));
+    }
+    assert(!stack.push(99));
+    assert(stack.size() == 4);
+    
+    size_t memory = stack.memory_usage();
+    int val;
+    for (int round = 0; round < 1000; ++round) {
+        assert(stack.pop(val));
+        assert(stack.push(round));
+    }
+    // Popped nodes are recycled, so the footprint does not grow
+    assert(stack.memory_usage() == memory);
+    
+    std::cout << "Capacity and reuse test passed!\n";
+}
+
+void test_concurrent_operations() {
+    std::cout << "Testing concurrent compact stack operations...\n";
+    
+    constexpr int num_threads = 8;
+    constexpr int operations_per_thread = 20000;
+    AtomicCompactStack<int> stack(num_threads * 64);
+    
+    std::atomic<long long> pushed_sum{0};
+    std::atomic<long long> popped_sum{0};
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            int val;
+            for (int i = 0; i < operations_per_thread; ++i) {
+                int item = t * operations_per_thread + i;
+                if (stack.push(item)) {
+                    pushed_sum.fetch_add(item);
+                }
+                if (stack.pop(val)) {
+                    popped_sum.fetch_add(val);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    int val;
+    while (stack.pop(val)) {
+        popped_sum.fetch_add(val);
+    }
+    assert(pushed_sum.load() == popped_sum.load());
+    
+    std::cout << "Concurrent operations test passed!\n";
+}
+
+void test_emplace() {
+    std::cout << "Testing emplace functionality...\n";
+    
+    AtomicCompactStack<std::pair<int, std::string>> stack(8);
+    
+    assert(stack.emplace(1, "first"));
+    assert(stack.emplace(2, "second"));
+    
+    std::pair<int, std::string> val;
+    assert(stack.pop(val));
+    assert(val.first == 2 && val.second == "second");
+    assert(stack.pop(val));
+    assert(val.first == 1 && val.second == "first");
+    
+    // Elements left in the stack are destroyed with it
+    assert(stack.emplace(3, std::string(64, 'x')));
+    
+    std::cout << "Emplace test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCompactStack Tests\n";
+    std::cout << "========================\n\n";
+    
+    test_basic_operations();
+    test_capacity_and_reuse();
+    test_concurrent_operations();
+    test_emplace();
+    
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
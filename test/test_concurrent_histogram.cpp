@@ -0,0 +1,195 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <random>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/concurrent_histogram.hpp"
+
+using namespace lockfree;
+
+void test_bucket_mapping() {
+    std::cout << "Testing bucket mapping...\n";
+
+    using Histogram = ConcurrentHistogram<7, 48>;
+    static_assert(Histogram::bucket_count() == 42 * 128);
+
+    // Small values are exact
+    for (uint64_t v = 0; v < 256; ++v) {
+        assert(Histogram::bucket_index(v) == v);
+        assert(Histogram::lowest_equivalent_value(v) == v);
+        assert(Histogram::highest_equivalent_value(v) == v);
+    }
+
+    // Every value lies in its bucket, buckets are contiguous and at most 1/128 wide
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 200000; ++i) {
+        const uint64_t v = rng() >> (rng() % 64);
+        const uint64_t clamped = std::min(v, Histogram::MAX_TRACKABLE);
+        const uint64_t low = Histogram::lowest_equivalent_value(v);
+        const uint64_t high = Histogram::highest_equivalent_value(v);
+        assert(low <= clamped && clamped <= high);
+        assert(Histogram::bucket_index(v) < Histogram::bucket_count());
+        assert(high - low <= low / 128);
+        if (high < Histogram::MAX_TRACKABLE) {
+            assert(Histogram::bucket_index(high + 1) == Histogram::bucket_index(v) + 1);
+        }
+    }
+    assert(Histogram::bucket_index(UINT64_MAX) == Histogram::bucket_count() - 1);
+    using FullRange = ConcurrentHistogram<7, 64>;
+    assert(FullRange::bucket_index(UINT64_MAX) == FullRange::bucket_count() - 1);
+
+    std::cout << "Bucket mapping test passed!\n";
+}
+
+void test_percentiles() {
+    std::cout << "Testing percentile queries...\n";
+
+    ConcurrentHistogram<> histogram;
+    auto empty = histogram.snapshot();
+    assert(empty.total_count() == 0 && empty.value_at_percentile(50) == 0 && empty.max() == 0);
+
+    for (uint64_t v = 1; v <= 100000; ++v) {
+        histogram.record(v);
+    }
+    auto snap = histogram.snapshot();
+    assert(snap.total_count() == 100000);
+    assert(snap.min() == 1 && snap.max() == 100000);
+    assert(snap.mean() == 50000.5);
+
+    for (double p : {1.0, 25.0, 50.0, 90.0, 99.0, 99.9}) {
+        const double expected = p * 1000;
+        const double actual = static_cast<double>(snap.value_at_percentile(p));
+        assert(actual >= expected && actual <= expected * (1 + 1.0 / 128) + 1);
+    }
+    assert(snap.value_at_percentile(0) == 1);
+    assert(snap.value_at_percentile(100) == 100000);
+    assert(snap.value_at_percentile(150) == 100000);
+    assert(snap.count_at_or_below(255) == 255);
+
+    // Values above the trackable range keep an exact max
+    ConcurrentHistogram<7, 20> small;
+    small.record(5);
+    small.record(uint64_t{1} << 40, 3);
+    auto big = small.snapshot();
+    assert(big.total_count() == 4);
+    assert(big.max() == uint64_t{1} << 40);
+    assert(big.value_at_percentile(99) == uint64_t{1} << 40);
+    assert(big.value_at_percentile(10) == 5);
+
+    std::cout << "Percentile queries test passed!\n";
+}
+
+void test_concurrent_recording() {
+    std::cout << "Testing concurrent recording...\n";
+
+    constexpr int num_threads = 12;
+    constexpr int records_per_thread = 50000;
+    ConcurrentHistogram<> histogram(4);   // Fewer stripes than threads: the rest share a stripe
+    assert(histogram.stripe_count() == 4);
+
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        uint64_t last = 0;
+        while (!done.load()) {
+            auto snap = histogram.snapshot();
+            assert(snap.total_count() >= last);   // Counts only grow
+            last = snap.total_count();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < records_per_thread; ++i) {
+                histogram.record(static_cast<uint64_t>(t * 1000 + i % 1000));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+
+    auto snap = histogram.snapshot();
+    assert(snap.total_count() == static_cast<uint64_t>(num_threads) * records_per_thread);
+    assert(snap.min() == 0);
+    assert(snap.max() == (num_threads - 1) * 1000 + 999);
+
+    std::cout << "Concurrent recording test passed!\n";
+}
+
+void test_thread_churn() {
+    std::cout << "Testing stripe reuse across short-lived threads...\n";
+
+    ConcurrentHistogram<> histogram(4);
+    constexpr int num_threads = 20;   // Far more threads over time than stripes
+
+    // One thread at a time: each exiting thread's slot goes to the next one
+    for (int t = 0; t < num_threads; ++t) {
+        std::thread worker([&histogram, t]() {
+            for (int i = 0; i < 100; ++i) {
+                histogram.record(static_cast<uint64_t>(t));
+            }
+        });
+        worker.join();
+    }
+
+    auto snap = histogram.snapshot();
+    assert(snap.total_count() == num_threads * 100);
+    assert(snap.max() == num_threads - 1);
+    assert(histogram.shared_count() == 0);   // Every thread found a private stripe
+
+    std::cout << "Thread churn test passed!\n";
+}
+
+void test_merge_and_reset() {
+    std::cout << "Testing merge and reset...\n";
+
+    ConcurrentHistogram<> fast;
+    ConcurrentHistogram<> slow;
+    for (uint64_t i = 0; i < 900; ++i) {
+        fast.record(100);
+    }
+    for (uint64_t i = 0; i < 100; ++i) {
+        slow.record(10000);
+    }
+
+    ConcurrentHistogram<> total;
+    total.merge(fast);
+    total.merge(slow);
+    total.merge(total);   // Self-merge is a no-op
+    auto snap = total.snapshot();
+    assert(snap.total_count() == 1000);
+    assert(snap.value_at_percentile(90) == 100);
+    assert(snap.value_at_percentile(91) >= 10000);
+    assert(snap.min() == 100 && snap.max() == 10000);
+
+    auto combined = fast.snapshot();
+    combined.merge(slow.snapshot());
+    assert(combined.total_count() == 1000 && combined.mean() == snap.mean());
+
+    total.reset();
+    auto cleared = total.snapshot();
+    assert(cleared.total_count() == 0 && cleared.max() == 0);
+    total.record(7);
+    assert(total.snapshot().min() == 7);
+
+    std::cout << "Merge and reset test passed!\n";
+}
+
+int main() {
+    std::cout << "ConcurrentHistogram Tests\n";
+    std::cout << "=========================\n\n";
+
+    test_bucket_mapping();
+    test_percentiles();
+    test_concurrent_recording();
+    test_thread_churn();
+    test_merge_and_reset();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
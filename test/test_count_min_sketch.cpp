@@ -0,0 +1,183 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <random>
+#include <cmath>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/atomic_count_min_sketch.hpp"
+
+using namespace lockfree;
+
+// Zipf-distributed keys 0..distinct-1, key 0 the most frequent
+std::vector<uint64_t> zipf_stream(size_t length, size_t distinct, double skew, uint32_t seed) {
+    std::vector<double> weights(distinct);
+    for (size_t i = 0; i < distinct; ++i) {
+        weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), skew);
+    }
+    std::discrete_distribution<uint64_t> dist(weights.begin(), weights.end());
+    std::mt19937 rng(seed);
+    std::vector<uint64_t> stream(length);
+    for (auto& key : stream) {
+        key = dist(rng);
+    }
+    return stream;
+}
+
+void test_basic_counting() {
+    std::cout << "Testing basic counting...\n";
+
+    AtomicCountMinSketch<std::string, 1024, 4> sketch;
+    assert(sketch.estimate("absent") == 0);
+    assert(sketch.add("apple") == 1);
+    assert(sketch.add("apple", 4) == 5);
+    sketch.add("pear");
+    assert(sketch.estimate("apple") == 5);   // A few items in 1024 counters do not collide in every row
+    assert(sketch.estimate("pear") == 1);
+    assert(sketch.total_count() == 6);
+    assert(sketch.memory_bytes() == 1024 * 4 * 8);
+
+    sketch.clear();
+    assert(sketch.estimate("apple") == 0 && sketch.total_count() == 0);
+
+    std::cout << "Basic counting test passed!\n";
+}
+
+template<bool Conservative>
+uint64_t check_error_bound(const std::vector<uint64_t>& stream) {
+    AtomicCountMinSketch<uint64_t, 2048, 4, Conservative> sketch;
+    std::unordered_map<uint64_t, uint64_t> truth;
+    for (uint64_t key : stream) {
+        sketch.add(key);
+        ++truth[key];
+    }
+    assert(sketch.total_count() == stream.size());
+
+    const double bound = sketch.error_bound();
+    size_t within = 0;
+    uint64_t total_error = 0;
+    for (const auto& [key, count] : truth) {
+        const uint64_t estimate = sketch.estimate(key);
+        assert(estimate >= count);   // Never an underestimate
+        within += static_cast<double>(estimate - count) <= bound;
+        total_error += estimate - count;
+    }
+    assert(static_cast<double>(within) >= 0.98 * static_cast<double>(truth.size()));
+    return total_error;
+}
+
+void test_error_bounds() {
+    std::cout << "Testing error bounds...\n";
+
+    const auto stream = zipf_stream(200000, 50000, 1.0, 1);
+    const uint64_t plain_error = check_error_bound<false>(stream);
+    const uint64_t conservative_error = check_error_bound<true>(stream);
+    assert(conservative_error < plain_error);   // Conservative update only ever tightens
+
+    std::cout << "Error bounds test passed!\n";
+}
+
+void test_batches() {
+    std::cout << "Testing batch add and estimate...\n";
+
+    const auto keys = zipf_stream(1000, 300, 1.0, 2);
+    AtomicCountMinSketch<uint64_t, 512, 3> scalar;
+    AtomicCountMinSketch<uint64_t, 512, 3> batched;
+    std::vector<uint64_t> after_add(keys.size());
+    for (uint64_t key : keys) {
+        scalar.add(key);
+    }
+    batched.add_batch(keys.data(), 7, after_add.data());   // A partial group first
+    batched.add_batch(keys.data() + 7, keys.size() - 7, after_add.data() + 7);
+    assert(after_add[0] == 1);
+
+    std::vector<uint64_t> estimates(keys.size());
+    batched.estimate_batch(keys.data(), keys.size(), estimates.data());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(estimates[i] == scalar.estimate(keys[i]));
+        assert(after_add[i] <= estimates[i]);
+    }
+
+    std::vector<std::string> words = {"a", "b", "a", "c", "a", "b"};
+    AtomicCountMinSketch<std::string, 256, 4, true> strings;
+    strings.add_batch(words.data(), words.size());
+    assert(strings.estimate("a") == 3 && strings.estimate("b") == 2 && strings.estimate("c") == 1);
+    assert(strings.total_count() == 6);
+
+    std::cout << "Batch add and estimate test passed!\n";
+}
+
+template<bool Conservative>
+void run_concurrent_adds() {
+    constexpr int num_threads = 8;
+    constexpr int adds_per_thread = 40000;
+    AtomicCountMinSketch<uint64_t, 256, 4, Conservative> sketch;   // Small, so rows collide
+    const auto stream = zipf_stream(adds_per_thread, 2000, 1.2, 3);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            if (t % 2) {
+                sketch.add_batch(stream.data(), stream.size());
+            } else {
+                for (uint64_t key : stream) {
+                    sketch.add(key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::unordered_map<uint64_t, uint64_t> truth;
+    for (uint64_t key : stream) {
+        truth[key] += num_threads;
+    }
+    for (const auto& [key, count] : truth) {
+        assert(sketch.estimate(key) >= count);   // Concurrent adds are never lost
+    }
+    assert(sketch.total_count() == static_cast<uint64_t>(num_threads) * adds_per_thread);
+}
+
+void test_concurrent_adds() {
+    std::cout << "Testing concurrent adds...\n";
+
+    run_concurrent_adds<false>();
+    run_concurrent_adds<true>();
+
+    std::cout << "Concurrent adds test passed!\n";
+}
+
+void test_merge() {
+    std::cout << "Testing merge...\n";
+
+    AtomicCountMinSketch<uint64_t, 1024, 4> left;
+    AtomicCountMinSketch<uint64_t, 1024, 4> right;
+    for (uint64_t i = 0; i < 100; ++i) {
+        left.add(i, 2);
+        right.add(i + 50, 3);
+    }
+    left.merge(right);
+    left.merge(left);   // Self-merge is a no-op
+    assert(left.total_count() == 500);
+    assert(left.estimate(10) >= 2 && left.estimate(60) >= 5 && left.estimate(120) >= 3);
+
+    std::cout << "Merge test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCountMinSketch Tests\n";
+    std::cout << "==========================\n\n";
+
+    test_basic_counting();
+    test_error_bounds();
+    test_batches();
+    test_concurrent_adds();
+    test_merge();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
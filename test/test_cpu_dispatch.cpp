@@ -0,0 +1,143 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <atomic>
+#include <memory>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/cpu_dispatch.hpp"
+#include "lockfree/atomic_bloomfilter.hpp"
+#include "lockfree/atomic_trie.hpp"
+
+using namespace lockfree;
+
+// Every level the host supports, lowest first
+std::vector<const KernelTable*> supported_tables() {
+    std::vector<const KernelTable*> tables;
+    for (CpuLevel level : {CpuLevel::GENERIC, CpuLevel::POPCNT, CpuLevel::AVX2}) {
+        if (static_cast<int>(level) <= static_cast<int>(host_cpu_level())) {
+            tables.push_back(&kernels_for(level));
+        }
+    }
+    return tables;
+}
+
+void test_selection() {
+    std::cout << "Testing kernel selection...\n";
+
+    assert(kernels_for(CpuLevel::GENERIC).level == CpuLevel::GENERIC);
+    assert(static_cast<int>(kernels().level) <= static_cast<int>(host_cpu_level()));
+    assert(&kernels() == &kernels());   // Selected once
+    // Asking for more than the host has falls back to what it has
+    assert(kernels_for(CpuLevel::AVX2).level == host_cpu_level());
+
+    std::cout << "Host level: " << kernels_for(host_cpu_level()).name
+              << ", selected: " << kernels().name << "\n";
+    std::cout << "Kernel selection test passed!\n";
+}
+
+void test_popcount_kernels() {
+    std::cout << "Testing popcount kernels...\n";
+
+    std::mt19937_64 rng(1);
+    for (size_t count : {0u, 1u, 3u, 4u, 7u, 64u, 131u}) {
+        std::vector<std::atomic<uint64_t>> words(count);
+        for (auto& w : words) {
+            w.store(rng());
+        }
+        size_t expected = kernels_for(CpuLevel::GENERIC).popcount(words.data(), count);
+        for (const KernelTable* table : supported_tables()) {
+            assert(table->popcount(words.data(), count) == expected);
+            assert(table->popcount_quiescent(words.data(), count) == expected);
+        }
+    }
+
+    std::cout << "Popcount kernels test passed!\n";
+}
+
+void test_find_nonzero_kernels() {
+    std::cout << "Testing non-null scan kernels...\n";
+
+    std::mt19937_64 rng(3);
+    std::vector<std::atomic<uintptr_t>> slots(256);
+    for (int trial = 0; trial < 200; ++trial) {
+        for (auto& s : slots) {
+            s.store(rng() % 16 == 0 ? rng() | 1 : 0);
+        }
+        for (size_t from = 0; from <= slots.size(); from += 1 + trial % 7) {
+            size_t expected = kernels_for(CpuLevel::GENERIC).find_nonzero(slots.data(), from, slots.size());
+            for (const KernelTable* table : supported_tables()) {
+                assert(table->find_nonzero(slots.data(), from, slots.size()) == expected);
+            }
+        }
+    }
+
+    for (auto& s : slots) {
+        s.store(0);
+    }
+    for (const KernelTable* table : supported_tables()) {
+        assert(table->find_nonzero(slots.data(), 0, slots.size()) == slots.size());
+    }
+
+    std::cout << "Non-null scan kernels test passed!\n";
+}
+
+void test_hash_batch_kernels() {
+    std::cout << "Testing batch hash kernels...\n";
+
+    static_assert(hash_u64(0) == 0);
+    assert(hash_u64(1) != hash_u64(2));
+
+    std::mt19937_64 rng(4);
+    std::vector<uint64_t> keys(37);
+    for (auto& k : keys) {
+        k = rng();
+    }
+    for (const KernelTable* table : supported_tables()) {
+        std::vector<uint64_t> out(keys.size());
+        table->hash_batch(keys.data(), out.data(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            assert(out[i] == hash_u64(keys[i]));
+        }
+    }
+
+    std::cout << "Batch hash kernels test passed!\n";
+}
+
+void test_containers_use_kernels() {
+    std::cout << "Testing dispatched paths in containers...\n";
+
+    auto filter = std::make_unique<AtomicBloomFilter<int, 4096, 8>>();
+    for (int i = 0; i < 200; ++i) {
+        filter->insert(i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        assert(filter->contains(i));
+    }
+    assert(filter->bits_set() > 0 && filter->bits_set() <= 200 * 8);
+
+    AtomicTrie<char> trie;
+    for (const char* word : {"a", "ab", "az", "b~", "zz", "z\x7f"}) {
+        trie.insert(word);
+    }
+    assert(trie.get_all_with_prefix("a").size() == 3);
+    assert(trie.get_all_with_prefix("z").size() == 2);
+    assert(trie.erase("ab"));
+    assert(trie.get_all_with_prefix("a").size() == 2);
+
+    std::cout << "Dispatched paths in containers test passed!\n";
+}
+
+int main() {
+    std::cout << "CPU Dispatch Tests\n";
+    std::cout << "==================\n\n";
+
+    test_selection();
+    test_popcount_kernels();
+    test_find_nonzero_kernels();
+    test_hash_batch_kernels();
+    test_containers_use_kernels();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
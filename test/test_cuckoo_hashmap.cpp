@@ -0,0 +1,253 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include "lockfree/atomic_cuckoo_hashmap.hpp"
+
+using namespace lockfree;
+
+// Hash whose low bits are all zero: every key shares primary bucket 0
+struct CollidingHash {
+    size_t operator()(int key) const {
+        return static_cast<size_t>(key) << 40;
+    }
+};
+
+void test_basic_cuckoo_operations() {
+    std::cout << "Testing basic cuckoo hashmap operations...\n";
+
+    AtomicCuckooHashMap<uint64_t, int> map(64);
+
+    assert(map.empty());
+    assert(map.capacity() >= 64);
+
+    assert(map.insert(101, 1));
+    assert(map.insert(202, 2));
+    assert(!map.insert(101, 10));   // Insert does not overwrite
+    assert(map.size() == 2);
+
+    int value;
+    assert(map.find(101, value) && value == 1);
+    assert(map.contains(202));
+    assert(!map.contains(303));
+
+    assert(map.insert_or_assign(101, 100));
+    assert(map.find(101, value) && value == 100);
+    assert(map.insert_or_assign(303, 3));
+    assert(map.size() == 3);
+
+    assert(map.erase(202));
+    assert(!map.erase(202));
+    assert(!map.contains(202));
+    assert(map.size() == 2);
+
+    std::cout << "Basic cuckoo hashmap operations test passed!\n";
+}
+
+void test_high_load_and_resize() {
+    std::cout << "Testing high load factor and resize...\n";
+
+    AtomicCuckooHashMap<int, int> map(4096);
+    const size_t initial_buckets = map.bucket_count();
+
+    // Fill to 90% of the initial capacity without resizing
+    const int target = static_cast<int>(map.capacity() * 9 / 10);
+    for (int i = 0; i < target; ++i) {
+        assert(map.insert(i, i * 3));
+    }
+    assert(map.bucket_count() == initial_buckets);
+    assert(map.load_factor() > 0.89);
+
+    // Keep going until the table has to grow
+    for (int i = target; i < target * 3; ++i) {
+        assert(map.insert(i, i * 3));
+    }
+    assert(map.bucket_count() > initial_buckets);
+    assert(map.size() == static_cast<size_t>(target * 3));
+
+    for (int i = 0; i < target * 3; ++i) {
+        int value;
+        assert(map.find(i, value) && value == i * 3);
+    }
+    assert(!map.contains(target * 3));
+
+    std::cout << "High load factor and resize test passed!\n";
+}
+
+void test_colliding_keys() {
+    std::cout << "Testing keys that share their buckets...\n";
+
+    // Every insert lands on a full primary bucket, so entries must be displaced
+    // to their alternate buckets
+    AtomicCuckooHashMap<int, int, CollidingHash> map(256);
+    for (int i = 0; i < 24; ++i) {
+        assert(map.insert(i, i));
+    }
+    for (int i = 0; i < 24; ++i) {
+        int value;
+        assert(map.find(i, value) && value == i);
+    }
+    assert(map.size() == 24);
+
+    std::cout << "Colliding keys test passed!\n";
+}
+
+void test_concurrent_readers_during_displacement() {
+    std::cout << "Testing concurrent readers while writers displace entries...\n";
+
+    AtomicCuckooHashMap<int, int> map(1024);
+    constexpr int stable_keys = 500;
+    for (int i = 0; i < stable_keys; ++i) {
+        map.insert(i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> misses{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&, r]() {
+            int key = r;
+            while (!done.load()) {
+                int value;
+                // Stable keys are never erased, so a miss means a displaced entry was lost
+                if (!map.find(key, value) || value != key) {
+                    misses.fetch_add(1);
+                }
+                key = (key + 13) % stable_keys;
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&, w]() {
+            std::mt19937 gen(w);
+            for (int i = 0; i < 20000; ++i) {
+                int key = stable_keys + static_cast<int>(gen() % 20000);
+                if (gen() % 3 == 0) {
+                    map.erase(key);
+                } else {
+                    map.insert_or_assign(key, key);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    assert(misses.load() == 0);
+    for (int i = 0; i < stable_keys; ++i) {
+        assert(map.contains(i));
+    }
+
+    std::cout << "Concurrent readers during displacement test passed!\n";
+}
+
+void test_no_torn_reads_under_displacement() {
+    std::cout << "Testing reads never see torn entries while entries move...\n";
+
+    // Each value carries its key in the high half, so a read that mixes the words of
+    // two entries (or of one entry before and after an update) is detectable
+    AtomicCuckooHashMap<uint64_t, uint64_t> map(256);
+    constexpr uint64_t hot_keys = 200;
+    for (uint64_t key = 0; key < hot_keys; ++key) {
+        map.insert(key, key << 32);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&, r]() {
+            uint64_t key = static_cast<uint64_t>(r);
+            while (!done.load(std::memory_order_relaxed)) {
+                uint64_t value;
+                if (!map.find(key, value) || (value >> 32) != key) {
+                    torn.fetch_add(1);
+                }
+                key = (key + 7) % hot_keys;
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&, w]() {
+            std::mt19937 gen(100 + w);
+            for (uint32_t round = 1; round <= 20000; ++round) {
+                // Rewrite hot entries in place and churn cold keys to force displacements
+                uint64_t key = gen() % hot_keys;
+                map.insert_or_assign(key, (key << 32) | round);
+                uint64_t cold = hot_keys + gen() % 4000;
+                if (gen() % 2 == 0) {
+                    map.erase(cold);
+                } else {
+                    map.insert_or_assign(cold, cold << 32);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    assert(torn.load() == 0);
+    std::cout << "Torn read test passed!\n";
+}
+
+void test_concurrent_inserts() {
+    std::cout << "Testing concurrent inserts across resizes...\n";
+
+    AtomicCuckooHashMap<int, int> map(64);
+    constexpr int num_threads = 4;
+    constexpr int keys_per_thread = 5000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < keys_per_thread; ++i) {
+                int key = i * num_threads + t;
+                assert(map.insert(key, -key));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(map.size() == num_threads * keys_per_thread);
+    for (int key = 0; key < num_threads * keys_per_thread; ++key) {
+        int value;
+        assert(map.find(key, value) && value == -key);
+    }
+
+    std::cout << "Concurrent inserts test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicCuckooHashMap Tests\n";
+    std::cout << "=========================\n\n";
+
+    test_basic_cuckoo_operations();
+    test_high_load_and_resize();
+    test_colliding_keys();
+    test_concurrent_readers_during_displacement();
+    test_no_torn_reads_under_displacement();
+    test_concurrent_inserts();
+
+    std::cout << "\nAll cuckoo hashmap tests passed!\n";
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <tuple>
+#include <set>
+#include <random>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/hash.hpp"
+#include "lockfree/atomic_hashmap.hpp"
+#include "lockfree/atomic_set.hpp"
+#include "lockfree/atomic_bloomfilter.hpp"
+
+using namespace lockfree;
+
+enum class Color : uint8_t { RED = 1, GREEN = 2 };
+
+void test_integer_and_scalar_hashes() {
+    std::cout << "Testing integer and scalar hashes...\n";
+
+    Hasher<uint64_t> h64;
+    Hasher<int> h32;
+    assert(h64(1) == hash_u64(1));
+    assert(h64(1) != 1);                                // Not the identity
+    assert(h32(-1) == h64(static_cast<uint64_t>(-1)));  // Sign-extended like a widened key
+    assert(Hasher<Color>{}(Color::GREEN) == hash_u64(2));
+
+    // Strided keys still use every low bit pattern
+    std::set<size_t> low_bits;
+    for (uint64_t i = 0; i < 1024; ++i) {
+        low_bits.insert(h64(i << 12) & 1023);
+    }
+    assert(low_bits.size() > 600);
+
+    assert(Hasher<double>{}(0.0) == Hasher<double>{}(-0.0));
+    assert(Hasher<double>{}(1.0) != Hasher<double>{}(2.0));
+
+    int a = 0, b = 0;
+    assert(Hasher<int*>{}(&a) != Hasher<int*>{}(&b));
+
+    std::cout << "Integer and scalar hashes test passed!\n";
+}
+
+void test_string_hashes() {
+    std::cout << "Testing string hashes...\n";
+
+    Hasher<std::string> hs;
+    Hasher<std::string_view> hv;
+    assert(hs(std::string("hello")) == hv("hello"));    // Transparent
+    assert(hv("hello") != hv("hellp"));
+    assert(hv("") == hash_bytes("", 0));
+    assert(hash_bytes("abc", 3, 1) != hash_bytes("abc", 3, 2));
+
+    // Every length class (0, 1-3, 4-16, 17-47, 48+), with a shared prefix
+    std::set<size_t> seen;
+    std::string s;
+    for (int len = 0; len < 200; ++len) {
+        assert(seen.insert(hv(s)).second);
+        s.push_back('x');
+    }
+
+    // Hashing reads only the given range
+    std::string padded = "key:123|garbage";
+    assert(hv(std::string_view(padded).substr(0, 7)) == hv("key:123"));
+
+    std::cout << "String hashes test passed!\n";
+}
+
+void test_composite_hashes() {
+    std::cout << "Testing pair and tuple hashes...\n";
+
+    Hasher<std::pair<int, int>> hp;
+    assert(hp({1, 2}) != hp({2, 1}));   // Order-sensitive
+    assert(hp({7, 7}) != hp({8, 8}));   // The old h1 ^ (h2 << 1) mapped many equal pairs alike
+
+    std::set<size_t> pairs;
+    for (int i = 0; i < 100; ++i) {
+        for (int j = 0; j < 100; ++j) {
+            pairs.insert(hp({i, j}));
+        }
+    }
+    assert(pairs.size() == 10000);
+
+    Hasher<std::tuple<int, std::string, double>> ht;
+    assert(ht({1, "a", 2.0}) == ht({1, "a", 2.0}));
+    assert(ht({1, "a", 2.0}) != ht({1, "b", 2.0}));
+    assert((Hasher<std::tuple<int>>{}({5}) != Hasher<std::tuple<int, int>>{}({5, 0})));
+
+    std::cout << "Pair and tuple hashes test passed!\n";
+}
+
+void test_hash_batch() {
+    std::cout << "Testing batch hashing...\n";
+
+    std::mt19937_64 rng(7);
+    for (size_t count : {0u, 1u, 3u, 4u, 5u, 17u, 300u, 1000u}) {
+        std::vector<uint64_t> keys64(count);
+        std::vector<int32_t> keys32(count);
+        std::vector<std::string> keys_str(count);
+        for (size_t i = 0; i < count; ++i) {
+            keys64[i] = rng();
+            keys32[i] = static_cast<int32_t>(rng());
+            keys_str[i] = std::to_string(rng());
+        }
+
+        std::vector<size_t> out(count);
+        hash_batch(std::span<const uint64_t>(keys64), std::span<size_t>(out));
+        for (size_t i = 0; i < count; ++i) {
+            assert(out[i] == Hasher<uint64_t>{}(keys64[i]));
+        }
+
+        hash_batch(std::span<const int32_t>(keys32), std::span<size_t>(out));
+        for (size_t i = 0; i < count; ++i) {
+            assert(out[i] == Hasher<int32_t>{}(keys32[i]));
+        }
+
+        hash_batch(std::span<const std::string>(keys_str), std::span<size_t>(out));
+        for (size_t i = 0; i < count; ++i) {
+            assert(out[i] == Hasher<std::string>{}(keys_str[i]));
+        }
+    }
+
+    std::cout << "Batch hashing test passed!\n";
+}
+
+void test_container_defaults() {
+    std::cout << "Testing container defaults...\n";
+
+    // Keys 4096 apart all fell into bucket 0 of a 1024-bucket map with std::hash
+    AtomicHashMap<uint64_t, int> map(1024);
+    std::vector<uint64_t> keys;
+    for (uint64_t i = 0; i < 512; ++i) {
+        keys.push_back(i << 12);
+        assert(map.insert(i << 12, static_cast<int>(i)));
+    }
+    std::vector<int> values(keys.size());
+    bool found[512];
+    assert(map.find_batch(keys.data(), keys.size(), values.data(), found) == keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(found[i] && values[i] == static_cast<int>(i));
+    }
+
+    AtomicSet<std::pair<int, int>> set;
+    for (int i = 0; i < 50; ++i) {
+        assert(set.insert({i, 50 - i}));
+    }
+    assert(set.contains({10, 40}));
+    assert(!set.contains({40, 11}));
+
+    AtomicBloomFilter<uint64_t, 65536, 4> filter;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        filter.insert(i << 16);
+    }
+    size_t false_positives = 0;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        assert(filter.contains(i << 16));
+        false_positives += filter.contains((i << 16) + 1);
+    }
+    assert(false_positives < 10);   // Expected about 0.02% with 2000 keys in 64K bits, k = 4
+
+    std::cout << "Container defaults test passed!\n";
+}
+
+int main() {
+    std::cout << "Hash Library Tests\n";
+    std::cout << "==================\n\n";
+
+    test_integer_and_scalar_hashes();
+    test_string_hashes();
+    test_composite_hashes();
+    test_hash_batch();
+    test_container_defaults();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
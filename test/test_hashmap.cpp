@@ -7,10 +7,32 @@
 #include <string>
 #include <random>
 #include <unordered_set>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+#include <cstdio>
+#include <memory>
 #include "lockfree/atomic_hashmap.hpp"
 
 using namespace lockfree;
 
+// Sends every key to bucket 0 of an 8-bucket table; pairs of keys share a full hash
+struct SameBucketHash {
+    size_t operator()(int key) const {
+        return static_cast<size_t>(key / 2) * 8;
+    }
+};
+
+// Counts how often the container falls back to comparing keys
+struct CountingEqual {
+    static inline int calls = 0;
+    bool operator()(int a, int b) const {
+        ++calls;
+        return a == b;
+    }
+};
+
 void test_basic_hashmap_operations() {
     std::cout << "Testing basic hashmap operations...\n";
     
@@ -304,6 +326,72 @@ void test_load_factor_behavior() {
     std::cout << "Load factor behavior test passed!\n";
 }
 
+void test_cached_hash_comparisons() {
+    std::cout << "Testing cached hash comparisons...\n";
+    
+    AtomicHashMap<int, int, SameBucketHash, CountingEqual> map(8);
+    for (int i = 0; i < 32; ++i) {
+        assert(map.insert(i, i * 10));
+    }
+    
+    // One chain of 32 nodes: only the node with the same hash (and the key's twin) is compared
+    CountingEqual::calls = 0;
+    assert(map.contains(7));
+    assert(CountingEqual::calls <= 2);
+    
+    // A hash that matches no node never reaches KeyEqual
+    CountingEqual::calls = 0;
+    assert(!map.contains(1000));
+    assert(CountingEqual::calls == 0);
+    
+    // Keys sharing a full hash are still told apart by KeyEqual
+    assert(map.erase(6));
+    assert(!map.contains(6));
+    assert(map.contains(7));
+    int value;
+    assert(map.find(7, value) && value == 70);
+    
+    std::cout << "Cached hash comparisons test passed!\n";
+}
+
+void test_batch_lookups() {
+    std::cout << "Testing batched lookups...\n";
+    
+    AtomicHashMap<int, std::string> map(64);
+    for (int i = 0; i < 200; i += 2) {
+        map.insert(i, std::string("v").append(std::to_string(i)));
+    }
+    map.erase(10);
+    
+    // 37 keys: two full groups plus a partial one, hits and misses interleaved
+    std::vector<int> keys;
+    for (int i = 0; i < 37; ++i) {
+        keys.push_back(i * 3);
+    }
+    std::vector<std::string> values(keys.size(), "untouched");
+    std::unique_ptr<bool[]> found(new bool[keys.size()]);
+    
+    size_t hits = map.find_batch(keys.data(), keys.size(), values.data(), found.get());
+    size_t expected_hits = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        bool present = keys[i] % 2 == 0 && keys[i] < 200 && keys[i] != 10;
+        assert(found[i] == present);
+        assert(values[i] == (present ? std::string("v").append(std::to_string(keys[i])) : "untouched"));
+        expected_hits += present ? 1 : 0;
+    }
+    assert(hits == expected_hits);
+    
+    std::unique_ptr<bool[]> present(new bool[keys.size()]);
+    assert(map.contains_batch(keys.data(), keys.size(), present.get()) == expected_hits);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(present[i] == found[i]);
+    }
+    
+    assert(map.find_batch(keys.data(), 0, values.data(), found.get()) == 0);
+    
+    std::cout << "Batched lookups test passed!\n";
+}
+
 void test_stress_operations() {
     std::cout << "Testing stress operations...\n";
     
@@ -373,6 +461,290 @@ void test_stress_operations() {
     std::cout << "Stress operations test passed!\n";
 }
 
+void test_snapshot_round_trip() {
+    std::cout << "Testing snapshot save/load...\n";
+    
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_snapshot_test.bin").string();
+    
+    // Fixed-size records
+    {
+        AtomicHashMap<int, int> source(256);
+        for (int i = 0; i < 5000; ++i) {
+            assert(source.insert(i, i * 3));
+        }
+        for (int i = 0; i < 5000; i += 7) {
+            assert(source.erase(i));
+        }
+        assert(source.save_snapshot(path, 4));
+        
+        AtomicHashMap<int, int> same_layout(256);
+        assert(same_layout.insert(1, -1));  // Existing entries win over the snapshot
+        assert(same_layout.load_snapshot(path));
+        assert(same_layout.size() == source.size());
+        
+        AtomicHashMap<int, int> other_layout(1000);
+        assert(other_layout.load_snapshot(path, SnapshotMode::EAGER, 2));
+        assert(other_layout.size() == source.size());
+        
+        for (int i = 0; i < 5000; ++i) {
+            int value = 0;
+            bool expected = (i % 7) != 0;
+            assert(other_layout.find(i, value) == expected);
+            if (expected) {
+                assert(value == i * 3);
+            }
+            assert(same_layout.find(i, value) == expected);
+            if (expected) {
+                assert(value == (i == 1 ? -1 : i * 3));
+            }
+        }
+    }
+    
+    // Variable-size records
+    {
+        AtomicHashMap<std::string, std::string> source(64);
+        for (int i = 0; i < 1000; ++i) {
+            assert(source.insert("key_" + std::to_string(i), std::string(i % 50, 'v')));
+        }
+        assert(source.save_snapshot(path));
+        
+        AtomicHashMap<std::string, std::string> loaded(64);
+        assert(loaded.load_snapshot(path, SnapshotMode::LAZY));  // Falls back to eager
+        assert(!loaded.snapshot_attached());
+        assert(loaded.size() == 1000);
+        
+        std::string value;
+        assert(loaded.find("key_49", value));
+        assert(value == std::string(49, 'v'));
+        assert(loaded.find("key_0", value));
+        assert(value.empty());
+        
+        // A snapshot with a different record layout is rejected
+        AtomicHashMap<int, int> wrong_types;
+        assert(!wrong_types.load_snapshot(path));
+        assert(wrong_types.empty());
+    }
+    
+    AtomicHashMap<int, int> missing;
+    assert(!missing.load_snapshot(path + ".missing"));
+    
+    std::remove(path.c_str());
+    std::cout << "Snapshot save/load test passed!\n";
+}
+
+void test_snapshot_lazy_mode() {
+    std::cout << "Testing lazy snapshot mode...\n";
+    
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_lazy_test.bin").string();
+    
+    {
+        AtomicHashMap<uint64_t, uint64_t> source(512);
+        for (uint64_t i = 0; i < 4000; ++i) {
+            assert(source.insert(i, i + 100));
+        }
+        assert(source.save_snapshot(path));
+    }
+    
+    AtomicHashMap<uint64_t, uint64_t> map(512);
+    assert(map.load_snapshot(path, SnapshotMode::LAZY));
+    assert(map.snapshot_attached());
+    assert(map.size() == 4000);
+    assert(!map.empty());
+    
+    // Saving before any bucket is promoted copies the mapped records
+    {
+        const std::string copy_path = path + ".copy";
+        assert(map.save_snapshot(copy_path));
+        AtomicHashMap<uint64_t, uint64_t> copy(512);
+        assert(copy.load_snapshot(copy_path));
+        assert(copy.size() == 4000);
+        for (uint64_t i = 0; i < 4000; ++i) {
+            uint64_t found = 0;
+            assert(copy.find(i, found) && found == i + 100);
+        }
+        
+        // The copy keeps the writer's layout, so it attaches lazily as well
+        AtomicHashMap<uint64_t, uint64_t> lazy_copy(512);
+        assert(lazy_copy.load_snapshot(copy_path, SnapshotMode::LAZY));
+        assert(lazy_copy.snapshot_attached());
+        std::remove(copy_path.c_str());
+    }
+    
+    // Saving over the attached file leaves the mapping readable
+    assert(map.save_snapshot(path));
+    for (uint64_t i = 0; i < 4000; ++i) {
+        uint64_t found = 0;
+        assert(map.find(i, found) && found == i + 100);
+    }
+    assert(!std::filesystem::exists(path + ".tmp"));
+    
+    // Reads are served from the mapped file
+    uint64_t value = 0;
+    assert(map.find(17, value));
+    assert(value == 117);
+    assert(map.contains(3999));
+    assert(!map.contains(4000));
+    assert(map.find_if(42, [](uint64_t v) { return v == 142; }));
+    
+    // Writes promote their bucket first
+    assert(!map.insert(17, 0));
+    assert(map.erase(18));
+    assert(!map.contains(18));
+    assert(map.insert(5000, 1));
+    assert(map.size() == 4000);
+    
+    // Concurrent readers and writers during promotion
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint64_t i = t; i < 4000; i += 4) {
+                uint64_t found = 0;
+                if (i != 18 && (!map.find(i, found) || found != i + 100)) {
+                    mismatches.fetch_add(1);
+                }
+                if (i % 10 == 0) {
+                    map.insert(i + 10000, i);
+                }
+            }
+        });
+    }
+    map.promote_snapshot(2);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(mismatches.load() == 0);
+    
+    map.release_snapshot();
+    assert(!map.snapshot_attached());
+    assert(map.find(3999, value) && value == 4099);
+    
+    size_t iterated = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        ++iterated;
+    }
+    assert(iterated == map.size());
+    
+    std::remove(path.c_str());
+    std::cout << "Lazy snapshot mode test passed!\n";
+}
+
+// Identity hash, unlike the default Hasher<int>
+struct IdentityHash {
+    size_t operator()(int key) const {
+        return static_cast<size_t>(key);
+    }
+};
+
+void test_snapshot_hash_mismatch() {
+    std::cout << "Testing snapshot load with a different hash function...\n";
+    
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_hash_test.bin").string();
+    {
+        AtomicHashMap<int, int> source(256);
+        for (int i = 0; i < 3000; ++i) {
+            assert(source.insert(i, i + 7));
+        }
+        assert(source.save_snapshot(path));
+    }
+    
+    // Same bucket count, so only the fingerprint tells the layouts apart
+    for (SnapshotMode mode : {SnapshotMode::EAGER, SnapshotMode::LAZY}) {
+        AtomicHashMap<int, int, IdentityHash> loaded(256);
+        assert(loaded.load_snapshot(path, mode));
+        assert(!loaded.snapshot_attached());   // LAZY falls back to a rehashing load
+        assert(loaded.size() == 3000);
+        for (int i = 0; i < 3000; ++i) {
+            int value = 0;
+            assert(loaded.find(i, value) && value == i + 7);
+        }
+    }
+    
+    // The hash that wrote the file still attaches lazily
+    AtomicHashMap<int, int> same_hash(256);
+    assert(same_hash.load_snapshot(path, SnapshotMode::LAZY));
+    assert(same_hash.snapshot_attached());
+    
+    std::remove(path.c_str());
+    std::cout << "Snapshot hash mismatch test passed!\n";
+}
+
+void test_snapshot_corrupt_header() {
+    std::cout << "Testing snapshot load of corrupt headers...\n";
+    
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_corrupt_test.bin").string();
+    {
+        AtomicHashMap<int, int> source(16);
+        for (int i = 0; i < 100; ++i) {
+            assert(source.insert(i, i));
+        }
+        assert(source.save_snapshot(path));
+    }
+    std::vector<char> original;
+    {
+        std::ifstream in(path, std::ios::binary);
+        original.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    
+    // Overwrite one header field and check the load is refused without touching the map
+    auto patched = [&](size_t offset, const auto& field) {
+        std::vector<char> bytes = original;
+        std::memcpy(bytes.data() + offset, &field, sizeof(field));
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.close();
+        AtomicHashMap<int, int> loaded(16);
+        bool ok = loaded.load_snapshot(path, SnapshotMode::LAZY) || loaded.load_snapshot(path);
+        assert(loaded.empty());
+        return ok;
+    };
+    
+    // Header layout: magic[8], version, byte_order + flags, key_size, value_size, bucket_count, ...
+    constexpr size_t BYTE_ORDER_OFFSET = 12;
+    constexpr size_t BUCKET_COUNT_OFFSET = 24;
+    assert(!patched(BUCKET_COUNT_OFFSET, (uint64_t{1} << 61) - 1));   // (count + 1) * 8 wraps to 0
+    assert(!patched(BUCKET_COUNT_OFFSET, UINT64_MAX));
+    assert(!patched(BUCKET_COUNT_OFFSET, uint64_t{1} << 40));
+    assert(!patched(BYTE_ORDER_OFFSET, uint16_t{0x0201}));            // Written by the other byte order
+    
+    std::remove(path.c_str());
+    std::cout << "Snapshot corrupt header test passed!\n";
+}
+
+void test_snapshot_concurrent_save() {
+    std::cout << "Testing snapshot save under concurrent writes...\n";
+    
+    const std::string path = (std::filesystem::temp_directory_path() / "lockfree_hashmap_concurrent_test.bin").string();
+    
+    AtomicHashMap<int, int> map(128);
+    for (int i = 0; i < 2000; ++i) {
+        map.insert(i, i);
+    }
+    
+    std::atomic<bool> stop{false};
+    std::thread writer([&]() {
+        for (int i = 2000; !stop.load(); ++i) {
+            map.insert(i, i);
+            map.erase(i - 2000 + 1000000);  // Never present; exercises the erase path
+        }
+    });
+    
+    assert(map.save_snapshot(path, 3));
+    stop.store(true);
+    writer.join();
+    
+    AtomicHashMap<int, int> loaded(128);
+    assert(loaded.load_snapshot(path));
+    assert(loaded.size() >= 2000);
+    for (int i = 0; i < 2000; ++i) {
+        int value = -1;
+        assert(loaded.find(i, value) && value == i);
+    }
+    
+    std::remove(path.c_str());
+    std::cout << "Snapshot concurrent save test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicHashMap Tests\n";
     std::cout << "===================\n\n";
@@ -385,7 +757,14 @@ int main() {
     test_iteration();
     test_move_semantics();
     test_load_factor_behavior();
+    test_cached_hash_comparisons();
+    test_batch_lookups();
     test_stress_operations();
+    test_snapshot_round_trip();
+    test_snapshot_lazy_mode();
+    test_snapshot_hash_mismatch();
+    test_snapshot_corrupt_header();
+    test_snapshot_concurrent_save();
     
     std::cout << "\nAll hashmap tests passed!\n";
     std::cout << "\nNote: This HashMap implementation demonstrates basic lock-free\n";
@@ -0,0 +1,218 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <functional>
+#include "lockfree/inplace_task.hpp"
+#include "lockfree/atomic_work_stealing_deque.hpp"
+
+using namespace lockfree;
+
+// Count allocations to check the no-allocation guarantee
+static std::atomic<long> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void test_layout() {
+    std::cout << "Testing task layout...\n";
+
+    static_assert(sizeof(InplaceTask<48>) == 56);
+    static_assert(sizeof(InplaceTask<112>) == 120);
+    static_assert(InplaceTask<48>::capacity() == 48);
+
+    // With the slot's occupancy flag, a 48-byte task fills exactly one cache line:
+    // the deque is its two index lines plus one line per slot
+    static_assert(sizeof(AtomicWorkStealingDeque<InplaceTask<48>>) == 64 * (4096 + 2));
+
+    std::cout << "Task layout test passed!\n";
+}
+
+void test_inline_captures() {
+    std::cout << "Testing inline captures...\n";
+
+    std::array<int, 12> block{};   // 48 bytes
+    for (int i = 0; i < 12; ++i) {
+        block[i] = i;
+    }
+    int sum = 0;
+    auto body = [block, &sum]() mutable {
+        for (int v : block) {
+            sum += v;
+        }
+    };
+    static_assert(!InplaceTask<48>::fits_inline<decltype(body)>());   // 48 bytes plus a reference
+    static_assert(InplaceTask<64>::fits_inline<decltype(body)>());
+
+    long before = g_allocations.load();
+    {
+        InplaceTask<64> task(body);
+        assert(task && task.is_inline());
+
+        InplaceTask<64> moved(std::move(task));
+        assert(!task && moved);
+
+        InplaceTask<64> assigned;
+        assigned = std::move(moved);
+        assigned();
+    }
+    assert(g_allocations.load() == before);
+    assert(sum == 66);
+
+    std::cout << "Inline captures test passed!\n";
+}
+
+void test_heap_fallback() {
+    std::cout << "Testing heap fallback for large captures...\n";
+
+    std::array<char, 200> big{};
+    big[199] = 7;
+    int seen = 0;
+
+    long before = g_allocations.load();
+    {
+        InplaceTask<48> task([big, &seen]() { seen = big[199]; });
+        assert(task && !task.is_inline());
+        InplaceTask<48> moved(std::move(task));
+        moved();
+    }
+    assert(g_allocations.load() == before + 1);
+    assert(seen == 7);
+
+    std::cout << "Heap fallback test passed!\n";
+}
+
+void test_move_only_and_destruction() {
+    std::cout << "Testing move-only captures and destruction...\n";
+
+    auto owned = std::make_shared<int>(5);
+    std::weak_ptr<int> watch = owned;
+
+    {
+        InplaceTask<48> task([p = std::move(owned)]() { *p += 1; });
+        assert(task.is_inline());
+        task();
+        assert(*watch.lock() == 6);
+
+        InplaceTask<48> other;
+        other = std::move(task);
+        assert(!watch.expired());
+        other = InplaceTask<48>();   // Destroys the capture
+        assert(watch.expired());
+    }
+
+    auto unique = std::make_unique<int>(9);
+    int result = 0;
+    InplaceTask<48> task([u = std::move(unique), &result]() { result = *u; });
+    task();
+    assert(result == 9);
+
+    InplaceTask<48> empty;
+    bool threw = false;
+    try {
+        empty();
+    } catch (const std::bad_function_call&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "Move-only captures and destruction test passed!\n";
+}
+
+void test_work_stealing_deque_tasks() {
+    std::cout << "Testing tasks in a work-stealing deque...\n";
+
+    using Task = InplaceTask<48>;
+    constexpr int num_tasks = 20000;
+    constexpr int num_thieves = 3;
+
+    auto deque = std::make_unique<AtomicWorkStealingDeque<Task>>();
+    std::vector<std::atomic<int>> runs(num_tasks);
+    std::atomic<int> executed{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < num_thieves; ++t) {
+        thieves.emplace_back([&]() {
+            Task task;
+            while (!done.load()) {
+                if (deque->steal(task)) {
+                    task();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    Task task;
+    for (int i = 0; i < num_tasks; ++i) {
+        // A full deque drops pushes, so run some work ourselves first
+        while (deque->size() >= deque->capacity() - 1 && deque->pop_bottom(task)) {
+            task();
+        }
+        std::array<int, 8> payload{};
+        payload[0] = i;
+        deque->push_bottom(Task([payload, &runs, &executed]() {
+            runs[payload[0]].fetch_add(1);
+            executed.fetch_add(1);
+        }));
+        if (i % 4 == 0 && deque->pop_bottom(task)) {
+            task();
+        }
+    }
+    while (deque->pop_bottom(task)) {
+        task();
+    }
+    while (executed.load() < num_tasks) {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (auto& count : runs) {
+        assert(count.load() == 1);
+    }
+    assert(deque->empty());
+
+    std::cout << "Work-stealing deque tasks test passed!\n";
+}
+
+int main() {
+    std::cout << "InplaceTask Tests\n";
+    std::cout << "=================\n\n";
+
+    test_layout();
+    test_inline_captures();
+    test_heap_fallback();
+    test_move_only_and_destruction();
+    test_work_stealing_deque_tasks();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/atomic_interval_map.hpp"
+
+using namespace lockfree;
+
+template<typename Point, typename Value>
+std::vector<std::pair<Point, Point>> collect(const AtomicIntervalMap<Point, Value>& map, Point a, Point b) {
+    std::vector<std::pair<Point, Point>> found;
+    map.overlapping(a, b, [&](Point lo, Point hi, const Value&) {
+        found.emplace_back(lo, hi);
+        return true;
+    });
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+void test_basic_operations() {
+    std::cout << "Testing basic operations...\n";
+
+    AtomicIntervalMap<uint32_t, std::string> map;
+    assert(map.empty());
+    assert(map.insert(10, 20, "a"));
+    assert(map.insert(15, 15, "point"));
+    assert(map.insert(10, 30, "b"));
+    assert(!map.insert(10, 20, "dup"));
+    assert(!map.insert(5, 4, "inverted"));
+    assert(map.size() == 3);
+
+    std::string value;
+    assert(map.find(10, 20, value) && value == "a");
+    assert(!map.find(10, 21, value));
+    assert(map.contains(15, 15));
+
+    assert(map.erase(10, 20));
+    assert(!map.erase(10, 20));
+    assert(!map.contains(10, 20));
+    assert(map.size() == 2);
+
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_overlap_queries() {
+    std::cout << "Testing overlap queries against brute force...\n";
+
+    AtomicIntervalMap<int32_t, int> map;
+    std::vector<std::pair<int32_t, int32_t>> all;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 3000; ++i) {
+        const int32_t lo = static_cast<int32_t>(rng() % 200000) - 100000;
+        const int32_t length = static_cast<int32_t>(rng() % (1u << (rng() % 16)));
+        if (map.insert(lo, lo + length, i)) {
+            all.emplace_back(lo, lo + length);
+        }
+    }
+    std::sort(all.begin(), all.end());
+
+    for (int q = 0; q < 500; ++q) {
+        const int32_t a = static_cast<int32_t>(rng() % 220000) - 110000;
+        const int32_t b = q % 2 ? a : a + static_cast<int32_t>(rng() % 2000);
+        std::vector<std::pair<int32_t, int32_t>> expected;
+        for (const auto& interval : all) {
+            if (interval.first <= b && interval.second >= a) {
+                expected.push_back(interval);
+            }
+        }
+        assert((collect(map, a, b) == expected));
+        assert(map.count_overlapping(a, b) == expected.size());
+    }
+
+    // Endpoints are inclusive
+    AtomicIntervalMap<int32_t, int> edges;
+    edges.insert(0, 9, 0);
+    assert(edges.count_overlapping(9, 20) == 1);
+    assert(edges.count_overlapping(-5, 0) == 1);
+    assert(edges.count_overlapping(10, 20) == 0);
+    assert(edges.count_overlapping(5, 4) == 0);
+
+    std::cout << "Overlap queries test passed!\n";
+}
+
+void test_extreme_endpoints() {
+    std::cout << "Testing extreme endpoints...\n";
+
+    constexpr int64_t MIN = std::numeric_limits<int64_t>::min();
+    constexpr int64_t MAX = std::numeric_limits<int64_t>::max();
+    AtomicIntervalMap<int64_t, int> map;
+    assert(map.insert(MIN, MAX, 1));   // Length class 64
+    assert(map.insert(MIN, MIN + 1, 2));
+    assert(map.insert(MAX - 1, MAX, 3));
+    assert(map.insert(-1, 1, 4));
+
+    assert(map.count_overlapping(MIN, MIN) == 2);
+    assert(map.count_overlapping(MAX, MAX) == 2);
+    assert(map.count_overlapping(0, 0) == 2);
+    assert(map.count_overlapping(MIN, MAX) == 4);
+
+    AtomicIntervalMap<uint8_t, int> bytes;
+    assert(bytes.insert(0, 255, 1));
+    assert(bytes.insert(200, 255, 2));
+    assert(bytes.count_overlapping(255, 255) == 2);
+    assert(bytes.count_overlapping(0, 0) == 1);
+
+    std::cout << "Extreme endpoints test passed!\n";
+}
+
+void test_early_stop() {
+    std::cout << "Testing early stop...\n";
+
+    AtomicIntervalMap<uint32_t, int> map;
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.insert(i, i + (1u << (i % 8)), static_cast<int>(i));
+    }
+    size_t visited = 0;
+    size_t reported = map.stab(50, [&](uint32_t lo, uint32_t hi, const int&) {
+        assert(lo <= 50 && hi >= 50);
+        return ++visited < 3;
+    });
+    assert(visited == 3 && reported == 3);
+
+    std::cout << "Early stop test passed!\n";
+}
+
+void test_concurrent_operations() {
+    std::cout << "Testing concurrent operations...\n";
+
+    constexpr int num_threads = 4;
+    constexpr uint32_t per_thread = 2000;
+    AtomicIntervalMap<uint32_t, uint32_t> map;
+
+    // Permanent intervals, all of which cover point 0x80000000
+    for (uint32_t i = 1; i <= 64; ++i) {
+        map.insert(0x80000000u - i * 1000, 0x80000000u + i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            size_t permanent = 0;
+            map.stab(0x80000000u, [&](uint32_t lo, uint32_t hi, const uint32_t& value) {
+                assert(lo <= 0x80000000u && hi >= 0x80000000u);
+                permanent += value <= 64;
+                return true;
+            });
+            assert(permanent == 64);
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            for (uint32_t i = 0; i < per_thread; ++i) {
+                const uint32_t lo = static_cast<uint32_t>(t) * 0x10000000u + i * 64;
+                const uint32_t hi = lo + (rng() % (1u << (rng() % 24)));
+                assert(map.insert(lo, hi, 1000 + i));
+                if (i % 2) {
+                    assert(map.erase(lo, hi));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+
+    assert(map.size() == 64 + num_threads * per_thread / 2);
+
+    std::cout << "Concurrent operations test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicIntervalMap Tests\n";
+    std::cout << "=======================\n\n";
+
+    test_basic_operations();
+    test_overlap_queries();
+    test_extreme_endpoints();
+    test_early_stop();
+    test_concurrent_operations();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
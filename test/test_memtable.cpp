@@ -0,0 +1,278 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <map>
+#include <filesystem>
+#include "lockfree/atomic_memtable.hpp"
+
+using namespace lockfree;
+
+namespace {
+
+std::string fresh_directory(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+} // namespace
+
+void test_basic_memtable_operations() {
+    std::cout << "Testing basic memtable operations...\n";
+
+    const std::string dir = fresh_directory("lockfree_memtable_basic");
+    {
+        AtomicMemTable<int, std::string> table(dir);
+
+        std::string value;
+        assert(!table.get(1, value));
+
+        assert(table.put(1, "one"));
+        assert(table.put(2, "two"));
+        assert(table.get(1, value) && value == "one");
+
+        // Overwrites and erases are new versions of the key
+        assert(table.put(1, "uno"));
+        assert(table.get(1, value) && value == "uno");
+        assert(table.erase(2));
+        assert(!table.get(2, value));
+        assert(!table.contains(2));
+        assert(table.put(2, "dos"));
+        assert(table.get(2, value) && value == "dos");
+
+        assert(table.run_count() == 0);
+    }
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Basic memtable operations test passed!\n";
+}
+
+void test_flush_to_runs() {
+    std::cout << "Testing flush to sorted runs...\n";
+
+    const std::string dir = fresh_directory("lockfree_memtable_flush");
+    {
+        AtomicMemTable<int, int> table(dir, AtomicMemTable<int, int>::DEFAULT_MEMTABLE_BYTES, 256);
+
+        for (int i = 0; i < 1000; ++i) {
+            assert(table.put(i, i * 10));
+        }
+        assert(table.flush());
+        assert(table.run_count() == 1);
+        assert(table.frozen_count() == 0);
+        assert(table.active_bytes() == 0);
+
+        // Newer writes shadow the run, tombstones hide run values
+        for (int i = 0; i < 1000; i += 2) {
+            assert(table.put(i, -i));
+        }
+        assert(table.erase(999));
+        assert(table.flush());
+        assert(table.run_count() == 2);
+
+        for (int i = 0; i < 999; ++i) {
+            int value;
+            assert(table.get(i, value));
+            assert(value == (i % 2 == 0 ? -i : i * 10));
+        }
+        int value;
+        assert(!table.get(999, value));
+        assert(!table.get(5000, value));
+        assert(!table.get(-1, value));
+
+        // Nothing new to flush
+        assert(!table.freeze());
+        assert(table.flush());
+        assert(table.run_count() == 2);
+    }
+
+    // Runs survive reopening the directory
+    {
+        AtomicMemTable<int, int> reopened(dir);
+        assert(reopened.run_count() == 2);
+        int value;
+        assert(reopened.get(4, value) && value == -4);
+        assert(reopened.get(5, value) && value == 50);
+        assert(!reopened.get(999, value));
+    }
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Flush to sorted runs test passed!\n";
+}
+
+void test_merged_scan() {
+    std::cout << "Testing merged scan across tables and runs...\n";
+
+    const std::string dir = fresh_directory("lockfree_memtable_scan");
+    {
+        AtomicMemTable<std::string, std::string> table(dir);
+        std::map<std::string, std::string> expected;
+
+        for (int i = 0; i < 50; ++i) {
+            std::string key = "key" + std::to_string(100 + i);
+            table.put(key, "old");
+            expected[key] = "old";
+        }
+        assert(table.flush());
+
+        for (int i = 0; i < 50; i += 5) {
+            std::string key = "key" + std::to_string(100 + i);
+            table.put(key, "new");
+            expected[key] = "new";
+        }
+        assert(table.freeze());     // Leave a frozen or flushed table behind
+        table.erase("key101");
+        expected.erase("key101");
+        table.put("key999", "tail");
+        expected["key999"] = "tail";
+
+        std::map<std::string, std::string> seen;
+        std::string previous;
+        size_t visited = table.scan("key000", "key999", [&](const std::string& key, const std::string& value) {
+            assert(previous.empty() || previous < key);
+            previous = key;
+            seen[key] = value;
+            return true;
+        });
+        assert(visited == expected.size());
+        assert(seen == expected);
+
+        // Bounded scan stops early
+        size_t limited = table.scan("key110", "key119", [](const std::string&, const std::string&) {
+            return true;
+        });
+        assert(limited == 10);
+        size_t first_only = table.scan("key000", "key999", [](const std::string&, const std::string&) {
+            return false;
+        });
+        assert(first_only == 1);
+    }
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Merged scan test passed!\n";
+}
+
+void test_concurrent_writes_with_background_flush() {
+    std::cout << "Testing concurrent writes with background flush...\n";
+
+    const std::string dir = fresh_directory("lockfree_memtable_concurrent");
+    {
+        // Small threshold so the active table is frozen many times during the test
+        AtomicMemTable<int, int> table(dir, 64 * 1024, 1024);
+
+        constexpr int num_threads = 4;
+        constexpr int keys_per_thread = 5000;
+        std::atomic<bool> done{false};
+        std::atomic<int> reader_misses{0};
+
+        std::thread reader([&]() {
+            while (!done.load()) {
+                int value;
+                // Thread 0 writes key 0 first, so once visible it must stay visible
+                if (table.get(0, value) && value != 0) {
+                    reader_misses.fetch_add(1);
+                }
+            }
+        });
+
+        std::vector<std::thread> writers;
+        for (int t = 0; t < num_threads; ++t) {
+            writers.emplace_back([&, t]() {
+                for (int i = 0; i < keys_per_thread; ++i) {
+                    int key = t * keys_per_thread + i;
+                    assert(table.put(key, key));
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        done.store(true);
+        reader.join();
+
+        assert(reader_misses.load() == 0);
+        assert(table.flush());
+        assert(table.run_count() > 1);
+
+        for (int key = 0; key < num_threads * keys_per_thread; ++key) {
+            int value;
+            assert(table.get(key, value));
+            assert(value == key);
+        }
+    }
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Concurrent writes with background flush test passed!\n";
+}
+
+void test_sorted_run_format() {
+    std::cout << "Testing sorted run file format...\n";
+
+    using Run = SortedRun<int, std::string>;
+    const std::string dir = fresh_directory("lockfree_sorted_run");
+    std::filesystem::create_directories(dir);
+    const std::string path = dir + "/run.sst";
+
+    {
+        Run::Writer writer(path, 128);
+        for (int i = 0; i < 200; ++i) {
+            std::string value = "v" + std::to_string(i);
+            assert(writer.add(i * 2, i == 7 ? nullptr : &value));
+        }
+        assert(writer.entry_count() == 200);
+        assert(writer.finish());
+    }
+
+    Run run;
+    assert(run.open(path));
+    assert(run.entry_count() == 200);
+    assert(run.block_count() > 1);
+
+    std::string value;
+    assert(run.get(10, value) == Run::Lookup::FOUND && value == "v5");
+    assert(run.get(14, value) == Run::Lookup::DELETED);
+    assert(run.get(11, value) == Run::Lookup::MISSING);
+    assert(run.get(-2, value) == Run::Lookup::MISSING);
+    assert(run.get(1000, value) == Run::Lookup::MISSING);
+
+    int count = 0;
+    run.range(100, 119, [&](const int& key, const std::string* v) {
+        assert(key >= 100 && key <= 119);
+        assert(v && *v == "v" + std::to_string(key / 2));
+        ++count;
+        return true;
+    });
+    assert(count == 10);
+
+    // Corrupt files are rejected
+    Run missing;
+    assert(!missing.open(dir + "/does_not_exist.sst"));
+    {
+        std::ofstream garbage(dir + "/garbage.sst", std::ios::binary);
+        garbage << std::string(100, 'x');
+    }
+    Run corrupt;
+    assert(!corrupt.open(dir + "/garbage.sst"));
+
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Sorted run file format test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicMemTable Tests\n";
+    std::cout << "====================\n\n";
+
+    test_basic_memtable_operations();
+    test_flush_to_runs();
+    test_merged_scan();
+    test_concurrent_writes_with_background_flush();
+    test_sorted_run_format();
+
+    std::cout << "\nAll memtable tests passed!\n";
+
+    return 0;
+}
@@ -451,6 +451,55 @@ void test_power_of_two_requirement() {
     std::cout << "✓ Passed\n";
 }
 
+void test_inline_and_raw_storage() {
+    std::cout << "Testing inline and raw slot storage... ";
+    
+    struct Pair64 {
+        uint64_t key;
+        uint64_t value;
+    };
+    
+    AtomicMPMCQueue<Pair64, 8> inline_queue;
+    for (int round = 0; round < 3; ++round) {
+        for (uint64_t i = 0; i < 8; ++i) {
+            assert(inline_queue.enqueue(Pair64{i, i + round}));
+        }
+        Pair64 item{};
+        assert(inline_queue.front(item) && item.key == 0);
+        for (uint64_t i = 0; i < 8; ++i) {
+            assert(inline_queue.dequeue(item));
+            assert(item.key == i && item.value == i + round);
+        }
+        assert(inline_queue.empty());
+    }
+    
+    // Elements of other types are constructed on enqueue and destroyed exactly once
+    static std::atomic<int> live{0};
+    struct Counted {
+        int value;
+        explicit Counted(int v) : value(v) { live.fetch_add(1); }
+        Counted(const Counted& other) : value(other.value) { live.fetch_add(1); }
+        Counted& operator=(const Counted&) = default;
+        ~Counted() { live.fetch_sub(1); }
+    };
+    
+    {
+        AtomicMPMCQueue<Counted, 8> queue;
+        assert(live.load() == 0);
+        for (int i = 0; i < 5; ++i) {
+            assert(queue.emplace(i));
+        }
+        assert(live.load() == 5);
+        
+        Counted out(-1);
+        assert(queue.dequeue(out) && out.value == 0);
+        assert(live.load() == 5);   // four queued plus out
+    }
+    assert(live.load() == 0);
+    
+    std::cout << "✓ Passed\n";
+}
+
 int main() {
     std::cout << "AtomicMPMCQueue Tests\n";
     std::cout << "=====================\n\n";
@@ -459,6 +508,7 @@ int main() {
         test_basic_operations();
         test_move_semantics();
         test_emplace();
+        test_inline_and_raw_storage();
         test_capacity_limits();
         test_fifo_ordering();
         test_power_of_two_requirement();
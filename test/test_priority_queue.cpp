@@ -72,7 +72,7 @@ void test_basic_priority_queue_operations() {
 void test_integer_priority_queue() {
     std::cout << "Testing integer priority queue...\n";
     
-    AtomicPriorityQueue<int> pq;  // Default is std::less (min-heap)
+    AtomicPriorityQueue<int, std::less<int>> pq;  // Min-heap
     
     // Insert random values
     std::vector<int> values = {15, 3, 8, 1, 12, 7, 20, 5};
@@ -254,6 +254,92 @@ void test_priority_queue_stress() {
     std::cout << "Priority queue stress test passed!\n";
 }
 
+void test_long_running_order() {
+    std::cout << "Testing priority order across many head advances...\n";
+    
+    // Min-queue with a standing backlog, so the popped prefix is cut off over and over
+    AtomicPriorityQueue<int, std::less<int>> pq;
+    std::mt19937 gen(11);
+    std::vector<int> reference;
+    for (int i = 0; i < 500; ++i) {
+        int value = static_cast<int>(gen() % 100000);
+        pq.push(value);
+        reference.push_back(value);
+    }
+    std::make_heap(reference.begin(), reference.end(), std::greater<int>());
+    
+    int last_popped = -1;
+    for (int round = 0; round < 100000; ++round) {
+        // New values are never below the last popped one, so pops stay monotonic
+        int value = last_popped + static_cast<int>(gen() % 1000);
+        pq.push(value);
+        reference.push_back(value);
+        std::push_heap(reference.begin(), reference.end(), std::greater<int>());
+        
+        int popped = 0;
+        assert(pq.pop(popped));
+        std::pop_heap(reference.begin(), reference.end(), std::greater<int>());
+        assert(popped == reference.back());
+        reference.pop_back();
+        assert(popped >= last_popped);
+        last_popped = popped;
+    }
+    assert(pq.size() == reference.size());
+    
+    int top = 0;
+    assert(pq.top(top) && top == *std::min_element(reference.begin(), reference.end()));
+    
+    std::cout << "Long-running order test passed!\n";
+}
+
+void test_concurrent_push_pop_exactly_once() {
+    std::cout << "Testing concurrent push/pop delivers every element once...\n";
+    
+    AtomicPriorityQueue<int> pq;
+    constexpr int num_producers = 3;
+    constexpr int num_consumers = 3;
+    constexpr int per_producer = 20000;
+    
+    std::atomic<int> popped_count{0};
+    std::vector<std::vector<int>> popped(num_consumers);
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < num_producers; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < per_producer; ++i) {
+                pq.push(t * per_producer + i);
+            }
+        });
+    }
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&, t]() {
+            int value = 0;
+            while (popped_count.load() < num_producers * per_producer) {
+                if (pq.pop(value)) {
+                    popped[t].push_back(value);
+                    popped_count.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::vector<int> all;
+    for (const auto& values : popped) {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    assert(all.size() == static_cast<size_t>(num_producers * per_producer));
+    for (size_t i = 0; i < all.size(); ++i) {
+        assert(all[i] == static_cast<int>(i));
+    }
+    assert(pq.empty());
+    
+    std::cout << "Concurrent push/pop exactly-once test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicPriorityQueue Tests\n";
     std::cout << "=========================\n\n";
@@ -263,6 +349,8 @@ int main() {
     test_concurrent_priority_queue();
     test_emplace_operations();
     test_priority_queue_stress();
+    test_long_running_order();
+    test_concurrent_push_pop_exactly_once();
     
     std::cout << "\nAll priority queue tests passed!\n";
     return 0;
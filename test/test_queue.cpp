@@ -289,6 +289,66 @@ void test_move_semantics() {
     std::cout << "Move semantics test passed!\n";
 }
 
+void test_inline_value_operations() {
+    std::cout << "Testing inline value operations...\n";
+    
+    struct Pair64 {
+        uint64_t key;
+        uint64_t value;
+    };
+    
+    AtomicQueue<Pair64> queue;
+    for (uint64_t i = 0; i < 100; ++i) {
+        queue.enqueue(Pair64{i, i * 3});
+    }
+    assert(queue.size() == 100);
+    
+    Pair64 item{};
+    assert(queue.front(item) && item.key == 0);
+    for (uint64_t i = 0; i < 100; ++i) {
+        assert(queue.dequeue(item));
+        assert(item.key == i && item.value == i * 3);
+    }
+    assert(queue.empty());
+    assert(!queue.front(item));
+    
+    // Each element must be dequeued exactly once under contention
+    const int num_threads = 4;
+    const int items_per_thread = 10000;
+    AtomicQueue<Pair64> shared;
+    std::vector<std::atomic<int>> seen(num_threads * items_per_thread);
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                uint64_t id = static_cast<uint64_t>(t * items_per_thread + i);
+                shared.enqueue(Pair64{id, ~id});
+            }
+        });
+        threads.emplace_back([&]() {
+            Pair64 value{};
+            while (consumed.load() < num_threads * items_per_thread) {
+                if (shared.dequeue(value)) {
+                    assert(value.value == ~value.key);
+                    seen[value.key].fetch_add(1);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    for (auto& count : seen) {
+        assert(count.load() == 1);
+    }
+    
+    std::cout << "Inline value operations test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicQueue Tests\n";
     std::cout << "=================\n\n";
@@ -300,6 +360,7 @@ int main() {
     test_emplace_operations();
     test_queue_stress();
     test_move_semantics();
+    test_inline_value_operations();
     
     std::cout << "\nAll queue tests passed!\n";
     return 0;
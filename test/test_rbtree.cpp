@@ -294,6 +294,177 @@ void test_move_semantics() {
     std::cout << "Move semantics test passed!\n";
 }
 
+void test_reverse_iteration() {
+    std::cout << "Testing reverse iteration...\n";
+    
+    AtomicRBTree<int, int> tree;
+    std::vector<int> keys(500);
+    for (int i = 0; i < 500; ++i) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(11));
+    for (int key : keys) {
+        assert(tree.insert(key, key * 10));
+    }
+    for (int i = 0; i < 500; i += 3) {
+        assert(tree.erase(i));   // Logically deleted nodes must be skipped
+    }
+    
+    std::vector<int> expected;
+    for (int i = 499; i >= 0; --i) {
+        if (i % 3 != 0) {
+            expected.push_back(i);
+        }
+    }
+    
+    std::vector<int> reversed;
+    for (auto it = tree.rbegin(); it != tree.rend(); ++it) {
+        auto [key, value] = *it;
+        assert(value == key * 10);
+        reversed.push_back(key);
+    }
+    assert(reversed == expected);
+    
+    // Bounds are inclusive and need not be present
+    std::vector<int> visited;
+    size_t count = tree.reverse_range(250, 100, [&](const int& key, const int& value) {
+        assert(value == key * 10);
+        visited.push_back(key);
+        return true;
+    });
+    std::vector<int> in_range;
+    std::copy_if(expected.begin(), expected.end(), std::back_inserter(in_range),
+                 [](int key) { return key >= 100 && key <= 250; });
+    assert(count == in_range.size());
+    assert(visited == in_range);
+    
+    // Latest three at or before 1000: the visitor stops the scan
+    visited.clear();
+    assert(tree.reverse_range(1000, 0, [&](const int& key, const int&) {
+        visited.push_back(key);
+        return visited.size() < 3;
+    }) == 3);
+    assert((visited == std::vector<int>{499, 497, 496}));
+    
+    AtomicRBTree<int, int> empty_tree;
+    assert(empty_tree.rbegin() == empty_tree.rend());
+    assert(empty_tree.reverse_range(10, 0, [](const int&, const int&) { return true; }) == 0);
+    
+    std::cout << "Reverse iteration test passed!\n";
+}
+
+void test_insert_or_assign_and_compute() {
+    std::cout << "Testing insert_or_assign and compute...\n";
+    
+    AtomicRBTree<int, long> tree;
+    long value = 0;
+    
+    // New keys are inserted, existing ones replaced without a new node
+    assert(tree.insert_or_assign(1, 10));
+    assert(tree.find(1, value) && value == 10);
+    assert(tree.insert_or_assign(1, 20));
+    assert(tree.find(1, value) && value == 20);
+    assert(tree.size() == 1);
+    
+    assert(tree.compute(1, [](long current) { return current + 5; }));
+    assert(tree.find(1, value) && value == 25);
+    assert(tree.compute(2, [](long current) { return current + 7; }));   // Starts from Value{}
+    assert(tree.find(2, value) && value == 7);
+    assert(tree.size() == 2);
+    
+    // An erased key can be inserted again, next to its marked node
+    assert(tree.erase(1));
+    assert(!tree.contains(1));
+    assert(tree.insert(1, 3));
+    assert(!tree.insert(1, 4));
+    assert(tree.find(1, value) && value == 3);
+    assert(tree.erase(1));
+    assert(tree.compute(1, [](long current) { return current + 1; }));
+    assert(tree.find(1, value) && value == 1);
+    assert(tree.size() == 2);
+    
+    std::vector<std::pair<int, long>> seen;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+        auto [key, current] = *it;
+        seen.emplace_back(key, current);
+    }
+    assert((seen == std::vector<std::pair<int, long>>{{1, 1}, {2, 7}}));
+    
+    // Word-sized values are still handed out by reference
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+        (*it).second = (*it).first * 100;
+    }
+    assert(tree.find(1, value) && value == 100);
+    assert(tree.find(2, value) && value == 200);
+    auto last = tree.rbegin();
+    long& last_value = (*last).second;
+    last_value = 250;
+    (*last).second += 1;
+    std::pair<const int&, long&> entry = *tree.begin();
+    entry.second -= 1;
+    assert(tree.find(2, value) && value == 251);
+    assert(tree.find(1, value) && value == 99);
+    
+    // Other values are still handed out by reference
+    AtomicRBTree<int, std::string> names;
+    assert(names.insert(1, "one"));
+    (*names.begin()).second += "!";
+    std::string name;
+    assert(names.find(1, name) && name == "one!");
+    
+    std::cout << "insert_or_assign and compute test passed!\n";
+}
+
+void test_concurrent_compute() {
+    std::cout << "Testing concurrent compute...\n";
+    
+    AtomicRBTree<int, long> tree;
+    constexpr int num_threads = 4;
+    constexpr int keys = 64;
+    constexpr int rounds = 20000;
+    
+    // Even keys exist from the start, odd keys are created by the first compute()
+    for (int i = 0; i < keys; i += 2) {
+        assert(tree.insert(i, 0));
+    }
+    
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            for (int i = 0; i < keys; i += 2) {
+                assert(tree.contains(i));   // Updated keys never go missing
+            }
+        }
+    });
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            for (int i = 0; i < rounds; ++i) {
+                assert(tree.compute(static_cast<int>(rng() % keys), [](long current) { return current + 1; }));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+    
+    // No increment is lost and every odd key was inserted exactly once
+    long total = 0;
+    size_t count = 0;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+        total += (*it).second;
+        ++count;
+    }
+    assert(total == static_cast<long>(num_threads) * rounds);
+    assert(count == keys && tree.size() == keys);
+    
+    std::cout << "Concurrent compute test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicRBTree Tests\n";
     std::cout << "==================\n\n";
@@ -306,6 +477,9 @@ int main() {
     test_iteration();
     test_tree_stress();
     test_move_semantics();
+    test_reverse_iteration();
+    test_insert_or_assign_and_compute();
+    test_concurrent_compute();
     
     std::cout << "\nAll red-black tree tests passed!\n";
     std::cout << "\nNote: This implementation provides a simplified lock-free tree\n";
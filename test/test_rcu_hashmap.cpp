@@ -0,0 +1,238 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <map>
+#include "lockfree/atomic_rcu_hashmap.hpp"
+
+using namespace lockfree;
+
+// Value type that counts its live instances so leaks and double frees are visible
+struct Counted {
+    static inline std::atomic<int> live{0};
+    int payload = 0;
+    Counted() { live.fetch_add(1); }
+    Counted(int p) : payload(p) { live.fetch_add(1); }
+    Counted(const Counted& other) : payload(other.payload) { live.fetch_add(1); }
+    Counted& operator=(const Counted& other) = default;
+    ~Counted() { live.fetch_sub(1); }
+};
+
+void test_basic_rcu_operations() {
+    std::cout << "Testing basic RCU hashmap operations...\n";
+
+    AtomicRcuHashMap<int, std::string> map;
+
+    assert(map.empty());
+    assert(map.size() == 0);
+    assert(map.bucket_count() == 1024);
+
+    assert(map.insert(1, "one"));
+    assert(map.insert(2, "two"));
+    assert(!map.insert(1, "uno"));  // Insert does not overwrite
+    assert(map.size() == 2);
+
+    std::string value;
+    assert(map.find(1, value) && value == "one");
+    assert(map.contains(2));
+    assert(!map.contains(3));
+
+    assert(map.insert_or_assign(1, "uno"));
+    assert(map.find(1, value) && value == "uno");
+    assert(map.size() == 2);
+
+    assert(map.find_if(2, [](const std::string& v) { return v == "two"; }));
+    assert(!map.find_if(2, [](const std::string& v) { return v == "dos"; }));
+
+    assert(map.erase(1));
+    assert(!map.erase(1));
+    assert(!map.contains(1));
+    assert(map.size() == 1);
+
+    std::cout << "Basic RCU hashmap operations test passed!\n";
+}
+
+void test_write_batch() {
+    std::cout << "Testing write batches...\n";
+
+    AtomicRcuHashMap<int, int> map;
+    AtomicRcuHashMap<int, int>::WriteBatch batch;
+    for (int i = 0; i < 100; ++i) {
+        batch.put(i, i);
+    }
+    batch.put(5, 500);      // Later changes to a key win
+    batch.erase(7);
+    batch.erase(1000);      // Erasing a missing key is a no-op
+    assert(batch.size() == 103);
+    assert(map.apply(batch));
+
+    assert(map.size() == 99);
+    int value;
+    assert(map.find(5, value) && value == 500);
+    assert(!map.contains(7));
+    assert(map.find(99, value) && value == 99);
+
+    batch.clear();
+    assert(batch.empty());
+    assert(map.apply(batch));
+    assert(map.size() == 99);
+
+    std::cout << "Write batch test passed!\n";
+}
+
+// Hasher whose every instance gets a different seed, like a per-map randomized hasher
+struct SeededHash {
+    static inline std::atomic<size_t> next_seed{1};
+    size_t seed = next_seed.fetch_add(0x9E3779B97F4A7C15ULL);
+    size_t operator()(int key) const { return lockfree::Hasher<int>{}(key) ^ seed; }
+};
+
+void test_write_batch_stateful_hasher() {
+    std::cout << "Testing write batches with a stateful hasher...\n";
+
+    AtomicRcuHashMap<int, int, SeededHash> map;
+    assert(map.insert(3, 3));
+    AtomicRcuHashMap<int, int, SeededHash>::WriteBatch batch;
+    for (int i = 0; i < 200; ++i) {
+        batch.put(i, i * 2);
+    }
+    batch.erase(10);
+    assert(map.apply(batch));
+
+    // Batched keys must land where the map's own hasher looks for them
+    assert(map.size() == 199);
+    int value = 0;
+    for (int i = 0; i < 200; ++i) {
+        assert(map.find(i, value) == (i != 10));
+        assert(i == 10 || value == i * 2);
+    }
+    assert(map.erase(3) && !map.contains(3));
+
+    std::cout << "Stateful hasher write batch test passed!\n";
+}
+
+void test_resize_and_for_each() {
+    std::cout << "Testing resize and snapshot iteration...\n";
+
+    AtomicRcuHashMap<int, int> map(16);
+    assert(map.bucket_count() == 256);  // Rounded up to one segment
+
+    for (int i = 0; i < 5000; ++i) {
+        assert(map.insert(i, i * 2));
+    }
+    assert(map.size() == 5000);
+    assert(map.bucket_count() >= 5000 * 100 / 75);
+    assert(map.load_factor() <= 0.75);
+
+    std::map<int, int> seen;
+    map.for_each([&](const int& key, const int& v) {
+        seen[key] = v;
+    });
+    assert(seen.size() == 5000);
+    for (const auto& [key, v] : seen) {
+        assert(v == key * 2);
+    }
+
+    std::cout << "Resize and snapshot iteration test passed!\n";
+}
+
+void test_concurrent_readers_and_writers() {
+    std::cout << "Testing concurrent readers with batched writers...\n";
+
+    AtomicRcuHashMap<int, int> map;
+    constexpr int key_count = 2000;
+    for (int i = 0; i < key_count; ++i) {
+        map.insert(i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&, r]() {
+            int key = r;
+            while (!done.load()) {
+                int value;
+                // Writers only store multiples of the key, and never erase the lower half
+                if (map.find(key, value)) {
+                    if (value % (key == 0 ? 1 : key) != 0) {
+                        bad_reads.fetch_add(1);
+                    }
+                } else if (key < key_count / 2) {
+                    bad_reads.fetch_add(1);
+                }
+                key = (key + 7) % key_count;
+            }
+            map.offline();
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&, w]() {
+            for (int round = 0; round < 200; ++round) {
+                AtomicRcuHashMap<int, int>::WriteBatch batch;
+                for (int i = 0; i < 20; ++i) {
+                    int key = (round * 20 + i * 13 + w) % key_count;
+                    batch.put(key, key * (round + 1));
+                }
+                int churn = key_count / 2 + (round * 7 + w) % (key_count / 2);
+                batch.erase(churn);
+                assert(map.apply(batch));
+                map.insert(churn, churn);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    assert(bad_reads.load() == 0);
+    for (int i = 0; i < key_count / 2; ++i) {
+        assert(map.contains(i));
+    }
+
+    std::cout << "Concurrent readers with batched writers test passed!\n";
+}
+
+void test_reclamation() {
+    std::cout << "Testing deferred reclamation...\n";
+
+    {
+        AtomicRcuHashMap<int, Counted> map;
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 20; ++i) {
+                map.insert_or_assign(i, Counted(round));
+            }
+        }
+        Counted value;
+        assert(map.find(3, value) && value.payload == 49);
+    }
+    // Versions retired by the map are freed once no reader can hold them
+    QsbrDomain::global().synchronize();
+    assert(Counted::live.load() == 0);
+
+    std::cout << "Deferred reclamation test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicRcuHashMap Tests\n";
+    std::cout << "======================\n\n";
+
+    test_basic_rcu_operations();
+    test_write_batch();
+    test_write_batch_stateful_hasher();
+    test_resize_and_for_each();
+    test_concurrent_readers_and_writers();
+    test_reclamation();
+
+    std::cout << "\nAll RCU hashmap tests passed!\n";
+
+    return 0;
+}
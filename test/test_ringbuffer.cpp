@@ -421,6 +421,60 @@ void test_stress_operations() {
     std::cout << "Stress operations test passed!\n";
 }
 
+void test_inline_value_operations() {
+    std::cout << "Testing inline value operations...\n";
+    
+    struct Pair64 {
+        uint64_t key;
+        uint64_t value;
+    };
+    static_assert(lockfree::InlineValue<Pair64>);
+    static_assert(!lockfree::InlineValue<std::string>);
+    
+    AtomicRingBuffer<Pair64, 8> buffer;
+    
+    // Fill, drain and refill so every slot is reused
+    for (int round = 0; round < 3; ++round) {
+        for (uint64_t i = 0; i < 8; ++i) {
+            assert(buffer.push(Pair64{i, i * 10 + round}));
+        }
+        assert(!buffer.push(Pair64{99, 99}));
+        
+        Pair64 item{};
+        assert(buffer.front(item) && item.key == 0);
+        assert(buffer.back(item) && item.key == 7);
+        
+        for (uint64_t i = 0; i < 8; ++i) {
+            assert(buffer.pop(item));
+            assert(item.key == i && item.value == i * 10 + round);
+        }
+        assert(buffer.empty());
+    }
+    
+    // SPSC path with a concurrent producer and consumer
+    AtomicRingBuffer<uint64_t, 64> spsc;
+    const uint64_t count = 100000;
+    std::thread producer([&]() {
+        for (uint64_t i = 0; i < count; ++i) {
+            while (!spsc.spsc_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    uint64_t expected = 0;
+    while (expected < count) {
+        uint64_t value;
+        if (spsc.spsc_pop(value)) {
+            assert(value == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    
+    std::cout << "Inline value operations test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicRingBuffer Tests\n";
     std::cout << "======================\n\n";
@@ -434,6 +488,7 @@ int main() {
     test_front_back_operations();
     test_move_semantics();
     test_stress_operations();
+    test_inline_value_operations();
     
     std::cout << "\nAll ringbuffer tests passed!\n";
     std::cout << "\nNote: This RingBuffer implementation provides both general\n";
@@ -7,10 +7,27 @@
 #include <string>
 #include <random>
 #include <algorithm>
+#include <memory>
 #include "lockfree/atomic_set.hpp"
 
 using namespace lockfree;
 
+// Sends every key to bucket 0 of an 8-bucket table; pairs of keys share a full hash
+struct SameBucketHash {
+    size_t operator()(int key) const {
+        return static_cast<size_t>(key / 2) * 8;
+    }
+};
+
+// Counts how often the container falls back to comparing keys
+struct CountingEqual {
+    static inline int calls = 0;
+    bool operator()(int a, int b) const {
+        ++calls;
+        return a == b;
+    }
+};
+
 void test_basic_set_operations() {
     std::cout << "Testing basic set operations...\n";
     
@@ -355,6 +372,61 @@ void test_move_semantics() {
     std::cout << "Move semantics test passed!\n";
 }
 
+void test_cached_hash_comparisons() {
+    std::cout << "Testing cached hash comparisons...\n";
+    
+    AtomicSet<int, SameBucketHash, CountingEqual> set(8);
+    for (int i = 0; i < 32; ++i) {
+        assert(set.insert(i));
+    }
+    
+    // One chain of 32 nodes: only the node with the same hash (and the key's twin) is compared
+    CountingEqual::calls = 0;
+    assert(set.contains(7));
+    assert(CountingEqual::calls <= 2);
+    
+    // A hash that matches no node never reaches KeyEqual
+    CountingEqual::calls = 0;
+    assert(!set.contains(1000));
+    assert(CountingEqual::calls == 0);
+    
+    // Keys sharing a full hash are still told apart by KeyEqual
+    assert(set.erase(6));
+    assert(!set.contains(6));
+    assert(set.contains(7));
+    
+    std::cout << "Cached hash comparisons test passed!\n";
+}
+
+void test_batch_lookups() {
+    std::cout << "Testing batched lookups...\n";
+    
+    AtomicSet<std::string> set(64);
+    for (int i = 0; i < 100; ++i) {
+        set.insert("item" + std::to_string(i));
+    }
+    set.erase("item42");
+    
+    std::vector<std::string> values;
+    for (int i = 30; i < 150; i += 3) {
+        values.push_back("item" + std::to_string(i));
+    }
+    std::unique_ptr<bool[]> found(new bool[values.size()]);
+    
+    size_t hits = set.contains_batch(values.data(), values.size(), found.get());
+    size_t expected_hits = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        int n = 30 + static_cast<int>(i) * 3;
+        bool present = n < 100 && n != 42;
+        assert(found[i] == present);
+        expected_hits += present ? 1 : 0;
+    }
+    assert(hits == expected_hits);
+    assert(set.find_batch(values.data(), values.size(), found.get()) == expected_hits);
+    
+    std::cout << "Batched lookups test passed!\n";
+}
+
 void test_stress_operations() {
     std::cout << "Testing stress operations...\n";
     
@@ -434,6 +506,8 @@ int main() {
     test_predicate_operations();
     test_to_vector();
     test_move_semantics();
+    test_cached_hash_comparisons();
+    test_batch_lookups();
     test_stress_operations();
     
     std::cout << "\nAll set tests passed!\n";
@@ -8,6 +8,7 @@
 #include <random>
 #include <algorithm>
 #include <map>
+#include <memory>
 #include "lockfree/atomic_skiplist.hpp"
 
 using namespace lockfree;
@@ -169,6 +170,54 @@ void test_string_keys() {
     std::cout << "String key operations test passed!\n";
 }
 
+void test_string_key_prefixes() {
+    std::cout << "Testing string keys with shared prefixes...\n";
+    
+    // Keys that tie on the cached 8-byte prefix, differ past it, or differ by
+    // embedded NULs and bytes above 0x7f must still follow std::string order
+    std::vector<std::string> keys = {
+        "", "a", std::string("a\0", 2), std::string("a\0\0", 3), "abcdefgh", "abcdefghi",
+        "abcdefgh" + std::string(1, '\0'), "abcdefghij", "abcdefgz", "zzzzzzzzzz",
+        "\x80", "\xff\xff\xff\xff\xff\xff\xff\xff", "\xff\xff\xff\xff\xff\xff\xff\xff\x01",
+        "prefix/shared/key/0001", "prefix/shared/key/0002", "prefix/shared/key/0010", "prefix/shared"
+    };
+    
+    AtomicSkipList<std::string, int> skiplist;
+    std::mt19937 rng(5);
+    std::vector<std::string> shuffled = keys;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    for (size_t i = 0; i < shuffled.size(); ++i) {
+        assert(skiplist.insert(shuffled[i], static_cast<int>(i)));
+        assert(!skiplist.insert(shuffled[i], -1));
+    }
+    
+    std::sort(keys.begin(), keys.end());
+    std::vector<std::string> iterated;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        iterated.push_back((*it).first);
+    }
+    assert(iterated == keys);
+    
+    for (const auto& key : keys) {
+        assert(skiplist.contains(key));
+        assert(!skiplist.contains(key + "~"));
+    }
+    
+    std::vector<std::string> ranged;
+    skiplist.range("abcdefgh", "abcdefgz", [&](const std::string& key, int) {
+        ranged.push_back(key);
+        return true;
+    });
+    assert((ranged == std::vector<std::string>{"abcdefgh", "abcdefgh" + std::string(1, '\0'),
+                                               "abcdefghi", "abcdefghij", "abcdefgz"}));
+    
+    assert(skiplist.erase("abcdefghi"));
+    assert(!skiplist.contains("abcdefghi"));
+    assert(skiplist.contains("abcdefghij"));
+    
+    std::cout << "String key prefixes test passed!\n";
+}
+
 void test_concurrent_skiplist_operations() {
     std::cout << "Testing concurrent skiplist operations...\n";
     
@@ -446,6 +495,480 @@ void test_range_properties() {
     std::cout << "Range query properties test passed!\n";
 }
 
+void test_sorted_batches() {
+    std::cout << "Testing sorted batch find and insert...\n";
+    
+    AtomicSkipList<int, int> skiplist;
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < 2000; i += 2) {
+        pairs.emplace_back(i, i * 10);
+    }
+    assert(skiplist.insert_sorted_batch(pairs.data(), pairs.size()) == pairs.size());
+    assert(skiplist.insert_sorted_batch(pairs.data(), 10) == 0);   // Already present
+    assert(skiplist.size() == pairs.size());
+    
+    // Dense, sparse, duplicate and missing keys
+    std::vector<int> keys = {-5, 0, 0, 1, 2, 3, 4, 100, 1000, 1001, 1998, 1999, 5000};
+    std::vector<int> values(keys.size(), -1);
+    std::unique_ptr<bool[]> found(new bool[keys.size()]);
+    assert(skiplist.find_sorted_batch(keys.data(), keys.size(), values.data(), found.get()) == 7);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        int expected;
+        assert(found[i] == skiplist.find(keys[i], expected));
+        assert(!found[i] || values[i] == expected);
+        assert(found[i] || values[i] == -1);
+    }
+    
+    // Erased keys are not found; a later insert of the same key is
+    assert(skiplist.erase(4));
+    std::vector<std::pair<int, int>> again = {{3, 30}, {4, 44}, {5, 50}};
+    assert(skiplist.insert_sorted_batch(again.data(), again.size()) == 3);
+    assert(skiplist.insert_sorted_batch(again.data(), again.size()) == 0);
+    keys = {3, 4, 5};
+    assert(skiplist.find_sorted_batch(keys.data(), keys.size(), values.data(), found.get()) == 3);
+    assert(values[1] == 44);
+    
+    // Out-of-order input is still handled
+    std::vector<std::pair<int, int>> unsorted = {{7, 7}, {-1, -1}, {9, 9}, {7, 0}};
+    assert(skiplist.insert_sorted_batch(unsorted.data(), unsorted.size()) == 3);
+    keys = {9, -1, 7, 1000};
+    assert(skiplist.find_sorted_batch(keys.data(), keys.size(), values.data(), found.get()) == 4);
+    assert(values[0] == 9 && values[1] == -1 && values[2] == 7);
+    
+    std::vector<int> iterated;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        iterated.push_back((*it).first);
+    }
+    assert(std::is_sorted(iterated.begin(), iterated.end()));
+    assert(std::adjacent_find(iterated.begin(), iterated.end()) == iterated.end());
+    
+    std::cout << "Sorted batch find and insert test passed!\n";
+}
+
+void test_concurrent_sorted_batches() {
+    std::cout << "Testing concurrent sorted batches...\n";
+    
+    constexpr int num_threads = 4;
+    constexpr int batches = 50;
+    constexpr int batch_size = 200;
+    AtomicSkipList<int, int> skiplist;
+    
+    // Thread t inserts keys congruent to t mod num_threads, in sorted runs that interleave with the others
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int b = 0; b < batches; ++b) {
+                std::vector<std::pair<int, int>> run;
+                for (int i = 0; i < batch_size; ++i) {
+                    const int key = (b * batch_size + i) * num_threads + t;
+                    run.emplace_back(key, -key);
+                }
+                assert(skiplist.insert_sorted_batch(run.data(), run.size()) == run.size());
+                
+                std::vector<int> keys;
+                for (const auto& [key, value] : run) {
+                    keys.push_back(key);
+                }
+                std::vector<int> values(keys.size());
+                std::unique_ptr<bool[]> found(new bool[keys.size()]);
+                assert(skiplist.find_sorted_batch(keys.data(), keys.size(), values.data(), found.get()) == keys.size());
+                for (size_t i = 0; i < keys.size(); ++i) {
+                    assert(values[i] == -keys[i]);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    assert(skiplist.size() == static_cast<size_t>(num_threads * batches * batch_size));
+    int previous = -1;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        assert((*it).first == previous + 1);
+        previous = (*it).first;
+    }
+    
+    std::cout << "Concurrent sorted batches test passed!\n";
+}
+
+void test_erase_and_reinsert() {
+    std::cout << "Testing erase and reinsert of the same keys...\n";
+    
+    AtomicSkipList<int, int> skiplist;
+    for (int i = 0; i < 1000; ++i) {
+        assert(skiplist.insert(i, i));
+    }
+    
+    // Erased keys can be inserted again at once, with the new value
+    for (int round = 1; round <= 5; ++round) {
+        for (int i = 0; i < 1000; i += 3) {
+            assert(skiplist.erase(i));
+            assert(!skiplist.contains(i));
+            assert(!skiplist.erase(i));
+            assert(skiplist.insert(i, i + round * 1000));
+        }
+    }
+    
+    int value = 0;
+    assert(skiplist.find(0, value) && value == 5000);
+    assert(skiplist.find(1, value) && value == 1);
+    assert(skiplist.size() == 1000);
+    
+    // No erased tower may linger and duplicate a key in iteration or range scans
+    int expected = 0;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        assert((*it).first == expected++);
+    }
+    assert(expected == 1000);
+    assert(skiplist.range(100, 199, [](const int&, const int&) { return true; }) == 100);
+    
+    for (int i = 0; i < 1000; ++i) {
+        assert(skiplist.erase(i));
+    }
+    assert(skiplist.empty());
+    assert(skiplist.insert(500, 1));
+    assert(skiplist.size() == 1);
+    
+    std::cout << "Erase and reinsert test passed!\n";
+}
+
+void test_concurrent_erase_reinsert() {
+    std::cout << "Testing concurrent erase and reinsert...\n";
+    
+    AtomicSkipList<int, int> skiplist;
+    constexpr int num_threads = 4;
+    constexpr int keys = 256;
+    constexpr int rounds = 20000;
+    
+    // Even keys are never touched; odd keys are erased and reinserted by every thread
+    for (int i = 0; i < keys; ++i) {
+        assert(skiplist.insert(i, i));
+    }
+    
+    std::atomic<int> balance{0};
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            for (int i = 0; i < keys; i += 2) {
+                assert(skiplist.contains(i));
+            }
+        }
+    });
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            int local = 0;
+            for (int i = 0; i < rounds; ++i) {
+                const int key = static_cast<int>(rng() % (keys / 2)) * 2 + 1;
+                if (rng() % 2) {
+                    local -= skiplist.erase(key);
+                } else {
+                    local += skiplist.insert(key, t);
+                }
+            }
+            balance.fetch_add(local);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+    
+    // Every successful insert and erase of an odd key is reflected exactly once
+    assert(static_cast<int>(skiplist.size()) == keys + balance.load());
+    int previous = -1;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        assert((*it).first > previous);
+        previous = (*it).first;
+    }
+    
+    std::cout << "Concurrent erase and reinsert test passed!\n";
+}
+
+void test_manual_index_maintenance() {
+    std::cout << "Testing manual index maintenance...\n";
+    
+    AtomicSkipList<int, int> skiplist(IndexMode::MANUAL);
+    assert(skiplist.index_mode() == IndexMode::MANUAL);
+    constexpr int keys = 10000;
+    
+    std::vector<int> order(keys);
+    for (int i = 0; i < keys; ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(7));
+    for (int key : order) {
+        assert(skiplist.insert(key, key * 2));
+    }
+    
+    // Level 0 alone answers every query before the index exists
+    int value = 0;
+    assert(skiplist.find(keys - 1, value) && value == (keys - 1) * 2);
+    assert(skiplist.maintain() > 0);
+    assert(skiplist.maintain() == 0);   // Idempotent once built
+    
+    for (int i = 0; i < keys; i += 2) {
+        assert(skiplist.erase(i));
+    }
+    for (int i = 0; i < keys; ++i) {
+        assert(skiplist.contains(i) == (i % 2 == 1));
+    }
+    assert(skiplist.maintain() > 0);
+    for (int i = 0; i < keys; ++i) {
+        assert(skiplist.contains(i) == (i % 2 == 1));
+    }
+    assert(skiplist.size() == keys / 2);
+    
+    // Sorted batches and ranges see the same contents through the rebuilt index
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < keys; i += 2) {
+        batch.emplace_back(i, i * 2);
+    }
+    assert(skiplist.insert_sorted_batch(batch.data(), batch.size()) == batch.size());
+    assert(skiplist.range(100, 199, [](const int&, const int&) { return true; }) == 100);
+    skiplist.maintain();
+    assert(skiplist.size() == keys);
+    
+    AtomicSkipList<int, int> eager;
+    assert(eager.insert(1, 1));
+    assert(eager.maintain() == 0);   // The eager index needs no maintainer
+    
+    std::cout << "Manual index maintenance test passed!\n";
+}
+
+void test_background_index_concurrent() {
+    std::cout << "Testing background index maintenance under concurrent writes...\n";
+    
+    AtomicSkipList<int, int> skiplist(IndexMode::BACKGROUND);
+    constexpr int num_threads = 4;
+    constexpr int keys = 4096;
+    constexpr int rounds = 20000;
+    
+    // As in the eager test: even keys stay, odd keys churn while the index is rebuilt.
+    // The batch races the maintainer raising nodes it has just published.
+    std::vector<std::pair<int, int>> evens;
+    for (int i = 0; i < keys; i += 2) {
+        evens.emplace_back(i, i);
+    }
+    assert(skiplist.insert_sorted_batch(evens.data(), evens.size()) == evens.size());
+    
+    std::atomic<int> balance{0};
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            for (int i = 0; i < keys; i += 2) {
+                assert(skiplist.contains(i));
+            }
+        }
+    });
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            int local = 0;
+            for (int i = 0; i < rounds; ++i) {
+                const int key = static_cast<int>(rng() % (keys / 2)) * 2 + 1;
+                if (rng() % 2) {
+                    local -= skiplist.erase(key);
+                } else {
+                    local += skiplist.insert(key, t);
+                }
+            }
+            balance.fetch_add(local);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+    
+    assert(static_cast<int>(skiplist.size()) == keys / 2 + balance.load());
+    int previous = -1;
+    for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+        assert((*it).first > previous);
+        previous = (*it).first;
+        assert(skiplist.contains(previous));
+    }
+    
+    std::cout << "Background index maintenance test passed!\n";
+}
+
+void test_reverse_iteration() {
+    std::cout << "Testing reverse iteration...\n";
+    
+    // MANUAL without maintain(): no index, so every run starts at the head
+    for (IndexMode mode : {IndexMode::EAGER, IndexMode::MANUAL}) {
+        AtomicSkipList<int, int> skiplist(mode);
+        std::vector<int> keys(2000);
+        for (int i = 0; i < 2000; ++i) {
+            keys[i] = i;
+        }
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(11));
+        for (int key : keys) {
+            assert(skiplist.insert(key, key * 10));
+        }
+        for (int i = 0; i < 2000; i += 3) {
+            assert(skiplist.erase(i));
+        }
+        
+        std::vector<int> expected;
+        for (int i = 1999; i >= 0; --i) {
+            if (i % 3 != 0) {
+                expected.push_back(i);
+            }
+        }
+        
+        std::vector<int> reversed;
+        for (auto it = skiplist.rbegin(); it != skiplist.rend(); ++it) {
+            auto [key, value] = *it;
+            assert(value == key * 10);
+            reversed.push_back(key);
+        }
+        assert(reversed == expected);
+        
+        std::vector<int> visited;
+        size_t count = skiplist.reverse_range(1250, 100, [&](const int& key, const int& value) {
+            assert(value == key * 10);
+            visited.push_back(key);
+            return true;
+        });
+        std::vector<int> in_range;
+        std::copy_if(expected.begin(), expected.end(), std::back_inserter(in_range),
+                     [](int key) { return key >= 100 && key <= 1250; });
+        assert(count == in_range.size());
+        assert(visited == in_range);
+        
+        // Latest three at or before 1000
+        visited.clear();
+        assert(skiplist.reverse_range(1000, 0, [&](const int& key, const int&) {
+            visited.push_back(key);
+            return visited.size() < 3;
+        }) == 3);
+        assert((visited == std::vector<int>{1000, 998, 997}));
+        assert(skiplist.reverse_range(5, 10, [](const int&, const int&) { return true; }) == 0);
+    }
+    
+    AtomicSkipList<std::string, int> names;
+    for (const char* name : {"alpha", "bravo", "charlie", "delta"}) {
+        assert(names.insert(name, 0));
+    }
+    std::vector<std::string> descending;
+    names.reverse_range("c", "b", [&](const std::string& key, const int&) {
+        descending.push_back(key);
+        return true;
+    });
+    assert((descending == std::vector<std::string>{"bravo"}));
+    
+    AtomicSkipList<int, int> empty_list;
+    assert(empty_list.rbegin() == empty_list.rend());
+    
+    std::cout << "Reverse iteration test passed!\n";
+}
+
+void test_insert_or_assign_and_compute() {
+    std::cout << "Testing insert_or_assign and compute...\n";
+    
+    AtomicSkipList<int, long> skiplist;
+    long value = 0;
+    
+    // New keys are inserted, existing ones replaced without a new node
+    assert(skiplist.insert_or_assign(1, 10));
+    assert(skiplist.find(1, value) && value == 10);
+    assert(skiplist.insert_or_assign(1, 20));
+    assert(skiplist.find(1, value) && value == 20);
+    assert(skiplist.size() == 1);
+    
+    assert(skiplist.compute(1, [](long current) { return current + 5; }));
+    assert(skiplist.find(1, value) && value == 25);
+    assert(skiplist.compute(2, [](long current) { return current + 7; }));   // Starts from Value{}
+    assert(skiplist.find(2, value) && value == 7);
+    assert(skiplist.size() == 2);
+    
+    // Erased keys come back as new nodes
+    assert(skiplist.erase(1));
+    assert(skiplist.compute(1, [](long current) { return current + 1; }));
+    assert(skiplist.find(1, value) && value == 1);
+    
+    // Iteration and scans see the replaced values
+    assert(skiplist.insert_or_assign(2, 70));
+    std::vector<std::pair<int, long>> seen;
+    skiplist.range(0, 10, [&](const int& key, const long& current) {
+        seen.emplace_back(key, current);
+        return true;
+    });
+    assert((seen == std::vector<std::pair<int, long>>{{1, 1}, {2, 70}}));
+    assert((*skiplist.rbegin() == std::pair<int, long>(2, 70)));
+    
+    // Word-sized structs without padding qualify too
+    struct Level {
+        int32_t quantity;
+        int32_t orders;
+    };
+    AtomicSkipList<int, Level> book(IndexMode::MANUAL);
+    assert(book.insert_or_assign(100, Level{5, 1}));
+    assert(book.compute(100, [](Level level) { return Level{level.quantity + 3, level.orders + 1}; }));
+    Level level{};
+    assert(book.find(100, level) && level.quantity == 8 && level.orders == 2);
+    
+    std::cout << "insert_or_assign and compute test passed!\n";
+}
+
+void test_concurrent_compute() {
+    std::cout << "Testing concurrent compute...\n";
+    
+    for (IndexMode mode : {IndexMode::EAGER, IndexMode::BACKGROUND}) {
+        AtomicSkipList<int, long> skiplist(mode);
+        constexpr int num_threads = 4;
+        constexpr int keys = 64;
+        constexpr int rounds = 20000;
+        
+        // Even keys exist from the start, odd keys are created by the first compute()
+        for (int i = 0; i < keys; i += 2) {
+            assert(skiplist.insert(i, 0));
+        }
+        
+        std::atomic<bool> done{false};
+        std::thread reader([&]() {
+            while (!done.load()) {
+                for (int i = 0; i < keys; i += 2) {
+                    assert(skiplist.contains(i));   // Updated keys never go missing
+                }
+            }
+        });
+        
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                std::mt19937 rng(t);
+                for (int i = 0; i < rounds; ++i) {
+                    assert(skiplist.compute(static_cast<int>(rng() % keys), [](long current) { return current + 1; }));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        done.store(true);
+        reader.join();
+        
+        // No increment is lost and every odd key was inserted exactly once
+        long total = 0;
+        for (auto it = skiplist.begin(); it != skiplist.end(); ++it) {
+            total += (*it).second;
+        }
+        assert(total == static_cast<long>(num_threads) * rounds);
+        assert(skiplist.size() == keys);
+    }
+    
+    std::cout << "Concurrent compute test passed!\n";
+}
+
 int main() {
     std::cout << "AtomicSkipList Tests\n";
     std::cout << "====================\n\n";
@@ -454,12 +977,22 @@ int main() {
     test_ordered_insertion();
     test_erase_operations();
     test_string_keys();
+    test_string_key_prefixes();
     test_concurrent_skiplist_operations();
     test_emplace_operations();
     test_iteration();
     test_move_semantics();
     test_stress_operations();
     test_range_properties();
+    test_sorted_batches();
+    test_concurrent_sorted_batches();
+    test_erase_and_reinsert();
+    test_concurrent_erase_reinsert();
+    test_manual_index_maintenance();
+    test_background_index_concurrent();
+    test_reverse_iteration();
+    test_insert_or_assign_and_compute();
+    test_concurrent_compute();
     
     std::cout << "\nAll skiplist tests passed!\n";
     std::cout << "\nNote: This SkipList implementation provides lock-free operations\n";
@@ -0,0 +1,136 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <memory>
+#include <map>
+#include "lockfree/atomic_string_hashmap.hpp"
+
+using namespace lockfree;
+
+void test_basic_string_hashmap_operations() {
+    std::cout << "Testing basic inline-key hashmap operations...\n";
+
+    AtomicStringHashMap<int> map(64);
+    assert(map.empty());
+    assert(map.bucket_count() == 64);
+
+    const std::string long_key(100, 'k');   // Well past the small-string limit
+    assert(map.insert("short", 1));
+    assert(map.insert(long_key, 2));
+    assert(map.insert("", 3));              // Empty keys are valid
+    assert(!map.insert("short", 10));       // Insert does not overwrite
+    assert(map.size() == 3);
+
+    int value;
+    assert(map.find("short", value) && value == 1);
+    assert(map.find(long_key, value) && value == 2);
+    assert(map.find("", value) && value == 3);
+    assert(!map.contains(std::string(99, 'k')));    // Prefix of a stored key
+    assert(!map.contains("shorter"));
+
+    assert(map.find_if("short", [](int v) { return v == 1; }));
+    assert(!map.find_if("short", [](int v) { return v == 2; }));
+
+    assert(map.erase("short"));
+    assert(!map.erase("short"));
+    assert(!map.contains("short"));
+    assert(map.insert("short", 4));         // A deleted key can be inserted again
+    assert(map.find("short", value) && value == 4);
+    assert(map.size() == 3);
+
+    std::cout << "Basic inline-key hashmap operations test passed!\n";
+}
+
+void test_binary_keys_and_move_only_values() {
+    std::cout << "Testing binary keys and move-only values...\n";
+
+    AtomicStringHashMap<std::unique_ptr<int>> map(16);
+
+    // Keys are byte strings: embedded NULs are part of the key
+    const std::string a("ab\0cd", 5);
+    const std::string b("ab\0ce", 5);
+    assert(map.insert(a, std::make_unique<int>(1)));
+    assert(map.emplace(b, new int(2)));
+    assert(map.contains(a) && map.contains(b));
+    assert(!map.contains("ab"));
+    assert(map.find_if(b, [](const std::unique_ptr<int>& p) { return *p == 2; }));
+
+    std::cout << "Binary keys and move-only values test passed!\n";
+}
+
+void test_iteration() {
+    std::cout << "Testing iteration...\n";
+
+    AtomicStringHashMap<int> map(8);
+    std::map<std::string, int> expected;
+    for (int i = 0; i < 50; ++i) {
+        std::string key = "key-" + std::string(i, '#') + std::to_string(i);
+        map.insert(key, i);
+        expected[key] = i;
+    }
+    map.erase("key-0");
+    expected.erase("key-0");
+
+    std::map<std::string, int> seen;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        auto [key, value] = *it;
+        seen[std::string(key)] = value;
+    }
+    assert(seen == expected);
+
+    AtomicStringHashMap<int> empty_map(4);
+    assert(empty_map.begin() == empty_map.end());
+
+    std::cout << "Iteration test passed!\n";
+}
+
+void test_concurrent_inserts() {
+    std::cout << "Testing concurrent inserts of overlapping keys...\n";
+
+    AtomicStringHashMap<int> map(256);
+    constexpr int num_threads = 4;
+    constexpr int num_keys = 2000;
+    std::atomic<int> successes{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            // Every thread tries every key; exactly one insert per key may win
+            for (int i = 0; i < num_keys; ++i) {
+                int k = (i + t * 500) % num_keys;
+                if (map.insert("session/" + std::to_string(k) + "/token", k)) {
+                    successes.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(successes.load() == num_keys);
+    assert(map.size() == num_keys);
+    for (int k = 0; k < num_keys; ++k) {
+        int value;
+        assert(map.find("session/" + std::to_string(k) + "/token", value) && value == k);
+    }
+
+    std::cout << "Concurrent inserts test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicStringHashMap Tests\n";
+    std::cout << "=========================\n\n";
+
+    test_basic_string_hashmap_operations();
+    test_binary_keys_and_move_only_values();
+    test_iteration();
+    test_concurrent_inserts();
+
+    std::cout << "\nAll inline-key hashmap tests passed!\n";
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <unordered_set>
+#include "lockfree/string_interner.hpp"
+
+using namespace lockfree;
+
+void test_basic_interning() {
+    std::cout << "Testing basic interning...\n";
+
+    StringInterner interner;
+    assert(interner.empty());
+
+    StringInterner::Id cpu = interner.intern("host.cpu");
+    StringInterner::Id mem = interner.intern("host.mem");
+    assert(cpu != mem);
+    assert(interner.intern("host.cpu") == cpu);     // Same string, same ID
+    assert(interner.intern(std::string("host.mem")) == mem);
+    assert(interner.size() == 2);
+
+    assert(interner.resolve(cpu) == "host.cpu");
+    assert(interner.resolve(mem) == "host.mem");
+
+    StringInterner::Id id;
+    assert(interner.find("host.cpu", id) && id == cpu);
+    assert(!interner.find("host.disk", id));
+    assert(interner.size() == 2);                   // find() does not intern
+
+    StringInterner::Id empty = interner.intern("");
+    assert(interner.resolve(empty).empty());
+    assert(interner.intern("") == empty);
+
+    std::cout << "Basic interning test passed!\n";
+}
+
+void test_stable_handles() {
+    std::cout << "Testing handle stability across arena chunks and segments...\n";
+
+    StringInterner interner(64);
+    std::vector<StringInterner::Id> ids;
+    std::vector<std::string_view> views;
+
+    // Enough strings to fill several arena chunks and directory segments
+    for (int i = 0; i < 20000; ++i) {
+        StringInterner::Id id = interner.intern("metric." + std::to_string(i) + ".p99");
+        ids.push_back(id);
+        views.push_back(interner.resolve(id));
+    }
+
+    // A string larger than a regular chunk gets its own allocation
+    std::string large(200000, 'x');
+    StringInterner::Id large_id = interner.intern(large);
+    assert(interner.resolve(large_id) == large);
+
+    for (int i = 0; i < 20000; ++i) {
+        std::string expected = "metric." + std::to_string(i) + ".p99";
+        assert(interner.resolve(ids[i]) == expected);
+        assert(views[i].data() == interner.resolve(ids[i]).data());    // Bytes never move
+    }
+    assert(interner.size() == 20001);
+    assert(interner.arena_bytes() >= large.size());
+    assert(interner.memory_usage() > interner.arena_bytes());
+
+    std::cout << "Stable handles test passed!\n";
+}
+
+void test_concurrent_interning() {
+    std::cout << "Testing concurrent interning of a shared vocabulary...\n";
+
+    StringInterner interner(1024);
+    constexpr int num_threads = 4;
+    constexpr int vocabulary = 500;
+
+    std::vector<std::vector<StringInterner::Id>> seen(num_threads, std::vector<StringInterner::Id>(vocabulary));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            // Every thread interns every word, starting at different offsets
+            for (int round = 0; round < 20; ++round) {
+                for (int i = 0; i < vocabulary; ++i) {
+                    int word = (i + t * 131 + round * 17) % vocabulary;
+                    StringInterner::Id id = interner.intern("tag:" + std::to_string(word));
+                    assert(id != StringInterner::INVALID_ID);
+                    if (round == 0) {
+                        seen[t][word] = id;
+                    } else {
+                        assert(seen[t][word] == id);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // All threads agree on one ID per word, and IDs are unique
+    std::unordered_set<StringInterner::Id> unique;
+    for (int word = 0; word < vocabulary; ++word) {
+        for (int t = 1; t < num_threads; ++t) {
+            assert(seen[t][word] == seen[0][word]);
+        }
+        assert(interner.resolve(seen[0][word]) == "tag:" + std::to_string(word));
+        unique.insert(seen[0][word]);
+    }
+    assert(unique.size() == vocabulary);
+    assert(interner.size() == vocabulary);
+
+    std::cout << "Concurrent interning test passed!\n";
+}
+
+int main() {
+    std::cout << "StringInterner Tests\n";
+    std::cout << "====================\n\n";
+
+    test_basic_interning();
+    test_stable_handles();
+    test_concurrent_interning();
+
+    std::cout << "\nAll string interner tests passed!\n";
+
+    return 0;
+}
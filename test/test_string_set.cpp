@@ -0,0 +1,77 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <set>
+#include "lockfree/atomic_string_set.hpp"
+
+using namespace lockfree;
+
+void test_basic_string_set_operations() {
+    std::cout << "Testing basic inline string set operations...\n";
+
+    AtomicStringSet<> set(32);
+    assert(set.empty());
+
+    const std::string long_value(64, 'v');
+    assert(set.insert("alpha"));
+    assert(set.insert(long_value));
+    assert(!set.insert("alpha"));
+    assert(set.size() == 2);
+
+    assert(set.contains("alpha"));
+    assert(set.find(long_value));
+    assert(!set.contains("alph"));
+
+    assert(set.erase("alpha"));
+    assert(!set.contains("alpha"));
+    assert(!set.erase("alpha"));
+    assert(set.size() == 1);
+
+    std::cout << "Basic inline string set operations test passed!\n";
+}
+
+void test_iteration_and_concurrency() {
+    std::cout << "Testing concurrent inserts and iteration...\n";
+
+    AtomicStringSet<> set(128);
+    constexpr int num_threads = 4;
+    constexpr int per_thread = 1000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                set.insert("user:" + std::to_string(t * per_thread + i));
+                set.insert("shared:" + std::to_string(i));  // Contended duplicates
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(set.size() == num_threads * per_thread + per_thread);
+
+    std::set<std::string> seen;
+    for (auto it = set.begin(); it != set.end(); ++it) {
+        assert(seen.insert(std::string(*it)).second);   // Each element exactly once
+    }
+    assert(seen.size() == set.size());
+    assert(seen.count("shared:999") == 1);
+
+    std::cout << "Concurrent inserts and iteration test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicStringSet Tests\n";
+    std::cout << "=====================\n\n";
+
+    test_basic_string_set_operations();
+    test_iteration_and_concurrency();
+
+    std::cout << "\nAll inline string set tests passed!\n";
+
+    return 0;
+}
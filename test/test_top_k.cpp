@@ -0,0 +1,128 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <random>
+#include <cassert>
+#include <cstdint>
+#include "lockfree/atomic_top_k.hpp"
+
+using namespace lockfree;
+
+bool tracked(const std::vector<std::pair<uint64_t, uint64_t>>& top, uint64_t key) {
+    return std::any_of(top.begin(), top.end(), [&](const auto& entry) { return entry.first == key; });
+}
+
+void test_heavy_hitters() {
+    std::cout << "Testing heavy hitters among noise...\n";
+
+    // Keys 0-9 occur 1000-100 times; 50000 other keys once each, interleaved
+    AtomicTopK<uint64_t, 16> top_k;
+    std::vector<uint64_t> stream;
+    for (uint64_t key = 0; key < 10; ++key) {
+        stream.insert(stream.end(), 1000 - key * 100, key);
+    }
+    for (uint64_t noise = 0; noise < 50000; ++noise) {
+        stream.push_back(1000000 + noise);
+    }
+    std::shuffle(stream.begin(), stream.end(), std::mt19937(4));
+    for (uint64_t key : stream) {
+        top_k.add(key);
+    }
+
+    auto top = top_k.top();
+    assert(top.size() <= 16);
+    for (uint64_t key = 0; key < 10; ++key) {
+        assert(top[key].first == key);   // Most frequent first
+        assert(top[key].second >= 1000 - key * 100);
+    }
+    assert(top_k.total_count() == stream.size());
+    assert(top_k.estimate(3) == top[3].second);
+
+    std::cout << "Heavy hitters test passed!\n";
+}
+
+void test_string_items() {
+    std::cout << "Testing string items and batches...\n";
+
+    AtomicTopK<std::string, 2> top_k;
+    std::vector<std::string> words;
+    for (int i = 0; i < 30; ++i) {
+        words.push_back(i % 3 == 0 ? "rare" : "common");
+        words.push_back("frequent");
+        words.push_back("word" + std::to_string(i));
+    }
+    top_k.add_batch(words.data(), words.size());
+    top_k.add("frequent", 5);
+
+    auto top = top_k.top();
+    assert(top.size() == 2);
+    assert(top[0].first == "frequent" && top[0].second == 35);
+    assert(top[1].first == "common" && top[1].second == 20);
+
+    std::cout << "String items test passed!\n";
+}
+
+void test_concurrent_tracking() {
+    std::cout << "Testing concurrent tracking...\n";
+
+    constexpr int num_threads = 8;
+    constexpr int adds_per_thread = 30000;
+    AtomicTopK<uint64_t, 8, 1024, 4> top_k;
+
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            auto top = top_k.top();
+            assert(top.size() <= 8);
+            for (size_t i = 1; i < top.size(); ++i) {
+                assert(top[i - 1].second >= top[i].second);
+                assert(top[i - 1].first != top[i].first);
+            }
+        }
+    });
+
+    // Every thread sees keys 0-3 often and its own stream of unique keys
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<uint64_t> batch;
+            for (int i = 0; i < adds_per_thread; ++i) {
+                const uint64_t key = i % 5 == 0 ? static_cast<uint64_t>(i % 4) : (static_cast<uint64_t>(t + 1) << 32) + i;
+                if (t % 2) {
+                    batch.push_back(key);
+                } else {
+                    top_k.add(key);
+                }
+            }
+            top_k.add_batch(batch.data(), batch.size());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+
+    auto top = top_k.top();
+    for (uint64_t key = 0; key < 4; ++key) {
+        assert(tracked(top, key));
+        assert(top_k.estimate(key) >= num_threads * adds_per_thread / 20);
+    }
+
+    std::cout << "Concurrent tracking test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicTopK Tests\n";
+    std::cout << "================\n\n";
+
+    test_heavy_hitters();
+    test_string_items();
+    test_concurrent_tracking();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
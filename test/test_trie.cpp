@@ -8,6 +8,7 @@
 #include <random>
 #include <set>
 #include <string>
+#include <string_view>
 #include <memory>
 #include "lockfree/atomic_trie.hpp"
 
@@ -459,6 +460,93 @@ void test_performance_characteristics() {
     std::cout << "  Prefix search rate: " << static_cast<int>(prefix_rate) << " ops/sec\n";
 }
 
+void test_bulk_insert() {
+    std::cout << "Testing bulk insert... ";
+    
+    std::vector<std::string> words;
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<> length_dist(1, 10);
+    std::uniform_int_distribution<> char_dist('a', 'f');
+    for (int i = 0; i < 5000; ++i) {
+        std::string word;
+        for (int j = length_dist(gen); j > 0; --j) {
+            word += static_cast<char>(char_dist(gen));
+        }
+        words.push_back(word);
+    }
+    words.push_back("");                       // Skipped
+    words.push_back(words.front());            // Duplicate within the input
+    const std::set<std::string> distinct(words.begin(), words.end() - 2);
+    
+    AtomicStringTrie trie;
+    assert(trie.insert("abc"));                // Already present before the bulk load
+    assert(trie.insert("zzz"));                // In a partition the bulk load does not touch
+    assert(trie.insert("f"));
+    assert(trie.erase("f"));
+    
+    const size_t expected = distinct.size() - distinct.count("abc");
+    assert(trie.bulk_insert(words, 4) == expected);
+    assert(trie.size() == expected + 2);
+    for (const auto& word : distinct) {
+        assert(trie.contains(word));
+    }
+    assert(trie.contains("zzz"));
+    assert(!trie.contains("abcdefabcdef"));
+    
+    // Inserting the same words again adds nothing; the trie stays fully usable
+    assert(trie.bulk_insert(words, 3) == 0);
+    assert(trie.insert("abcdefabcdef"));
+    assert(trie.erase("abc") && !trie.contains("abc"));
+    assert(trie.get_all_with_prefix("zz").size() == 1);
+    
+    std::vector<std::string> collected;
+    for (const auto& word : trie) {
+        collected.push_back(word);
+    }
+    assert(std::is_sorted(collected.begin(), collected.end()));
+    assert(collected.size() == trie.size());
+    
+    // Single-threaded and string_view input
+    AtomicStringTrie single;
+    std::vector<std::string_view> views = {"one", "two", "three", "two"};
+    assert(single.bulk_insert(views, 1) == 3);
+    assert(single.contains("three") && single.size() == 3);
+    
+    std::cout << "✓\n";
+}
+
+void test_concurrent_bulk_insert() {
+    std::cout << "Testing concurrent bulk inserts... ";
+    
+    // Two bulk loads and plain inserts race on the same partitions
+    AtomicStringTrie trie;
+    std::vector<std::vector<std::string>> batches(3);
+    for (int i = 0; i < 3000; ++i) {
+        batches[i % 3].push_back("key" + std::to_string(i % 2000));
+    }
+    
+    std::atomic<size_t> inserted{0};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() { inserted += trie.bulk_insert(batches[0], 2); });
+    threads.emplace_back([&]() { inserted += trie.bulk_insert(batches[1], 2); });
+    threads.emplace_back([&]() {
+        for (const auto& word : batches[2]) {
+            inserted += trie.insert(word) ? 1 : 0;
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    assert(inserted.load() == 2000);
+    assert(trie.size() == 2000);
+    for (int i = 0; i < 2000; ++i) {
+        assert(trie.contains("key" + std::to_string(i)));
+    }
+    
+    std::cout << "✓\n";
+}
+
 int main() {
     std::cout << "AtomicTrie Test Suite\n";
     std::cout << "====================\n\n";
@@ -474,6 +562,8 @@ int main() {
         test_move_semantics();
         test_stress_operations();
         test_performance_characteristics();
+        test_bulk_insert();
+        test_concurrent_bulk_insert();
         
         std::cout << "\n✅ All tests passed!\n";
         
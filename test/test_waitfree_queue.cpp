@@ -0,0 +1,148 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <memory>
+#include "lockfree/atomic_waitfree_queue.hpp"
+
+using namespace lockfree;
+
+void test_basic_operations() {
+    std::cout << "Testing basic wait-free queue operations...\n";
+    
+    AtomicWaitFreeQueue<int> queue;
+    
+    assert(queue.empty());
+    assert(queue.size() == 0);
+    
+    assert(queue.enqueue(1));
+    assert(queue.enqueue(2));
+    assert(queue.enqueue(3));
+    assert(!queue.empty());
+    assert(queue.size() == 3);
+    
+    int val;
+    assert(queue.dequeue(val));
+    assert(val == 1);
+    assert(queue.dequeue(val));
+    assert(val == 2);
+    assert(queue.dequeue(val));
+    assert(val == 3);
+    
+    assert(queue.empty());
+    assert(!queue.dequeue(val));
+    
+    std::cout << "Basic operations test passed!\n";
+}
+
+void test_move_only_and_emplace() {
+    std::cout << "Testing move-only elements and emplace...\n";
+    
+    AtomicWaitFreeQueue<std::unique_ptr<std::string>> queue;
+    assert(queue.enqueue(std::make_unique<std::string>("first")));
+    assert(queue.emplace(new std::string("second")));
+    
+    std::unique_ptr<std::string> val;
+    assert(queue.dequeue(val));
+    assert(*val == "first");
+    
+    // The remaining element is destroyed with the queue
+    assert(queue.size() == 1);
+    
+    std::cout << "Move-only and emplace test passed!\n";
+}
+
+void test_concurrent_fifo() {
+    std::cout << "Testing concurrent producers and consumers...\n";
+    
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 20000;
+    AtomicWaitFreeQueue<int, 16> queue;
+    
+    std::atomic<int> consumed{0};
+    std::atomic<long long> consumed_sum{0};
+    std::vector<std::vector<int>> last_seen(num_consumers, std::vector<int>(num_producers, -1));
+    std::vector<std::thread> threads;
+    
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                // Never fails: no retry budget to exhaust
+                assert(queue.enqueue(p * items_per_producer + i));
+            }
+        });
+    }
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            int val;
+            while (consumed.load() < num_producers * items_per_producer) {
+                if (queue.dequeue(val)) {
+                    int producer = val / items_per_producer;
+                    // Items from one producer arrive in order
+                    assert(val % items_per_producer > last_seen[c][producer]);
+                    last_seen[c][producer] = val % items_per_producer;
+                    consumed_sum.fetch_add(val);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    long long total = static_cast<long long>(num_producers) * items_per_producer;
+    assert(consumed_sum.load() == total * (total - 1) / 2);
+    assert(queue.empty());
+    
+    std::cout << "Concurrent FIFO test passed!\n";
+}
+
+void test_thread_slots() {
+    std::cout << "Testing thread slot limit and reuse...\n";
+    
+    AtomicWaitFreeQueue<int, 2> queue;
+    assert(queue.enqueue(1));   // Main thread takes one slot
+    
+    // Threads that exit give their slot back, so any number can run one after another
+    for (int round = 0; round < 10; ++round) {
+        std::thread([&]() { assert(queue.enqueue(round)); }).join();
+    }
+    
+    // With both slots held, a third thread is turned away
+    std::atomic<bool> holding{false};
+    std::atomic<bool> release{false};
+    std::thread holder([&]() {
+        assert(queue.enqueue(100));
+        holding.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!holding.load()) {
+        std::this_thread::yield();
+    }
+    std::thread([&]() { assert(!queue.enqueue(200)); }).join();
+    release.store(true);
+    holder.join();
+    
+    assert(queue.size() == 12);
+    
+    std::cout << "Thread slot test passed!\n";
+}
+
+int main() {
+    std::cout << "AtomicWaitFreeQueue Tests\n";
+    std::cout << "=========================\n\n";
+    
+    test_basic_operations();
+    test_move_only_and_emplace();
+    test_concurrent_fifo();
+    test_thread_slots();
+    
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}